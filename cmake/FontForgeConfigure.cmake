@@ -61,6 +61,10 @@ function(fontforge_generate_config template destination)
   set(CMAKE_REQUIRED_INCLUDES stdlib.h)
   check_function_exists(realpath HAVE_REALPATH)
   cmake_pop_check_state()
+  cmake_push_check_state(RESET)
+  set(CMAKE_REQUIRED_INCLUDES stdio.h)
+  check_function_exists(open_memstream HAVE_OPEN_MEMSTREAM)
+  cmake_pop_check_state()
 
   # These are hard requirements/unsupported, should get rid of these
   set(HAVE_LIBINTL_H 1)
@@ -0,0 +1,116 @@
+/* Copyright (C) 2026 by the FontForge authors */
+/*
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+
+ * The name of the author may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <fontforge-config.h>
+
+#include "arena.h"
+
+#include "splinefont.h"
+#include "uiinterface.h"
+
+#include <glib.h>
+#include <stdlib.h>
+
+#define ARENA_BLOCK	(64*1024)
+#define ARENA_ALIGN	16
+#define ARENA_ROUND(n)	(((n)+ARENA_ALIGN-1)&~(size_t) (ARENA_ALIGN-1))
+#define ARENA_HEADER	ARENA_ROUND(sizeof(struct arenablock))
+
+struct arenablock {
+    struct arenablock *next;
+    size_t size, used;
+};
+
+struct arena {
+    struct arenablock *blocks;	/* The first block is the one being filled */
+    struct arena *prev;		/* The arena which was current before this one */
+};
+
+static GPrivate current_arena = G_PRIVATE_INIT(NULL);
+
+Arena *ArenaBegin(void) {
+    Arena *a = calloc(1,sizeof(Arena));
+
+    a->prev = g_private_get(&current_arena);
+    g_private_set(&current_arena,a);
+return( a );
+}
+
+void ArenaEnd(Arena *a) {
+    struct arenablock *b, *next;
+
+    if ( a!=g_private_get(&current_arena) )
+	IError("Arenas must be ended in the reverse order they were begun");
+    else
+	g_private_set(&current_arena,a->prev);
+    for ( b=a->blocks; b!=NULL; b=next ) {
+	next = b->next;
+	free(b);
+    }
+    free(a);
+}
+
+/* Blocks come from calloc and are never reused, so memory is already zeroed */
+void *ArenaAlloc(Arena *a, size_t size) {
+    struct arenablock *b = a->blocks;
+
+    size = size==0 ? ARENA_ALIGN : ARENA_ROUND(size);
+    if ( b==NULL || b->used+size>b->size ) {
+	if ( size>ARENA_BLOCK/4 ) {
+	    /* Big requests get a block of their own, which is kept behind */
+	    /*  the one being filled so its remaining space is not wasted */
+	    b = calloc(1,ARENA_HEADER+size);
+	    b->size = b->used = size;
+	    if ( a->blocks==NULL )
+		a->blocks = b;
+	    else {
+		b->next = a->blocks->next;
+		a->blocks->next = b;
+	    }
+return( (char *) b + ARENA_HEADER );
+	}
+	b = calloc(1,ARENA_HEADER+ARENA_BLOCK);
+	b->size = ARENA_BLOCK;
+	b->next = a->blocks;
+	a->blocks = b;
+    }
+    b->used += size;
+return( (char *) b + ARENA_HEADER + b->used - size );
+}
+
+void *ArenaChunkAlloc(size_t size) {
+    Arena *a = g_private_get(&current_arena);
+
+    if ( a==NULL )
+return( chunkalloc(size) );
+return( ArenaAlloc(a,size) );
+}
+
+void ArenaChunkFree(void *item, size_t size) {
+    if ( g_private_get(&current_arena)==NULL )
+	chunkfree(item,size);
+}
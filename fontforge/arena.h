@@ -0,0 +1,23 @@
+#ifndef FONTFORGE_ARENA_H
+#define FONTFORGE_ARENA_H
+
+#include <stddef.h>
+
+/* Scoped allocation for the intermediate data of per-glyph geometry  */
+/*  operations (remove overlap, stroke, simplify). Between ArenaBegin   */
+/*  and the matching ArenaEnd, ArenaChunkAlloc on the same thread takes */
+/*  zeroed memory from the arena and ArenaChunkFree does nothing; the   */
+/*  whole arena is released by ArenaEnd. Outside any arena they behave  */
+/*  like chunkalloc and chunkfree. Arenas nest, and each thread has its */
+/*  own. Anything which must outlive the operation (the resulting       */
+/*  SplinePoints and Splines) must be allocated normally */
+
+typedef struct arena Arena;
+
+extern Arena *ArenaBegin(void);
+extern void ArenaEnd(Arena *a);
+extern void *ArenaAlloc(Arena *a, size_t size);
+extern void *ArenaChunkAlloc(size_t size);
+extern void ArenaChunkFree(void *item, size_t size);
+
+#endif /* FONTFORGE_ARENA_H */
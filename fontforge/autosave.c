@@ -41,12 +41,20 @@
 #include <dirent.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <glib.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
 
+#if defined(__MINGW32__)
+# include <io.h>
+#endif
+
 int AutoSaveFrequency=5;
+int AutoSaveIncremental=true;	/* Append changed glyphs rather than rewrite the file */
+int AutoSaveSync=1;		/* fsync: 0=>never, 1=>whole rewrites, 2=>always */
 
 #if !defined(__MINGW32__)
 # include <pwd.h>
@@ -108,6 +116,10 @@ return( false );
     }
     while ( (entry=readdir(dir))!=NULL ) {
 	if ( strcmp(entry->d_name,".")==0 || strcmp(entry->d_name,"..")==0 )
+    continue;
+	/* A whole autosave which was never finished, the previous one is good */
+	if ( strlen(entry->d_name)>4 &&
+		strcmp(entry->d_name+strlen(entry->d_name)-4,".tmp")==0 )
     continue;
 	buffer = smprintf("%s/%s",recoverdir,entry->d_name);
 	fprintf( stderr, "Recovering from %s... ", buffer);
@@ -132,10 +144,12 @@ int DoAutoRecovery(int inquire )
 
 void CleanAutoRecovery(void) {
     char *buffer;
-    char *recoverdir = getAutoDirName();
+    char *recoverdir;
     DIR *dir;
     struct dirent *entry;
 
+    AutoSaveFlush();
+    recoverdir = getAutoDirName();
     if ( recoverdir==NULL )
 return;
     if ( (dir = opendir(recoverdir))==NULL ) {
@@ -157,6 +171,243 @@ return;
 }
 
 
+int AutoSaveRename(const char *from, const char *to) {
+#if defined(__MINGW32__)
+    /* rename doesn't replace existing files here */
+    unlink(to);
+#endif
+return( rename(from,to) );
+}
+
+/* Autosaves are serialized on the main thread, where the glyphs can't */
+/*  change under us, and written out by a worker thread so that a slow */
+/*  disk (or fsync) doesn't stall the UI. The main thread only copies the */
+/*  contours, which are most of the text, and the worker formats them */
+struct autosavejob {
+    char *filename;
+    char *data;
+    size_t len;
+    struct sfddeferred *deferred;	/* Contours to format into data */
+    unsigned int append: 1;	/* else write a new file and rename it over */
+    unsigned int sync: 1;
+};
+
+static GAsyncQueue *autosave_queue;
+static GMutex autosave_lock;
+static GCond autosave_done;
+static int autosave_pending;
+/* Files the worker failed to write. The main thread rewrites them whole */
+/*  at the next autosave, since appending to them would lose glyphs */
+static char **autosave_failed;
+static int autosave_failed_cnt;
+
+static int WriteAll(int fd, const char *data, size_t len) {
+    ssize_t ret;
+
+    while ( len>0 ) {
+	ret = write(fd,data,len);
+	if ( ret<0 ) {
+	    if ( errno==EINTR )
+    continue;
+return( false );
+	}
+	data += ret;
+	len -= ret;
+    }
+return( true );
+}
+
+static int SyncFile(int fd) {
+#if defined(__MINGW32__)
+return( _commit(fd)==0 );
+#else
+return( fsync(fd)==0 );
+#endif
+}
+
+/* Returns whether the file was written */
+static int AutoSaveWrite(struct autosavejob *job) {
+    char *name = job->append ? job->filename : smprintf("%s.tmp",job->filename);
+    int fd, ok;
+
+    /* An append never creates the file, as it would lack the font's header */
+    fd = open(name,job->append ? O_WRONLY|O_APPEND : O_WRONLY|O_CREAT|O_TRUNC,0644);
+    if ( fd==-1 ) {
+	fprintf( stderr, "Failed to write autosave file %s\n", job->filename );
+	if ( !job->append )
+	    free(name);
+return( false );
+    }
+    ok = WriteAll(fd,job->data,job->len);
+    if ( ok && job->sync )
+	ok = SyncFile(fd);
+    if ( close(fd)!=0 )
+	ok = false;
+    if ( !job->append ) {
+	if ( ok && AutoSaveRename(name,job->filename)!=0 )
+	    ok = false;
+	if ( !ok )
+	    unlink(name);
+	free(name);
+    }
+    if ( !ok )
+	fprintf( stderr, "Failed to write autosave file %s\n", job->filename );
+return( ok );
+}
+
+/* Formats the contours left in the job into its text */
+static int AutoSaveFormat(struct autosavejob *job) {
+#ifdef HAVE_OPEN_MEMSTREAM
+    char *data=NULL;
+    size_t len=0;
+    FILE *out;
+    int ok;
+
+    if ( job->deferred==NULL )
+return( true );
+    out = open_memstream(&data,&len);
+    if ( out==NULL ) {
+	SFDDeferredFree(job->deferred);
+	job->deferred = NULL;
+	fprintf( stderr, "Failed to write autosave file %s\n", job->filename );
+return( false );
+    }
+    ok = SFDWriteDeferred(out,job->data,job->len,job->deferred);
+    job->deferred = NULL;
+    if ( fclose(out)!=0 )
+	ok = false;
+    free(job->data);
+    job->data = data;
+    job->len = len;
+    if ( !ok )
+	fprintf( stderr, "Failed to write autosave file %s\n", job->filename );
+return( ok );
+#else
+return( job->deferred==NULL );
+#endif
+}
+
+static gpointer AutoSaveWorker(gpointer UNUSED(data)) {
+    struct autosavejob *job;
+    int i, ok;
+
+    for (;;) {
+	job = g_async_queue_pop(autosave_queue);
+	ok = AutoSaveFormat(job) && AutoSaveWrite(job);
+	g_mutex_lock(&autosave_lock);
+	if ( !ok ) {
+	    for ( i=0; i<autosave_failed_cnt && strcmp(autosave_failed[i],job->filename)!=0; ++i );
+	    if ( i==autosave_failed_cnt ) {
+		autosave_failed = realloc(autosave_failed,(autosave_failed_cnt+1)*sizeof(char *));
+		autosave_failed[autosave_failed_cnt++] = job->filename;
+		job->filename = NULL;
+	    }
+	}
+	if ( --autosave_pending==0 )
+	    g_cond_broadcast(&autosave_done);
+	g_mutex_unlock(&autosave_lock);
+	free(job->filename);
+	free(job->data);
+	free(job);
+    }
+return( NULL );
+}
+
+static void AutoSaveQueue(char *filename, char *data, size_t len,
+	struct sfddeferred *deferred, int append, int sync) {
+    struct autosavejob *job = calloc(1,sizeof(struct autosavejob));
+
+    if ( autosave_queue==NULL ) {
+	autosave_queue = g_async_queue_new();
+	g_thread_unref(g_thread_new("autosave",AutoSaveWorker,NULL));
+    }
+    job->filename = copy(filename);
+    job->data = data;
+    job->len = len;
+    job->deferred = deferred;
+    job->append = append;
+    job->sync = sync;
+    g_mutex_lock(&autosave_lock);
+    ++autosave_pending;
+    g_mutex_unlock(&autosave_lock);
+    g_async_queue_push(autosave_queue,job);
+}
+
+void AutoSaveFlush(void) {
+    if ( autosave_queue==NULL )
+return;
+    g_mutex_lock(&autosave_lock);
+    while ( autosave_pending>0 )
+	g_cond_wait(&autosave_done,&autosave_lock);
+    g_mutex_unlock(&autosave_lock);
+}
+
+/* Returns whether a background write to filename has failed since we */
+/*  last asked (and forgets the failure) */
+static int AutoSaveTakeFailure(const char *filename) {
+    int i, failed = false;
+
+    g_mutex_lock(&autosave_lock);
+    for ( i=0; i<autosave_failed_cnt; ++i ) {
+	if ( strcmp(autosave_failed[i],filename)==0 ) {
+	    free(autosave_failed[i]);
+	    autosave_failed[i] = autosave_failed[--autosave_failed_cnt];
+	    failed = true;
+    break;
+	}
+    }
+    g_mutex_unlock(&autosave_lock);
+return( failed );
+}
+
+static void SFAutoSaveBackground(SplineFont *sf,EncMap *map) {
+#ifdef HAVE_OPEN_MEMSTREAM
+    char *data=NULL;
+    size_t len=0;
+    FILE *asfd;
+    struct sfddeferred *deferred;
+    int whole, cnt;
+
+    if ( no_windowing_ui )
+return;
+    if ( sf->cidmaster!=NULL ) sf=sf->cidmaster;
+    /* Start a new file when there isn't one, when recovery would read the */
+    /*  appended glyphs with the wrong layers, when the file has grown */
+    /*  to mostly old copies of glyphs, or when it holds glyphs which are */
+    /*  gone or no longer changed */
+    whole = !AutoSaveIncremental || sf->autosave.layer_cnt!=sf->layer_cnt ||
+	    sf->autosave.journal_cnt > 4*sf->autosave.glyph_cnt+256 ||
+	    !SFDAutoSaveAppendable(sf);
+    asfd = open_memstream(&data,&len);
+    if ( asfd==NULL ) {
+	SFAutoSave(sf,map);
+return;
+    }
+    cnt = SFDDumpAutoSave(asfd,sf,map,!whole,&deferred);
+    if ( fclose(asfd)!=0 ) {
+	free(data);
+	SFDDeferredFree(deferred);
+	/* The glyphs are marked as written, so rewrite them all next time */
+	memset(&sf->autosave,0,sizeof(sf->autosave));
+	sf->changed_since_autosave = true;
+return;
+    }
+    if ( whole ) {
+	sf->autosave.layer_cnt = sf->layer_cnt;
+	sf->autosave.glyph_cnt = cnt;
+	sf->autosave.journal_cnt = 0;
+    } else if ( cnt==0 ) {
+	free(data);
+return;
+    } else
+	sf->autosave.journal_cnt += cnt;
+    AutoSaveQueue(sf->autosavename,data,len,deferred,!whole,
+	    AutoSaveSync==2 || (AutoSaveSync==1 && whole));
+#else
+    SFAutoSave(sf,map);
+#endif
+}
+
 static void _DoAutoSaves(FontViewBase *fvs) {
     FontViewBase *fv;
     SplineFont *sf;
@@ -166,11 +417,16 @@ return;
 
     for ( fv=fvs; fv!=NULL; fv=fv->next ) {
 	sf = fv->cidmaster?fv->cidmaster:fv->sf;
+	/* A whole rewrite includes every changed glyph, whatever got lost */
+	if ( sf->autosavename!=NULL && AutoSaveTakeFailure(sf->autosavename) ) {
+	    memset(&sf->autosave,0,sizeof(sf->autosave));
+	    sf->changed_since_autosave = true;
+	}
 	if ( sf->changed_since_autosave ) {
 	    if ( sf->autosavename==NULL )
 		MakeAutoSaveName(sf);
 	    if ( sf->autosavename!=NULL )
-		SFAutoSave(sf,fv->map);
+		SFAutoSaveBackground(sf,fv->map);
 	}
     }
 }
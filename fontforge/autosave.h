@@ -4,5 +4,7 @@
 extern int DoAutoRecoveryExtended(int inquire);
 extern void DoAutoSaves(void);
 extern void CleanAutoRecovery(void);
+extern void AutoSaveFlush(void);
+extern int AutoSaveRename(const char *from, const char *to);
 
 #endif /* FONTFORGE_AUTOSAVE_H */
@@ -207,7 +207,7 @@ static void ApplyChanges(WidthInfo *wi) {
 
     for ( i=0; i<wi->real_lcnt; ++i ) {
 	ch = wi->left[i];
-	SplineCharLayerFindBounds(ch->sc,wi->layer,&bb);
+	SplineCharLayerFindBoundsCached(ch->sc,wi->layer,&bb);
 	width = rint(bb.maxx + ch->newr);
 	if ( width!=ch->sc->width ) {
 	    SCPreserveWidth(ch->sc);
@@ -431,7 +431,7 @@ static void SCFindEdges(struct charone *ch,WidthInfo *wi) {
     int i;
     DBounds bb;
 
-    SplineCharQuickConservativeBounds(ch->sc,&bb);
+    SplineCharQuickConservativeBoundsCached(ch->sc,&bb);
     ch->base = rint(bb.miny/wi->decimation);
     ch->top = rint(bb.maxy/wi->decimation);
     ch->ledge = malloc((ch->top-ch->base+1)*sizeof(short));
@@ -462,7 +462,7 @@ static void SCFindEdges(struct charone *ch,WidthInfo *wi) {
     break;
 	sc = ref->sc;
     }
-    SplineCharQuickBounds(ch->sc,&bb);
+    SplineCharQuickBoundsCached(ch->sc,&bb);
     if ( sc->unicodeenc=='k' ) {
 	ch->baseserif = 1;
 	ch->lefttops = 3;
@@ -572,7 +572,7 @@ void AW_FindFontParameters(WidthInfo *wi) {
     for ( i=0; caps[i]!='\0' && cnt<5; i+=2 )
 	for ( j=caps[i]; j<=caps[i+1] && cnt<5; ++j )
 	    if ( (si=SFFindExistingSlot(sf,j,NULL))!=-1 && sf->glyphs[si]!=NULL ) {
-		SplineCharQuickBounds(sf->glyphs[si],&bb);
+		SplineCharQuickBoundsCached(sf->glyphs[si],&bb);
 		caph += bb.maxy;
 		++cnt;
 	    }
@@ -585,7 +585,7 @@ void AW_FindFontParameters(WidthInfo *wi) {
 	if ( (si=SFFindExistingSlot(sf,descent[i],NULL))!=-1 && sf->glyphs[si]!=NULL )
     break;
     if ( descent[i]!='\0' ) {
-	SplineCharQuickBounds(sf->glyphs[si],&bb);
+	SplineCharQuickBoundsCached(sf->glyphs[si],&bb);
 	ds = bb.miny;
     } else
 	ds = -sf->descent;
@@ -593,7 +593,7 @@ void AW_FindFontParameters(WidthInfo *wi) {
     cnt = 0; xh = 0;
     for ( i=0; xheight[i]!='\0' && cnt<5; ++i )
 	if ( (si=SFFindExistingSlot(sf,xheight[i],NULL))!=-1 && sf->glyphs[si]!=NULL ) {
-	    SplineCharQuickBounds(sf->glyphs[si],&bb);
+	    SplineCharQuickBoundsCached(sf->glyphs[si],&bb);
 	    xh += bb.maxy;
 	    ++cnt;
 	}
@@ -609,7 +609,7 @@ void AW_FindFontParameters(WidthInfo *wi) {
 	topx = SCFindMinXAtY(sf->glyphs[si],wi->layer,2*caph/3);
 	bottomx = SCFindMinXAtY(sf->glyphs[si],wi->layer,caph/3);
 	/* Some fonts don't sit on the baseline... */
-	SplineCharQuickBounds(sf->glyphs[si],&bb);
+	SplineCharQuickBoundsCached(sf->glyphs[si],&bb);
 	/* beware of slanted (italic, oblique) fonts */
 	ytop = caph/2; ybottom=bb.miny;
 	stemx = SCFindMinXAtY(sf->glyphs[si],wi->layer,ytop);
@@ -671,7 +671,7 @@ void AW_FindFontParameters(WidthInfo *wi) {
 	SplineChar *sc = sf->glyphs[si];
 	if ( sc->changedsincelasthinted && !sc->manualhints )
 	    SplineCharAutoHint(sc,wi->layer,NULL);
-	SplineCharQuickBounds(sc,&bb);
+	SplineCharQuickBoundsCached(sc,&bb);
 	if ( sc->vstem!=NULL && sc->vstem->next!=NULL ) {
 	    wi->n_stem_exterior_width = sc->vstem->next->start+sc->vstem->next->width-
 		    sc->vstem->start;
@@ -692,7 +692,7 @@ void AW_FindFontParameters(WidthInfo *wi) {
 	    ((si=SFFindExistingSlot(sf,0x399,"Iota"))!=-1 && sf->glyphs[si]!=NULL ) ||
 	    ((si=SFFindExistingSlot(sf,0x406,"afii10055"))!=-1 && sf->glyphs[si]!=NULL ) ) {
 	SplineChar *sc = sf->glyphs[si];
-	SplineCharQuickBounds(sc,&bb);
+	SplineCharQuickBoundsCached(sc,&bb);
 	wi->current_I_spacing = sc->width - (bb.maxx-bb.minx);
     }
 
@@ -742,7 +742,7 @@ real SFGuessItalicAngle(SplineFont *sf) {
     if ( easyserif[i]=='\0' )		/* can't guess */
 return( 0 );
 
-    SplineCharFindBounds(sf->glyphs[si],&bb);
+    SplineCharFindBoundsCached(sf->glyphs[si],&bb);
     as = bb.maxy-bb.miny;
 
     topx = SCFindMinXAtY(sf->glyphs[si],ly_fore,2*as/3+bb.miny);
@@ -33,6 +33,7 @@
 #include "edgelist2.h"
 #include "fontforgevw.h"
 #include "fvfonts.h"
+#include "parallel.h"
 #include "splineoverlap.h"
 #include "splineutil.h"
 #include "tottfgpos.h"
@@ -44,8 +45,9 @@
 #define DENOM_FACTOR_OF_EMSIZE	50.0
 
 static int aw2_bbox_separation(AW_Glyph *g1, AW_Glyph *g2, AW_Data *all) {
-    int j;
+    int j, n;
     int imin_y, imax_y;
+    const short *left, *right;
     real tot, cnt;
     real denom;
     /* the goal is to give a weighted average that expresses the visual */
@@ -67,10 +69,13 @@ return( PyFF_GlyphSeparation(g1,g2,all) );
 return( 0 );
     denom = all->denom;
     tot = cnt = 0;
-    for ( j=imin_y ; j<imax_y; ++j ) {
-	if ( g2->left[j-g2->imin_y] < 32767 && g1->right[j-g1->imin_y] > -32767 ) {
+    left = g2->left + (imin_y-g2->imin_y);
+    right = g1->right + (imin_y-g1->imin_y);
+    n = imax_y-imin_y;
+    for ( j=0 ; j<n; ++j ) {
+	if ( left[j] < 32767 && right[j] > -32767 ) {
 	    /* beware of gaps such as those in "i" or "aaccute" */
-	    real sep = g2->left[j-g2->imin_y] - g1->right[j-g1->imin_y];
+	    real sep = left[j] - right[j];
 	    real weight = 1.0/(sep + denom);
 	    weight *= weight;
 
@@ -83,6 +88,32 @@ return( 0 );
 return( rint( tot ) );
 }
 
+/* Runs func over [0,cnt) on all processors. The glyph edge profiles are */
+/*  only read once they are built, so rows of pairs can be measured at the */
+/*  same time; but a python separation hook needs the interpreter, which   */
+/*  we can't share out, so then everything stays on this thread */
+static void aw2_foreach(int cnt, void (*func)(void *data, int index), void *data) {
+#if !defined(_NO_PYTHON)
+    if ( PyFF_GlyphSeparationHook!=NULL ) {
+	int i;
+	for ( i=0; i<cnt; ++i )
+	    (func)(data,i);
+return;
+    }
+#endif
+    FFParallelFor(cnt,func,data);
+}
+
+static void aw2_figure_separation_row(void *_all, int i) {
+    AW_Data *all = _all;
+    int *vpt = all->visual_separation + i*all->gcnt;
+    AW_Glyph *me = &all->glyphs[i];
+    int j;
+
+    for ( j=0; j<all->gcnt; ++j )
+	vpt[j] = aw2_bbox_separation(me,&all->glyphs[j],all);
+}
+
 static void aw2_figure_lsb(int right_index, AW_Data *all) {
     int i;
     AW_Glyph *me, *other;
@@ -131,7 +162,7 @@ static void aw2_figure_rsb(int left_index, AW_Data *all) {
 
 static void aw2_figure_all_sidebearing(AW_Data *all) {
     int i,j;
-    AW_Glyph *me, *other;
+    AW_Glyph *me;
     real transform[6], half;
     int width, changed;
     uint8_t *rsel = calloc(all->fv->map->enccount,sizeof(uint8_t));
@@ -140,14 +171,7 @@ static void aw2_figure_all_sidebearing(AW_Data *all) {
 
     all->denom = denom;
     all->visual_separation = malloc(all->gcnt*all->gcnt*sizeof(int));
-    for ( i=0; i<all->gcnt; ++i ) {
-	int *vpt = all->visual_separation + i*all->gcnt;
-	me = &all->glyphs[i];
-	for ( j=0; j<all->gcnt; ++j ) {
-	    other = &all->glyphs[j];
-	    vpt[j] = aw2_bbox_separation(me,other,all);
-	}
-    }
+    aw2_foreach(all->gcnt,aw2_figure_separation_row,all);
 
     half = all->desired_separation/2;
     for ( i=0; i<all->gcnt; ++i ) {
@@ -207,6 +231,20 @@ static void aw2_figure_all_sidebearing(AW_Data *all) {
     free(rsel);
 }
 
+/* The smallest gap between the right edge of one glyph and the left edge */
+/*  of the next over n rows (0x7fff if they only meet in gaps, which are  */
+/*  marked by +/-32767 and so never win). A plain min reduction over      */
+/*  contiguous rows, so the compiler can vectorize it */
+static int aw2_closest_approach(const short *left, const short *right, int n) {
+    int j, smallest = 0x7fff;
+
+    for ( j=0; j<n; ++j ) {
+	int tot = left[j] - right[j];
+	smallest = tot<smallest ? tot : smallest;
+    }
+return( smallest );
+}
+
 static int ak2_figure_kern(AW_Glyph *g1, AW_Glyph *g2, AW_Data *all) {
     int sep = aw2_bbox_separation(g1,g2,all);
     sep += g2->bb.minx + g1->sc->width - g1->bb.maxx;
@@ -214,20 +252,15 @@ return( all->desired_separation - sep );
 }
 
 static int ak2_figure_touch(AW_Glyph *g1, AW_Glyph *g2, AW_Data *all) {
-    int j;
     int imin_y, imax_y;
-    real smallest, tot;
+    real smallest;
 
     imin_y = g2->imin_y > g1->imin_y ? g2->imin_y : g1->imin_y;
     imax_y = g2->imax_y < g1->imax_y ? g2->imax_y : g1->imax_y;
     if ( imax_y < imin_y )		/* no overlap. ie grave and "a" */
 return( - (g2->bb.minx + g1->sc->width - g1->bb.maxx) );
-    smallest = 0x7fff;
-    for ( j=imin_y ; j<imax_y; ++j ) {
-	tot = g2->left[j-g2->imin_y] - g1->right[j-g1->imin_y];
-	if ( tot<smallest )
-	    smallest = tot;
-    }
+    smallest = aw2_closest_approach(g2->left + (imin_y-g2->imin_y),
+	    g1->right + (imin_y-g1->imin_y), imax_y-imin_y);
     if ( smallest == 0x7fff )	/* Overlaps only in gaps, "i" and something between the base and the dot */
 return( - (g2->bb.minx + g1->sc->width - g1->bb.maxx) );
 
@@ -258,9 +291,9 @@ return( all->desired_separation - tot );
 }
 
 static int ak2_figure_touchclass(int *class1, int *class2, AW_Data *all) {
-    int h,i,j;
+    int h,i;
     int imin_y, imax_y;
-    real smallest, smaller, tot;
+    real smallest, smaller;
 
     smallest = 0x7fff;
     for ( h=0; class1[h]!=-1; ++h ) {
@@ -274,12 +307,8 @@ static int ak2_figure_touchclass(int *class1, int *class2, AW_Data *all) {
 		    smallest = - (g2->bb.minx + g1->sc->width - g1->bb.maxx);
 	continue;
 	    }
-	    smaller = 0x7fff;
-	    for ( j=imin_y ; j<imax_y; ++j ) {
-		tot = g2->left[j-g2->imin_y] - g1->right[j-g1->imin_y];
-		if ( tot<smaller )
-		    smaller = tot;
-	    }
+	    smaller = aw2_closest_approach(g2->left + (imin_y-g2->imin_y),
+		    g1->right + (imin_y-g1->imin_y), imax_y-imin_y);
 	    if ( smaller == 0x7fff ) {
 		if ( smallest < - (g2->bb.minx + g1->sc->width - g1->bb.maxx) )
 		    smallest = - (g2->bb.minx + g1->sc->width - g1->bb.maxx);
@@ -499,7 +528,7 @@ void AutoWidth2(FontViewBase *fv,int separation,int min_side,int max_side,
 	    }
 	    i = scripts[s].gcnt;
 	    scripts[s].glyphs[i].sc = sc;
-	    SplineCharLayerFindBounds(sc,fv->active_layer,&scripts[s].glyphs[i].bb);
+	    SplineCharLayerFindBoundsCached(sc,fv->active_layer,&scripts[s].glyphs[i].bb);
 	    if ( scripts[s].glyphs[i].bb.minx<-16000 || scripts[s].glyphs[i].bb.maxx>16000 ||
 		    scripts[s].glyphs[i].bb.miny<-16000 || scripts[s].glyphs[i].bb.maxy>16000 )
 		ff_post_notice(_("Glyph too big"),_("%s has a bounding box which is too big for this algorithm to work. Ignored."),sc->name);
@@ -562,7 +591,7 @@ void GuessOpticalOffset(SplineChar *sc,int layer,real *_loff, real *_roff,
     all.denom = (sf->ascent + sf->descent)/DENOM_FACTOR_OF_EMSIZE;
 
     glyph.sc = sc;
-    SplineCharLayerFindBounds(sc,layer,&glyph.bb);
+    SplineCharLayerFindBoundsCached(sc,layer,&glyph.bb);
     if ( glyph.bb.minx<-16000 || glyph.bb.maxx>16000 ||
 	    glyph.bb.miny<-16000 || glyph.bb.maxy>16000 ) {
 	ff_post_notice(_("Glyph too big"),_("%s has a bounding box which is too big for this algorithm to work. Ignored."),sc->name);
@@ -584,6 +613,59 @@ void GuessOpticalOffset(SplineChar *sc,int layer,real *_loff, real *_roff,
 #endif		/* PYTHON */
 }
 
+/* Kerning by pairs: each left glyph's row of kerns is figured on its own */
+/*  (possibly on another thread) and the non-zero ones are only turned    */
+/*  into kern pairs afterwards, in row order, so the result is the same   */
+/*  however many threads did the work */
+struct ak2_kern {
+    int right;			/* index into the AW_Glyph array */
+    int off;
+};
+
+struct ak2_row {
+    int cnt;
+    struct ak2_kern *kerns;
+};
+
+struct ak2_pairs {
+    AW_Data *all;
+    int min_kern, from_closest_approach, only_closer;
+    struct ak2_row *rows;
+};
+
+static void ak2_figure_row(void *_pairs, int i) {
+    struct ak2_pairs *pairs = _pairs;
+    AW_Data *all = pairs->all;
+    AW_Glyph *g1 = &all->glyphs[i];
+    struct ak2_row *row = &pairs->rows[i];
+    int k, kern, max = 0;
+
+    if ( !g1->sc->ticked )
+return;
+    for ( k=0; k<all->gcnt; ++k ) {
+	AW_Glyph *g2 = &all->glyphs[k];
+	if ( !g2->sc->ticked2 )
+    continue;
+	if ( pairs->from_closest_approach )
+	    kern = rint( ak2_figure_touch(g1,g2,all));
+	else {
+	    kern = rint( ak2_figure_kern(g1,g2,all));
+	    if ( kern<pairs->min_kern && kern>-pairs->min_kern )
+		kern = 0;
+	}
+	if ( pairs->only_closer && kern>0 )
+	    kern=0;
+	if ( kern!=0 ) {
+	    if ( row->cnt>=max ) {
+		max += 32;
+		row->kerns = realloc(row->kerns,max*sizeof(struct ak2_kern));
+	    }
+	    row->kerns[row->cnt].right = k;
+	    row->kerns[row->cnt++].off = kern;
+	}
+    }
+}
+
 void AutoKern2(SplineFont *sf, int layer,SplineChar **left,SplineChar **right,
 	struct lookup_subtable *into,
 	int separation, int min_kern, int from_closest_approach, int only_closer,
@@ -592,6 +674,7 @@ void AutoKern2(SplineFont *sf, int layer,SplineChar **left,SplineChar **right,
 	void *data) {
     AW_Data all;
     AW_Glyph *glyphs;
+    struct ak2_pairs pairs;
     int i,cnt,k, kern;
     SplineChar *sc;
     KernPair *last, *kp, *next;
@@ -637,7 +720,7 @@ void AutoKern2(SplineFont *sf, int layer,SplineChar **left,SplineChar **right,
     glyphs = calloc(cnt+1,sizeof(AW_Glyph));
     for ( cnt=i=0; i<sf->glyphcnt; ++i ) if ( (sc = sf->glyphs[i])!=NULL ) {
 	if ( sc->ticked || sc->ticked2 ) {
-	    SplineCharLayerFindBounds(sc,layer,&glyphs[cnt].bb);
+	    SplineCharLayerFindBoundsCached(sc,layer,&glyphs[cnt].bb);
 	    if ( glyphs[cnt].bb.minx<-16000 || glyphs[cnt].bb.maxx>16000 ||
 		    glyphs[cnt].bb.miny<-16000 || glyphs[cnt].bb.maxy>16000 )
 		ff_post_notice(_("Glyph too big"),_("%s has a bounding box which is too big for this algorithm to work. Ignored."),sc->name);
@@ -668,42 +751,37 @@ void AutoKern2(SplineFont *sf, int layer,SplineChar **left,SplineChar **right,
 
     all.glyphs = glyphs;
     all.gcnt = cnt;
+    pairs.all = &all;
+    pairs.min_kern = min_kern;
+    pairs.from_closest_approach = from_closest_approach;
+    pairs.only_closer = only_closer;
+    pairs.rows = calloc(cnt,sizeof(struct ak2_row));
+    aw2_foreach(cnt,ak2_figure_row,&pairs);
     for ( i=0; i<cnt; ++i ) {
 	AW_Glyph *g1 = &glyphs[i];
-	if ( !g1->sc->ticked )
-    continue;
-	for ( k=0; k<cnt; ++k ) {
-	    AW_Glyph *g2 = &glyphs[k];
-	    if ( !g2->sc->ticked2 )
-	continue;
-	    if ( from_closest_approach )
-		kern = rint( ak2_figure_touch(g1,g2,&all));
-	    else {
-		kern = rint( ak2_figure_kern(g1,g2,&all));
-		if ( kern<min_kern && kern>-min_kern )
-		    kern = 0;
-	    }
-	    if ( only_closer && kern>0 )
-		kern=0;
-	    if ( kern!=0 ) {
-		if ( addkp==NULL ) {
-		    kp = chunkalloc(sizeof(KernPair));
-		    kp->subtable = into;
-		    kp->off = kern;
-		    if ( is_l2r ) {
-			kp->sc = g2->sc;
-			kp->next = g1->sc->kerns;
-			g1->sc->kerns = kp;
-		    } else {
-			kp->sc = g1->sc;
-			kp->next = g2->sc->kerns;
-			g2->sc->kerns = kp;
-		    }
-		} else
-		    (*addkp)(data,g1->sc,g2->sc,kern);
-	    }
+	struct ak2_row *row = &pairs.rows[i];
+	for ( k=0; k<row->cnt; ++k ) {
+	    AW_Glyph *g2 = &glyphs[row->kerns[k].right];
+	    kern = row->kerns[k].off;
+	    if ( addkp==NULL ) {
+		kp = chunkalloc(sizeof(KernPair));
+		kp->subtable = into;
+		kp->off = kern;
+		if ( is_l2r ) {
+		    kp->sc = g2->sc;
+		    kp->next = g1->sc->kerns;
+		    g1->sc->kerns = kp;
+		} else {
+		    kp->sc = g1->sc;
+		    kp->next = g2->sc->kerns;
+		    g2->sc->kerns = kp;
+		}
+	    } else
+		(*addkp)(data,g1->sc,g2->sc,kern);
 	}
+	free(row->kerns);
     }
+    free(pairs.rows);
     for ( i=0; i<cnt; ++i )
 	AWGlyphFree( &glyphs[i] );
     free(glyphs);
@@ -712,6 +790,32 @@ void AutoKern2(SplineFont *sf, int layer,SplineChar **left,SplineChar **right,
 #endif		/* PYTHON */
 }
 
+struct ak2_classes {
+    AW_Data *all;
+    int **ileft, **iright;
+    int rcnt;
+    int min_kern, from_closest_approach, only_closer;
+    int *kerns;			/* array[lcnt][rcnt] */
+};
+
+static void ak2_figure_class_row(void *_classes, int i) {
+    struct ak2_classes *classes = _classes;
+    int k, kern;
+
+    for ( k=0; k<classes->rcnt; ++k ) {
+	if ( classes->from_closest_approach )
+	    kern = rint( ak2_figure_touchclass(classes->ileft[i],classes->iright[k],classes->all));
+	else {
+	    kern = rint( ak2_figure_kernclass(classes->ileft[i],classes->iright[k],classes->all));
+	    if ( kern<classes->min_kern && kern>-classes->min_kern )
+		kern = 0;
+	}
+	if ( kern>0 && classes->only_closer )
+	    kern = 0;
+	classes->kerns[i*classes->rcnt+k] = kern;
+    }
+}
+
 void AutoKern2NewClass(SplineFont *sf,int layer,char **leftnames, char **rightnames,
 	int lcnt, int rcnt,
 	void (*kcAddOffset)(void *data,int left_index, int right_index,int offset), void *data,
@@ -719,7 +823,8 @@ void AutoKern2NewClass(SplineFont *sf,int layer,char **leftnames, char **rightna
 	int chunk_height) {
     AW_Data all;
     AW_Glyph *glyphs;
-    int i,cnt,k, kern;
+    struct ak2_classes classes;
+    int i,cnt,k;
     SplineChar ***left = GlyphClassesFromNames(sf,leftnames,lcnt);
     SplineChar ***right = GlyphClassesFromNames(sf,rightnames,rcnt);
     int **ileft = malloc(lcnt*sizeof(int*));
@@ -754,7 +859,7 @@ void AutoKern2NewClass(SplineFont *sf,int layer,char **leftnames, char **rightna
     glyphs = calloc(cnt+1,sizeof(AW_Glyph));
     for ( cnt=i=0; i<sf->glyphcnt; ++i ) if ( (sc = sf->glyphs[i])!=NULL ) {
 	if ( sc->ticked || sc->ticked2 ) {
-	    SplineCharLayerFindBounds(sc,layer,&glyphs[cnt].bb);
+	    SplineCharLayerFindBoundsCached(sc,layer,&glyphs[cnt].bb);
 	    if ( glyphs[cnt].bb.minx<-16000 || glyphs[cnt].bb.maxx>16000 ||
 		    glyphs[cnt].bb.miny<-16000 || glyphs[cnt].bb.maxy>16000 ) {
 		ff_post_notice(_("Glyph too big"),_("%s has a bounding box which is too big for this algorithm to work. Ignored."),sc->name);
@@ -784,20 +889,19 @@ void AutoKern2NewClass(SplineFont *sf,int layer,char **leftnames, char **rightna
 
     all.glyphs = glyphs;
     all.gcnt = cnt;
-    for ( i=0; i<lcnt; ++i ) {
-	for ( k=0; k<rcnt; ++k ) {
-	    if ( from_closest_approach )
-		kern = rint( ak2_figure_touchclass(ileft[i],iright[k],&all));
-	    else {
-		kern = rint( ak2_figure_kernclass(ileft[i],iright[k],&all));
-		if ( kern<min_kern && kern>-min_kern )
-		    kern = 0;
-	    }
-	    if ( kern>0 && only_closer )
-		kern = 0;
-	    (*kcAddOffset)(data,i, k, kern);
-	}
-    }
+    classes.all = &all;
+    classes.ileft = ileft;
+    classes.iright = iright;
+    classes.rcnt = rcnt;
+    classes.min_kern = min_kern;
+    classes.from_closest_approach = from_closest_approach;
+    classes.only_closer = only_closer;
+    classes.kerns = malloc((lcnt*rcnt+1)*sizeof(int));
+    aw2_foreach(lcnt,ak2_figure_class_row,&classes);
+    for ( i=0; i<lcnt; ++i )
+	for ( k=0; k<rcnt; ++k )
+	    (*kcAddOffset)(data,i, k, classes.kerns[i*rcnt+k]);
+    free(classes.kerns);
 
     for ( i=0; i<lcnt; ++i ) {
 	free(ileft[i]);
@@ -821,6 +925,36 @@ static void kc2AddOffset(void *data,int left_index, int right_index,int offset)
 	kc->offsets[left_index*kc->second_cnt+right_index] = offset;
 }
 
+struct ak2_separations {
+    AW_Data *all;
+    SplineChar **leftglyphs, **rightglyphs;
+    int rcnt;
+    int *visual_separation;	/* array[lcnt][rcnt] */
+};
+
+static void ak2_figure_separation_row(void *_seps, int i) {
+    struct ak2_separations *seps = _seps;
+    int *vpt = seps->visual_separation + i*seps->rcnt;
+    SplineChar *lsc = seps->leftglyphs[i];
+    AW_Glyph *me, *other;
+    int j;
+
+    if ( lsc->ticked ) {
+	me = &seps->all->glyphs[lsc->ttf_glyph];
+	for ( j=0; j<seps->rcnt; ++j ) {
+	    SplineChar *rsc = seps->rightglyphs[j];
+	    if ( rsc->ticked2 ) {
+		other = &seps->all->glyphs[rsc->ttf_glyph];
+		vpt[j] = aw2_bbox_separation(me,other,seps->all);
+	    } else
+		vpt[j] = 0;
+	}
+    } else {
+	for ( j=0; j<seps->rcnt; ++j )
+	    vpt[j] = 0;
+    }
+}
+
 void AutoKern2BuildClasses(SplineFont *sf,int layer,
 	SplineChar **leftglyphs,SplineChar **rightglyphs,
 	struct lookup_subtable *sub,
@@ -828,7 +962,8 @@ void AutoKern2BuildClasses(SplineFont *sf,int layer,
 	int autokern,
 	real good_enough) {
     AW_Data all;
-    AW_Glyph *glyphs, *me, *other;
+    AW_Glyph *glyphs;
+    struct ak2_separations seps;
     int chunk_height;
     int i,j,k,cnt,lcnt,rcnt, lclasscnt,rclasscnt;
     int len;
@@ -923,7 +1058,7 @@ return;
     glyphs = calloc(cnt+1,sizeof(AW_Glyph));
     for ( cnt=i=0; i<sf->glyphcnt; ++i ) if ( (sc = sf->glyphs[i])!=NULL ) {
 	if ( sc->ticked || sc->ticked2 ) {
-	    SplineCharLayerFindBounds(sc,layer,&glyphs[cnt].bb);
+	    SplineCharLayerFindBoundsCached(sc,layer,&glyphs[cnt].bb);
 	    if ( glyphs[cnt].bb.minx<-16000 || glyphs[cnt].bb.maxx>16000 ||
 		    glyphs[cnt].bb.miny<-16000 || glyphs[cnt].bb.maxy>16000 ) {
 		ff_post_notice(_("Glyph too big"),_("%s has a bounding box which is too big for this algorithm to work. Ignored."),sc->name);
@@ -939,24 +1074,12 @@ return;
     all.glyphs = glyphs;
     all.gcnt = cnt;
     visual_separation = malloc(lcnt*rcnt*sizeof(int));
-    for ( i=0; i<lcnt; ++i ) {
-	int *vpt = visual_separation + i*rcnt;
-	SplineChar *lsc = leftglyphs[i];
-	if ( lsc->ticked ) {
-	    me = &all.glyphs[lsc->ttf_glyph];
-	    for ( j=0; j<rcnt; ++j ) {
-		SplineChar *rsc = rightglyphs[j];
-		if ( rsc->ticked2 ) {
-		    other = &all.glyphs[rsc->ttf_glyph];
-		    vpt[j] = aw2_bbox_separation(me,other,&all);
-		} else
-		    vpt[j] = 0;
-	    }
-	} else {
-	    for ( j=0; j<rcnt; ++j )
-		vpt[j] = 0;
-	}
-    }
+    seps.all = &all;
+    seps.leftglyphs = leftglyphs;
+    seps.rightglyphs = rightglyphs;
+    seps.rcnt = rcnt;
+    seps.visual_separation = visual_separation;
+    aw2_foreach(lcnt,ak2_figure_separation_row,&seps);
     for ( i=0; i<cnt; ++i )
 	AWGlyphFree( &glyphs[i] );
 #if !defined(_NO_PYTHON)
@@ -52,6 +52,7 @@
 #include "utype.h"
 #include "views.h"
 
+#include <glib.h>
 #include <math.h>
 
 #ifndef HAVE_EXECINFO_H
@@ -76,6 +77,37 @@ int export_clipboard = 1;
 
 int maxundoes = 120;		/* -1 is infinite */
 int preserve_hint_undoes = true;
+int undo_memory_limit = 0;	/* Megabytes all undoes may hold, 0 is no limit */
+int undo_compress = false;	/* Pack all but the latest undo of each layer */
+				/*  (and keep undoes when scripting) */
+
+/* Scripts may edit different fonts in several threads at once, and a trim */
+/*  may drop the undoes of any open font. So the budget's counters, the */
+/*  trim itself and the linking of new undoes into their lists are all done */
+/*  with undo_lock held (it is recursive, as freeing undoes adjusts the */
+/*  counters) */
+static GRecMutex undo_lock;
+static size_t undo_bytes;	/* Held by the undoes counted against the budget */
+static size_t undo_trim_at;	/* Don't try trimming again till we pass this */
+static uint32_t undo_stamp;
+
+/* Moves an undo's share of the budget from old_bytes to new_bytes and */
+/*  returns the new total */
+static size_t UndoBudgetAdjust(size_t old_bytes, size_t new_bytes) {
+    size_t total;
+
+    g_rec_mutex_lock(&undo_lock);
+    undo_bytes = undo_bytes - old_bytes + new_bytes;
+    total = undo_bytes;
+    g_rec_mutex_unlock(&undo_lock);
+return( total );
+}
+
+/* Scripts normally have no use for undoes, but if they are packed they are */
+/*  cheap enough to keep */
+static int NoUndoes(void) {
+return( maxundoes==0 || (no_windowing_ui && !undo_compress) );
+}
 
 static uint8_t *bmpcopy(uint8_t *bitmap,int bytes_per_line, int lines) {
     uint8_t *ret = malloc(bytes_per_line*lines);
@@ -493,6 +525,445 @@ void ExtractHints(SplineChar *sc,void *hints,int docopy) {
     sc->vconflicts = StemInfoAnyOverlaps(v);
 }
 
+/* Undoes keep a full copy of the outline, which adds up quickly when an */
+/*  operation touches every glyph of a big font. So, optionally, all but the */
+/*  most recent undo of each layer keep their contours serialized into a     */
+/*  flat buffer (a fraction of the size of the SplinePoints and Splines),    */
+/*  and the undoes of all glyphs together may be held to a memory budget,    */
+/*  the oldest undoes anywhere in the session being dropped first */
+
+struct packbuf {
+    uint8_t *data;
+    size_t len, max;
+};
+
+static void PackBytes(struct packbuf *pb, const void *data, size_t len) {
+    if ( pb->len+len > pb->max ) {
+	pb->max = 2*pb->max + len + 256;
+	pb->data = realloc(pb->data,pb->max);
+    }
+    memcpy(pb->data+pb->len,data,len);
+    pb->len += len;
+}
+
+static void PackString(struct packbuf *pb, const char *str) {
+    uint32_t len = str==NULL ? 0 : strlen(str)+1;
+
+    PackBytes(pb,&len,sizeof(len));
+    if ( len!=0 )
+	PackBytes(pb,str,len);
+}
+
+static const uint8_t *UnpackBytes(const uint8_t *pt, void *data, size_t len) {
+    memcpy(data,pt,len);
+return( pt+len );
+}
+
+static const uint8_t *UnpackString(const uint8_t *pt, char **str) {
+    uint32_t len;
+
+    pt = UnpackBytes(pt,&len,sizeof(len));
+    *str = NULL;
+    if ( len!=0 ) {
+	*str = malloc(len);
+	pt = UnpackBytes(pt,*str,len);
+    }
+return( pt );
+}
+
+enum packed_point_flags {
+    ppf_nonextcp=0x1, ppf_noprevcp=0x2, ppf_nextcpdef=0x4, ppf_prevcpdef=0x8,
+    ppf_selected=0x10, ppf_isintersection=0x20, ppf_flexy=0x40, ppf_flexx=0x80,
+    ppf_roundx=0x100, ppf_roundy=0x200, ppf_dontinterpolate=0x400,
+    ppf_hintmask=0x800, ppf_name=0x1000
+    /* pointtype and the two cp selections go above bit 16 */
+};
+
+enum packed_contour_flags { pcf_closed=0x1, pcf_order2=0x2, pcf_clip=0x4, pcf_optimize=0x8 };
+
+static void PackSplinePoint(struct packbuf *pb, const SplinePoint *sp) {
+    uint32_t flags;
+
+    flags = (sp->nonextcp?ppf_nonextcp:0) | (sp->noprevcp?ppf_noprevcp:0) |
+	    (sp->nextcpdef?ppf_nextcpdef:0) | (sp->prevcpdef?ppf_prevcpdef:0) |
+	    (sp->selected?ppf_selected:0) | (sp->isintersection?ppf_isintersection:0) |
+	    (sp->flexy?ppf_flexy:0) | (sp->flexx?ppf_flexx:0) |
+	    (sp->roundx?ppf_roundx:0) | (sp->roundy?ppf_roundy:0) |
+	    (sp->dontinterpolate?ppf_dontinterpolate:0) |
+	    (sp->hintmask!=NULL?ppf_hintmask:0) | (sp->name!=NULL?ppf_name:0) |
+	    (sp->pointtype<<16) | (sp->nextcpselected<<18) | (sp->prevcpselected<<20);
+    PackBytes(pb,&sp->me,sizeof(BasePoint));
+    PackBytes(pb,&sp->nextcp,sizeof(BasePoint));
+    PackBytes(pb,&sp->prevcp,sizeof(BasePoint));
+    PackBytes(pb,&flags,sizeof(flags));
+    PackBytes(pb,&sp->ttfindex,sizeof(sp->ttfindex));
+    PackBytes(pb,&sp->nextcpindex,sizeof(sp->nextcpindex));
+    if ( sp->hintmask!=NULL )
+	PackBytes(pb,sp->hintmask,sizeof(HintMask));
+    if ( sp->name!=NULL )
+	PackString(pb,sp->name);
+}
+
+static const uint8_t *UnpackSplinePoint(const uint8_t *pt, SplinePoint *sp) {
+    uint32_t flags;
+
+    pt = UnpackBytes(pt,&sp->me,sizeof(BasePoint));
+    pt = UnpackBytes(pt,&sp->nextcp,sizeof(BasePoint));
+    pt = UnpackBytes(pt,&sp->prevcp,sizeof(BasePoint));
+    pt = UnpackBytes(pt,&flags,sizeof(flags));
+    pt = UnpackBytes(pt,&sp->ttfindex,sizeof(sp->ttfindex));
+    pt = UnpackBytes(pt,&sp->nextcpindex,sizeof(sp->nextcpindex));
+    sp->nonextcp = (flags&ppf_nonextcp)!=0;
+    sp->noprevcp = (flags&ppf_noprevcp)!=0;
+    sp->nextcpdef = (flags&ppf_nextcpdef)!=0;
+    sp->prevcpdef = (flags&ppf_prevcpdef)!=0;
+    sp->selected = (flags&ppf_selected)!=0;
+    sp->isintersection = (flags&ppf_isintersection)!=0;
+    sp->flexy = (flags&ppf_flexy)!=0;
+    sp->flexx = (flags&ppf_flexx)!=0;
+    sp->roundx = (flags&ppf_roundx)!=0;
+    sp->roundy = (flags&ppf_roundy)!=0;
+    sp->dontinterpolate = (flags&ppf_dontinterpolate)!=0;
+    sp->pointtype = (flags>>16)&3;
+    sp->nextcpselected = (flags>>18)&3;
+    sp->prevcpselected = (flags>>20)&3;
+    if ( flags&ppf_hintmask ) {
+	sp->hintmask = chunkalloc(sizeof(HintMask));
+	pt = UnpackBytes(pt,sp->hintmask,sizeof(HintMask));
+    }
+    if ( flags&ppf_name )
+	pt = UnpackString(pt,&sp->name);
+return( pt );
+}
+
+static void PackSplineSets(struct packbuf *pb, const SplineSet *ss) {
+    SplinePoint *sp;
+    int32_t cnt;
+    uint8_t flags;
+
+    for ( ; ss!=NULL; ss=ss->next ) {
+	cnt = 0;
+	for ( sp=ss->first; sp!=NULL; ) {
+	    ++cnt;
+	    if ( sp->next==NULL || (sp = sp->next->to)==ss->first )
+	break;
+	}
+	flags = (ss->first!=NULL && ss->first->prev!=NULL ? pcf_closed : 0) |
+		(ss->first!=NULL && ss->first->next!=NULL && ss->first->next->order2 ? pcf_order2 : 0) |
+		(ss->is_clip_path ? pcf_clip : 0) |
+		(ss->beziers_need_optimizer ? pcf_optimize : 0);
+	PackBytes(pb,&cnt,sizeof(cnt));
+	PackBytes(pb,&flags,sizeof(flags));
+	PackBytes(pb,&ss->start_offset,sizeof(ss->start_offset));
+	PackBytes(pb,&ss->spiro_cnt,sizeof(ss->spiro_cnt));
+	if ( ss->spiro_cnt!=0 )
+	    PackBytes(pb,ss->spiros,ss->spiro_cnt*sizeof(spiro_cp));
+	PackString(pb,ss->contour_name);
+	for ( sp=ss->first; cnt>0; --cnt, sp=sp->next->to )
+	    PackSplinePoint(pb,sp);
+    }
+}
+
+static SplineSet *UnpackSplineSets(const uint8_t *pt, const uint8_t *end) {
+    SplineSet *head=NULL, *last=NULL, *ss;
+    SplinePoint *sp;
+    int32_t cnt;
+    uint8_t flags;
+
+    while ( pt<end ) {
+	ss = chunkalloc(sizeof(SplineSet));
+	pt = UnpackBytes(pt,&cnt,sizeof(cnt));
+	pt = UnpackBytes(pt,&flags,sizeof(flags));
+	pt = UnpackBytes(pt,&ss->start_offset,sizeof(ss->start_offset));
+	pt = UnpackBytes(pt,&ss->spiro_cnt,sizeof(ss->spiro_cnt));
+	if ( ss->spiro_cnt!=0 ) {
+	    ss->spiro_max = ss->spiro_cnt;
+	    ss->spiros = malloc(ss->spiro_max*sizeof(spiro_cp));
+	    pt = UnpackBytes(pt,ss->spiros,ss->spiro_cnt*sizeof(spiro_cp));
+	}
+	pt = UnpackString(pt,&ss->contour_name);
+	ss->is_clip_path = (flags&pcf_clip)!=0;
+	ss->beziers_need_optimizer = (flags&pcf_optimize)!=0;
+	for ( ; cnt>0; --cnt ) {
+	    sp = chunkalloc(sizeof(SplinePoint));
+	    pt = UnpackSplinePoint(pt,sp);
+	    if ( ss->first==NULL )
+		ss->first = sp;
+	    else
+		SplineMake(ss->last,sp,(flags&pcf_order2)!=0);
+	    ss->last = sp;
+	}
+	if ( (flags&pcf_closed) && ss->first!=NULL ) {
+	    SplineMake(ss->last,ss->first,(flags&pcf_order2)!=0);
+	    ss->last = ss->first;
+	}
+	if ( head==NULL )
+	    head = ss;
+	else
+	    last->next = ss;
+	last = ss;
+    }
+return( head );
+}
+
+static size_t SplineSetsBytes(const SplineSet *ss) {
+    const SplinePoint *sp;
+    size_t bytes = 0;
+
+    for ( ; ss!=NULL; ss=ss->next ) {
+	bytes += sizeof(SplineSet) + ss->spiro_max*sizeof(spiro_cp);
+	for ( sp=ss->first; sp!=NULL; ) {
+	    bytes += sizeof(SplinePoint);
+	    if ( sp->hintmask!=NULL )
+		bytes += sizeof(HintMask);
+	    if ( sp->next==NULL )
+	break;
+	    bytes += sizeof(Spline);
+	    if ( (sp = sp->next->to)==ss->first )
+	break;
+	}
+    }
+return( bytes );
+}
+
+static size_t UndoListBytes(const Undoes *undo);
+
+/* A rough count of the memory one undo holds (outlines dominate) */
+static size_t UndoBytes(const Undoes *undo) {
+    size_t bytes = sizeof(Undoes);
+    const RefChar *ref;
+    const AnchorPoint *ap;
+    int i;
+
+    switch ( undo->undotype ) {
+      case ut_state: case ut_tstate: case ut_statehint: case ut_statename:
+      case ut_hints: case ut_anchors: case ut_statelookup:
+	bytes += SplineSetsBytes(undo->u.state.splines) + undo->u.state.packed_len;
+	bytes += undo->u.state.instrs_len;
+	for ( ref=undo->u.state.refs; ref!=NULL; ref=ref->next ) {
+	    bytes += sizeof(RefChar) + ref->layer_cnt*sizeof(struct reflayer);
+	    for ( i=0; i<ref->layer_cnt; ++i )
+		bytes += SplineSetsBytes(ref->layers[i].splines);
+	}
+	for ( ap=undo->u.state.anchor; ap!=NULL; ap=ap->next )
+	    bytes += sizeof(AnchorPoint);
+      break;
+      case ut_bitmap:
+	bytes += undo->u.bmpstate.bytes_per_line*(undo->u.bmpstate.ymax-undo->u.bmpstate.ymin+1);
+      break;
+      case ut_multiple: case ut_layers:
+	bytes += UndoListBytes(undo->u.multiple.mult);
+      break;
+      case ut_composit:
+	bytes += UndoListBytes(undo->u.composit.state) + UndoListBytes(undo->u.composit.bitmaps);
+      break;
+      default:
+      break;
+    }
+return( bytes );
+}
+
+static size_t UndoListBytes(const Undoes *undo) {
+    size_t bytes = 0;
+
+    for ( ; undo!=NULL; undo=undo->next )
+	bytes += UndoBytes(undo);
+return( bytes );
+}
+
+static int UndoHasState(const Undoes *undo) {
+return( undo->undotype==ut_state || undo->undotype==ut_tstate ||
+	undo->undotype==ut_statehint || undo->undotype==ut_statename );
+}
+
+static void UndoRecount(Undoes *undo) {
+    size_t old_bytes = undo->bytes;
+
+    if ( old_bytes!=0 ) {
+	undo->bytes = UndoBytes(undo);
+	UndoBudgetAdjust(old_bytes,undo->bytes);
+    }
+}
+
+static void UndoPack(Undoes *undo) {
+    struct packbuf pb;
+
+    if ( !UndoHasState(undo) || undo->u.state.splines==NULL ||
+	    undo->u.state.packed_splines!=NULL )
+return;
+    memset(&pb,0,sizeof(pb));
+    PackSplineSets(&pb,undo->u.state.splines);
+    SplinePointListsFree(undo->u.state.splines);
+    undo->u.state.splines = NULL;
+    undo->u.state.packed_splines = realloc(pb.data,pb.len);
+    undo->u.state.packed_len = pb.len;
+    UndoRecount(undo);
+}
+
+SplineSet *UndoPackedSplines(const Undoes *undo) {
+    if ( undo==NULL || !UndoHasState(undo) || undo->u.state.packed_splines==NULL )
+return( NULL );
+return( UnpackSplineSets(undo->u.state.packed_splines,
+	    undo->u.state.packed_splines+undo->u.state.packed_len) );
+}
+
+static void UndoUnpack(Undoes *undo) {
+    if ( undo==NULL || !UndoHasState(undo) || undo->u.state.packed_splines==NULL )
+return;
+    undo->u.state.splines = UnpackSplineSets(undo->u.state.packed_splines,
+	    undo->u.state.packed_splines+undo->u.state.packed_len);
+    free(undo->u.state.packed_splines);
+    undo->u.state.packed_splines = NULL;
+    undo->u.state.packed_len = 0;
+    UndoRecount(undo);
+}
+
+struct undoage {
+    uint32_t stamp;
+    int depth;
+    Undoes *undo, *prev;
+};
+
+struct undoages {
+    struct undoage *ages;
+    int cnt, max;
+};
+
+static void UndoListAges(struct undoages *ua, Undoes *head) {
+    Undoes *prev, *u;
+    int depth;
+
+    /* The latest undo of each layer always survives */
+    if ( head==NULL )
+return;
+    for ( prev=head, u=head->next, depth=1; u!=NULL; prev=u, u=u->next, ++depth ) {
+	if ( ua->cnt>=ua->max ) {
+	    ua->max = 2*ua->max + 1000;
+	    ua->ages = realloc(ua->ages,ua->max*sizeof(struct undoage));
+	}
+	ua->ages[ua->cnt].stamp = u->stamp;
+	ua->ages[ua->cnt].depth = depth;
+	ua->ages[ua->cnt].undo = u;
+	ua->ages[ua->cnt++].prev = prev;
+    }
+}
+
+static void FontUndoAges(struct undoages *ua, SplineFont *sf) {
+    BDFFont *bdf;
+    int i, l;
+
+    for ( i=0; i<sf->glyphcnt; ++i ) if ( sf->glyphs[i]!=NULL )
+	for ( l=0; l<sf->glyphs[i]->layer_cnt; ++l )
+	    UndoListAges(ua,sf->glyphs[i]->layers[l].undoes);
+    for ( bdf=sf->bitmaps; bdf!=NULL; bdf=bdf->next )
+	for ( i=0; i<bdf->glyphcnt; ++i ) if ( bdf->glyphs[i]!=NULL )
+	    UndoListAges(ua,bdf->glyphs[i]->undoes);
+}
+
+static void MasterUndoAges(struct undoages *ua, SplineFont *sf) {
+    int i;
+
+    if ( sf->subfontcnt==0 )
+	FontUndoAges(ua,sf);
+    else for ( i=0; i<sf->subfontcnt; ++i )
+	FontUndoAges(ua,sf->subfonts[i]);
+}
+
+static int agecmp(const void *_a1, const void *_a2) {
+    const struct undoage *a1 = _a1, *a2 = _a2;
+
+    if ( a1->stamp!=a2->stamp )
+return( a1->stamp<a2->stamp ? -1 : 1 );
+    /* Undoes read from an sfd file have no stamp, drop the deepest first */
+return( a2->depth - a1->depth );
+}
+
+/* Drops the oldest undoes of all open fonts until together they are well */
+/*  within the budget (this visits every glyph of every font, so we don't */
+/*  want to do it often). sf, the font being edited, may not be in a font */
+/*  view yet */
+static void UndoesTrimToBudget(SplineFont *sf) {
+    size_t limit = ((size_t) undo_memory_limit)<<20;
+    struct undoages ua;
+    FontViewBase *fv, *test;
+    SplineFont *master;
+    int i;
+
+    if ( undo_memory_limit<=0 )
+return;
+    g_rec_mutex_lock(&undo_lock);
+    if ( undo_bytes<=limit || undo_bytes<=undo_trim_at ) {
+	g_rec_mutex_unlock(&undo_lock);
+return;
+    }
+
+    memset(&ua,0,sizeof(ua));
+    if ( sf!=NULL && sf->cidmaster!=NULL )
+	sf = sf->cidmaster;
+    if ( sf!=NULL )
+	MasterUndoAges(&ua,sf);
+    for ( fv=FontViewFirst(); fv!=NULL; fv=fv->next ) {
+	master = fv->cidmaster!=NULL ? fv->cidmaster : fv->sf;
+	/* Several views may show the same font */
+	for ( test=FontViewFirst(); test!=fv; test=test->next )
+	    if ( (test->cidmaster!=NULL ? test->cidmaster : test->sf)==master )
+	break;
+	if ( test==fv && master!=sf )
+	    MasterUndoAges(&ua,master);
+    }
+    qsort(ua.ages,ua.cnt,sizeof(struct undoage),agecmp);
+    for ( i=0; i<ua.cnt && undo_bytes>limit-limit/4; ++i ) {
+	/* Always drop from the end of a list, so an undo is never left */
+	/*  without the ones between it and the present */
+	if ( ua.ages[i].undo->next!=NULL )
+    continue;
+	ua.ages[i].prev->next = NULL;
+	UndoesFree(ua.ages[i].undo);
+    }
+    free(ua.ages);
+    /* If what is left is mostly the latest undo of every glyph, there is */
+    /*  no point looking again until it has grown by a good bit */
+    undo_trim_at = undo_bytes>limit ? undo_bytes + limit/4 : 0;
+    g_rec_mutex_unlock(&undo_lock);
+}
+
+size_t SFUndoBytes(SplineFont *sf, int *undo_cnt) {
+    size_t bytes = 0;
+    int i, l, cnt = 0;
+    SplineFont *sub;
+    BDFFont *bdf;
+    Undoes *u;
+
+    if ( sf->cidmaster!=NULL )
+	sf = sf->cidmaster;
+    /* Another thread's trim may be dropping some of these */
+    g_rec_mutex_lock(&undo_lock);
+    for ( l=0; l<(sf->subfontcnt==0 ? 1 : sf->subfontcnt); ++l ) {
+	sub = sf->subfontcnt==0 ? sf : sf->subfonts[l];
+	for ( i=0; i<sub->glyphcnt; ++i ) if ( sub->glyphs[i]!=NULL ) {
+	    SplineChar *sc = sub->glyphs[i];
+	    int ly;
+	    for ( ly=0; ly<sc->layer_cnt; ++ly ) {
+		for ( u=sc->layers[ly].undoes; u!=NULL; u=u->next, ++cnt )
+		    bytes += UndoBytes(u);
+		for ( u=sc->layers[ly].redoes; u!=NULL; u=u->next, ++cnt )
+		    bytes += UndoBytes(u);
+	    }
+	}
+	for ( bdf=sub->bitmaps; bdf!=NULL; bdf=bdf->next )
+	    for ( i=0; i<bdf->glyphcnt; ++i ) if ( bdf->glyphs[i]!=NULL ) {
+		for ( u=bdf->glyphs[i]->undoes; u!=NULL; u=u->next, ++cnt )
+		    bytes += UndoBytes(u);
+		for ( u=bdf->glyphs[i]->redoes; u!=NULL; u=u->next, ++cnt )
+		    bytes += UndoBytes(u);
+	    }
+    }
+    g_rec_mutex_unlock(&undo_lock);
+    if ( undo_cnt!=NULL )
+	*undo_cnt = cnt;
+return( bytes );
+}
+
 void UndoesFreeButRetainFirstN( Undoes** undopp, int retainAmount )
 {
     if( !undopp || !*undopp )
@@ -535,6 +1006,7 @@ void UndoesFree(Undoes *undo) {
 	  case ut_state: case ut_tstate: case ut_statehint: case ut_statename:
 	  case ut_hints: case ut_anchors: case ut_statelookup:
 	    SplinePointListsFree(undo->u.state.splines);
+	    free(undo->u.state.packed_splines);
 	    RefCharsFree(undo->u.state.refs);
 	    UHintListFree(undo->u.state.hints);
 	    free(undo->u.state.instrs);
@@ -568,18 +1040,27 @@ void UndoesFree(Undoes *undo) {
 	    IError( "Unknown undo type in UndoesFree: %d", undo->undotype );
 	  break;
 	}
+	if ( undo->bytes!=0 )
+	    UndoBudgetAdjust(undo->bytes,0);
 	chunkfree(undo,sizeof(Undoes));
 	undo = unext;
     }
 }
 
-static Undoes *AddUndo(Undoes *undo,Undoes **uhead,Undoes **rhead) {
+/* sf is the font the undo belongs to (NULL if it has none) */
+static Undoes *AddUndo(SplineFont *sf,Undoes *undo,Undoes **uhead,Undoes **rhead) {
     int ucnt;
-    Undoes *u, *prev;
+    Undoes *u = NULL, *prev;
 
     UndoesFree(*rhead);
     *rhead = NULL;
+    /* A trim never drops the latest undo of a list, so it is safe to pack */
+    /*  this one before it is pushed down */
+    if ( undo_compress && *uhead!=NULL )
+	UndoPack(*uhead);
+    undo->bytes = UndoBytes(undo);
     if ( maxundoes==0 ) maxundoes = 1;		/* Must be at least one or snap to breaks */
+    g_rec_mutex_lock(&undo_lock);
     if ( maxundoes>0 ) {
 	ucnt = 0;
 	prev = NULL;
@@ -589,7 +1070,6 @@ static Undoes *AddUndo(Undoes *undo,Undoes **uhead,Undoes **rhead) {
 	    prev = u;
 	}
 	if ( u!=NULL ) {
-	    UndoesFree(u);
 	    if ( prev!=NULL )
 		prev->next = NULL;
 	    else
@@ -598,13 +1078,18 @@ static Undoes *AddUndo(Undoes *undo,Undoes **uhead,Undoes **rhead) {
     }
     undo->next = *uhead;
     *uhead = undo;
+    undo->stamp = ++undo_stamp;
+    undo_bytes += undo->bytes;
+    g_rec_mutex_unlock(&undo_lock);
+    UndoesFree(u);
+    UndoesTrimToBudget(sf);
 
     return( undo );
 }
 
 static Undoes *CVAddUndo(CharViewBase *cv,Undoes *undo) {
 
-    Undoes* ret = AddUndo( undo,
+    Undoes* ret = AddUndo( cv->sc->parent, undo,
 			   &cv->layerheads[cv->drawmode]->undoes,
 			   &cv->layerheads[cv->drawmode]->redoes );
 
@@ -624,7 +1109,7 @@ Undoes *CVPreserveState(CharViewBase *cv) {
 
 //    if (!quiet)
 //        printf("CVPreserveState() no_windowing_ui:%d maxundoes:%d\n", no_windowing_ui, maxundoes );
-    if ( no_windowing_ui || maxundoes==0 )		/* No use for undoes in scripting */
+    if ( NoUndoes() )
 return(NULL);
 
     undo = chunkalloc(sizeof(Undoes));
@@ -667,7 +1152,7 @@ Undoes *SCPreserveHints(SplineChar *sc,int layer) {
     if ( layer<0 || layer>=sc->layer_cnt )
         return( NULL );
 
-    if ( no_windowing_ui || maxundoes==0 )		/* No use for undoes in scripting */
+    if ( NoUndoes() )
 return(NULL);
     if ( !preserve_hint_undoes )
 return( NULL );
@@ -680,7 +1165,7 @@ return( NULL );
     undo->u.state.instrs = (uint8_t*) copyn((char *) sc->ttf_instrs, sc->ttf_instrs_len);
     undo->u.state.instrs_len = sc->ttf_instrs_len;
     undo->copied_from = sc->parent;
-return( AddUndo(undo,&sc->layers[layer].undoes,&sc->layers[layer].redoes));
+return( AddUndo(sc->parent,undo,&sc->layers[layer].undoes,&sc->layers[layer].redoes));
 }
 
 /* This routine allows for undoes in scripting -- under controlled conditions */
@@ -726,13 +1211,13 @@ return(NULL);
     undo->u.state.dostroke = sc->layers[layer].dostroke;
     undo->u.state.fillfirst = sc->layers[layer].fillfirst;
     undo->copied_from = sc->parent;
-return( AddUndo(undo,&sc->layers[layer].undoes,&sc->layers[layer].redoes));
+return( AddUndo(sc->parent,undo,&sc->layers[layer].undoes,&sc->layers[layer].redoes));
 }
 
 /* This routine does not allow for undoes in scripting */
 Undoes *SCPreserveLayer(SplineChar *sc,int layer, int dohints) {
 
-    if ( no_windowing_ui || maxundoes==0 )		/* No use for undoes in scripting */
+    if ( NoUndoes() )
 return(NULL);
 return( _SCPreserveLayer(sc,layer,dohints));
 }
@@ -769,11 +1254,11 @@ Undoes *_SFPreserveGuide(SplineFont *sf) {
     undo->u.state.dostroke = sf->grid.dostroke;
     undo->u.state.fillfirst = sf->grid.fillfirst;
     undo->copied_from = sf;
-return( AddUndo(undo,&sf->grid.undoes,&sf->grid.redoes));
+return( AddUndo(sf,undo,&sf->grid.undoes,&sf->grid.redoes));
 }
 
 Undoes *SFPreserveGuide(SplineFont *sf) {
-    if ( no_windowing_ui || maxundoes==0 )             /* No use for undoes in scripting */
+    if ( NoUndoes() )
 return(NULL);
 return( _SFPreserveGuide(sf) );
 }
@@ -814,7 +1299,7 @@ return( undo );
 Undoes *CVPreserveWidth(CharViewBase *cv,int width) {
     Undoes *undo;
 
-    if ( no_windowing_ui || maxundoes==0 )		/* No use for undoes in scripting */
+    if ( NoUndoes() )
 return(NULL);
 
     undo = chunkalloc(sizeof(Undoes));
@@ -829,7 +1314,7 @@ return( CVAddUndo(cv,undo));
 Undoes *CVPreserveVWidth(CharViewBase *cv,int vwidth) {
     Undoes *undo;
 
-    if ( no_windowing_ui || maxundoes==0 )		/* No use for undoes in scripting */
+    if ( NoUndoes() )
 return(NULL);
 
     undo = chunkalloc(sizeof(Undoes));
@@ -844,7 +1329,7 @@ return( CVAddUndo(cv,undo));
 Undoes *SCPreserveWidth(SplineChar *sc) {
     Undoes *undo;
 
-    if ( no_windowing_ui || maxundoes==0 )		/* No use for undoes in scripting */
+    if ( NoUndoes() )
 return(NULL);
 
     undo = chunkalloc(sizeof(Undoes));
@@ -855,7 +1340,7 @@ return(NULL);
     undo->u.state.width = sc->width;
     undo->layer = dm_fore;
 
-    Undoes* ret = AddUndo(undo,&sc->layers[ly_fore].undoes,&sc->layers[ly_fore].redoes);
+    Undoes* ret = AddUndo(sc->parent,undo,&sc->layers[ly_fore].undoes,&sc->layers[ly_fore].redoes);
 
     return(ret);
 }
@@ -863,7 +1348,7 @@ return(NULL);
 Undoes *SCPreserveVWidth(SplineChar *sc) {
     Undoes *undo;
 
-    if ( no_windowing_ui || maxundoes==0 )		/* No use for undoes in scripting */
+    if ( NoUndoes() )
 return(NULL);
 
     undo = chunkalloc(sizeof(Undoes));
@@ -872,14 +1357,14 @@ return(NULL);
     undo->was_modified = sc->changed;
     undo->was_order2 = sc->layers[ly_fore].order2;
     undo->u.state.width = sc->vwidth;
-return( AddUndo(undo,&sc->layers[ly_fore].undoes,&sc->layers[ly_fore].redoes));
+return( AddUndo(sc->parent,undo,&sc->layers[ly_fore].undoes,&sc->layers[ly_fore].redoes));
 }
 
 Undoes *BCPreserveState( BDFChar *bc ) {
     Undoes *undo;
     BDFRefChar *head, *ref, *prev = NULL;
 
-    if ( no_windowing_ui || maxundoes==0 )		/* No use for undoes in scripting */
+    if ( NoUndoes() )
 return(NULL);
 
     undo = chunkalloc(sizeof(Undoes));
@@ -903,11 +1388,12 @@ return(NULL);
 	    prev->next = ref;
 	prev = ref;
     }
-return( AddUndo(undo,&bc->undoes,&bc->redoes));
+return( AddUndo(bc->sc!=NULL?bc->sc->parent:NULL,undo,&bc->undoes,&bc->redoes));
 }
 
 static void SCUndoAct(SplineChar *sc,int layer, Undoes *undo) {
 
+    UndoUnpack(undo);
     switch ( undo->undotype ) {
       case ut_noop:
       break;
@@ -1018,6 +1504,8 @@ void CVDoUndo(CharViewBase *cv) {
 
     cv->layerheads[cv->drawmode]->undoes = undo->next;
     undo->next = NULL;
+    /* The charview looks at the state in the latest undo, keep it unpacked */
+    UndoUnpack(cv->layerheads[cv->drawmode]->undoes);
 
     SCUndoAct(cv->sc,CVLayer(cv),undo);
     undo->next = cv->layerheads[cv->drawmode]->redoes;
@@ -1047,6 +1535,7 @@ void SCDoUndo(SplineChar *sc,int layer) {
 return;
     sc->layers[layer].undoes = undo->next;
     undo->next = NULL;
+    UndoUnpack(sc->layers[layer].undoes);
     SCUndoAct(sc,layer,undo);
     undo->next = sc->layers[layer].redoes;
     sc->layers[layer].redoes = undo;
@@ -1128,6 +1617,7 @@ void CVRemoveTopUndo(CharViewBase *cv) {
     cv->layerheads[cv->drawmode]->undoes = undo->next;
     undo->next = NULL;
     UndoesFree(undo);
+    UndoUnpack(cv->layerheads[cv->drawmode]->undoes);
 }
 
 static void BCUndoAct(BDFChar *bc,Undoes *undo) {
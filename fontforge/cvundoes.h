@@ -5,6 +5,7 @@
 #include "splinefont.h"
 
 extern int no_windowing_ui, maxundoes;
+extern int undo_memory_limit, undo_compress;
 
 /**
  * Serialize and undo into a string.
@@ -53,6 +54,11 @@ extern void CVDoUndo(CharViewBase *cv);
 extern void CVRemoveTopUndo(CharViewBase *cv);
 extern void _CVRestoreTOriginalState(CharViewBase *cv, PressedOn *p);
 extern void _CVUndoCleanup(CharViewBase *cv, PressedOn *p);
+/* A fresh copy of the contours of an undo whose contours were packed, */
+/*  NULL if they weren't. The undo itself is left as it is */
+extern SplineSet *UndoPackedSplines(const Undoes *undo);
+/* Roughly how much memory the undoes and redoes of a font hold */
+extern size_t SFUndoBytes(SplineFont *sf, int *undo_cnt);
 
 /**
   * Dump a list of undos for a splinechar starting at the given 'undo'.
@@ -50,9 +50,17 @@
 #include "utype.h"
 
 #include <dirent.h>
+#include <fcntl.h>
 #include <math.h>
+#include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
+#if !defined(__MINGW32__)
+# include <sys/mman.h>
+#endif
+#ifndef O_BINARY
+# define O_BINARY 0
+#endif
 
 Encoding *default_encoding = NULL;
 
@@ -822,8 +830,307 @@ return( -1 );
 return ( cid );
 }
 
+/* A cidmap is compiled into one block of memory, so that it can be      */
+/*  cached on disk (in the user's cache directory) and mapped straight    */
+/*  back in by later runs rather than parsing the text file again. All   */
+/*  offsets are from the start of the block and all numbers are in the    */
+/*  byte order of the machine which wrote it. The hash tables find the    */
+/*  cid of a unicode code point or of a glyph name without scanning       */
+#define CIDMAP_MAGIC		"FFCIDMAP"
+#define CIDMAP_VERSION		1
+#define CIDMAP_BYTEORDER	0x01020304
+#define CIDMAP_EMPTY		0xffffffff
+
+struct cidmapdata {
+    char magic[8];
+    uint32_t byteorder, version;
+    uint32_t len;		/* Of the whole block */
+    uint32_t cidmax, namemax;
+    uint32_t src_path;		/* Text file it was compiled from, and its */
+    int64_t src_size, src_mtime;	/*  state at the time */
+    uint32_t unicode;		/* namemax+1 code points */
+    uint32_t names;		/* namemax+1 string offsets, 0 for no name */
+    uint32_t alts, alt_cnt;	/* (cid,uni) pairs for the extra code points */
+				/*  of a cid, by cid and then as in the file */
+    uint32_t unihash, unihash_size;	/* (uni,cid) pairs, cid CIDMAP_EMPTY if unused */
+    uint32_t namehash, namehash_size;	/* cids */
+    uint32_t strings;		/* NUL terminated strings run to the end */
+};
+
+static uint32_t cidmap_unihash(uint32_t uni) {
+return( uni*2654435761U );
+}
+
+static uint32_t cidmap_namehash(const char *name) {
+    uint32_t h = 0x811c9dc5;
+
+    while ( *name ) {
+	h ^= (unsigned char) *name++;
+	h *= 0x01000193;
+    }
+return( h );
+}
+
+static const uint32_t *cidmap_array(const struct cidmapdata *data,uint32_t off) {
+return( (const uint32_t *) (((const uint8_t *) data) + off) );
+}
+
+static const char *CidMapName(const struct cidmap *map,int cid) {
+    uint32_t off;
+
+    if ( map->data==NULL || cid<0 || cid>map->namemax )
+return( NULL );
+    off = cidmap_array(map->data,map->data->names)[cid];
+return( off==0 ? NULL : ((const char *) map->data) + off );
+}
+
+static uint32_t cidmap_hashsize(int cnt) {
+    uint32_t size = 16;
+
+    while ( size<2*(uint32_t) cnt )
+	size <<= 1;
+return( size );
+}
+
+/* Alternate unicode code points of a cid, in the order of the file */
+struct cidmapalt { uint32_t cid, uni; };
+
+struct cidmapaltsort { struct cidmapalt alt; int pos; };
+
+static int cidmapalt_cmp(const void *_a1, const void *_a2) {
+    const struct cidmapaltsort *a1 = _a1, *a2 = _a2;
+
+    if ( a1->alt.cid!=a2->alt.cid )
+return( a1->alt.cid<a2->alt.cid ? -1 : 1 );
+return( a1->pos-a2->pos );	/* Keep file order within a cid */
+}
+
+static struct cidmapdata *CidMapCompile(int cidmax,int namemax,uint32_t *unicode,
+	char **names,struct cidmapalt *alts,int alt_cnt,const char *src,
+	struct stat *st) {
+    struct cidmapdata hdr, *data;
+    uint32_t *ua, *na, *uh, *nh, h, mask;
+    struct cidmapaltsort *sorted;
+    struct cidmapalt *sa;
+    size_t len, slen;
+    uint8_t *base;
+    char *spt;
+    int i;
+
+    memset(&hdr,0,sizeof(hdr));
+    memcpy(hdr.magic,CIDMAP_MAGIC,8);
+    hdr.byteorder = CIDMAP_BYTEORDER;
+    hdr.version = CIDMAP_VERSION;
+    hdr.cidmax = cidmax;
+    hdr.namemax = namemax;
+    if ( st!=NULL ) {
+	hdr.src_size = st->st_size;
+	hdr.src_mtime = st->st_mtime;
+    }
+    hdr.unihash_size = cidmap_hashsize(namemax+alt_cnt);
+    hdr.namehash_size = cidmap_hashsize(namemax);
+
+    len = sizeof(hdr);
+    hdr.unicode = len;	len += (namemax+1)*sizeof(uint32_t);
+    hdr.names = len;	len += (namemax+1)*sizeof(uint32_t);
+    hdr.alts = len;	len += 2*alt_cnt*sizeof(uint32_t);
+    hdr.alt_cnt = alt_cnt;
+    hdr.unihash = len;	len += 2*hdr.unihash_size*sizeof(uint32_t);
+    hdr.namehash = len;	len += hdr.namehash_size*sizeof(uint32_t);
+    hdr.strings = len;
+    slen = strlen(src)+1;
+    for ( i=0; i<=namemax; ++i )
+	if ( names[i]!=NULL )
+	    slen += strlen(names[i])+1;
+    len += slen;
+    hdr.len = len;
+
+    base = calloc(1,len);
+    data = (struct cidmapdata *) base;
+    *data = hdr;
+    ua = (uint32_t *) (base+hdr.unicode);
+    na = (uint32_t *) (base+hdr.names);
+    uh = (uint32_t *) (base+hdr.unihash);
+    nh = (uint32_t *) (base+hdr.namehash);
+    memcpy(ua,unicode,(namemax+1)*sizeof(uint32_t));
+
+    spt = (char *) (base+hdr.strings);
+    strcpy(spt,src);
+    data->src_path = hdr.strings;
+    spt += strlen(src)+1;
+    for ( i=0; i<=namemax; ++i ) if ( names[i]!=NULL ) {
+	na[i] = spt-(char *) base;
+	strcpy(spt,names[i]);
+	spt += strlen(names[i])+1;
+    }
+
+    sorted = malloc((alt_cnt+1)*sizeof(struct cidmapaltsort));
+    for ( i=0; i<alt_cnt; ++i ) {
+	sorted[i].alt = alts[i];
+	sorted[i].pos = i;
+    }
+    qsort(sorted,alt_cnt,sizeof(struct cidmapaltsort),cidmapalt_cmp);
+    sa = (struct cidmapalt *) (base+hdr.alts);
+    for ( i=0; i<alt_cnt; ++i )
+	sa[i] = sorted[i].alt;
+    free(sorted);
+
+    /* The first cid with a given code point wins, and failing that, the */
+    /*  last alternate in the file */
+    mask = hdr.unihash_size-1;
+    for ( i=0; i<2*(int) hdr.unihash_size; i+=2 )
+	uh[i+1] = CIDMAP_EMPTY;
+    for ( i=0; i<namemax+alt_cnt; ++i ) {
+	uint32_t uni = i<namemax ? unicode[i] : alts[alt_cnt-1-(i-namemax)].uni;
+	uint32_t cid = i<namemax ? (uint32_t) i : alts[alt_cnt-1-(i-namemax)].cid;
+	for ( h=cidmap_unihash(uni)&mask; uh[2*h+1]!=CIDMAP_EMPTY && uh[2*h]!=uni; h=(h+1)&mask );
+	if ( uh[2*h+1]==CIDMAP_EMPTY ) {
+	    uh[2*h] = uni;
+	    uh[2*h+1] = cid;
+	}
+    }
+    mask = hdr.namehash_size-1;
+    for ( i=0; i<(int) hdr.namehash_size; ++i )
+	nh[i] = CIDMAP_EMPTY;
+    for ( i=0; i<namemax; ++i ) if ( names[i]!=NULL ) {
+	for ( h=cidmap_namehash(names[i])&mask;
+		nh[h]!=CIDMAP_EMPTY && strcmp(names[nh[h]],names[i])!=0; h=(h+1)&mask );
+	if ( nh[h]==CIDMAP_EMPTY )
+	    nh[h] = i;
+    }
+return( data );
+}
+
+/* Checks a block read from the cache before we trust its offsets */
+static int CidMapValid(const struct cidmapdata *data,size_t len) {
+    const uint32_t *na;
+    uint32_t i;
+
+    if ( len<sizeof(struct cidmapdata) || memcmp(data->magic,CIDMAP_MAGIC,8)!=0 ||
+	    data->byteorder!=CIDMAP_BYTEORDER || data->version!=CIDMAP_VERSION ||
+	    data->len!=len || data->namemax>=0x10000000 ||
+	    data->alt_cnt>=0x10000000 || data->unihash_size>=0x10000000 ||
+	    data->namehash_size>=0x10000000 ||
+	    (data->unihash_size&(data->unihash_size-1))!=0 || data->unihash_size==0 ||
+	    (data->namehash_size&(data->namehash_size-1))!=0 || data->namehash_size==0 )
+return( false );
+    if ( data->unicode!=sizeof(struct cidmapdata) ||
+	    data->names!=data->unicode+(data->namemax+1)*sizeof(uint32_t) ||
+	    data->alts!=data->names+(data->namemax+1)*sizeof(uint32_t) ||
+	    data->unihash!=data->alts+2*data->alt_cnt*sizeof(uint32_t) ||
+	    data->namehash!=data->unihash+2*data->unihash_size*sizeof(uint32_t) ||
+	    data->strings!=data->namehash+data->namehash_size*sizeof(uint32_t) ||
+	    data->strings>=len || ((const char *) data)[len-1]!='\0' ||
+	    data->src_path!=data->strings )
+return( false );
+    na = cidmap_array(data,data->names);
+    for ( i=0; i<=data->namemax; ++i )
+	if ( na[i]!=0 && (na[i]<data->strings || na[i]>=len) )
+return( false );
+return( true );
+}
+
+static void CidMapSetData(struct cidmap *map,const struct cidmapdata *data,int mapped) {
+    map->data = data;
+    map->datalen = data->len;
+    map->mapped = mapped;
+    map->cidmax = data->cidmax;
+    map->namemax = data->namemax;
+    map->unicode = cidmap_array(data,data->unicode);
+}
+
+static char *CidMapCacheName(const char *file) {
+    char *dir = getFontForgeUserDir(Cache), *ret;
+    const char *pt = strrchr(file,'/');
+
+    if ( dir==NULL )
+return( NULL );
+    pt = pt==NULL ? file : pt+1;
+    ret = smprintf("%s/cidmap/%s.bin", dir, pt);
+    free(dir);
+return( ret );
+}
+
+/* Maps in the compiled form of file, if the cache has an up to date one */
+static int CidMapFromCache(struct cidmap *map,const char *file,struct stat *st) {
+    char *cache = CidMapCacheName(file);
+    const struct cidmapdata *data = NULL;
+    int fd;
+    struct stat cst;
+    void *mem;
+
+    if ( cache==NULL )
+return( false );
+    fd = open(cache,O_RDONLY|O_BINARY);
+    free(cache);
+    if ( fd==-1 )
+return( false );
+    if ( fstat(fd,&cst)==-1 || cst.st_size<(off_t) sizeof(struct cidmapdata) ) {
+	close(fd);
+return( false );
+    }
+#if !defined(__MINGW32__)
+    mem = mmap(NULL,cst.st_size,PROT_READ,MAP_SHARED,fd,0);
+    if ( mem==MAP_FAILED )
+	mem = NULL;
+#else
+    mem = malloc(cst.st_size);
+    if ( read(fd,mem,cst.st_size)!=cst.st_size ) {
+	free(mem);
+	mem = NULL;
+    }
+#endif
+    close(fd);
+    if ( mem==NULL )
+return( false );
+    data = mem;
+    if ( !CidMapValid(data,cst.st_size) || data->src_size!=st->st_size ||
+	    data->src_mtime!=st->st_mtime ||
+	    strcmp(((const char *) data)+data->src_path,file)!=0 ) {
+#if !defined(__MINGW32__)
+	munmap(mem,cst.st_size);
+#else
+	free(mem);
+#endif
+return( false );
+    }
+#if !defined(__MINGW32__)
+    CidMapSetData(map,data,true);
+#else
+    CidMapSetData(map,data,false);
+#endif
+return( true );
+}
+
+static void CidMapToCache(const struct cidmapdata *data,const char *file) {
+    char *cache = CidMapCacheName(file), *tmp, *pt;
+    FILE *out;
+    int ok;
+
+    if ( cache==NULL )
+return;
+    pt = strrchr(cache,'/');
+    *pt = '\0';
+    GFileMkDir(cache, 0755);
+    *pt = '/';
+    /* Write it under another name first, so another process never maps */
+    /*  a partial file */
+    tmp = smprintf("%s.%d", cache, (int) getpid());
+    out = fopen(tmp,"wb");
+    if ( out!=NULL ) {
+	ok = fwrite(data,1,data->len,out)==data->len;
+	if ( fclose(out)!=0 )
+	    ok = false;
+	if ( !ok || rename(tmp,cache)!=0 )
+	    unlink(tmp);
+    }
+    free(tmp);
+    free(cache);
+}
+
 int CID2Uni(struct cidmap *map,int cid) {
     unsigned int uni;
+    const char *name;
 
     if ( map==NULL )
 return( -1 );
@@ -831,8 +1138,8 @@ return( -1 );
 return( 0 );
     else if ( cid<map->namemax && map->unicode[cid]!=0 )
 return( map->unicode[cid] );
-    else if ( cid<map->namemax && map->name[cid]!=NULL ) {
-	if ( sscanf(map->name[cid],"uni%x", &uni )==1 )
+    else if ( cid<map->namemax && (name = CidMapName(map,cid))!=NULL ) {
+	if ( sscanf(name,"uni%x", &uni )==1 )
 return( uni );
     }
 
@@ -845,8 +1152,8 @@ int CID2NameUni(struct cidmap *map,int cid, char *buffer, int len) {
 
     if ( map==NULL )
 	snprintf(buffer,len,"cid-%d", cid);
-    else if ( cid<map->namemax && map->name[cid]!=NULL ) {
-	strncpy(buffer,map->name[cid],len);
+    else if ( cid<map->namemax && (temp = CidMapName(map,cid))!=NULL ) {
+	strncpy(buffer,temp,len);
 	buffer[len-1] = '\0';
     } else if ( cid==0 )
 	strcpy(buffer,".notdef");
@@ -864,42 +1171,54 @@ return( enc );
 }
 
 int NameUni2CID(struct cidmap *map, int uni, const char *name) {
-    int i;
-    struct cidaltuni *alts;
+    const struct cidmapdata *data;
+    const uint32_t *tab;
+    uint32_t h, mask;
 
-    if ( map==NULL )
-		return( -1 );
+    if ( map==NULL || (data = map->data)==NULL )
+return( -1 );
     if ( uni!=-1 ) {
-		// Search for a matching code.
-		for ( i=0; i<map->namemax; ++i )
-		    if ( map->unicode[i]==(uint32_t)uni )
-				return( i );
-		for ( alts=map->alts; alts!=NULL; alts=alts->next )
-		    if ( alts->uni==uni )
-				return( alts->cid );
-    } else {
-	// Search for a matching name.
-	if ( name!=NULL )
-	    for ( i=0; i<map->namemax; ++i )
-		if ( map->name[i]!=NULL && strcmp(map->name[i],name)==0 )
-		    return( i );
+	tab = cidmap_array(data,data->unihash);
+	mask = data->unihash_size-1;
+	for ( h=cidmap_unihash(uni)&mask; tab[2*h+1]!=CIDMAP_EMPTY; h=(h+1)&mask )
+	    if ( tab[2*h]==(uint32_t) uni )
+return( tab[2*h+1]<=data->namemax ? (int) tab[2*h+1] : -1 );
+    } else if ( name!=NULL ) {
+	tab = cidmap_array(data,data->namehash);
+	mask = data->namehash_size-1;
+	for ( h=cidmap_namehash(name)&mask; tab[h]!=CIDMAP_EMPTY; h=(h+1)&mask ) {
+	    const char *test = CidMapName(map,tab[h]);
+	    if ( test!=NULL && strcmp(test,name)==0 )
+return( tab[h] );
+	}
     }
-	return( -1 );
+return( -1 );
 }
 
 struct altuni *CIDSetAltUnis(struct cidmap *map,int cid) {
     /* Some CIDs are mapped to several unicode code points, damn it */
     struct altuni *sofar = NULL, *alt;
-    struct cidaltuni *alts;
+    const struct cidmapalt *alts;
+    int lo, hi, mid;
 
-    for ( alts=map->alts; alts!=NULL; alts=alts->next ) {
-	if ( alts->cid==cid ) {
-	    alt = chunkalloc(sizeof(struct altuni));
-	    alt->next = sofar;
-	    sofar = alt;
-	    alt->unienc = alts->uni;
-	    alt->vs = -1;
-	}
+    if ( map->data==NULL || cid<0 )
+return( NULL );
+    alts = (const struct cidmapalt *) cidmap_array(map->data,map->data->alts);
+    lo = 0; hi = map->data->alt_cnt;
+    while ( lo<hi ) {
+	mid = (lo+hi)/2;
+	if ( alts[mid].cid<(uint32_t) cid )
+	    lo = mid+1;
+	else
+	    hi = mid;
+    }
+    for ( hi=lo; hi<(int) map->data->alt_cnt && alts[hi].cid==(uint32_t) cid; ++hi );
+    while ( --hi>=lo ) {
+	alt = chunkalloc(sizeof(struct altuni));
+	alt->next = sofar;
+	sofar = alt;
+	alt->unienc = alts[hi].uni;
+	alt->vs = -1;
     }
 return( sofar );
 }
@@ -970,14 +1289,12 @@ return( NULL );
 }
 
 static struct cidmap *MakeDummyMap(char *registry,char *ordering,int supplement) {
-    struct cidmap *ret = malloc(sizeof(struct cidmap));
+    struct cidmap *ret = calloc(1,sizeof(struct cidmap));
 
     ret->registry = copy(registry);
     ret->ordering = copy(ordering);
     ret->supplement = ret->maxsupple = supplement;
     ret->cidmax = ret->namemax = 0;
-    ret->unicode = NULL; ret->name = NULL;
-    ret->alts = NULL;
     ret->next = cidmaps;
     cidmaps = ret;
 return( ret );
@@ -985,11 +1302,18 @@ return( ret );
 
 struct cidmap *LoadMapFromFile(char *file,char *registry,char *ordering,
 	int supplement) {
-    struct cidmap *ret = malloc(sizeof(struct cidmap));
+    struct cidmap *ret = calloc(1,sizeof(struct cidmap));
     char *pt = strrchr(file,'.');
     FILE *f;
     int cid1, cid2, uni, cnt, i, ch;
+    int cidmax, namemax;
     char name[100];
+    uint32_t *unicode;
+    char **names;
+    struct cidmapalt *alts = NULL;
+    int alt_cnt = 0, alt_max = 0;
+    struct stat st;
+    int have_st;
 
     while ( pt>file && isdigit(pt[-1]))
 	--pt;
@@ -998,52 +1322,64 @@ struct cidmap *LoadMapFromFile(char *file,char *registry,char *ordering,
 	ret->maxsupple = supplement;
     ret->registry = copy(registry);
     ret->ordering = copy(ordering);
-    ret->alts = NULL;
     ret->cidmax = ret->namemax = 0;
-    ret->unicode = NULL; ret->name = NULL;
     ret->next = cidmaps;
     cidmaps = ret;
 
+    have_st = stat(file,&st)==0;
+    if ( have_st && CidMapFromCache(ret,file,&st) )
+return( ret );
+
     f = fopen( file,"r" );
     if ( f==NULL ) {
 	ff_post_error(_("Missing cidmap file"),_("Couldn't open cidmap file: %s"), file );
-    } else if ( fscanf( f, "%d %d", &ret->cidmax, &ret->namemax )!=2 ) {
+    } else if ( fscanf( f, "%d %d", &cidmax, &namemax )!=2 || namemax<0 ) {
 	ff_post_error(_("Bad cidmap file"),_("%s is not a cidmap file, please download\nhttp://fontforge.sourceforge.net/cidmaps.tgz"), file );
 	fprintf( stderr, _("%s is not a cidmap file, please download\nhttp://fontforge.sourceforge.net/cidmaps.tgz"), file );
 	fclose(f);
     } else {
-	ret->unicode = calloc(ret->namemax+1,sizeof(uint32_t));
-	ret->name = calloc(ret->namemax+1,sizeof(char *));
+	unicode = calloc(namemax+1,sizeof(uint32_t));
+	names = calloc(namemax+1,sizeof(char *));
 	while ( 1 ) {
 	    cnt=fscanf( f, "%d..%d %x", &cid1, &cid2, (unsigned *) &uni );
 	    if ( cnt<=0 )
 	break;
-	    if ( cid1>ret->namemax )
+	    if ( cid1>namemax || cid1<0 )
 	continue;
 	    if ( cnt==3 ) {
-		if ( cid2>ret->namemax ) cid2 = ret->namemax;
+		if ( cid2>namemax ) cid2 = namemax;
 		for ( i=cid1; i<=cid2; ++i )
-		    ret->unicode[i] = uni++;
+		    unicode[i] = uni++;
 	    } else if ( cnt==1 ) {
 		if ( fscanf(f,"%x", (unsigned *) &uni )==1 ) {
-		    ret->unicode[cid1] = uni;
+		    unicode[cid1] = uni;
 		    ch = getc(f);
 		    while ( ch==',' ) {
 			if ( fscanf(f,"%x", (unsigned *) &uni )==1 ) {
-			    struct cidaltuni *alt = chunkalloc(sizeof(struct cidaltuni));
-			    alt->next = ret->alts;
-			    ret->alts = alt;
-			    alt->uni = uni;
-			    alt->cid = cid1;
+			    if ( alt_cnt>=alt_max )
+				alts = realloc(alts,(alt_max += 100+alt_max)*sizeof(struct cidmapalt));
+			    alts[alt_cnt].uni = uni;
+			    alts[alt_cnt++].cid = cid1;
 			}
 			ch = getc(f);
 		    }
 		    ungetc(ch,f);
-		} else if ( fscanf(f," /%s", name )==1 )
-		    ret->name[cid1] = copy(name);
+		} else if ( fscanf(f," /%99s", name )==1 ) {
+		    free(names[cid1]);
+		    names[cid1] = copy(name);
+		}
 	    }
 	}
 	fclose(f);
+	CidMapSetData(ret,CidMapCompile(cidmax,namemax,unicode,names,alts,alt_cnt,
+		file,have_st ? &st : NULL),false);
+	if ( have_st )
+	    CidMapToCache(ret->data,file);
+	for ( i=0; i<=namemax; ++i )
+	    free(names[i]);
+	free(names);
+	free(unicode);
+	free(alts);
     }
 return( ret );
 }
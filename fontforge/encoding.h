@@ -4,20 +4,17 @@
 #include "baseviews.h"
 #include "splinefont.h"
 
-struct cidaltuni {
-    struct cidaltuni *next;
-    int uni;
-    int cid;
-};
+struct cidmapdata;
 
 struct cidmap {
     char *registry, *ordering;
     int supplement, maxsupple;
     int cidmax;			/* Max cid found in the charset */
     int namemax;		/* Max cid with useful info */
-    uint32_t *unicode;
-    char **name;
-    struct cidaltuni *alts;
+    const uint32_t *unicode;	/* Within data */
+    const struct cidmapdata *data;	/* Compiled form of the file, see encoding.c */
+    size_t datalen;
+    unsigned int mapped: 1;	/* data is mapped from the cache, not malloced */
     struct cidmap *next;
 };
 
@@ -38,6 +38,7 @@
 #include "gfile.h"
 #include "glif_name_hash.h"
 #include "lookups.h"
+#include "namehash.h"
 #include "namelist.h"
 #include "splinesaveafm.h" // for SCWorthOutputting
 #include "splineutil.h"
@@ -1045,62 +1046,94 @@ static int SameBaseAP(SplineChar *sc1,SplineChar *sc2,struct lookup_subtable *su
     return AsymmetricSameBaseAP(sc1,sc2,sub) && AsymmetricSameBaseAP(sc2,sc1,sub);
 }
 
-static void dump_anchors(FILE *out,SplineFont *sf,struct lookup_subtable *sub) {
-    int i, j, k;
-    SplineFont *_sf;
+/* The glyph data belonging to each subtable, gathered in one pass over the */
+/*  font so that dumping a lookup doesn't mean rescanning every glyph for  */
+/*  each of its subtables */
+enum fea_dumpkind { fdk_pst, fdk_kern, fdk_vkern };
+
+struct fea_dumpentry {
+    SplineChar *sc;
+    void *data;				/* PST or KernPair */
+    int kind;
+};
+
+struct fea_dumpanchored {
+    SplineChar *sc;
+    int subfont;
+};
+
+struct fea_dumpsub {
+    struct lookup_subtable *sub;
+    struct fea_dumpentry *entries;	/* In glyph order */
+    int cnt, max;
+    struct fea_dumpanchored *anchored;	/* Glyphs with anchor points in the subtable */
+    int acnt, amax;
+};
+
+struct fea_dumpindex {
+    struct fea_dumpsub *subs;		/* By subtable_offset */
+    int sub_cnt;
+    int fast;				/* Don't gather glyphs which share anchors */
+};
+
+static struct fea_dumpsub *fea_dumpsub(struct fea_dumpindex *di,struct lookup_subtable *sub) {
+    if ( sub==NULL || sub->subtable_offset<0 || sub->subtable_offset>=di->sub_cnt ||
+	    di->subs[sub->subtable_offset].sub!=sub )
+return( NULL );
+return( &di->subs[sub->subtable_offset] );
+}
+
+static void dump_anchors(FILE *out,SplineFont *sf,struct lookup_subtable *sub,
+	struct fea_dumpindex *di) {
+    int a, b, j, k;
     SplineChar *sc;
     AnchorClass *ac;
     AnchorPoint *ap, *ap_entry, *ap_exit;
+    struct fea_dumpsub *ds = fea_dumpsub(di,sub);
 
+    if ( ds==NULL )
+return;
     for ( ac = sf->anchor; ac!=NULL; ac=ac->next ) if ( ac->subtable==sub ) {
 	if ( sub->lookup->lookup_type==gpos_cursive ) {
-	    k=0;
-	    do {
-		_sf = k<sf->subfontcnt ? sf->subfonts[k] : sf;
-		for ( i=0; i<_sf->glyphcnt; ++i ) if ( (sc=_sf->glyphs[i])!=NULL ) {
-		    ap_entry = ap_exit = NULL;
-		    for ( ap=sc->anchor; ap!=NULL; ap=ap->next ) if ( ap->anchor==ac ) {
-			if ( ap->type == at_centry )
-			    ap_entry = ap;
-			else if ( ap->type == at_cexit )
-			    ap_exit = ap;
-		    }
-		    if ( ap_entry!=NULL || ap_exit!=NULL ) {
-			fprintf( out, "    pos cursive " );
-			dump_glyphname(out,sc);
-			putc(' ',out);
-			dump_anchorpoint(out,ap_entry);
-			putc(' ',out);
-			dump_anchorpoint(out,ap_exit);
-			putc(';',out);
-			putc('\n',out);
-		    }
+	    for ( a=0; a<ds->acnt; ++a ) {
+		sc = ds->anchored[a].sc;
+		ap_entry = ap_exit = NULL;
+		for ( ap=sc->anchor; ap!=NULL; ap=ap->next ) if ( ap->anchor==ac ) {
+		    if ( ap->type == at_centry )
+			ap_entry = ap;
+		    else if ( ap->type == at_cexit )
+			ap_exit = ap;
+		}
+		if ( ap_entry!=NULL || ap_exit!=NULL ) {
+		    fprintf( out, "    pos cursive " );
+		    dump_glyphname(out,sc);
+		    putc(' ',out);
+		    dump_anchorpoint(out,ap_entry);
+		    putc(' ',out);
+		    dump_anchorpoint(out,ap_exit);
+		    putc(';',out);
+		    putc('\n',out);
 		}
-		++k;
-	    } while ( k<sf->subfontcnt );
+	    }
 	} else {
 	    struct amarks { SplineChar *sc; AnchorPoint *ap; } *marks = NULL;
 	    int cnt, max;
 	    cnt = max = 0;
-	    k=0;
 	    /* Gather all the marks in this class */
-	    do {
-		_sf = k<sf->subfontcnt ? sf->subfonts[k] : sf;
-		for ( i=0; i<_sf->glyphcnt; ++i ) if ( (sc=_sf->glyphs[i])!=NULL ) {
-		    for ( ap=sc->anchor; ap!=NULL; ap=ap->next ) {
-			if ( ap->anchor==ac && ap->type==at_mark ) {
-			    if ( cnt>=max )
-				marks = realloc(marks,(max+=20)*sizeof(struct amarks));
-			    marks[cnt].sc = sc;
-			    marks[cnt].ap = ap;
-			    sc->ticked = false;
-			    ++cnt;
-		    break;
-			}
+	    for ( a=0; a<ds->acnt; ++a ) {
+		sc = ds->anchored[a].sc;
+		for ( ap=sc->anchor; ap!=NULL; ap=ap->next ) {
+		    if ( ap->anchor==ac && ap->type==at_mark ) {
+			if ( cnt>=max )
+			    marks = realloc(marks,(max+=20)*sizeof(struct amarks));
+			marks[cnt].sc = sc;
+			marks[cnt].ap = ap;
+			sc->ticked = false;
+			++cnt;
+		break;
 		    }
 		}
-		++k;
-	    } while ( k<sf->subfontcnt );
+	    }
 	    if ( cnt==0 )
     continue;		/* No marks? Nothing to be done */
 	    /* Now output the marks */
@@ -1108,7 +1141,7 @@ static void dump_anchors(FILE *out,SplineFont *sf,struct lookup_subtable *sub) {
 		SplineChar *osc;
 		ap = marks[k].ap;
 		fprintf( out, "  markClass [" );
-		for ( j=k; j<cnt; ++j ) if ( !(osc = marks[j].sc)->ticked ) {
+		for ( j=k; j<(di->fast ? k+1 : cnt); ++j ) if ( !(osc = marks[j].sc)->ticked ) {
 		    AnchorPoint *other = marks[j].ap;
 		    if ( other->me.x == ap->me.x && other->me.y == ap->me.y &&
 			    (other->has_ttf_pt == ap->has_ttf_pt &&
@@ -1132,78 +1165,72 @@ static void dump_anchors(FILE *out,SplineFont *sf,struct lookup_subtable *sub) {
     if ( sub->lookup->lookup_type==gpos_cursive )
 return;
 
-    k=0;
-    do {
-	_sf = k<sf->subfontcnt ? sf->subfonts[k] : sf;
-	for ( i=0; i<_sf->glyphcnt; ++i ) if ( (sc=_sf->glyphs[i])!=NULL ) {
-	    sc->ticked = false;
-	}
-	++k;
-    } while ( k<sf->subfontcnt );
-    k=0;
-    do {
-	_sf = k<sf->subfontcnt ? sf->subfonts[k] : sf;
-	for ( i=0; i<_sf->glyphcnt; ++i ) {
-	    if ( (sc=_sf->glyphs[i])!=NULL && !sc->ticked && HasBaseAP(sc,sub)) {
-		fprintf( out, "  pos %s ",
-			sub->lookup->lookup_type==gpos_mark2base ? "base" :
-			sub->lookup->lookup_type==gpos_mark2mark ? "mark" :
-			"ligature" );
-		if ( sub->lookup->lookup_type!=gpos_mark2ligature ) {
-		    putc('[',out);
-		    for ( j=i; j<_sf->glyphcnt; ++j ) {
-			SplineChar *osc;
-			if ( (osc=_sf->glyphs[j])!=NULL && !osc->ticked && SameBaseAP(osc,sc,sub)) {
-			    osc->ticked = true;
-			    dump_glyphname(out,osc);
-			    putc(' ',out);
-			}
+    for ( a=0; a<ds->acnt; ++a )
+	ds->anchored[a].sc->ticked = false;
+    for ( a=0; a<ds->acnt; ++a ) {
+	sc = ds->anchored[a].sc;
+	if ( !sc->ticked && HasBaseAP(sc,sub)) {
+	    fprintf( out, "  pos %s ",
+		    sub->lookup->lookup_type==gpos_mark2base ? "base" :
+		    sub->lookup->lookup_type==gpos_mark2mark ? "mark" :
+		    "ligature" );
+	    if ( sub->lookup->lookup_type!=gpos_mark2ligature ) {
+		putc('[',out);
+		/* Any glyph with the same base anchors must also have some */
+		/*  anchor in this subtable, and be later in the same subfont */
+		for ( b=a; b<ds->acnt && ds->anchored[b].subfont==ds->anchored[a].subfont; ++b ) {
+		    SplineChar *osc = ds->anchored[b].sc;
+		    if ( !osc->ticked && SameBaseAP(osc,sc,sub)) {
+			osc->ticked = true;
+			dump_glyphname(out,osc);
+			putc(' ',out);
 		    }
-		    fprintf(out, "] " );
-		} else {
-		    dump_glyphname(out,sc);
-		    putc(' ',out);
+		    if ( di->fast )
+		break;
 		}
-		if ( sub->lookup->lookup_type!=gpos_mark2ligature ) {
-		    int first = true;
-		    for ( ap = sc->anchor; ap!=NULL; ap=ap->next ) if ( ap->anchor->subtable==sub && ap->type!=at_mark ) {
-			if ( !first )
-			    fprintf(out,"\n\t");
-			first = false;
-			dump_anchorpoint(out,ap);
-			fprintf( out, " mark @");
-			dump_ascii(out, ap->anchor->name );
-		    }
-		    fprintf(out,";\n");
-		} else {
-		    int li, anymore=true, any;
-		    for ( li=0; anymore; ++li ) {
-			any = anymore = false;
-			for ( ap = sc->anchor; ap!=NULL; ap=ap->next ) if ( ap->anchor->subtable==sub ) {
-			    if ( ap->lig_index>li )
-				anymore = true;
-			    else if ( ap->lig_index==li ) {
-				if ( li!=0 && !any )
-				    fprintf( out, "\n    ligComponent\n      " );
-				dump_anchorpoint(out,ap);
-				fprintf( out, " mark @");
-				dump_ascii(out, ap->anchor->name );
-				putc( ' ',out );
-			        any = true;
-			    }
-			}
-			if ( !any && anymore ) {
-			    if ( li!=0 )
+		fprintf(out, "] " );
+	    } else {
+		dump_glyphname(out,sc);
+		putc(' ',out);
+	    }
+	    if ( sub->lookup->lookup_type!=gpos_mark2ligature ) {
+		int first = true;
+		for ( ap = sc->anchor; ap!=NULL; ap=ap->next ) if ( ap->anchor->subtable==sub && ap->type!=at_mark ) {
+		    if ( !first )
+			fprintf(out,"\n\t");
+		    first = false;
+		    dump_anchorpoint(out,ap);
+		    fprintf( out, " mark @");
+		    dump_ascii(out, ap->anchor->name );
+		}
+		fprintf(out,";\n");
+	    } else {
+		int li, anymore=true, any;
+		for ( li=0; anymore; ++li ) {
+		    any = anymore = false;
+		    for ( ap = sc->anchor; ap!=NULL; ap=ap->next ) if ( ap->anchor->subtable==sub ) {
+			if ( ap->lig_index>li )
+			    anymore = true;
+			else if ( ap->lig_index==li ) {
+			    if ( li!=0 && !any )
 				fprintf( out, "\n    ligComponent\n      " );
-			    fprintf( out, "<anchor NULL>" );	/* In adobe's example no anchor class is given */
+			    dump_anchorpoint(out,ap);
+			    fprintf( out, " mark @");
+			    dump_ascii(out, ap->anchor->name );
+			    putc( ' ',out );
+			    any = true;
 			}
 		    }
-                    fprintf(out,";\n");
+		    if ( !any && anymore ) {
+			if ( li!=0 )
+			    fprintf( out, "\n    ligComponent\n      " );
+			fprintf( out, "<anchor NULL>" );	/* In adobe's example no anchor class is given */
+		    }
 		}
+		fprintf(out,";\n");
 	    }
 	}
-	++k;
-    } while ( k<sf->subfontcnt );
+    }
 }
 
 static void number_subtables(SplineFont *sf) {
@@ -1220,6 +1247,76 @@ static void number_subtables(SplineFont *sf) {
     }
 }
 
+static void fea_dumpindex_add(struct fea_dumpsub *ds,SplineChar *sc,void *data,int kind) {
+    if ( ds->cnt>=ds->max )
+	ds->entries = realloc(ds->entries,(ds->max += 16+ds->max)*sizeof(struct fea_dumpentry));
+    ds->entries[ds->cnt].sc = sc;
+    ds->entries[ds->cnt].data = data;
+    ds->entries[ds->cnt++].kind = kind;
+}
+
+static void fea_dumpindex_build(struct fea_dumpindex *di,SplineFont *sf,int fast) {
+    OTLookup *otl;
+    struct lookup_subtable *sub;
+    struct fea_dumpsub *ds;
+    SplineFont *_sf;
+    SplineChar *sc;
+    PST *pst;
+    KernPair *kp;
+    AnchorPoint *ap;
+    int isgpos, cnt, i, k, isv;
+
+    number_subtables(sf);
+    cnt = 0;
+    for ( isgpos=0; isgpos<2; ++isgpos )
+	for ( otl = isgpos ? sf->gpos_lookups : sf->gsub_lookups; otl!=NULL; otl = otl->next )
+	    for ( sub = otl->subtables; sub!=NULL; sub=sub->next )
+		++cnt;
+    di->sub_cnt = cnt;
+    di->subs = calloc(cnt+1,sizeof(struct fea_dumpsub));
+    di->fast = fast;
+    for ( isgpos=0; isgpos<2; ++isgpos )
+	for ( otl = isgpos ? sf->gpos_lookups : sf->gsub_lookups; otl!=NULL; otl = otl->next )
+	    for ( sub = otl->subtables; sub!=NULL; sub=sub->next )
+		di->subs[sub->subtable_offset].sub = sub;
+
+    k=0;
+    do {
+	_sf = k<sf->subfontcnt ? sf->subfonts[k] : sf;
+	for ( i=0; i<_sf->glyphcnt; ++i ) if ( (sc=_sf->glyphs[i])!=NULL ) {
+	    for ( pst=sc->possub; pst!=NULL; pst=pst->next )
+		if ( (ds = fea_dumpsub(di,pst->subtable))!=NULL )
+		    fea_dumpindex_add(ds,sc,pst,fdk_pst);
+	    for ( isv=0; isv<2; ++isv ) {
+		for ( kp=isv ? sc->vkerns : sc->kerns; kp!=NULL; kp=kp->next )
+		    if ( (ds = fea_dumpsub(di,kp->subtable))!=NULL )
+			fea_dumpindex_add(ds,sc,kp,isv ? fdk_vkern : fdk_kern);
+	    }
+	    for ( ap=sc->anchor; ap!=NULL; ap=ap->next ) {
+		if ( ap->anchor==NULL || (ds = fea_dumpsub(di,ap->anchor->subtable))==NULL )
+	    continue;
+		if ( ds->acnt!=0 && ds->anchored[ds->acnt-1].sc==sc )
+	    continue;
+		if ( ds->acnt>=ds->amax )
+		    ds->anchored = realloc(ds->anchored,(ds->amax += 16+ds->amax)*sizeof(struct fea_dumpanchored));
+		ds->anchored[ds->acnt].sc = sc;
+		ds->anchored[ds->acnt++].subfont = k;
+	    }
+	}
+	++k;
+    } while ( k<sf->subfontcnt );
+}
+
+static void fea_dumpindex_free(struct fea_dumpindex *di) {
+    int i;
+
+    for ( i=0; i<di->sub_cnt; ++i ) {
+	free(di->subs[i].entries);
+	free(di->subs[i].anchored);
+    }
+    free(di->subs);
+}
+
 static int fea_bad_contextual_nestedlookup(SplineFont *sf,FPST *fpst, OTLookup *nested) {
     int gid, k;
     SplineFont *_sf;
@@ -1293,9 +1390,10 @@ return( true );
     }
 }
 
-static void dump_lookup(FILE *out, SplineFont *sf, OTLookup *otl);
+static void dump_lookup(FILE *out, SplineFont *sf, OTLookup *otl, struct fea_dumpindex *di);
 
-static void dump_needednestedlookups(FILE *out, SplineFont *sf, OTLookup *otl) {
+static void dump_needednestedlookups(FILE *out, SplineFont *sf, OTLookup *otl,
+	struct fea_dumpindex *di) {
     struct lookup_subtable *sub;
     int r, s, n;
     /* So we cheat, and extend the fea format to allow us to specify a lookup */
@@ -1324,7 +1422,7 @@ static void dump_needednestedlookups(FILE *out, SplineFont *sf, OTLookup *otl) {
 		for ( s=0; s<fpst->rules[r].lookup_cnt; ++s ) {
 		    OTLookup *nested = fpst->rules[r].lookups[s].lookup;
 		    if ( nested!=NULL && nested->features==NULL && !nested->ticked )
-			dump_lookup(out,sf,nested);
+			dump_lookup(out,sf,nested,di);
 		}
 	    } else if ( fpst->rules[r].lookup_cnt==1 ) {
 		OTLookup *nested = fpst->rules[r].lookups[0].lookup;
@@ -1334,17 +1432,17 @@ static void dump_needednestedlookups(FILE *out, SplineFont *sf, OTLookup *otl) {
 /*  expressed inline */
 			(nested->lookup_length>1 ||
 			 fea_bad_contextual_nestedlookup(sf,fpst,nested)))
-		    dump_lookup(out,sf,nested);
+		    dump_lookup(out,sf,nested,di);
 	    }
 	}
     }
 }
 
-static void dump_lookup(FILE *out, SplineFont *sf, OTLookup *otl) {
+static void dump_lookup(FILE *out, SplineFont *sf, OTLookup *otl, struct fea_dumpindex *di) {
     struct lookup_subtable *sub;
     static char *flagnames[] = { "RightToLeft", "IgnoreBaseGlyphs", "IgnoreLigatures", "IgnoreMarks", NULL };
-    int i, k;
-    SplineFont *_sf;
+    int i, e;
+    struct fea_dumpsub *ds;
     SplineChar *sc;
     PST *pst;
     int isv;
@@ -1358,10 +1456,9 @@ return;					/* No support for apple "lookups" */
 
     if ( otl->lookup_type==gsub_context || otl->lookup_type==gsub_contextchain ||
 	    otl->lookup_type==gpos_context || otl->lookup_type==gpos_contextchain )
-	dump_needednestedlookups(out,sf,otl);
+	dump_needednestedlookups(out,sf,otl,di);
 
     if ( sf->cidmaster ) sf = sf->cidmaster;
-    number_subtables(sf);
 
     fprintf( out, "\nlookup %s {\n", lookupname(otl) );
     if ( otl->lookup_flags==0 || (otl->lookup_flags&0xe0)!=0 )
@@ -1397,95 +1494,91 @@ return;					/* No support for apple "lookups" */
 	else if ( sub->fpst!=NULL )
 	    dump_contextpst(out,sf,sub);
 	else if ( sub->anchor_classes )
-	    dump_anchors(out,sf,sub);
-	else {
-	    k=0;
-	    do {
-		_sf = k<sf->subfontcnt ? sf->subfonts[k] : sf;
-		for ( i=0; i<_sf->glyphcnt; ++i ) if ( (sc=_sf->glyphs[i])!=NULL ) {
-		    for ( pst=sc->possub; pst!=NULL; pst=pst->next ) if ( pst->subtable==sub ) {
-			switch ( otl->lookup_type ) {
-			  case gsub_single:
-			  case gsub_multiple:
-			    fprintf( out, "    sub " );
-			    dump_glyphname(out,sc);
-			    fprintf( out, " by " );
-			    if (*(pst->u.subs.variant) != '\0') {
-				dump_glyphnamelist(out,sf,pst->u.subs.variant );
-			    } else {
-				fprintf( out, "NULL" ); // really possible! see GH: №4618
-			    }
-			    fprintf( out,";\n" );
-			  break;
-			  case gsub_alternate:
-			    fprintf( out, "    sub " );
-			    dump_glyphname(out,sc);
-			    fprintf( out, " from [" );
-			    dump_glyphnamelist(out,sf,pst->u.alt.components );
-			    fprintf( out,"];\n" );
-			  break;
-			  case gsub_ligature:
-			    fprintf( out, "    sub " );
-			    dump_glyphnamelist(out,sf,pst->u.lig.components );
-			    fprintf( out, " by " );
-			    dump_glyphname(out,sc);
-			    fprintf( out,";\n" );
-			  break;
-			  case gpos_single:
-			    fprintf( out, "    pos " );
-			    dump_glyphname(out,sc);
-			    putc(' ',out);
-			    dump_valuerecord(out,&pst->u.pos);
-			    fprintf( out,";\n" );
-			  break;
-			  case gpos_pair:
-			    fprintf( out, "    pos " );
-			    dump_glyphname(out,sc);
-			    putc(' ',out);
-			    dump_glyphnamelist(out,sf,pst->u.pair.paired );
-			    putc(' ',out);
-			    dump_valuerecord(out,&pst->u.pair.vr[0]);
-			    fprintf( out,";\n" );
-			  break;
-			  default:
-			    /* Eh? How'd we get here? An anchor class with */
-			    /* no anchors perhaps? */
-			  break;
+	    dump_anchors(out,sf,sub,di);
+	else if ( (ds = fea_dumpsub(di,sub))!=NULL ) {
+	    for ( e=0; e<ds->cnt; ++e ) {
+		sc = ds->entries[e].sc;
+		if ( ds->entries[e].kind==fdk_pst ) {
+		    pst = ds->entries[e].data;
+		    switch ( otl->lookup_type ) {
+		      case gsub_single:
+		      case gsub_multiple:
+			fprintf( out, "    sub " );
+			dump_glyphname(out,sc);
+			fprintf( out, " by " );
+			if (*(pst->u.subs.variant) != '\0') {
+			    dump_glyphnamelist(out,sf,pst->u.subs.variant );
+			} else {
+			    fprintf( out, "NULL" ); // really possible! see GH: №4618
 			}
+			fprintf( out,";\n" );
+		      break;
+		      case gsub_alternate:
+			fprintf( out, "    sub " );
+			dump_glyphname(out,sc);
+			fprintf( out, " from [" );
+			dump_glyphnamelist(out,sf,pst->u.alt.components );
+			fprintf( out,"];\n" );
+		      break;
+		      case gsub_ligature:
+			fprintf( out, "    sub " );
+			dump_glyphnamelist(out,sf,pst->u.lig.components );
+			fprintf( out, " by " );
+			dump_glyphname(out,sc);
+			fprintf( out,";\n" );
+		      break;
+		      case gpos_single:
+			fprintf( out, "    pos " );
+			dump_glyphname(out,sc);
+			putc(' ',out);
+			dump_valuerecord(out,&pst->u.pos);
+			fprintf( out,";\n" );
+		      break;
+		      case gpos_pair:
+			fprintf( out, "    pos " );
+			dump_glyphname(out,sc);
+			putc(' ',out);
+			dump_glyphnamelist(out,sf,pst->u.pair.paired );
+			putc(' ',out);
+			dump_valuerecord(out,&pst->u.pair.vr[0]);
+			fprintf( out,";\n" );
+		      break;
+		      default:
+			/* Eh? How'd we get here? An anchor class with */
+			/* no anchors perhaps? */
+		      break;
 		    }
-		    // We skip outputting these here if the SplineFont says to use native kerning.
-		    if (sf->preferred_kerning != 1) for ( isv=0; isv<2; ++isv ) {
-			for ( kp=isv ? sc->vkerns : sc->kerns; kp!=NULL; kp=kp->next ) if ( kp->subtable==sub ) {
-			    fprintf( out, "    pos " );
-			    dump_glyphname(out,sc);
-			    putc(' ',out);
-			    if ( kp->adjust!=NULL ) {
-				/* If we have a device table then we must use the long */
-			        /* format */
-				if ( isv ) {
-				    fprintf( out," < 0 0 0 %d <device NULL> <device NULL> <device NULL> ",
-					    kp->off );
-				    dumpdevice(out,kp->adjust);
-			            fprintf( out, " > " );
-			            dump_glyphname(out,kp->sc);
-			            fprintf( out, " < 0 0 0 0 >;\n" );
-				} else {
-				    fprintf( out," < 0 0 %d 0 <device NULL> <device NULL> ",
-					    kp->off );
-				    dumpdevice(out,kp->adjust);
-			            fprintf( out, " <device NULL>> " );
-			            dump_glyphname(out,kp->sc);
-			            fprintf( out, " < 0 0 0 0 >;\n" );
-				}
-			    } else
+		// We skip outputting these here if the SplineFont says to use native kerning.
+		} else if ( sf->preferred_kerning != 1 ) {
+		    kp = ds->entries[e].data;
+		    isv = ds->entries[e].kind==fdk_vkern;
+		    fprintf( out, "    pos " );
+		    dump_glyphname(out,sc);
+		    putc(' ',out);
+		    if ( kp->adjust!=NULL ) {
+			/* If we have a device table then we must use the long */
+			/* format */
+			if ( isv ) {
+			    fprintf( out," < 0 0 0 %d <device NULL> <device NULL> <device NULL> ",
+				    kp->off );
+			    dumpdevice(out,kp->adjust);
+			    fprintf( out, " > " );
 			    dump_glyphname(out,kp->sc);
-			    putc(' ',out);
-			    fprintf( out, "%d;\n", kp->off );
+			    fprintf( out, " < 0 0 0 0 >;\n" );
+			} else {
+			    fprintf( out," < 0 0 %d 0 <device NULL> <device NULL> ",
+				    kp->off );
+			    dumpdevice(out,kp->adjust);
+			    fprintf( out, " <device NULL>> " );
+			    dump_glyphname(out,kp->sc);
+			    fprintf( out, " < 0 0 0 0 >;\n" );
 			}
-		    }		/* End isv/kp loops */
+		    } else
+		    dump_glyphname(out,kp->sc);
+		    putc(' ',out);
+		    fprintf( out, "%d;\n", kp->off );
 		}
-		++k;
-	    } while ( k<sf->subfontcnt );
+	    }
 	}
     }				/* End subtables */
     fprintf( out, "} %s;\n", lookupname(otl) );
@@ -1525,15 +1618,18 @@ static void untick_lookups(SplineFont *sf) {
 	    otl->ticked = false;
 }
 
-void FeatDumpOneLookup(FILE *out,SplineFont *sf, OTLookup *otl) {
+void _FeatDumpOneLookup(FILE *out,SplineFont *sf, OTLookup *otl, int fast) {
     FeatureScriptLangList *fl;
     struct scriptlanglist *sl;
+    struct fea_dumpindex di;
     int l;
 
     untick_lookups(sf);
     gdef_markclasscheck(out,sf,otl);
 
-    dump_lookup(out,sf,otl);
+    fea_dumpindex_build(&di,sf->cidmaster!=NULL ? sf->cidmaster : sf,fast);
+    dump_lookup(out,sf,otl,&di);
+    fea_dumpindex_free(&di);
 
     for ( fl = otl->features; fl!=NULL; fl=fl->next ) {
 	fprintf( out, "\nfeature %c%c%c%c {\n", fl->featuretag>>24, fl->featuretag>>16, fl->featuretag>>8, fl->featuretag );
@@ -1552,6 +1648,10 @@ void FeatDumpOneLookup(FILE *out,SplineFont *sf, OTLookup *otl) {
     }
 }
 
+void FeatDumpOneLookup(FILE *out,SplineFont *sf, OTLookup *otl) {
+    _FeatDumpOneLookup(out,sf,otl,false);
+}
+
 static void dump_gdef(FILE *out,SplineFont *sf) {
     PST *pst;
     int i,gid,j,k,l, lcnt, needsclasses, hasclass[4], clsidx;
@@ -1791,7 +1891,7 @@ static void dump_header_languagesystem(FILE *out, SplineFont *sf) {
     fprintf( out, "\n" );
 }
 
-static void dump_gsubgpos(FILE *out, SplineFont *sf) {
+static void dump_gsubgpos(FILE *out, SplineFont *sf, struct fea_dumpindex *di) {
     int isgpos;
     int i,l,s, subl;
     OTLookup *otl;
@@ -1808,7 +1908,7 @@ static void dump_gsubgpos(FILE *out, SplineFont *sf) {
 	    note_nested_lookups_used_twice(isgpos ? sf->gpos_lookups : sf->gsub_lookups);
 	    for ( otl= isgpos ? sf->gpos_lookups : sf->gsub_lookups; otl!=NULL; otl=otl->next )
 		if ( otl->features!=NULL && !otl->unused )	/* Nested lookups will be output with the lookups which invoke them */
-		    dump_lookup( out, sf, otl );
+		    dump_lookup( out, sf, otl, di );
 	    for ( i=0; feats[i]!=0; ++i ) {
 		fprintf( out, "\nfeature %c%c%c%c {\n", feats[i]>>24, feats[i]>>16, feats[i]>>8, feats[i] );
 		if ( feats[i]>=CHR('s','s','0','1') &&  feats[i]<=CHR('s','s','2','0') &&
@@ -1972,7 +2072,8 @@ static void cleanupnames(SplineFont *sf) {
 	}
 }
 
-void FeatDumpFontLookups(FILE *out,SplineFont *sf) {
+void _FeatDumpFontLookups(FILE *out,SplineFont *sf,int fast) {
+    struct fea_dumpindex di;
 
     if ( sf->cidmaster!=NULL ) sf=sf->cidmaster;
 
@@ -1985,13 +2086,19 @@ void FeatDumpFontLookups(FILE *out,SplineFont *sf) {
     preparenames(sf);
     gdef_markclasscheck(out,sf,NULL);
     dump_header_languagesystem(out,sf);
-    dump_gsubgpos(out,sf);
+    fea_dumpindex_build(&di,sf,fast);
+    dump_gsubgpos(out,sf,&di);
+    fea_dumpindex_free(&di);
     dump_gdef(out,sf);
     dump_base(out,sf);
     cleanupnames(sf);
     switch_to_old_locale(&tmplocale, &oldlocale); // Switch to the cached locale.
 }
 
+void FeatDumpFontLookups(FILE *out,SplineFont *sf) {
+    _FeatDumpFontLookups(out,sf,false);
+}
+
 
 /* ************************************************************************** */
 /* ******************************* Parse feat ******************************* */
@@ -2101,116 +2208,6 @@ return( class );
 }
 
 
-static int fea_classesIntersect(char *class1, char *class2) {
-    char *pt1, *start1, *pt2, *start2;
-    int ch1, ch2;
-
-    struct glif_name_index * glif_name_hash = glif_name_index_new(); // Open the hash table.
-    long int index = 0;
-    long int break_point = 0;
-    int output = 0;
-    if (class1[0] == '\0' || class2[0] == '\0') return 0; // We cancel further action if one list is blank.
-    // Parse the first input.
-    for ( pt1=class1 ; output == 0 && pt1[0] != '\0'; ) {
-        while ( *pt1==' ' ) ++pt1;
-        for ( start1 = pt1; *pt1!=' ' && *pt1!='\0'; ++pt1 );
-        ch1 = *pt1; *pt1 = '\0'; // Cache the byte and terminate.
-        // We do not want to add the same name twice. It breaks the hash.
-        if (glif_name_search_glif_name(glif_name_hash, start1) == NULL) {
-          glif_name_track_new(glif_name_hash, index++, start1);
-        }
-        *pt1 = ch1; // Restore the byte.
-    }
-    break_point = index; // Divide the entries from the two sources by index.
-    // Parse the second input.
-    for ( pt2=class2 ; output == 0 && pt2[0] != '\0'; ) {
-        while ( *pt2==' ' ) ++pt2;
-        for ( start2 = pt2; *pt2!=' ' && *pt2!='\0'; ++pt2 );
-        ch2 = *pt2; *pt2 = '\0'; // Cache the byte and terminate.
-        struct glif_name * tmp = NULL;
-        if ((tmp = glif_name_search_glif_name(glif_name_hash, start2)) == NULL) {
-          glif_name_track_new(glif_name_hash, index++, start2);
-        } else if (tmp->gid < break_point) {
-          output = 1;
-        }
-        *pt2 = ch2; // Restore the byte.
-    }
-    glif_name_index_destroy(glif_name_hash); // Close the hash table.
-    if (output == 1) return 1;
-    return 0;
-}
-
-
-#define SKIP_SPACES(s, i)                       \
-    do {                                        \
-        while ((s)[i] == ' ')                   \
-            i++;                                \
-    }                                           \
-    while (0)
-
-#define FIND_SPACE(s, i)                        \
-    do {                                        \
-        while ((s)[i] != ' ' && (s)[i] != '\0') \
-            i++;                                \
-    }                                           \
-    while (0)
-
-
-static char *fea_classesSplit(char *class1, char *class2) {
-    char *intersection;
-    int len = strlen(class1), len2 = strlen(class2);
-    int ix;
-    int i, j, i_end, j_end;
-    int length;
-    int match_found;
-
-    if ( len2>len ) len = len2;
-    intersection = malloc(len+1);
-    ix = 0;
-
-    i = 0;
-    SKIP_SPACES(class1, i);
-    while (class1[i] != '\0') {
-        i_end = i;
-        FIND_SPACE(class1, i_end);
-
-        length = i_end - i;
-
-        match_found = 0;
-        j = 0;
-        SKIP_SPACES(class2, j);
-        while (!match_found && class2[j] != '\0') {
-            j_end = j;
-            FIND_SPACE(class2, j_end);
-
-            if (length == j_end - j && strncmp(class1 + i, class2 + j, length) == 0) {
-                match_found = 1;
-
-                if (ix != 0) {
-                    intersection[ix] = ' ';
-                    ix++;
-                }
-                memcpy(intersection + ix, class1 + i, length * sizeof (char));
-                ix += length;
-
-                SKIP_SPACES(class1, i_end);
-                memmove(class1 + i, class1 + i_end, (strlen(class1 + i_end) + 1) * sizeof (char));
-                SKIP_SPACES(class2, j_end);
-                memmove(class2 + j, class2 + j_end, (strlen(class2 + j_end) + 1) * sizeof (char));
-            } else {
-                j = j_end;
-                SKIP_SPACES(class2, j);
-            }
-        }
-        if (!match_found) {
-            i = i_end;
-            SKIP_SPACES(class1, i);
-        }
-    }
-    intersection[ix] = '\0';
-    return( intersection );
-}
-
 enum toktype { tk_name, tk_class, tk_int, tk_char, tk_cid, tk_eof,
 /* keywords */
 	       tk_firstkey,
@@ -2232,6 +2229,7 @@ enum toktype { tk_name, tk_class, tk_int, tk_char, tk_cid, tk_eof,
 struct glyphclasses {
     char *classname, *glyphs;
     struct glyphclasses *next;
+    struct glyphclasses *hnext;		/* Same bucket of parseState.class_hash */
 };
 
 struct namedanchor {
@@ -2255,9 +2253,17 @@ struct gpos_mark {
     char *glyphs;
     AnchorPoint *ap;
     struct gpos_mark *same, *next;
+    struct gpos_mark *hnext;		/* Same bucket of parseState.mark_hash */
     int name_used;	/* Same "markClass" can be used in any mark type lookup, or indeed in multiple lookups of the same type */
 } *gpos_mark;
 
+/* Feature files are read into memory whole and lexed from there, rather */
+/*  than a character at a time through stdio */
+struct fea_input {
+    char *buf;
+    size_t pos, len;
+};
+
 #define MAXT	80
 #define MAXI	5
 struct parseState {
@@ -2266,7 +2272,7 @@ struct parseState {
     enum toktype type;
     uint32_t tag;
     int could_be_tag;
-    FILE *inlist[MAXI];
+    struct fea_input inlist[MAXI];
     int inc_depth;
     int line[MAXI];
     char *filename[MAXI];
@@ -2281,6 +2287,7 @@ struct parseState {
     SplineFont *sf;
     struct scriptlanglist *def_langsyses;
     struct glyphclasses *classes; // TODO: This eventually needs to merge with the SplineFont group storage. For now, it needs to copy from it at first invocation.
+    struct glyphclasses *class_hash[GN_HSIZE];	/* The same classes, by name */
     struct namedanchor *namedAnchors;
     struct namedvalue *namedValueRs;
     struct feat_item *sofar;
@@ -2290,6 +2297,7 @@ struct parseState {
     int gm_cnt[2], gm_max[2], gm_pos[2];
     struct gdef_mark *gdef_mark[2];
     struct gpos_mark *gpos_mark;
+    struct gpos_mark *mark_hash[GN_HSIZE];
 };
 
 static struct keywords {
@@ -2389,10 +2397,35 @@ static struct tablekeywords os2_keys[] = {
 };
 
 
+static void fea_input_load(struct fea_input *in, FILE *file) {
+    size_t max = 0, n;
+
+    in->buf = NULL;
+    in->pos = in->len = 0;
+    for (;;) {
+	if ( in->len==max )
+	    in->buf = realloc(in->buf,max += max==0 ? 0x10000 : max);
+	n = fread(in->buf+in->len,1,max-in->len,file);
+	if ( n==0 )
+    break;
+	in->len += n;
+    }
+}
+
+static int fea_getc(struct fea_input *in) {
+return( in->pos<in->len ? (uint8_t) in->buf[in->pos++] : EOF );
+}
+
+static void fea_ungetc(int ch, struct fea_input *in) {
+    if ( ch!=EOF )
+	--in->pos;
+}
+
 static void fea_ParseTok(struct parseState *tok);
 
 static void fea_handle_include(struct parseState *tok) {
-    FILE *in;
+    struct fea_input *in;
+    FILE *file;
     char namebuf[1025], *pt, *filename, *filename_deprecated;
     int ch;
 
@@ -2403,18 +2436,18 @@ static void fea_handle_include(struct parseState *tok) {
 return;
     }
 
-    in = tok->inlist[tok->inc_depth];
-    ch = getc(in);
+    in = &tok->inlist[tok->inc_depth];
+    ch = fea_getc(in);
     while ( isspace(ch))
-	ch = getc(in);
+	ch = fea_getc(in);
     pt = namebuf;
     while ( ch!=EOF && ch!=')' && pt<namebuf+sizeof(namebuf)-1 ) {
 	*pt++ = ch;
-	ch = getc(in);
+	ch = fea_getc(in);
     }
     if ( ch!=EOF && ch!=')' ) {
 	while ( ch!=EOF && ch!=')' )
-	    ch = getc(in);
+	    ch = fea_getc(in);
 	LogError(_("Include filename too long on line %d of %s"), tok->line[tok->inc_depth], tok->filename[tok->inc_depth] );
 	++tok->err_count;
     }
@@ -2464,14 +2497,14 @@ return;
         }
     }
 
-    in = fopen(filename,"r");
-    if ( in==NULL ) {
+    file = fopen(filename,"r");
+    if ( file==NULL ) {
         if ( filename != filename_deprecated ) {
             free(filename);
             filename = filename_deprecated;
-            in = fopen(filename,"r");
+            file = fopen(filename,"r");
         }
-        if ( in == NULL ) {
+        if ( file == NULL ) {
             LogError(_("Could not open include file (%s) on line %d of %s"),
                      filename, tok->line[tok->inc_depth], tok->filename[tok->inc_depth]);
             ++tok->err_count;
@@ -2489,13 +2522,14 @@ future compatibility. (See GitHub issue №4629 for more info.)"), namebuf);
 
     ++tok->inc_depth;
     tok->filename[tok->inc_depth] = filename;
-    tok->inlist[tok->inc_depth] = in;
+    fea_input_load(&tok->inlist[tok->inc_depth],file);
+    fclose(file);
     tok->line[tok->inc_depth] = 1;
     fea_ParseTok(tok);
 }
 
 static void fea_ParseTokWithKeywords(struct parseState *tok, int do_keywords) {
-    FILE *in = tok->inlist[tok->inc_depth];
+    struct fea_input *in = &tok->inlist[tok->inc_depth];
     int ch, peekch;
     char *pt, *start;
 
@@ -2505,27 +2539,28 @@ return;
     }
 
   skip_whitespace:
-    ch = getc(in);
+    ch = fea_getc(in);
     while ( isspace(ch) || ch=='#' ) {
 	if ( ch=='#' )
-	    while ( (ch=getc(in))!=EOF && ch!='\n' && ch!='\r' );
+	    while ( (ch=fea_getc(in))!=EOF && ch!='\n' && ch!='\r' );
 	if ( ch=='\n' || ch=='\r' ) {
 	    if ( ch=='\r' ) {
-		ch = getc(in);
+		ch = fea_getc(in);
 		if ( ch!='\n' )
-		    ungetc(ch,in);
+		    fea_ungetc(ch,in);
 	    }
 	    ++tok->line[tok->inc_depth];
 	}
-	ch = getc(in);
+	ch = fea_getc(in);
     }
 
     tok->could_be_tag = 0;
     if ( ch==EOF ) {
 	if ( tok->inc_depth>0 ) {
-	    fclose(tok->inlist[tok->inc_depth]);
+	    free(tok->inlist[tok->inc_depth].buf);
+	    memset(&tok->inlist[tok->inc_depth],0,sizeof(struct fea_input));
 	    free(tok->filename[tok->inc_depth]);
-	    in = tok->inlist[--tok->inc_depth];
+	    in = &tok->inlist[--tok->inc_depth];
   goto skip_whitespace;
 	}
 	tok->type = tk_eof;
@@ -2535,8 +2570,8 @@ return;
 
     start = pt = tok->tokbuf;
     if ( ch=='\\' || ch=='-' ) {
-	peekch=getc(in);
-	ungetc(peekch,in);
+	peekch=fea_getc(in);
+	fea_ungetc(peekch,in);
     }
 
     if ( isdigit(ch) || ch=='+' || ((ch=='-' || ch=='\\') && isdigit(peekch)) ) {
@@ -2546,16 +2581,16 @@ return;
 		*pt++ = ch;
 		start = pt;
 	    }
-	    ch = getc(in);
+	    ch = fea_getc(in);
 	} else if ( ch=='\\' ) {
-	    ch = getc(in);
+	    ch = fea_getc(in);
 	    tok->type = tk_cid;
 	}
 	while ( (isdigit( ch ) ||
 		(tok->base==0 && (ch=='x' || ch=='X' || (ch>='a' && ch<='f') || (ch>='A' && ch<='F'))))
 		&& pt<tok->tokbuf+15 ) {
 	    *pt++ = ch;
-	    ch = getc(in);
+	    ch = fea_getc(in);
 	}
 	if ( isdigit(ch)) {
 	    LogError(_("Number too long on line %d of %s"), tok->line[tok->inc_depth], tok->filename[tok->inc_depth] );
@@ -2564,7 +2599,7 @@ return;
 	    LogError(_("Missing number on line %d of %s"), tok->line[tok->inc_depth], tok->filename[tok->inc_depth] );
 	    ++tok->err_count;
 	}
-	ungetc(ch,in);
+	fea_ungetc(ch,in);
 	*pt = '\0';
 	tok->value = strtol(tok->tokbuf,NULL,tok->base);
 return;
@@ -2575,19 +2610,19 @@ return;
 	    tok->type = tk_class;
 	    *pt++ = ch;
 	    start = pt;
-	    ch = getc(in);
+	    ch = fea_getc(in);
 	    check_keywords = false;
 	} else if ( ch=='\\' ) {
-	    ch = getc(in);
+	    ch = fea_getc(in);
 	    check_keywords = false;
 	}
 	while ( isalnum(ch) || ch=='_' || ch=='.' || (ch=='-' && tok->type==tk_class) ) {
 	    if ( pt<tok->tokbuf+MAXT )
 		*pt++ = ch;
-	    ch = getc(in);
+	    ch = fea_getc(in);
 	}
 	*pt = '\0';
-	ungetc(ch,in);
+	fea_ungetc(ch,in);
 	// We are selective about names starting with a dot. .notdef and .null are acceptable.
 	if ((start[0] == '.') && (strcmp(start, ".notdef") != 0) && (strcmp(start, ".null") != 0)) {
 	    if ( !tok->skipping ) {
@@ -2666,19 +2701,19 @@ static void fea_ParseTag(struct parseState *tok) {
     fea_ParseTok(tok);
     if ( tok->type==tk_name && tok->could_be_tag &&
 	    tok->tag==CHR('O','S',' ',' ') ) {
-	FILE *in = tok->inlist[tok->inc_depth];
+	struct fea_input *in = &tok->inlist[tok->inc_depth];
 	int ch;
-	ch = getc(in);
+	ch = fea_getc(in);
 	if ( ch=='/' ) {
-	    ch = getc(in);
+	    ch = fea_getc(in);
 	    if ( ch=='2' ) {
 		tok->tag = CHR('O','S','/','2');
 	    } else {
 		tok->tag = CHR('O','S','/',' ');
-		ungetc(ch,in);
+		fea_ungetc(ch,in);
 	    }
 	} else
-	    ungetc(ch,in);
+	    fea_ungetc(ch,in);
     }
     if ( tok->type!=tk_name && tok->type!=tk_eof &&
 	    strlen(tok->tokbuf)==4 && isalnum(tok->tokbuf[0])) {
@@ -2699,13 +2734,13 @@ static int fea_ParseDeciPoints(struct parseState *tok) {
 
     fea_ParseTok(tok);
     if ( tok->type==tk_int ) {
-	FILE *in = tok->inlist[tok->inc_depth];
+	struct fea_input *in = &tok->inlist[tok->inc_depth];
 	char *pt = tok->tokbuf + strlen(tok->tokbuf);
 	int ch;
-	ch = getc(in);
+	ch = fea_getc(in);
 	if ( ch=='.' ) {
 	    *pt++ = ch;
-	    while ( (ch = getc(in))!=EOF && isdigit(ch)) {
+	    while ( (ch = fea_getc(in))!=EOF && isdigit(ch)) {
 		if ( pt<tok->tokbuf+sizeof(tok->tokbuf)-1 )
 		    *pt++ = ch;
 	    }
@@ -2713,7 +2748,7 @@ static int fea_ParseDeciPoints(struct parseState *tok) {
 	    tok->value = rint(strtod(tok->tokbuf,NULL)*10.0);
 	}
 	if ( ch!=EOF )
-	    ungetc(ch,in);
+	    fea_ungetc(ch,in);
     } else {
 	LogError(_("Expected '%s' on line %d of %s"), fea_keywords[tk_int].name,
 		tok->line[tok->inc_depth], tok->filename[tok->inc_depth] );
@@ -2796,39 +2831,52 @@ static void fea_end_statement(struct parseState *tok) {
 static struct glyphclasses *fea_lookup_class(struct parseState *tok,char *classname) {
     struct glyphclasses *test;
 
-    for ( test=tok->classes; test!=NULL; test=test->next ) {
+    for ( test=tok->class_hash[hashname(classname)]; test!=NULL; test=test->hnext ) {
 	if ( strcmp(classname,test->classname)==0 )
 return( test );
     }
 return( NULL );
 }
 
+static void fea_hash_class(struct parseState *tok,struct glyphclasses *gc) {
+    int hash = hashname(gc->classname);
+
+    gc->hnext = tok->class_hash[hash];
+    tok->class_hash[hash] = gc;
+}
+
+static struct gpos_mark *fea_lookup_markclass(struct parseState *tok,char *classname) {
+    struct gpos_mark *test;
+
+    for ( test=tok->mark_hash[hashname(classname)]; test!=NULL; test=test->hnext ) {
+	if ( strcmp(classname,test->name)==0 )
+return( test );
+    }
+return( NULL );
+}
+
 static char *fea_lookup_class_complain(struct parseState *tok,char *classname) {
     struct glyphclasses *test;
     struct gpos_mark *mtest;
 
-    for ( test=tok->classes; test!=NULL; test=test->next ) {
-	if ( strcmp(classname,test->classname)==0 )
+    if ( (test = fea_lookup_class(tok,classname))!=NULL )
 return( copy( test->glyphs) );
-    }
 
     /* Mark classes can also be used as normal classes */
-    for ( mtest=tok->gpos_mark; mtest!=NULL; mtest=mtest->next ) {
-	if ( strcmp(classname,mtest->name)==0 ) {
-	    struct gpos_mark *sames;
-	    int len=0;
-	    char *ret, *pt;
-	    for ( sames=mtest; sames!=NULL; sames=sames->same )
-		len += strlen(sames->glyphs)+1;
-	    pt = ret = malloc(len+1);
-	    for ( sames=mtest; sames!=NULL; sames=sames->same ) {
-		strcpy(pt,sames->glyphs);
-		pt += strlen(pt);
-		if ( sames->next!=NULL )
-		    *pt++ = ' ';
-	    }
-return( ret );
+    if ( (mtest = fea_lookup_markclass(tok,classname))!=NULL ) {
+	struct gpos_mark *sames;
+	int len=0;
+	char *ret, *pt;
+	for ( sames=mtest; sames!=NULL; sames=sames->same )
+	    len += strlen(sames->glyphs)+1;
+	pt = ret = malloc(len+1);
+	for ( sames=mtest; sames!=NULL; sames=sames->same ) {
+	    strcpy(pt,sames->glyphs);
+	    pt += strlen(pt);
+	    if ( sames->next!=NULL )
+		*pt++ = ' ';
 	}
+return( ret );
     }
 
     LogError(_("Use of undefined glyph class, %s, on line %d of %s"), classname, tok->line[tok->inc_depth], tok->filename[tok->inc_depth] );
@@ -2839,10 +2887,8 @@ return( NULL );
 static struct gpos_mark *fea_lookup_markclass_complain(struct parseState *tok,char *classname) {
     struct gpos_mark *test;
 
-    for ( test=tok->gpos_mark; test!=NULL; test=test->next ) {
-	if ( strcmp(classname,test->name)==0 )
+    if ( (test = fea_lookup_markclass(tok,classname))!=NULL )
 return( test );
-    }
     LogError(_("Use of undefined mark class, %s, on line %d of %s"), classname, tok->line[tok->inc_depth], tok->filename[tok->inc_depth] );
     ++tok->err_count;
 return( NULL );
@@ -2857,6 +2903,7 @@ static void fea_AddClassDef(struct parseState *tok,char *classname,char *content
 	test->classname = classname;
 	test->next = tok->classes;
 	tok->classes = test;
+	fea_hash_class(tok,test);
     } else {
 	free(classname);
 	free(test->glyphs);
@@ -3641,6 +3688,7 @@ static void fea_ParseMarkClass(struct parseState *tok) {
     char *class_string;
     AnchorPoint *ap;
     struct gpos_mark *gm, *ngm;
+    int hash;
 
     fea_ParseTok(tok);
     if ( tok->type==tk_name )
@@ -3679,9 +3727,7 @@ return;
     gm = chunkalloc(sizeof(*gm));
     gm->glyphs = class_string;
     gm->ap = ap;
-    for ( ngm=tok->gpos_mark; ngm!=NULL; ngm=ngm->next )
-	if ( strcmp(ngm->name,tok->tokbuf)==0 )
-    break;
+    ngm = fea_lookup_markclass(tok,tok->tokbuf);
     if ( ngm!=NULL ) {
 	/* Multiple anchor points for the same name */
 	gm->same = ngm->same;
@@ -3690,6 +3736,9 @@ return;
 	gm->next = tok->gpos_mark;
 	tok->gpos_mark = gm;
 	gm->name = copy(tok->tokbuf);
+	hash = hashname(gm->name);
+	gm->hnext = tok->mark_hash[hash];
+	tok->mark_hash[hash] = gm;
     }
 
     fea_end_statement(tok);
@@ -5211,7 +5260,7 @@ static struct nameid *fea_ParseNameId(struct parseState *tok,int strid) {
     struct nameid *nm;
     char *start, *pt;
     int max, ch, value;
-    FILE *in = tok->inlist[tok->inc_depth];
+    struct fea_input *in = &tok->inlist[tok->inc_depth];
     /* nameid <id> [<string attribute>] string; */
     /*  "nameid" and <id> will already have been parsed when we get here */
     /* <string attribute> := <platform> | <platform> <specific> <language> */
@@ -5257,7 +5306,7 @@ static struct nameid *fea_ParseNameId(struct parseState *tok,int strid) {
 	    nm = NULL;
 	max = 0;
 	pt = 0; start = NULL;
-	while ( (ch=getc(in))!=EOF && ch!='"' ) {
+	while ( (ch=fea_getc(in))!=EOF && ch!='"' ) {
 	    if ( ch=='\n' || ch=='\r' )
 	continue;		/* Newline characters are ignored here */
 				/*  may be specified with backslashes */
@@ -5265,9 +5314,9 @@ static struct nameid *fea_ParseNameId(struct parseState *tok,int strid) {
 		int i, dmax = platform==3 ? 4 : 2;
 		value = 0;
 		for ( i=0; i<dmax; ++i ) {
-		    ch = getc(in);
+		    ch = fea_getc(in);
 		    if ( !ishexdigit(ch)) {
-			ungetc(ch,in);
+			fea_ungetc(ch,in);
 		break;
 		    }
 		    if ( ch>='a' && ch<='f' )
@@ -5608,19 +5657,19 @@ static void fea_ParseTableKeywords(struct parseState *tok, struct tablekeywords
 		tv->value = tok->tag;
 	    else if ( tok->type==tk_char && tok->tokbuf[0]=='"' ) {
 		uint8_t foo[4]; int ch;
-		FILE *in = tok->inlist[tok->inc_depth];
+		struct fea_input *in = &tok->inlist[tok->inc_depth];
 		memset(foo,' ',sizeof(foo));
 		for ( i=0; i<4; ++i ) {
-		    ch = getc(in);
+		    ch = fea_getc(in);
 		    if ( ch==EOF )
 		break;
 		    else if ( ch=='"' ) {
-			ungetc(ch,in);
+			fea_ungetc(ch,in);
 		break;
 		    }
 		    foo[i] = ch;
 		}
-		while ( (ch=getc(in))!=EOF && ch!='"' );
+		while ( (ch=fea_getc(in))!=EOF && ch!='"' );
 		tok->value=(foo[0]<<24) | (foo[1]<<16) | (foo[2]<<8) | foo[3];
 	    } else {
 		LogError(_("Expected string on line %d of %s"),
@@ -5644,11 +5693,11 @@ static void fea_ParseTableKeywords(struct parseState *tok, struct tablekeywords
 		    tv->value = tok->value;
 		if ( strcmp(keys[index].name,"FontRevision")==0 ) {
 		    /* Can take a float */
-		    FILE *in = tok->inlist[tok->inc_depth];
-		    int ch = getc(in);
+		    struct fea_input *in = &tok->inlist[tok->inc_depth];
+		    int ch = fea_getc(in);
 		    if ( ch=='.' )
-			for ( ch=getc(in); isdigit(ch); ch=getc(in));
-		    ungetc(ch,in);
+			for ( ch=fea_getc(in); isdigit(ch); ch=fea_getc(in));
+		    fea_ungetc(ch,in);
 		}
 		if ( index!=-1 && keys[index].cnt!=1 ) {
 		    int is_panose = strcmp(keys[index].name,"Panose")==0 && tv!=NULL;
@@ -6467,13 +6516,90 @@ static void fea_ApplyLookupListMark2(struct parseState *tok,
 }
 
 
-static int is_blank(const char *s) {
-    int i;
+/* Kerning classes get compared with each other many times over while they */
+/*  are sorted into a kerning class table. Rather than rescanning the name  */
+/*  strings each time, give every distinct glyph name a small integer and   */
+/*  work with arrays of those */
+struct name_ids {
+    struct glif_name_index *hash;
+    char **names;
+    int cnt, max;
+};
+
+struct id_class {
+    int *ids;
+    int cnt;
+};
+
+struct id_owners {
+    int *classes;		/* Every class which held the name when it was made */
+    int cnt, max;
+};
+
+static int fea_nameId(struct name_ids *ni, const char *name) {
+    struct glif_name *gn = glif_name_search_glif_name(ni->hash,name);
+
+    if ( gn!=NULL )
+return( gn->gid );
+    if ( ni->cnt>=ni->max )
+	ni->names = realloc(ni->names,(ni->max+=256)*sizeof(char *));
+    glif_name_track_new(ni->hash,ni->cnt,name);
+    ni->names[ni->cnt] = glif_name_search_glif_name(ni->hash,name)->glif_name;
+return( ni->cnt++ );
+}
+
+static void fea_classIds(struct name_ids *ni, char *class, struct id_class *ic) {
+    char *pt, *start;
+    int ch, max = 0;
+
+    ic->ids = NULL;
+    ic->cnt = 0;
+    for ( pt=class; ; ) {
+	while ( *pt==' ' ) ++pt;
+	if ( *pt=='\0' )
+    break;
+	for ( start=pt; *pt!=' ' && *pt!='\0'; ++pt );
+	ch = *pt; *pt = '\0';
+	if ( ic->cnt>=max )
+	    ic->ids = realloc(ic->ids,(max+=32)*sizeof(int));
+	ic->ids[ic->cnt++] = fea_nameId(ni,start);
+	*pt = ch;
+    }
+}
+
+static char *fea_idsClass(struct name_ids *ni, struct id_class *ic) {
+    int i, len = 0;
+    char *ret, *pt;
+
+    for ( i=0; i<ic->cnt; ++i )
+	len += strlen(ni->names[ic->ids[i]])+1;
+    pt = ret = malloc(len+1);
+    for ( i=0; i<ic->cnt; ++i ) {
+	if ( i!=0 )
+	    *pt++ = ' ';
+	strcpy(pt,ni->names[ic->ids[i]]);
+	pt += strlen(pt);
+    }
+    *pt = '\0';
+return( ret );
+}
+
+static void fea_addOwner(struct id_owners *owners, struct id_class *ic, int index) {
+    struct id_owners *o;
+    int k;
+
+    for ( k=0; k<ic->cnt; ++k ) {
+	o = &owners[ic->ids[k]];
+	if ( o->cnt!=0 && o->classes[o->cnt-1]==index )
+    continue;
+	if ( o->cnt>=o->max )
+	    o->classes = realloc(o->classes,(o->max+=8)*sizeof(int));
+	o->classes[o->cnt++] = index;
+    }
+}
 
-    i = 0;
-    while (s[i] != '\0' && s[i] == ' ')
-        i++;
-    return( s[i] == '\0');
+static int intcmp(const void *_i1, const void *_i2) {
+return( *(const int *) _i1 - *(const int *) _i2 );
 }
 
 struct class_set {
@@ -6487,7 +6613,11 @@ struct class_set {
 /* Simplify the list so that: There are no duplicates classes and each name */
 /*  appears in at most one class. This is what we need */
 static void fea_canonicalClassSet(struct class_set *set) {
-    int i,j,k;
+    int i,j,k,l,c,id,cnt,end,max,cand_cnt;
+    struct name_ids ni;
+    struct id_class *ics, split;
+    struct id_owners *owners;
+    int *count, *countj, *seen, *cand;
 
     /* Remove any duplicate classes */
     qsort(set->classes,set->cnt,sizeof(char *), strcmpD);
@@ -6505,28 +6635,117 @@ static void fea_canonicalClassSet(struct class_set *set) {
 	}
     }
 
-    for ( i=0; i < set->cnt - 1; ++i ) {
-        for ( j=i+1; j < set->cnt; ++j ) {
-            if ( fea_classesIntersect(set->classes[i],set->classes[j]) ) {
-                if ( set->cnt>=set->max )
-                    set->classes = realloc(set->classes,(set->max+=20)*sizeof(char *));
-                set->classes[set->cnt++] = fea_classesSplit(set->classes[i],set->classes[j]);
-            }
-        }
+    memset(&ni,0,sizeof(ni));
+    ni.hash = glif_name_index_new();
+    cnt = set->cnt;
+    max = cnt+20;
+    ics = malloc(max*sizeof(struct id_class));
+    seen = malloc(max*sizeof(int));
+    cand = malloc(max*sizeof(int));
+    for ( i=0; i<cnt; ++i ) {
+	fea_classIds(&ni,set->classes[i],&ics[i]);
+	seen[i] = -1;
+    }
+    count = calloc(ni.cnt+1,sizeof(int));
+    countj = calloc(ni.cnt+1,sizeof(int));
+    owners = calloc(ni.cnt+1,sizeof(struct id_owners));
+    for ( i=0; i<cnt; ++i )
+	fea_addOwner(owners,&ics[i],i);
+
+    /* Whenever two classes share names, move those names out of both and */
+    /*  into a new class at the end of the list (which is then checked in  */
+    /*  turn). Classes only ever lose names, so the only later classes which */
+    /*  can overlap class i are those that once shared a name with it, and  */
+    /*  whatever gets split off while we look at it */
+    for ( i=0; i<cnt-1; ++i ) {
+	for ( k=0; k<ics[i].cnt; ++k )
+	    ++count[ics[i].ids[k]];
+	cand_cnt = 0;
+	for ( k=0; k<ics[i].cnt; ++k ) {
+	    struct id_owners *o = &owners[ics[i].ids[k]];
+	    for ( l=0; l<o->cnt; ++l ) {
+		j = o->classes[l];
+		if ( j>i && seen[j]!=i ) {
+		    seen[j] = i;
+		    cand[cand_cnt++] = j;
+		}
+	    }
+	}
+	qsort(cand,cand_cnt,sizeof(int),intcmp);
+	end = cnt;
+	for ( c=0; ; ++c ) {
+	    if ( c<cand_cnt )
+		j = cand[c];
+	    else if ( end+c-cand_cnt<cnt )
+		j = end+c-cand_cnt;
+	    else
+	break;
+	    for ( k=0; k<ics[j].cnt && count[ics[j].ids[k]]==0; ++k );
+	    if ( k==ics[j].cnt )
+	continue;
+
+	    /* In the order of class i, take each name it shares with class j */
+	    /*  out of i and out of j (the first time it occurs there) */
+	    for ( k=0; k<ics[j].cnt; ++k )
+		++countj[ics[j].ids[k]];
+	    split.ids = malloc(ics[i].cnt*sizeof(int));
+	    split.cnt = 0;
+	    for ( k=l=0; k<ics[i].cnt; ++k ) {
+		id = ics[i].ids[k];
+		if ( countj[id]>0 ) {
+		    --countj[id];
+		    --count[id];
+		    split.ids[split.cnt++] = id;
+		} else
+		    ics[i].ids[l++] = id;
+	    }
+	    ics[i].cnt = l;
+	    for ( k=0; k<ics[j].cnt; ++k )
+		countj[ics[j].ids[k]] = 0;
+	    for ( k=0; k<split.cnt; ++k )
+		++countj[split.ids[k]];
+	    for ( k=l=0; k<ics[j].cnt; ++k ) {
+		id = ics[j].ids[k];
+		if ( countj[id]>0 )
+		    --countj[id];
+		else
+		    ics[j].ids[l++] = id;
+	    }
+	    ics[j].cnt = l;
+
+	    if ( cnt>=max ) {
+		max += 20+max/2;
+		ics = realloc(ics,max*sizeof(struct id_class));
+		seen = realloc(seen,max*sizeof(int));
+		cand = realloc(cand,max*sizeof(int));
+	    }
+	    ics[cnt] = split;
+	    seen[cnt] = -1;
+	    fea_addOwner(owners,&ics[cnt],cnt);
+	    ++cnt;
+	}
+	for ( k=0; k<ics[i].cnt; ++k )
+	    count[ics[i].ids[k]] = 0;
     }
 
-    /* Remove empty classes */
-    i = 0;
-    while (i < set->cnt) {
-        if (is_blank(set->classes[i])) {
-            free(set->classes[i]);
-            for ( k=i+1 ; k < set->cnt; ++k )
-                set->classes[k-1] = set->classes[k];
-            set->cnt -= 1;
-        } else {
-            i++;
-        }
+    /* Back to strings, dropping the classes which are now empty */
+    for ( i=0; i<set->cnt; ++i )
+	free(set->classes[i]);
+    if ( cnt>set->max )
+	set->classes = realloc(set->classes,(set->max=cnt)*sizeof(char *));
+    for ( i=j=0; i<cnt; ++i ) {
+	if ( ics[i].cnt!=0 )
+	    set->classes[j++] = fea_idsClass(&ni,&ics[i]);
+	free(ics[i].ids);
     }
+    set->cnt = j;
+
+    for ( i=0; i<ni.cnt; ++i )
+	free(owners[i].classes);
+    free(owners); free(count); free(countj);
+    free(ics); free(seen); free(cand);
+    free(ni.names);
+    glif_name_index_destroy(ni.hash);
 }
 
 static void KCFillDevTab(KernClass *kc,int index,DeviceTable *dt) {
@@ -6549,42 +6768,98 @@ return;
     memcpy(kp->adjust->corrections,dt->corrections,dt->last_pixel_size-dt->first_pixel_size+1);
 }
 
+/* Maps each glyph name in a set of disjoint classes to its class */
+static struct glif_name_index *fea_classIndex(char **classes, int cnt) {
+    struct glif_name_index *hash = glif_name_index_new();
+    char *pt, *start;
+    int i, ch;
+
+    for ( i=1; i<cnt; ++i ) {
+	for ( pt=classes[i]; ; ) {
+	    while ( *pt==' ' ) ++pt;
+	    if ( *pt=='\0' )
+	break;
+	    for ( start=pt; *pt!=' ' && *pt!='\0'; ++pt );
+	    ch = *pt; *pt = '\0';
+	    if ( glif_name_search_glif_name(hash,start)==NULL )
+		glif_name_track_new(hash,i,start);
+	    *pt = ch;
+	}
+    }
+return( hash );
+}
+
+/* Fills in the (distinct) classes which contain any of the names in class */
+static int fea_classesTouched(struct glif_name_index *hash, char *class,
+	int *seen, int stamp, int *touched) {
+    struct glif_name *gn;
+    char *pt, *start;
+    int ch, cnt = 0;
+
+    for ( pt=class; ; ) {
+	while ( *pt==' ' ) ++pt;
+	if ( *pt=='\0' )
+    break;
+	for ( start=pt; *pt!=' ' && *pt!='\0'; ++pt );
+	ch = *pt; *pt = '\0';
+	gn = glif_name_search_glif_name(hash,start);
+	*pt = ch;
+	if ( gn!=NULL && seen[gn->gid]!=stamp ) {
+	    seen[gn->gid] = stamp;
+	    touched[cnt++] = gn->gid;
+	}
+    }
+return( cnt );
+}
+
 static void fea_fillKernClass(KernClass *kc,struct feat_item *l) {
-    int i,j;
+    int i,j,f,s,fcnt,scnt,stamp;
     PST *pst;
-
+    struct glif_name_index *firsts, *seconds;
+    int *fseen, *sseen, *ftouched, *stouched;
+
+    /* fea_canonicalClassSet has made the classes disjoint, so every class */
+    /*  a rule's glyphs intersect can be found directly from the names */
+    firsts = fea_classIndex(kc->firsts,kc->first_cnt);
+    seconds = fea_classIndex(kc->seconds,kc->second_cnt);
+    fseen = calloc(kc->first_cnt,sizeof(int));
+    sseen = calloc(kc->second_cnt,sizeof(int));
+    ftouched = malloc(kc->first_cnt*sizeof(int));
+    stouched = malloc(kc->second_cnt*sizeof(int));
+    stamp = 0;
     while ( l!=NULL && l->type!=ft_subtable ) {
 	if ( l->type==ft_pstclass ) {
 	    pst = l->u2.pst;
-	    for ( i=1; i<kc->first_cnt; ++i ) {
-		if ( fea_classesIntersect(kc->firsts[i],l->u1.class) ) {
-		    for ( j=1; j<kc->second_cnt; ++j ) {
-			if ( fea_classesIntersect(kc->seconds[j],pst->u.pair.paired) ) {
-			    /* FontForge only supports kerning classes in one direction at a time, not full value records */
-			    if ( pst->u.pair.vr[0].h_adv_off != 0 ) {
-				kc->offsets[i*kc->second_cnt+j] = pst->u.pair.vr[0].h_adv_off;
-				if ( pst->u.pair.vr[0].adjust!=NULL )
-				    KCFillDevTab(kc,i*kc->second_cnt+j,&pst->u.pair.vr[0].adjust->xadv);
-			    } else if ( pst->u.pair.vr[0].v_adv_off != 0 ) {
-				kc->offsets[i*kc->second_cnt+j] = pst->u.pair.vr[0].v_adv_off;
-				if ( pst->u.pair.vr[0].adjust!=NULL )
-				    KCFillDevTab(kc,i*kc->second_cnt+j,&pst->u.pair.vr[0].adjust->yadv);
-			    } else if ( pst->u.pair.vr[1].h_adv_off != 0 ) {
-				kc->offsets[i*kc->second_cnt+j] = pst->u.pair.vr[1].h_adv_off;
-				if ( pst->u.pair.vr[1].adjust!=NULL )
-				    KCFillDevTab(kc,i*kc->second_cnt+j,&pst->u.pair.vr[1].adjust->xadv);
-			    }
-			    if ( strcmp(kc->seconds[j],pst->u.pair.paired)==0 )
-		    break;
-			}
+	    ++stamp;
+	    fcnt = fea_classesTouched(firsts,l->u1.class,fseen,stamp,ftouched);
+	    scnt = fea_classesTouched(seconds,pst->u.pair.paired,sseen,stamp,stouched);
+	    for ( f=0; f<fcnt; ++f ) {
+		i = ftouched[f];
+		for ( s=0; s<scnt; ++s ) {
+		    j = stouched[s];
+		    /* FontForge only supports kerning classes in one direction at a time, not full value records */
+		    if ( pst->u.pair.vr[0].h_adv_off != 0 ) {
+			kc->offsets[i*kc->second_cnt+j] = pst->u.pair.vr[0].h_adv_off;
+			if ( pst->u.pair.vr[0].adjust!=NULL )
+			    KCFillDevTab(kc,i*kc->second_cnt+j,&pst->u.pair.vr[0].adjust->xadv);
+		    } else if ( pst->u.pair.vr[0].v_adv_off != 0 ) {
+			kc->offsets[i*kc->second_cnt+j] = pst->u.pair.vr[0].v_adv_off;
+			if ( pst->u.pair.vr[0].adjust!=NULL )
+			    KCFillDevTab(kc,i*kc->second_cnt+j,&pst->u.pair.vr[0].adjust->yadv);
+		    } else if ( pst->u.pair.vr[1].h_adv_off != 0 ) {
+			kc->offsets[i*kc->second_cnt+j] = pst->u.pair.vr[1].h_adv_off;
+			if ( pst->u.pair.vr[1].adjust!=NULL )
+			    KCFillDevTab(kc,i*kc->second_cnt+j,&pst->u.pair.vr[1].adjust->xadv);
 		    }
-		    if ( strcmp(kc->firsts[i],l->u1.class)==0 )
-	    break;
 		}
 	    }
 	}
 	l = l->lookup_next;
     }
+    free(fseen); free(sseen);
+    free(ftouched); free(stouched);
+    glif_name_index_destroy(firsts);
+    glif_name_index_destroy(seconds);
 }
 
 static void SFKernClassRemoveFree(SplineFont *sf,KernClass *kc) {
@@ -7345,6 +7620,8 @@ static void CopySplineFontGroupsForFeatureFile(SplineFont *sf, struct parseState
       if (feature_current != NULL) feature_current->next = feature_tmp;
       else tok->classes = feature_tmp;
       feature_current = feature_tmp;
+      // The first group of a given name is the one lookups have always found.
+      if (fea_lookup_class(tok, feature_tmp->classname) == NULL) fea_hash_class(tok, feature_tmp);
     }
     ff_current = ff_current->next;
   }
@@ -7364,7 +7641,7 @@ void SFApplyFeatureFile(SplineFont *sf,FILE *file,char *filename,bool ignore_inv
 
     tok.line[0] = 1;
     tok.filename[0] = filename;
-    tok.inlist[0] = file;
+    fea_input_load(&tok.inlist[0],file);
     tok.base = 10;
     tok.in_ufo = fea_isInUFO(filename);
     if ( sf->cidmaster ) sf = sf->cidmaster;
@@ -7376,6 +7653,8 @@ void SFApplyFeatureFile(SplineFont *sf,FILE *file,char *filename,bool ignore_inv
     switch_to_c_locale(&tmplocale, &oldlocale); // Switch to the C locale temporarily and cache the old locale.
     fea_ParseFeatureFile(&tok);
     switch_to_old_locale(&tmplocale, &oldlocale); // Switch to the cached locale.
+    for ( int i=0; i<=tok.inc_depth; ++i )
+	free(tok.inlist[i].buf);
     if ( tok.err_count==0 ) {
 	tok.sofar = fea_reverseList(tok.sofar);
 	fea_ApplyFile(&tok, tok.sofar);
@@ -5,6 +5,8 @@
 
 extern void FeatDumpFontLookups(FILE *out, SplineFont *sf);
 extern void FeatDumpOneLookup(FILE *out, SplineFont *sf, OTLookup *otl);
+extern void _FeatDumpFontLookups(FILE *out, SplineFont *sf, int fast);
+extern void _FeatDumpOneLookup(FILE *out, SplineFont *sf, OTLookup *otl, int fast);
 extern void SFApplyFeatureFilename(SplineFont *sf, char *filename,bool ignore_invalid_replacement);
 
 #endif /* FONTFORGE_FEATUREFILE_H */
@@ -757,6 +757,8 @@ void FVTrans(FontViewBase *fv,SplineChar *sc,real transform[6], uint8_t *sel,
 	/* Barry thinks rounding them is a bad idea. */
 	SCRound2Int(sc,fv->active_layer,1.0);
     }
+    /* Callers often measure the glyph before telling anyone it changed */
+    SCInvalidateBounds(sc);
     if ( !(flags&fvt_noupdate) )
 	SCCharChangedUpdate(sc,fv->active_layer);
 }
@@ -514,6 +514,7 @@ SplineChar *SplineCharCopy(SplineChar *sc,SplineFont *into,struct sfmergecontext
 	layers[layer].images = ImageListCopy(layers[layer].images);
 	layers[layer].undoes = NULL;
 	layers[layer].redoes = NULL;
+	layers[layer].bounds_cached = layers[layer].qbounds_cached = false;
 	if ( into!=NULL ) {
 	    if ( into->layers[layer].order2!=sc->layers[layer].order2 ) {
 		nsc->layers[layer].order2 = into->layers[layer].order2;
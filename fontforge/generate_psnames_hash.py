@@ -0,0 +1,166 @@
+# -*- coding: utf-8 -*-
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# The name of the author may not be used to endorse or promote products
+# derived from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED
+# WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+# MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+# EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+# PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+# OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+# WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+# OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+# ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Builds psnames_hash.h, a perfect hash from the glyph names built into
+# namelist.c to their unicode code points, so UniFromName needn't build
+# a hash table at run time. Rerun it whenever the name tables change:
+#
+#     python3 generate_psnames_hash.py namelist.c > psnames_hash.h
+
+import re, sys
+
+# The order in which namelist.c used to add the lists to its hash. A name
+# found in several gets the code point from the last
+LIST_ORDER = ('agl', 'agl_nf', 'agl_sans', 'adobepua', 'greeksc', 'tex', 'ams')
+
+def parse(source):
+    blocks = {}     # X_pP_bB -> list of 256 names (or None)
+    planes = {}     # X_pP -> list of 256 block names (or None)
+    lists = {}      # X -> list of 17 plane names (or None)
+    altnames = []
+
+    array_re = re.compile(r'static const char (\**)(\w+)\[\] = \{(.*?)\n\};', re.S)
+    for m in array_re.finditer(source):
+        stars, name, body = m.groups()
+        items = [i.strip() for i in body.split(',')]
+        items = [i for i in items if i]
+        if stars == '*':
+            blocks[name] = [None if i == 'NULL' else i.strip('"') for i in items]
+        else:
+            planes[name] = [None if i == 'NULL' else i for i in items]
+
+    list_re = re.compile(r'static NameList (\w+) = \{.*?\{([^}]*)\}', re.S)
+    for m in list_re.finditer(source):
+        lists[m.group(1)] = [None if i.strip() == 'NULL' else i.strip()
+                             for i in m.group(2).split(',')]
+
+    alt = re.search(r'static struct psaltnames psaltnames\[\] = \{(.*?)\n\};', source, re.S)
+    for m in re.finditer(r'\{ "([^"]+)", (0x[0-9a-fA-F]+|\d+), \d+ \}', alt.group(1)):
+        altnames.append((m.group(1), int(m.group(2), 0)))
+
+    names = {}
+    for name, uni in altnames:
+        names[name] = uni
+    for nl in LIST_ORDER:
+        for p, plane in enumerate(lists[nl]):
+            if plane is None:
+                continue
+            for b, block in enumerate(planes[plane]):
+                if block is None:
+                    continue
+                for c, name in enumerate(blocks[block]):
+                    if name is not None:
+                        names[name] = (p << 16) | (b << 8) | c
+    return names
+
+def fnv(name, seed):
+    h = 0x811c9dc5 ^ seed
+    for c in name.encode('utf-8'):
+        h ^= c
+        h = (h * 0x01000193) & 0xffffffff
+    return h
+
+def build(names):
+    keys = sorted(names)
+    size = len(keys)
+    nbuckets = (size + 3) // 4
+    buckets = [[] for i in range(nbuckets)]
+    for k in keys:
+        buckets[fnv(k, 0) % nbuckets].append(k)
+
+    slots = [None] * size
+    disp = [0] * nbuckets
+    for b in sorted(range(nbuckets), key=lambda b: -len(buckets[b])):
+        if not buckets[b]:
+            continue
+        d = 1
+        while True:
+            pos = [fnv(k, d) % size for k in buckets[b]]
+            if len(set(pos)) == len(pos) and all(slots[p] is None for p in pos):
+                break
+            d += 1
+        disp[b] = d
+        for k, p in zip(buckets[b], pos):
+            slots[p] = k
+    return slots, disp
+
+def cstring(s):
+    return '"' + s.replace('\\', '\\\\').replace('"', '\\"') + '"'
+
+def main():
+    with open(sys.argv[1], encoding='utf-8') as f:
+        names = parse(f.read())
+    slots, disp = build(names)
+
+    print('/* This is a generated file, made by generate_psnames_hash.py from */')
+    print('/*  namelist.c. Do not edit it, rerun the script instead */')
+    print('')
+    print('#ifndef FONTFORGE_PSNAMES_HASH_H')
+    print('#define FONTFORGE_PSNAMES_HASH_H')
+    print('')
+    print('#include <stdint.h>')
+    print('#include <string.h>')
+    print('')
+    print('#define PSNAMES_CNT\t%d' % len(slots))
+    print('#define PSNAMES_BUCKETS\t%d' % len(disp))
+    print('')
+    print('static const uint32_t psnames_disp[PSNAMES_BUCKETS] = {')
+    for i in range(0, len(disp), 10):
+        print('\t' + ', '.join(str(d) for d in disp[i:i+10]) + ',')
+    print('};')
+    print('')
+    print('static const struct psname { const char *name; int32_t uni; } psnames[PSNAMES_CNT] = {')
+    for name in slots:
+        print('\t{ %s, 0x%04x },' % (cstring(name), names[name]))
+    print('};')
+    print('')
+    print('static uint32_t psnames_fnv(const char *name, uint32_t seed) {')
+    print('    uint32_t h = 0x811c9dc5 ^ seed;')
+    print('')
+    print('    while ( *name ) {')
+    print('\th ^= (unsigned char) *name++;')
+    print('\th *= 0x01000193;')
+    print('    }')
+    print('return( h );')
+    print('}')
+    print('')
+    print('/* The code point of one of the built in names, or -1 */')
+    print('static int psnames_lookup(const char *name) {')
+    print('    uint32_t d = psnames_disp[psnames_fnv(name,0)%PSNAMES_BUCKETS];')
+    print('    const struct psname *pn;')
+    print('')
+    print('    if ( d==0 )')
+    print('return( -1 );')
+    print('    pn = &psnames[psnames_fnv(name,d)%PSNAMES_CNT];')
+    print('    if ( strcmp(pn->name,name)!=0 )')
+    print('return( -1 );')
+    print('return( pn->uni );')
+    print('}')
+    print('')
+    print('#endif /* FONTFORGE_PSNAMES_HASH_H */')
+
+if __name__ == '__main__':
+    main()
@@ -34,6 +34,7 @@
 #include "cvundoes.h"
 #include "fontforgevw.h"
 #include "fvfonts.h"
+#include "parallel.h"
 #include "scriptfuncs.h"
 #include "splinefill.h"
 #include "splineorder2.h"
@@ -931,6 +932,7 @@ struct font_diff {
     char *name1, *name2;
     int top_diff, middle_diff, local_diff, diff;
     SplineChar **matches;
+    uint8_t *shared;		/* The match is also another glyph's match */
     SplineChar *last_sc;
     char held[600];
     int lcnt1, lcnt2;
@@ -939,34 +941,66 @@ struct font_diff {
     struct lookup_subtable **s2match1, **s1match2;
     int is_gpos;
     struct lookup_subtable *cur_sub1, *cur_sub2;
+    char *out;			/* When glyphs are compared in parallel their */
+    int olen, omax;		/*  reports go here rather than to diffs */
 };
 
-static void GlyphDiffSCError(struct font_diff *fd, SplineChar *sc, char *format, ... ) {
-    va_list ap;
+static void FDPrintf(struct font_diff *fd, const char *format, ... ) {
+    va_list ap, aq;
+    int len;
+
+    va_start(ap,format);
+    if ( fd->diffs!=NULL )
+	vfprintf(fd->diffs,format,ap);
+    else {
+	va_copy(aq,ap);
+	len = vsnprintf(NULL,0,format,aq);
+	va_end(aq);
+	if ( len>0 ) {
+	    if ( fd->olen+len+1>fd->omax ) {
+		fd->omax = fd->olen+len+1+200;
+		fd->out = realloc(fd->out,fd->omax);
+	    }
+	    vsnprintf(fd->out+fd->olen,len+1,format,ap);
+	    fd->olen += len;
+	}
+    }
+    va_end(ap);
+}
 
+static void GlyphDiffHeader(struct font_diff *fd) {
     if ( !fd->top_diff ) {
 	fprintf( fd->diffs, "%s", _("Outline Glyphs\n") );
-	fd->top_diff = fd->diff = true;
+	fd->top_diff = true;
     }
     if ( !fd->local_diff ) {
 	putc(' ',fd->diffs);
 	fprintf( fd->diffs, "%s", _("Glyph Differences\n") );
-	fd->local_diff = fd->diff = true;
+	fd->local_diff = true;
     }
+}
+
+static void GlyphDiffSCError(struct font_diff *fd, SplineChar *sc, char *format, ... ) {
+    va_list ap;
+    char buffer[600];
+
+    if ( fd->diffs!=NULL )
+	GlyphDiffHeader(fd);
+    fd->diff = true;
     va_start(ap,format);
     if ( fd->last_sc==sc ) {
 	if ( fd->held[0] ) {
-	    fputs("  ",fd->diffs);
+	    FDPrintf(fd,"  ");
 /* GT: FontForge needs to recognize the quotes used here(“”). If you change them */
 /* GT: (in the translated strings) let me know. It currently also recognizes */
 /* GT: guillemets and a couple of other quotes as well. */
 /* GT:   pfaedit@users.sourceforge.net */
-	    fprintf( fd->diffs, U_("Glyph “%s” differs\n"), sc->name );
-	    fprintf( fd->diffs, "   %s", fd->held );
+	    FDPrintf(fd, U_("Glyph “%s” differs\n"), sc->name );
+	    FDPrintf(fd, "   %s", fd->held );
 	    fd->held[0] = '\0';
 	}
-	fputs("   ",fd->diffs);
-	vfprintf(fd->diffs,format,ap);
+	vsnprintf(buffer,sizeof(buffer),format,ap);
+	FDPrintf(fd, "   %s", buffer );
     } else {
 	vsnprintf(fd->held,sizeof(fd->held),format,ap);
 	fd->last_sc = sc;
@@ -976,8 +1010,7 @@ static void GlyphDiffSCError(struct font_diff *fd, SplineChar *sc, char *format,
 
 static void GlyphDiffSCFinish(struct font_diff *fd) {
     if ( fd->held[0] ) {
-	fputs("  ",fd->diffs);
-	fprintf( fd->diffs, "%s", fd->held );
+	FDPrintf(fd, "  %s", fd->held );
 	fd->held[0] = '\0';
     }
     fd->last_sc = NULL;
@@ -1196,6 +1229,155 @@ static void FDAddMissingGlyph(struct font_diff *fd,SplineChar *sc2) {
     SCAddBackgrounds(sc,sc2);
 }
 
+/* A hash of everything SCCompare looks at, so that the (usually many) */
+/*  glyphs which are exactly the same in both fonts can be passed over */
+/*  without comparing their contours */
+static uint64_t FPAdd(uint64_t h, const void *data, size_t len) {
+    const uint8_t *pt = data;
+
+    while ( len-->0 ) {
+	h ^= *pt++;
+	h *= 0x100000001b3ULL;		/* FNV-1a */
+    }
+return( h );
+}
+
+static uint64_t FPAddPoint(uint64_t h, const BasePoint *bp) {
+    h = FPAdd(h,&bp->x,sizeof(bp->x));
+return( FPAdd(h,&bp->y,sizeof(bp->y)) );
+}
+
+static uint64_t SCFingerprint(SplineChar *sc,struct font_diff *fd) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    int layer, last, i, closed;
+    SplineSet *ss;
+    SplinePoint *sp;
+    RefChar *ref;
+    StemInfo *stem;
+
+    h = FPAdd(h,&sc->width,sizeof(sc->width));
+    h = FPAdd(h,&sc->vwidth,sizeof(sc->vwidth));
+    last = ly_fore;
+    if ( fd->sf1->multilayer ) {	/* As SCCompare does */
+	last = sc->layer_cnt-1;
+	h = FPAdd(h,&sc->layer_cnt,sizeof(sc->layer_cnt));
+    }
+    for ( layer=ly_fore; layer<=last; ++layer ) {
+	i = sc->layers[layer].dofill | (sc->layers[layer].dostroke<<1);
+	h = FPAdd(h,&i,sizeof(i));
+	for ( ss=sc->layers[layer].splines; ss!=NULL; ss=ss->next ) {
+	    closed = ss->first->prev!=NULL;
+	    h = FPAdd(h,&closed,sizeof(closed));
+	    for ( sp=ss->first; ; ) {
+		h = FPAddPoint(h,&sp->me);
+		h = FPAddPoint(h,&sp->nextcp);
+		h = FPAddPoint(h,&sp->prevcp);
+		if ( (fd->flags&fcf_hintmasks) && sp->hintmask!=NULL )
+		    h = FPAdd(h,*sp->hintmask,sizeof(HintMask));
+		if ( sp->next==NULL )
+	    break;
+		sp = sp->next->to;
+		if ( sp==ss->first )
+	    break;
+	    }
+	}
+	for ( ref=sc->layers[layer].refs; ref!=NULL; ref=ref->next ) {
+	    h = FPAdd(h,ref->sc->name,strlen(ref->sc->name)+1);
+	    h = FPAdd(h,&ref->sc->unicodeenc,sizeof(ref->sc->unicodeenc));
+	    h = FPAdd(h,ref->transform,sizeof(ref->transform));
+	    i = ref->point_match;
+	    h = FPAdd(h,&i,sizeof(i));
+	    if ( ref->point_match ) {
+		h = FPAdd(h,&ref->match_pt_base,sizeof(ref->match_pt_base));
+		h = FPAdd(h,&ref->match_pt_ref,sizeof(ref->match_pt_ref));
+	    }
+	}
+	i = -1;				/* End of layer */
+	h = FPAdd(h,&i,sizeof(i));
+    }
+    if ( fd->flags&fcf_hinting ) {
+	for ( stem=sc->hstem; stem!=NULL; stem=stem->next ) {
+	    h = FPAdd(h,&stem->start,sizeof(stem->start));
+	    h = FPAdd(h,&stem->width,sizeof(stem->width));
+	}
+	h = FPAdd(h,&i,sizeof(i));
+	for ( stem=sc->vstem; stem!=NULL; stem=stem->next ) {
+	    h = FPAdd(h,&stem->start,sizeof(stem->start));
+	    h = FPAdd(h,&stem->width,sizeof(stem->width));
+	}
+	h = FPAdd(h,&sc->ttf_instrs_len,sizeof(sc->ttf_instrs_len));
+	if ( sc->ttf_instrs_len!=0 )
+	    h = FPAdd(h,sc->ttf_instrs,sc->ttf_instrs_len);
+    }
+return( h );
+}
+
+struct glyph_report {
+    char *out;
+    int len;
+    int diff;
+};
+
+struct glyph_compare {
+    struct font_diff *fd;
+    struct glyph_report *reports;
+};
+
+static void SCCompareThread(void *data,int gid1) {
+    struct glyph_compare *gc = data;
+    struct glyph_report *rep = &gc->reports[gid1];
+    SplineChar *sc = gc->fd->sf1->glyphs[gid1], *sc2 = gc->fd->matches[gid1];
+    struct font_diff fd;
+
+    /* SSsCompare briefly rearranges the contours it looks at, so glyphs */
+    /*  of sf2 which match several of sf1 are left to the main thread */
+    if ( sc==NULL || sc2==NULL || gc->fd->shared[gid1] ||
+	    SCFingerprint(sc,gc->fd)==SCFingerprint(sc2,gc->fd) )
+return;
+    fd = *gc->fd;
+    fd.diffs = NULL;
+    fd.out = NULL; fd.olen = fd.omax = 0;
+    fd.last_sc = NULL; fd.held[0] = '\0';
+    fd.diff = false;
+    SCCompare(sc,sc2,&fd);
+    rep->out = fd.out;
+    rep->len = fd.olen;
+    rep->diff = fd.diff;
+}
+
+/* Compares the matched glyphs over all processors, then writes out what */
+/*  each found in glyph order, so the report is the same as a serial one */
+static void compareglyphsparallel(struct font_diff *fd) {
+    struct glyph_compare gc;
+    struct glyph_report *rep;
+    SplineChar *sc;
+    int gid1, diff;
+
+    gc.fd = fd;
+    gc.reports = calloc(fd->sf1_glyphcnt,sizeof(struct glyph_report));
+    FFParallelFor(fd->sf1_glyphcnt,SCCompareThread,&gc);
+
+    for ( gid1=0; gid1<fd->sf1_glyphcnt; ++gid1 ) {
+	rep = &gc.reports[gid1];
+	if ( fd->shared[gid1] ) {
+	    if ( (sc=fd->sf1->glyphs[gid1])!=NULL &&
+		    SCFingerprint(sc,fd)!=SCFingerprint(fd->matches[gid1],fd) )
+		SCCompare(sc,fd->matches[gid1],fd);
+	} else if ( rep->len!=0 ) {
+	    /* Printing the headers doesn't make it a difference, warnings */
+	    /*  alone leave diff unset */
+	    diff = fd->diff;
+	    GlyphDiffHeader(fd);
+	    fd->diff = diff;
+	    fwrite(rep->out,1,rep->len,fd->diffs);
+	}
+	if ( rep->diff )
+	    fd->diff = true;
+	free(rep->out);
+    }
+    free(gc.reports);
+}
+
 static void comparefontglyphs(struct font_diff *fd) {
     int gid1, gid2;
     SplineChar *sc, *sc2;
@@ -1244,10 +1426,15 @@ return;
     }
 
     fd->local_diff = false;
-    for ( gid1=0; gid1<fd->sf1_glyphcnt; ++gid1 ) {
-	if ( (sc=sf1->glyphs[gid1])!=NULL && (sc2=fd->matches[gid1])!=NULL )
-	    SCCompare(sc,sc2,fd);
-    }
+    if ( fd->flags&fcf_adddiff2sf1 ) {
+	/* Changes the glyphs of sf1 as it goes */
+	for ( gid1=0; gid1<fd->sf1_glyphcnt; ++gid1 ) {
+	    if ( (sc=sf1->glyphs[gid1])!=NULL && (sc2=fd->matches[gid1])!=NULL &&
+		    SCFingerprint(sc,fd)!=SCFingerprint(sc2,fd) )
+		SCCompare(sc,sc2,fd);
+	}
+    } else
+	compareglyphsparallel(fd);
 }
 
 static void comparebitmapglyphs(struct font_diff *fd, BDFFont *bdf1, BDFFont *bdf2) {
@@ -2279,7 +2466,7 @@ static void comparegsub(struct font_diff *fd) {
 
 int CompareFonts(SplineFont *sf1, EncMap *map1, SplineFont *sf2, FILE *diffs,
 	int flags) {
-    int gid1, gid2;
+    int gid1, gid2, other;
     SplineChar *sc, *sc2;
     struct font_diff fd;
 
@@ -2323,11 +2510,18 @@ int CompareFonts(SplineFont *sf1, EncMap *map1, SplineFont *sf2, FILE *diffs,
     for ( gid1=0; gid1<sf1->glyphcnt; ++gid1 ) if ( (sc=sf1->glyphs[gid1])!=NULL )
 	sc->ticked = false;
     fd.matches = calloc(sf1->glyphcnt,sizeof(SplineChar *));
+    fd.shared = calloc(sf1->glyphcnt,sizeof(uint8_t));
 
     for ( gid1=0; gid1<sf1->glyphcnt; ++gid1 ) if ( (sc=sf1->glyphs[gid1])!=NULL ) {
 	sc2 = SFGetChar(sf2,sc->unicodeenc,sc->name);
 	fd.matches[gid1] = sc2;
 	if ( sc2!=NULL ) {
+	    if ( sc2->ticked ) {
+		fd.shared[gid1] = true;
+		for ( other=0; other<gid1; ++other )
+		    if ( fd.matches[other]==sc2 )
+			fd.shared[other] = true;
+	    }
 	    sc2->ticked = true;
 	    sc->ticked = true;
 	}
@@ -2345,6 +2539,7 @@ int CompareFonts(SplineFont *sf1, EncMap *map1, SplineFont *sf2, FILE *diffs,
 	comparegsub(&fd);
 
     free(fd.matches);
+    free(fd.shared);
 
     if ( sf1->subfontcnt!=0 && sf2->subfontcnt!=0 ) {
 	free(sf1->glyphs); sf1->glyphs = NULL;
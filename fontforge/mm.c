@@ -33,6 +33,10 @@
 #include "fontforgevw.h"
 #include "lookups.h"
 #include "macenc.h"
+#include "parallel.h"
+#include "psread.h"
+#include "savefont.h"
+#include "sfd.h"
 #include "splinesaveafm.h"
 #include "splineutil.h"
 #include "splineutil2.h"
@@ -301,47 +305,75 @@ static SplineChar *SFMakeGlyphLike(SplineFont *sf, int gid, SplineFont *base) {
 return( sc );
 }
 
-static char *_MMBlendChar(MMSet *mm, int gid) {
-    int i, j, worthit = -1;
-    int all, any, any2, all2, anyend, allend, diff;
+/* The glyph being built in one of the fonts _MMBlendChar blends into */
+struct blendtarget {
+    SplineChar *sc;
+    SplinePointList *spllast;
+    RefChar *reflast;
+    StemInfo *hlast;
+    KernPair *kplast;
+};
+
+/* Checks that glyph gid matches in all the masters, and empties it in */
+/*  each of cnt fonts (creating it if it's missing and will be needed) */
+/*  ready to be blended. Sets *worthit if there's anything to blend */
+static char *MMPrepareGlyph(MMSet *mm, int gid, SplineFont **fonts, int cnt, int *worthit) {
+    int i, k;
     SplineChar *sc;
-    SplinePointList *spls[MmMax], *spl, *spllast;
-    SplinePoint *tos[MmMax], *to;
-    RefChar *refs[MmMax], *ref, *reflast;
-    KernPair *kp0, *kptest, *kp, *kplast;
-    StemInfo *hs[MmMax], *h, *hlast;
-    real width;
 
+    *worthit = -1;
     for ( i=0; i<mm->instance_count; ++i ) {
 	if ( mm->instances[i]->layers[ly_fore].order2 )
 return( _("One of the multiple master instances contains quadratic splines. It must be converted to cubic splines before it can be used in a multiple master") );
 	if ( gid>=mm->instances[i]->glyphcnt )
 return( _("The different instances of this mm have a different number of glyphs") );
 	if ( SCWorthOutputting(mm->instances[i]->glyphs[gid]) ) {
-	    if ( worthit == -1 ) worthit = true;
-	    else if ( worthit != true )
+	    if ( *worthit == -1 ) *worthit = true;
+	    else if ( *worthit != true )
 return( _("This glyph is defined in one instance font but not in another") );
 	} else {
-	    if ( worthit == -1 ) worthit = false;
-	    else if ( worthit != false )
+	    if ( *worthit == -1 ) *worthit = false;
+	    else if ( *worthit != false )
 return( _("This glyph is defined in one instance font but not in another") );
 	}
     }
 
-    sc = mm->normal->glyphs[gid];
-    if ( sc!=NULL ) {
-	SCClearContents(sc,ly_fore);
-	KernPairsFree(sc->kerns);
-	sc->kerns = NULL;
-	KernPairsFree(sc->vkerns);
-	sc->vkerns = NULL;
+    for ( k=0; k<cnt; ++k ) {
+	sc = fonts[k]->glyphs[gid];
+	if ( sc!=NULL ) {
+	    SCClearContents(sc,ly_fore);
+	    KernPairsFree(sc->kerns);
+	    sc->kerns = NULL;
+	    KernPairsFree(sc->vkerns);
+	    sc->vkerns = NULL;
+	} else if ( *worthit )
+	    SFMakeGlyphLike(fonts[k],gid,mm->instances[0]);
     }
+return( NULL );
+}
 
-    if ( !worthit )
-return( 0 );
+/* Blends glyph gid of the masters into each of cnt fonts, fonts[k] with */
+/*  the instance weights in weights[k]. The masters' contours, references, */
+/*  hints and kerns are walked once, and every value found is folded into */
+/*  all the fonts at once. MMPrepareGlyph must have been called first. */
+/*  This touches nothing but glyph gid in each font, so several glyphs may */
+/*  be blended at once on different threads */
+static char *_MMBlendChar(MMSet *mm, int gid, SplineFont **fonts, real **weights, int cnt) {
+    int i, j, k;
+    int all, any, any2, all2, anyend, allend, diff;
+    SplinePointList *spls[MmMax], *spl;
+    SplinePoint *tos[MmMax], *to;
+    RefChar *refs[MmMax], *ref;
+    struct reflayer *layers;
+    KernPair *kp0, *kptests[MmMax], *kp;
+    StemInfo *hs[MmMax], *h;
+    struct blendtarget *bt;
+    real width, *w;
+    char *ret = NULL;
 
-    if ( sc==NULL )
-	sc = SFMakeGlyphLike(mm->normal,gid,mm->instances[0]);
+    bt = calloc(cnt,sizeof(struct blendtarget));
+    for ( k=0; k<cnt; ++k )
+	bt[k].sc = fonts[k]->glyphs[gid];
 
 	/* Blend references => blend transformation matrices */
     diff = false;
@@ -351,25 +383,29 @@ return( 0 );
 	if ( refs[i]!=NULL ) any = true;
 	else all = false;
     }
-    reflast = NULL;
     while ( all ) {
-	ref = RefCharCreate();
-	*ref = *refs[0];
-	ref->layers[0].splines = NULL;
-	ref->next = NULL;
-	memset(ref->transform,0,sizeof(ref->transform));
-	ref->sc = mm->normal->glyphs[refs[0]->sc->orig_pos];
-	for ( i=0; i<mm->instance_count; ++i ) {
-	    if ( ref->sc->orig_pos!=refs[i]->sc->orig_pos )
+	for ( i=0; i<mm->instance_count; ++i )
+	    if ( refs[0]->sc->orig_pos!=refs[i]->sc->orig_pos )
 		diff = true;
-	    for ( j=0; j<6; ++j )
-		ref->transform[j] += refs[i]->transform[j]*mm->defweights[i];
+	for ( k=0; k<cnt; ++k ) {
+	    ref = RefCharCreate();
+	    layers = ref->layers;
+	    *ref = *refs[0];
+	    ref->layers = layers;	/* Don't share the master's */
+	    ref->layer_cnt = 1;
+	    ref->next = NULL;
+	    memset(ref->transform,0,sizeof(ref->transform));
+	    ref->sc = fonts[k]->glyphs[refs[0]->sc->orig_pos];
+	    w = weights[k];
+	    for ( i=0; i<mm->instance_count; ++i )
+		for ( j=0; j<6; ++j )
+		    ref->transform[j] += refs[i]->transform[j]*w[i];
+	    if ( bt[k].reflast==NULL )
+		bt[k].sc->layers[ly_fore].refs = ref;
+	    else
+		bt[k].reflast->next = ref;
+	    bt[k].reflast = ref;
 	}
-	if ( reflast==NULL )
-	    sc->layers[ly_fore].refs = ref;
-	else
-	    reflast->next = ref;
-	reflast = ref;
 	any = false; all = true;
 	for ( i=0; i<mm->instance_count; ++i ) {
 	    refs[i] = refs[i]->next;
@@ -377,20 +413,27 @@ return( 0 );
 	    else all = false;
 	}
     }
-    if ( any )
-return( _("This glyph contains a different number of references in different instances") );
-    if ( diff )
-return( _("A reference in this glyph refers to a different encoding in different instances") );
+    if ( any ) {
+	ret = _("This glyph contains a different number of references in different instances");
+  goto done;
+    }
+    if ( diff ) {
+	ret = _("A reference in this glyph refers to a different encoding in different instances");
+  goto done;
+    }
 
 	/* Blend Width */
-    width = 0;
-    for ( i=0; i<mm->instance_count; ++i )
-	width += mm->instances[i]->glyphs[gid]->width*mm->defweights[i];
-    sc->width = width;
-    width = 0;
-    for ( i=0; i<mm->instance_count; ++i )
-	width += mm->instances[i]->glyphs[gid]->vwidth*mm->defweights[i];
-    sc->vwidth = width;
+    for ( k=0; k<cnt; ++k ) {
+	w = weights[k];
+	width = 0;
+	for ( i=0; i<mm->instance_count; ++i )
+	    width += mm->instances[i]->glyphs[gid]->width*w[i];
+	bt[k].sc->width = width;
+	width = 0;
+	for ( i=0; i<mm->instance_count; ++i )
+	    width += mm->instances[i]->glyphs[gid]->vwidth*w[i];
+	bt[k].sc->vwidth = width;
+    }
 
 	/* Blend Splines */
     any = false; all = true;
@@ -399,42 +442,46 @@ return( _("A reference in this glyph refers to a different encoding in different
 	if ( spls[i]!=NULL ) any = true;
 	else all = false;
     }
-    spllast = NULL;
     while ( all ) {
-	spl = chunkalloc(sizeof(SplinePointList));
-	if ( spllast==NULL )
-	    sc->layers[ly_fore].splines = spl;
-	else
-	    spllast->next = spl;
-	spllast = spl;
+	for ( k=0; k<cnt; ++k ) {
+	    spl = chunkalloc(sizeof(SplinePointList));
+	    if ( bt[k].spllast==NULL )
+		bt[k].sc->layers[ly_fore].splines = spl;
+	    else
+		bt[k].spllast->next = spl;
+	    bt[k].spllast = spl;
+	}
 	for ( i=0; i<mm->instance_count; ++i )
 	    tos[i] = spls[i]->first;
 	all2 = true;
-	spl->last = NULL;
 	while ( all2 ) {
-	    to = chunkalloc(sizeof(SplinePoint));
-	    to->nonextcp = tos[0]->nonextcp;
-	    to->noprevcp = tos[0]->noprevcp;
-	    to->nextcpdef = tos[0]->nextcpdef;
-	    to->prevcpdef = tos[0]->prevcpdef;
-	    to->pointtype = tos[0]->pointtype;
-	    if ( tos[0]->hintmask!=NULL ) {
-		to->hintmask = chunkalloc(sizeof(HintMask));
-		memcpy(to->hintmask,tos[0]->hintmask,sizeof(HintMask));
-	    }
-	    for ( i=0; i<mm->instance_count; ++i ) {
-		to->me.x += tos[i]->me.x*mm->defweights[i];
-		to->me.y += tos[i]->me.y*mm->defweights[i];
-		to->nextcp.x += tos[i]->nextcp.x*mm->defweights[i];
-		to->nextcp.y += tos[i]->nextcp.y*mm->defweights[i];
-		to->prevcp.x += tos[i]->prevcp.x*mm->defweights[i];
-		to->prevcp.y += tos[i]->prevcp.y*mm->defweights[i];
+	    for ( k=0; k<cnt; ++k ) {
+		to = chunkalloc(sizeof(SplinePoint));
+		to->nonextcp = tos[0]->nonextcp;
+		to->noprevcp = tos[0]->noprevcp;
+		to->nextcpdef = tos[0]->nextcpdef;
+		to->prevcpdef = tos[0]->prevcpdef;
+		to->pointtype = tos[0]->pointtype;
+		if ( tos[0]->hintmask!=NULL ) {
+		    to->hintmask = chunkalloc(sizeof(HintMask));
+		    memcpy(to->hintmask,tos[0]->hintmask,sizeof(HintMask));
+		}
+		w = weights[k];
+		for ( i=0; i<mm->instance_count; ++i ) {
+		    to->me.x += tos[i]->me.x*w[i];
+		    to->me.y += tos[i]->me.y*w[i];
+		    to->nextcp.x += tos[i]->nextcp.x*w[i];
+		    to->nextcp.y += tos[i]->nextcp.y*w[i];
+		    to->prevcp.x += tos[i]->prevcp.x*w[i];
+		    to->prevcp.y += tos[i]->prevcp.y*w[i];
+		}
+		spl = bt[k].spllast;
+		if ( spl->last==NULL )
+		    spl->first = to;
+		else
+		    SplineMake3(spl->last,to);
+		spl->last = to;
 	    }
-	    if ( spl->last==NULL )
-		spl->first = to;
-	    else
-		SplineMake3(spl->last,to);
-	    spl->last = to;
 	    any2 = false; all2 = true;
 	    for ( i=0; i<mm->instance_count; ++i ) {
 		if ( tos[i]->next==NULL ) tos[i] = NULL;
@@ -442,20 +489,27 @@ return( _("A reference in this glyph refers to a different encoding in different
 		if ( tos[i]!=NULL ) any2 = true;
 		else all2 = false;
 	    }
-	    if ( !all2 && any2 )
-return( _("A contour in this glyph contains a different number of points in different instances") );
+	    if ( !all2 && any2 ) {
+		ret = _("A contour in this glyph contains a different number of points in different instances");
+  goto done;
+	    }
 	    anyend = false; allend = true;
 	    for ( i=0; i<mm->instance_count; ++i ) {
 		if ( tos[i]==spls[i]->first ) anyend = true;
 		else allend = false;
 	    }
 	    if ( allend ) {
-		SplineMake3(spl->last,spl->first);
-		spl->last = spl->first;
+		for ( k=0; k<cnt; ++k ) {
+		    spl = bt[k].spllast;
+		    SplineMake3(spl->last,spl->first);
+		    spl->last = spl->first;
+		}
 	break;
 	    }
-	    if ( anyend )
-return( _("A contour in this glyph contains a different number of points in different instances") );
+	    if ( anyend ) {
+		ret = _("A contour in this glyph contains a different number of points in different instances");
+  goto done;
+	    }
 	}
 	any = false; all = true;
 	for ( i=0; i<mm->instance_count; ++i ) {
@@ -464,8 +518,10 @@ return( _("A contour in this glyph contains a different number of points in diff
 	    else all = false;
 	}
     }
-    if ( any )
-return( _("This glyph contains a different number of contours in different instances") );
+    if ( any ) {
+	ret = _("This glyph contains a different number of contours in different instances");
+  goto done;
+    }
 
 	/* Blend hints */
     for ( j=0; j<2; ++j ) {
@@ -475,24 +531,28 @@ return( _("This glyph contains a different number of contours in different insta
 	    if ( hs[i]!=NULL ) any = true;
 	    else all = false;
 	}
-	hlast = NULL;
+	for ( k=0; k<cnt; ++k )
+	    bt[k].hlast = NULL;
 	while ( all ) {
-	    h = chunkalloc(sizeof(StemInfo));
-	    *h = *hs[0];
-	    h->where = NULL;
-	    h->next = NULL;
-	    h->start = h->width = 0;
-	    for ( i=0; i<mm->instance_count; ++i ) {
-		h->start += hs[i]->start*mm->defweights[i];
-		h->width += hs[i]->width*mm->defweights[i];
+	    for ( k=0; k<cnt; ++k ) {
+		h = chunkalloc(sizeof(StemInfo));
+		*h = *hs[0];
+		h->where = NULL;
+		h->next = NULL;
+		h->start = h->width = 0;
+		w = weights[k];
+		for ( i=0; i<mm->instance_count; ++i ) {
+		    h->start += hs[i]->start*w[i];
+		    h->width += hs[i]->width*w[i];
+		}
+		if ( bt[k].hlast!=NULL )
+		    bt[k].hlast->next = h;
+		else if ( j )
+		    bt[k].sc->hstem = h;
+		else
+		    bt[k].sc->vstem = h;
+		bt[k].hlast = h;
 	    }
-	    if ( hlast!=NULL )
-		hlast->next = h;
-	    else if ( j )
-		sc->hstem = h;
-	    else
-		sc->vstem = h;
-	    hlast = h;
 	    any = false; all = true;
 	    for ( i=0; i<mm->instance_count; ++i ) {
 		hs[i] = hs[i]->next;
@@ -500,48 +560,113 @@ return( _("This glyph contains a different number of contours in different insta
 		else all = false;
 	    }
 	}
-	if ( any )
-return( _("This glyph contains a different number of hints in different instances") );
+	if ( any ) {
+	    ret = _("This glyph contains a different number of hints in different instances");
+  goto done;
+	}
     }
 
 	/* Blend kernpairs */
     /* I'm not requiring ordered kerning pairs */
     /* I'm not bothering with vertical kerning */
-    kp0 = mm->instances[0]->glyphs[gid]->kerns;
-    kplast = NULL;
-    while ( kp0!=NULL ) {
-	int off = kp0->off*mm->defweights[0];
+    for ( kp0 = mm->instances[0]->glyphs[gid]->kerns; kp0!=NULL; kp0 = kp0->next ) {
+	kptests[0] = kp0;
 	for ( i=1; i<mm->instance_count; ++i ) {
-	    for ( kptest=mm->instances[i]->glyphs[gid]->kerns; kptest!=NULL; kptest=kptest->next )
-		if ( kptest->sc->orig_pos==kp0->sc->orig_pos )
+	    for ( kptests[i]=mm->instances[i]->glyphs[gid]->kerns; kptests[i]!=NULL; kptests[i]=kptests[i]->next )
+		if ( kptests[i]->sc->orig_pos==kp0->sc->orig_pos )
 	    break;
-	    if ( kptest==NULL )
-return( _("This glyph contains different kerning pairs in different instances") );
-	    off += kptest->off*mm->defweights[i];
+	    if ( kptests[i]==NULL ) {
+		ret = _("This glyph contains different kerning pairs in different instances");
+  goto done;
+	    }
+	}
+	for ( k=0; k<cnt; ++k ) {
+	    int off = 0;
+	    w = weights[k];
+	    for ( i=0; i<mm->instance_count; ++i )
+		off += kptests[i]->off*w[i];
+	    kp = chunkalloc(sizeof(KernPair));
+	    kp->sc = fonts[k]->glyphs[kp0->sc->orig_pos];
+	    kp->off = off;
+	    kp->subtable = kp0->subtable;
+	    if ( bt[k].kplast!=NULL )
+		bt[k].kplast->next = kp;
+	    else
+		bt[k].sc->kerns = kp;
+	    bt[k].kplast = kp;
 	}
-	kp = chunkalloc(sizeof(KernPair));
-	kp->sc = mm->normal->glyphs[kp0->sc->orig_pos];
-	kp->off = off;
-	kp->subtable = kp0->subtable;
-	if ( kplast!=NULL )
-	    kplast->next = kp;
-	else
-	    sc->kerns = kp;
-	kplast = kp;
-	kp0 = kp0->next;
     }
-return( 0 );
+  done:
+    free(bt);
+return( ret );
+}
+
+/* The subtable of sf that a kerning pair blended from one in the subtable */
+/*  from (which belongs to the first master) should go in. If sf has no */
+/*  subtable of that name one is made, in a lookup like from's */
+static struct lookup_subtable *MMKernSubtable(SplineFont *sf, struct lookup_subtable *from) {
+    OTLookup *otl;
+    struct lookup_subtable *sub, *test;
+
+    if ( from==NULL )
+return( NULL );
+    if ( (sub = SFFindLookupSubtable(sf,from->subtable_name))!=NULL )
+return( sub );
+    if ( (otl = SFFindLookup(sf,from->lookup->lookup_name))==NULL ) {
+	otl = chunkalloc(sizeof(OTLookup));
+	otl->lookup_type = from->lookup->lookup_type;
+	/* The new font has no mark classes or sets for the flags to name */
+	otl->lookup_flags = from->lookup->lookup_flags &
+		(pst_r2l|pst_ignorebaseglyphs|pst_ignoreligatures|pst_ignorecombiningmarks);
+	otl->lookup_name = copy(from->lookup->lookup_name);
+	otl->features = FeatureListCopy(from->lookup->features);
+	otl->store_in_afm = from->lookup->store_in_afm;
+	SortInsertLookup(sf,otl);
+    }
+    sub = chunkalloc(sizeof(struct lookup_subtable));
+    sub->subtable_name = copy(from->subtable_name);
+    sub->lookup = otl;
+    sub->per_glyph_pst_or_kern = true;
+    sub->vertical_kerning = from->vertical_kerning;
+    sub->separation = from->separation;
+    sub->minkern = from->minkern;
+    if ( otl->subtables==NULL )
+	otl->subtables = sub;
+    else {
+	for ( test=otl->subtables; test->next!=NULL; test=test->next );
+	test->next = sub;
+    }
+return( sub );
+}
+
+/* Blended kerning pairs are left pointing at the first master's subtables */
+/*  (threads can't add lookups), this moves those of sc to its font's own */
+static void MMFixKernSubtables(SplineFont *sf, SplineChar *sc) {
+    struct lookup_subtable *from = NULL, *to = NULL;
+    KernPair *kp;
+
+    for ( kp=sc->kerns; kp!=NULL; kp=kp->next ) {
+	if ( kp->subtable!=from ) {
+	    from = kp->subtable;
+	    to = MMKernSubtable(sf,from);
+	}
+	kp->subtable = to;
+    }
 }
 
 char *MMBlendChar(MMSet *mm, int gid) {
     char *ret;
     RefChar *ref;
+    int worthit;
 
     if ( gid>=mm->normal->glyphcnt )
 return( _("The different instances of this mm have a different number of glyphs") );
-    ret = _MMBlendChar(mm,gid);
+    ret = MMPrepareGlyph(mm,gid,&mm->normal,1,&worthit);
+    if ( ret==NULL && worthit )
+	ret = _MMBlendChar(mm,gid,&mm->normal,&mm->defweights,1);
     if ( mm->normal->glyphs[gid]!=NULL ) {
 	SplineChar *sc = mm->normal->glyphs[gid];
+	MMFixKernSubtables(mm->normal,sc);
 	for ( ref=sc->layers[ly_fore].refs; ref!=NULL; ref=ref->next ) {
 	    SCReinstanciateRefChar(sc,ref,ly_fore);
 	    SCMakeDependent(sc,ref->sc);
@@ -550,7 +675,7 @@ return( _("The different instances of this mm have a different number of glyphs"
 return(ret);
 }
 
-static struct psdict *BlendPrivate(struct psdict *private,MMSet *mm) {
+static struct psdict *BlendPrivate(struct psdict *private,MMSet *mm,real *weights) {
     struct psdict *other;
     real sum, val;
     char *data;
@@ -571,7 +696,7 @@ return( private );
 	for ( j=0; j<mm->instance_count; ++j ) {
 	    i = PSDictFindEntry(mm->instances[j]->private,"ForceBold");
 	    if ( i!=-1 && strcmp(mm->instances[j]->private->values[i],"true")==0 )
-		sum += mm->defweights[j];
+		sum += weights[j];
 	}
 	data = ( sum>=val ) ? "true" : "false";
 	PSDictChangeEntry(private,"ForceBold",data);
@@ -594,7 +719,7 @@ return( private );
 		val = strtod(values[j],&end);
 		if ( end==values[j])
 	    break;
-		sum += val*mm->defweights[j];
+		sum += val*weights[j];
 	    }
 	    if ( j!=mm->instance_count )
     continue;
@@ -617,7 +742,7 @@ return( private );
 		sum = 0;
 		for ( j=0; j<mm->instance_count; ++j ) {
 		    val = strtod(values[j],&end);
-		    sum += val*mm->defweights[j];
+		    sum += val*weights[j];
 		    while ( *end==' ' ) ++end;
 		    values[j] = end;
 		}
@@ -635,19 +760,75 @@ return( private );
 return( private );
 }
 
-int MMReblend(FontViewBase *fv, MMSet *mm) {
-    char *olderr, *err;
-    int i, first = -1;
-    SplineFont *sf = mm->instances[0];
+struct blendjob {
+    MMSet *mm;
+    SplineFont **fonts;
+    real **weights;
+    int cnt;
+    char **errs;
+    uint8_t *worthit;
+};
+
+static void MMBlendThread(void *_job, int gid) {
+    struct blendjob *job = _job;
+
+    if ( job->worthit[gid] )
+	job->errs[gid] = _MMBlendChar(job->mm,gid,job->fonts,job->weights,job->cnt);
+}
+
+/* Blends every glyph of the masters into each of cnt fonts, glyphs being */
+/*  spread over several threads. Returns the problem found with each glyph */
+/*  (or NULL), for the *_gcnt glyphs looked at */
+static char **MMBlendFonts(MMSet *mm, SplineFont **fonts, real **weights, int cnt, int *_gcnt) {
+    struct blendjob job;
+    SplineFont *sf;
     RefChar *ref;
+    int i, k, worthit, gcnt = mm->instances[0]->glyphcnt;
+
+    for ( k=0; k<cnt; ++k )
+	if ( fonts[k]->glyphcnt<gcnt )
+	    gcnt = fonts[k]->glyphcnt;
+    job.mm = mm;
+    job.fonts = fonts;
+    job.weights = weights;
+    job.cnt = cnt;
+    job.errs = calloc(gcnt+1,sizeof(char *));
+    job.worthit = calloc(gcnt+1,sizeof(uint8_t));
+    /* Emptying a glyph updates the glyphs it refers to, and references and */
+    /*  kerning pairs point at other glyphs of the same font, so all glyphs */
+    /*  are made ready before the threads start */
+    for ( i=0; i<gcnt; ++i ) {
+	job.errs[i] = MMPrepareGlyph(mm,i,fonts,cnt,&worthit);
+	job.worthit[i] = job.errs[i]==NULL && worthit;
+    }
+    FFParallelFor(gcnt,MMBlendThread,&job);
+    free(job.worthit);
+
+    for ( k=0; k<cnt; ++k ) {
+	sf = fonts[k];
+	for ( i=0; i<sf->glyphcnt; ++i ) if ( sf->glyphs[i]!=NULL ) {
+	    MMFixKernSubtables(sf,sf->glyphs[i]);
+	    for ( ref=sf->glyphs[i]->layers[ly_fore].refs; ref!=NULL; ref=ref->next ) {
+		SCReinstanciateRefChar(sf->glyphs[i],ref,ly_fore);
+		SCMakeDependent(sf->glyphs[i],ref->sc);
+	    }
+	}
+    }
+    *_gcnt = gcnt;
+return( job.errs );
+}
+
+int MMReblend(FontViewBase *fv, MMSet *mm) {
+    char *olderr, *err, **errs;
+    int i, gcnt, first = -1;
+    SplineFont *sf = mm->normal;
 
+    errs = MMBlendFonts(mm,&mm->normal,&mm->defweights,1,&gcnt);
     olderr = NULL;
-    for ( i=0; i<sf->glyphcnt; ++i ) {
-	if ( i>=mm->normal->glyphcnt )
-    break;
-	err = MMBlendChar(mm,i);
-	if ( mm->normal->glyphs[i]!=NULL )
-	    _SCCharChangedUpdate(mm->normal->glyphs[i],ly_fore,-1);
+    for ( i=0; i<gcnt; ++i ) {
+	if ( sf->glyphs[i]!=NULL )
+	    _SCCharChangedUpdate(sf->glyphs[i],ly_fore,-1);
+	err = errs[i];
 	if ( err==NULL )
     continue;
 	if ( olderr==NULL ) {
@@ -665,15 +846,9 @@ int MMReblend(FontViewBase *fv, MMSet *mm) {
 		fv->selected[enc] = true;
 	}
     }
+    free(errs);
 
-    sf = mm->normal;
-    for ( i=0; i<sf->glyphcnt; ++i ) if ( sf->glyphs[i]!=NULL ) {
-	for ( ref=sf->glyphs[i]->layers[ly_fore].refs; ref!=NULL; ref=ref->next ) {
-	    SCReinstanciateRefChar(sf->glyphs[i],ref,ly_fore);
-	    SCMakeDependent(sf->glyphs[i],ref->sc);
-	}
-    }
-    sf->private = BlendPrivate(sf->private,mm);
+    sf->private = BlendPrivate(sf->private,mm,mm->defweights);
 
     if ( olderr == NULL )	/* No Errors */
 return( true );
@@ -792,7 +967,7 @@ FontViewBase *MMCreateBlendedFont(MMSet *mm,FontViewBase *fv,real blends[MmMax],
 	free(new->fontname); free(new->fullname);
 	new->fontname = fn; new->fullname = full;
 	new->weight = _MMGuessWeight(mm,axispos,new->weight);
-	new->private = BlendPrivate(PSDictCopy(hold->private),mm);
+	new->private = BlendPrivate(PSDictCopy(hold->private),mm,mm->defweights);
 	new->fv = NULL;
 	fv = FontViewCreate(new,false);
 	MMReblend(fv,mm);
@@ -812,6 +987,123 @@ FontViewBase *MMCreateBlendedFont(MMSet *mm,FontViewBase *fv,real blends[MmMax],
 return( fv );
 }
 
+/* Runs the font's NormalizeDesignVector and ConvertDesignVector procedures */
+/*  on a design vector. Returns the number of weights left in stack, which */
+/*  should be the number of instances */
+int MMConvertDesignVector(real *designs, int dcnt, char *ndv, char *cdv,
+	real *stack) {
+    char *temp, dv[101];
+    int j, len, cnt;
+
+    /* PostScript parses things in "C" locale too */
+    locale_t tmplocale; locale_t oldlocale; // Declare temporary locale storage.
+    switch_to_c_locale(&tmplocale, &oldlocale); // Switch to the C locale temporarily and cache the old locale.
+    len = 0;
+    for ( j=0; j<dcnt; ++j ) {
+	sprintf(dv+len, "%g ", (double) designs[j]);
+	len += strlen(dv+len);
+    }
+    switch_to_old_locale(&tmplocale, &oldlocale); // Switch to the cached locale.
+
+    temp = malloc(len+strlen(ndv)+strlen(cdv)+20);
+    strcpy(temp,dv);
+    /*strcpy(temp+len++," ");*/		/* dv always will end in a space */
+
+    while ( isspace(*ndv)) ++ndv;
+    if ( *ndv=='{' )
+	++ndv;
+    strcpy(temp+len,ndv);
+    len += strlen(temp+len);
+    while ( len>0 && (temp[len-1]==' '||temp[len-1]=='\n') ) --len;
+    if ( len>0 && temp[len-1]=='}' ) --len;
+
+    while ( isspace(*cdv)) ++cdv;
+    if ( *cdv=='{' )
+	++cdv;
+    strcpy(temp+len,cdv);
+    len += strlen(temp+len);
+    while ( len>0 && (temp[len-1]==' '||temp[len-1]=='\n') ) --len;
+    if ( len>0 && temp[len-1]=='}' ) --len;
+
+    cnt = EvaluatePS(temp,stack,MmMax);
+    free(temp);
+return( cnt );
+}
+
+SplineFont **MMCreateInstances(MMSet *mm, int cnt, real *designs) {
+    SplineFont **fonts, *new, *base = mm->normal;
+    real **weights, *wbuf, axispos[4];
+    char **errs, *fn, *full;
+    int i, k, gcnt;
+
+    if ( mm->apple ) {
+	LogError( _("Instances can only be made from an Adobe multiple master font\n") );
+return( NULL );
+    }
+    if ( mm->ndv==NULL || mm->cdv==NULL ) {
+	LogError( _("This multiple master font has no design vector functions\n") );
+return( NULL );
+    }
+    weights = malloc(cnt*sizeof(real *));
+    wbuf = malloc(cnt*MmMax*sizeof(real));
+    for ( k=0; k<cnt; ++k ) {
+	weights[k] = wbuf+k*MmMax;
+	if ( MMConvertDesignVector(designs+k*mm->axis_count,mm->axis_count,
+		mm->ndv,mm->cdv,weights[k])!=mm->instance_count ) {
+	    LogError( _("The design vector of instance %d could not be converted into weights\n"), k );
+	    free(wbuf); free(weights);
+return( NULL );
+	}
+    }
+
+    fonts = malloc(cnt*sizeof(SplineFont *));
+    for ( k=0; k<cnt; ++k ) {
+	fonts[k] = new = MMNewFont(mm,-1,base->familyname);
+	MMWeightsUnMap(weights[k],axispos,mm->axis_count);
+	fn = _MMMakeFontname(mm,axispos,&full);
+	free(new->fontname); free(new->fullname);
+	new->fontname = fn; new->fullname = full;
+	new->weight = _MMGuessWeight(mm,axispos,new->weight);
+	new->private = BlendPrivate(PSDictCopy(base->private),mm,weights[k]);
+    }
+    errs = MMBlendFonts(mm,fonts,weights,cnt,&gcnt);
+    for ( i=0; i<gcnt; ++i ) if ( errs[i]!=NULL )
+	LogError( _("Glyph %d (%s) could not be blended: %s\n"), i,
+		mm->instances[0]->glyphs[i]!=NULL ? mm->instances[0]->glyphs[i]->name : "",
+		errs[i] );
+    free(errs);
+    for ( k=0; k<cnt; ++k ) {
+	fonts[k]->mm = NULL;
+	fonts[k]->changed = true;
+    }
+    free(wbuf); free(weights);
+return( fonts );
+}
+
+int MMGenerateInstances(MMSet *mm, int cnt, real *designs, char **filenames,
+	EncMap *map, int fmflags, int layer) {
+    SplineFont **fonts;
+    char *pt;
+    int k, ok = true;
+
+    fonts = MMCreateInstances(mm,cnt,designs);
+    if ( fonts==NULL )
+return( false );
+    /* Font generation keeps its state in globals, so one at a time */
+    for ( k=0; k<cnt; ++k ) {
+	pt = strrchr(filenames[k],'.');
+	if ( pt!=NULL && strmatch(pt,".sfd")==0 ) {
+	    if ( !SFDWrite(filenames[k],fonts[k],map,NULL,false) )
+		ok = false;
+	} else if ( !GenerateScript(fonts[k],filenames[k],"",fmflags,-1,NULL,NULL,
+		map,NULL,layer) )
+	    ok = false;
+	SplineFontFree(fonts[k]);
+    }
+    free(fonts);
+return( ok );
+}
+
 /******************************************************************************/
 /*                                MM Validation                               */
 /******************************************************************************/
@@ -45,6 +45,15 @@ extern char *MMMakeMasterFontname(MMSet *mm, int ipos, char **fullname);
 extern const char *MMAxisAbrev(char *axis_name);
 extern FontViewBase *MMCreateBlendedFont(MMSet *mm, FontViewBase *fv, real blends[MmMax], int tonew);
 extern int MMReblend(FontViewBase *fv, MMSet *mm);
+extern int MMConvertDesignVector(real *designs, int dcnt, char *ndv, char *cdv, real *stack);
+/* Makes a stand alone font for each of cnt instances of an adobe mm font, */
+/*  instance k at the design vector designs[k*axis_count...]. All the */
+/*  glyphs of all the instances are blended in one pass over the masters */
+extern SplineFont **MMCreateInstances(MMSet *mm, int cnt, real *designs);
+/* Makes the instances as above and saves instance k to filenames[k], as */
+/*  sfd or in whatever format the extension indicates. map is the encoding */
+/*  of mm->normal */
+extern int MMGenerateInstances(MMSet *mm, int cnt, real *designs, char **filenames, EncMap *map, int fmflags, int layer);
 extern int MMValid(MMSet *mm, int complain);
 extern void MMKern(SplineFont *sf, SplineChar *first, SplineChar *second, int diff, struct lookup_subtable *sub, KernPair *oldkp);
 
@@ -35,6 +35,7 @@
 #include "fvcomposite.h"
 #include "fvfonts.h"
 #include "namehash.h"
+#include "psnames_hash.h"
 #include "pua.h"
 #include "ustring.h"
 #include "utype.h"
@@ -61,9 +62,14 @@ NameList *namelist_for_new_fonts = &agl_nf;
 /* 0x0163 is named tcommaaccent, 0x21B should be */
 /* 0xf6be is named dotlessj, 0x237 should be */
 
-static int psnamesinited=false;
+/* The built in names are found through the perfect hash which          */
+/*  generate_psnames_hash.py makes from the tables below (so if you change */
+/*  them, rerun it). Only namelists loaded from files go in psbuckets, and */
+/*  they take precedence. Should one of them replace a built in list, the */
+/*  perfect hash is out of date, so everything goes in psbuckets */
 #define HASH_SIZE	257
 struct psbucket { const char *name; int uni; struct psbucket *prev; } *psbuckets[HASH_SIZE];
+static int psbuiltins_replaced = false;
 
 static void psaddbucket(const char *name, int uni) {
     unsigned int hash = hashname(name);
@@ -85,24 +91,6 @@ static void NameListHash(NameList *nl) {
     }
 }
 
-static void psinitnames(void) {
-    int i;
-    NameList *nl;
-
-    agl.next = &agl_nf;
-    agl_nf.next = &agl_sans;
-    agl_sans.next = &adobepua;
-    adobepua.next = &greeksc;
-    greeksc.next = &tex;
-    tex.next = &ams;
-
-    for ( i=0; psaltnames[i].name!=NULL ; ++i )
-	psaddbucket(psaltnames[i].name,psaltnames[i].unicode);
-    for ( nl=&agl; nl!=NULL; nl=nl->next )
-	NameListHash(nl);
-    psnamesinited = true;
-}
-
 static void psreinitnames(void) {
     /* If we reread a (loaded) namelist file, then we must remove the old defn*/
     /*  which means we must remove all the old hash entries before we can put */
@@ -119,9 +107,13 @@ static void psreinitnames(void) {
 	psbuckets[i] = NULL;
     }
 
-    for ( i=0; psaltnames[i].name!=NULL ; ++i )
-	psaddbucket(psaltnames[i].name,psaltnames[i].unicode);
-    for ( nl=&agl; nl!=NULL; nl=nl->next )
+    if ( psbuiltins_replaced ) {
+	for ( i=0; psaltnames[i].name!=NULL ; ++i )
+	    psaddbucket(psaltnames[i].name,psaltnames[i].unicode);
+	nl = &agl;
+    } else
+	nl = ams.next;
+    for ( ; nl!=NULL; nl=nl->next )
 	NameListHash(nl);
 }
 
@@ -162,13 +154,13 @@ int UniFromName(const char *name,enum uni_interp interp,Encoding *encname) {
     } else if ( name[0]!='\0' && name[1]=='\0' )
 	i = ((unsigned char *) name)[0];
     if ( i==-1 ) {
-	if ( !psnamesinited )
-	    psinitnames();
 	for ( buck = psbuckets[hashname(name)]; buck!=NULL; buck=buck->prev )
 	    if ( strcmp(buck->name,name)==0 )
 	break;
 	if ( buck!=NULL )
 	    i = buck->uni;
+	else if ( !psbuiltins_replaced )
+	    i = psnames_lookup(name);
     }
     if ( !_recognizePUA && i>=0xe000 && i<=0xf8ff )
 	i = -1;
@@ -544,9 +536,6 @@ NameList *LoadNamelist(char *filename) {
     if ( file==NULL )
 return( NULL );
 
-    if ( !psnamesinited )
-	psinitnames();
-
     pt = strrchr(filename,'/');
     if ( pt==NULL ) pt = filename; else ++pt;
     title = def2utf8_copy(pt);
@@ -676,6 +665,9 @@ return( NULL );
 	    *nl2 = *nl;
 	    nl2->next = next;
 	    chunkfree(nl,sizeof(NameList));
+	    if ( nl2==&agl || nl2==&agl_nf || nl2==&agl_sans || nl2==&adobepua ||
+		    nl2==&greeksc || nl2==&tex || nl2==&ams )
+		psbuiltins_replaced = true;
 	    psreinitnames();
 return( nl2 );
 	}
@@ -4188,7 +4180,7 @@ static NameList agl_sans = {
 	NULL,
 	N_("AGL without afii"),
 	{ agl_sans_p0, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL },
-	NULL, NULL, 0, NULL
+	&adobepua, NULL, 0, NULL
 };
 
 /* ************************************************************************** */
@@ -4973,7 +4965,7 @@ static NameList agl_nf = {
 	NULL,
 	N_("AGL For New Fonts"),
 	{ agl_nf_p0, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL },
-	NULL, NULL, 0, NULL
+	&agl_sans, NULL, 0, NULL
 };
 
 /* ************************************************************************** */
@@ -7053,7 +7045,7 @@ static NameList agl = {
 	&agl_sans,
 	N_("Adobe Glyph List"),
 	{ agl_p0, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL },
-	NULL, NULL, 0, NULL
+	&agl_nf, NULL, 0, NULL
 };
 /* ************************************************************************** */
 static const char *adobepua_p0_bf6[] = {
@@ -8355,7 +8347,7 @@ static NameList adobepua = {
 	&agl,
 	N_("AGL with PUA"),
 	{ adobepua_p0, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL },
-	NULL, NULL, 0, NULL
+	&greeksc, NULL, 0, NULL
 };
 /* ************************************************************************** */
 static const char *greeksc_p0_bf5[] = {
@@ -8880,7 +8872,7 @@ static NameList greeksc = {
 	&adobepua,
 	N_("Greek small caps"),
 	{ greeksc_p0, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL },
-	NULL, NULL, 0, NULL
+	&tex, NULL, 0, NULL
 };
 /* ************************************************************************** */
 static const char *tex_p0_b20[] = {
@@ -11995,7 +11987,7 @@ static NameList tex = {
 	&agl,
 	NU_("ΤεΧ Names"),
 	{ tex_p0, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL },
-	NULL, NULL, 0, NULL
+	&ams, NULL, 0, NULL
 };
 /* ************************************************************************** */
 static const char *ams_p0_be2[] = {
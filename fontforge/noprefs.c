@@ -72,6 +72,7 @@ extern char *TTFFoundry;
 extern char *xuid;
 extern char *SaveTablesPref;
 extern int maxundoes;			/* in cvundoes */
+extern int undo_memory_limit, undo_compress;	/* in cvundoes */
 extern int prefer_cjk_encodings;	/* in parsettf */
 extern int onlycopydisplayed, copymetadata, copyttfinstr;
 extern int oldformatstate;		/* in savefontdlg.c */
@@ -166,6 +167,8 @@ static int aa_pixelsize;			/* from anchorsaway.c */
 
 extern float OpenTypeLoadHintEqualityTolerance;  /* autohint.c */
 extern float GenerateHintWidthEqualityTolerance; /* splinesave.c */
+extern float GvarIUPTolerance; /* tottfvar.c */
+extern int GenerateGlyphCache; /* tottf.c */
 
 static int gfc_showhidden, gfc_dirplace;
 static char *gfc_bookmarks=NULL;
@@ -202,6 +205,8 @@ static struct prefs_list {
     { N_("JoinSnap"), pr_real, &joinsnap, NULL, NULL, '\0', NULL, 0, N_("The Edit->Join command will join points which are this close together\nA value of 0 means they must be coincident") },
     { N_("CopyMetaData"), pr_bool, &copymetadata, NULL, NULL, '\0', NULL, 0, N_("When copying glyphs from the font view, also copy the\nglyphs' metadata (name, encoding, comment, etc).") },
     { N_("UndoDepth"), pr_int, &maxundoes, NULL, NULL, '\0', NULL, 0, N_("The maximum number of Undoes/Redoes stored in a glyph") },
+    { N_("UndoMemoryLimit"), pr_int, &undo_memory_limit, NULL, NULL, '\0', NULL, 0, N_("The most memory (in megabytes) the undoes of all open fonts may use together.\nWhen there are more the oldest undoes, of whichever font,\nare dropped (the latest undo of each glyph is always kept). 0 means no limit") },
+    { N_("CompressUndoes"), pr_bool, &undo_compress, NULL, NULL, '\0', NULL, 0, N_("Keep all but the latest undo of each glyph in a packed form\nwhich uses much less memory. This also makes scripts keep undoes") },
     { N_("AutoWidthSync"), pr_bool, &adjustwidth, NULL, NULL, '\0', NULL, 0, N_("Changing the width of a glyph\nchanges the widths of all accented\nglyphs based on it.") },
     { N_("AutoLBearingSync"), pr_bool, &adjustlbearing, NULL, NULL, '\0', NULL, 0, N_("Changing the left side bearing\nof a glyph adjusts the lbearing\nof other references in all accented\nglyphs based on it.") },
     { N_("ClearInstrsBigChanges"), pr_bool, &clear_tt_instructions_when_needed, NULL, NULL, 'C', NULL, 0, N_("Instructions in a TrueType font refer to\npoints by number, so if you edit a glyph\nin such a way that some points have different\nnumbers (add points, remove them, etc.) then\nthe instructions will be applied to the wrong\npoints with disastrous results.\n  Normally FontForge will remove the instructions\nif it detects that the points have been renumbered\nin order to avoid the above problem. You may turn\nthis behavior off -- but be careful!") },
@@ -228,7 +233,9 @@ static struct prefs_list {
 #ifndef _NO_LIBPNG
     { N_("WritePNGInSFD"), pr_bool, &WritePNGInSFD, NULL, NULL, 'B', NULL, 0, N_("If your SFD contains images, write them as PNG; this results in smaller SFDs; but was not supported in FontForge versions compiled before July 2019, so older FontForge versions cannot read them.") },
 #endif
+    { N_("GenerateGlyphCache"), pr_bool, &GenerateGlyphCache, NULL, NULL, '\0', NULL, 0, N_("Remember the TrueType outlines of the glyphs in the last few fonts generated, so that regenerating a font only converts the glyphs which have changed.") },
     { N_("GenerateHintWidthEqualityTolerance"), pr_real, &GenerateHintWidthEqualityTolerance, NULL, NULL, '\0', NULL, 0, N_( "When generating a font, ignore slight rounding errors for hints that should be at the top or bottom of the glyph. For example, you might like to set this to 0.02 so that 19.999 will be considered 20. But only for the hint width value.") },
+    { N_("GvarIUPTolerance"), pr_real, &GvarIUPTolerance, NULL, NULL, '\0', NULL, 0, N_("When generating a TrueType distortable font, leave out of the gvar table any delta that the rasterizer can interpolate from the points around it to within this many em-units. A negative value writes every delta.") },
     { N_("HintBoundingBoxes"), pr_bool, &hint_bounding_boxes, NULL, NULL, '\0', NULL, 0, N_("FontForge will place vertical or horizontal hints to describe the bounding boxes of suitable glyphs.") },
     { N_("HintDiagonalEnds"), pr_bool, &hint_diagonal_ends, NULL, NULL, '\0', NULL, 0, N_("FontForge will place vertical or horizontal hints at the ends of diagonal stems.") },
     { N_("HintDiagonalInter"), pr_bool, &hint_diagonal_intersections, NULL, NULL, '\0', NULL, 0, N_("FontForge will place vertical or horizontal hints at the intersections of diagonal stems.") },
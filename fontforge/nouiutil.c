@@ -28,6 +28,7 @@
 #include <fontforge-config.h>
 
 #include "basics.h"
+#include "parallel.h"
 #include "splinefont.h"
 #include "uiinterface.h"
 #include "ustring.h"
@@ -51,6 +52,9 @@ static void NOUI_IError(const char *format,...) {
 
 static void NOUI__LogError(const char *format,va_list ap) {
     char buffer[400], *str;
+
+    if ( FFParallelDeferLog(format,ap) )
+return;
     vsnprintf(buffer,sizeof(buffer),format,ap);
     str = utf82def_copy_safe(buffer);
     fprintf(stderr,"%s",str);
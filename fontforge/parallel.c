@@ -0,0 +1,163 @@
+/* Copyright (C) 2026 by the FontForge authors */
+/*
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+
+ * The name of the author may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <fontforge-config.h>
+
+#include "parallel.h"
+
+#include "uiinterface.h"
+
+#include <glib.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct deferred_log {
+    int index, seq;
+    char *msg;
+};
+
+struct parallel_for {
+    void (*func)(void *data, int index);
+    void *data;
+    int cnt;
+    gint next;
+    GMutex log_lock;		/* Guards the messages held back by the workers */
+    struct deferred_log *log_msgs;
+    int log_cnt, log_max;
+};
+
+/* What the current thread is doing for a loop, if anything */
+struct worker {
+    struct parallel_for *pf;
+    int index;
+};
+
+static GPrivate cur_worker;
+static gint running = 0;
+
+int FFThreadCount(void) {
+    static gsize inited = 0;
+    static int thread_cnt;
+
+    if ( g_once_init_enter(&inited) ) {
+	const char *env = getenv("FONTFORGE_THREADS");
+	int cnt = env!=NULL ? strtol(env,NULL,10) : 0;
+	if ( cnt<=0 )
+	    cnt = g_get_num_processors();
+	if ( cnt<=0 )
+	    cnt = 1;
+	thread_cnt = cnt;
+	g_once_init_leave(&inited,1);
+    }
+return( thread_cnt );
+}
+
+int FFParallelDeferLog(const char *format, va_list ap) {
+    struct worker *w = g_private_get(&cur_worker);
+    struct parallel_for *pf;
+    char *msg;
+
+    if ( w==NULL )
+return( false );
+    pf = w->pf;
+    msg = g_strdup_vprintf(format,ap);
+    g_mutex_lock(&pf->log_lock);
+    if ( pf->log_cnt>=pf->log_max )
+	pf->log_msgs = realloc(pf->log_msgs,(pf->log_max += 32)*sizeof(struct deferred_log));
+    pf->log_msgs[pf->log_cnt].index = w->index;
+    pf->log_msgs[pf->log_cnt].seq = pf->log_cnt;
+    pf->log_msgs[pf->log_cnt++].msg = msg;
+    g_mutex_unlock(&pf->log_lock);
+return( true );
+}
+
+static int deferred_cmp(const void *_l1, const void *_l2) {
+    const struct deferred_log *l1 = _l1, *l2 = _l2;
+
+    if ( l1->index!=l2->index )
+return( l1->index<l2->index ? -1 : 1 );
+return( l1->seq - l2->seq );
+}
+
+static void FlushDeferredLog(struct parallel_for *pf) {
+    int i;
+
+    qsort(pf->log_msgs,pf->log_cnt,sizeof(struct deferred_log),deferred_cmp);
+    for ( i=0; i<pf->log_cnt; ++i ) {
+	LogError("%s",pf->log_msgs[i].msg);
+	g_free(pf->log_msgs[i].msg);
+    }
+    free(pf->log_msgs);
+    pf->log_msgs = NULL;
+    pf->log_cnt = pf->log_max = 0;
+}
+
+static gpointer ParallelWorker(gpointer _pf) {
+    struct worker w, *old = g_private_get(&cur_worker);
+
+    w.pf = _pf;
+    g_private_set(&cur_worker,&w);
+    while ( (w.index = g_atomic_int_add(&w.pf->next,1)) < w.pf->cnt )
+	(w.pf->func)(w.pf->data,w.index);
+    g_private_set(&cur_worker,old);
+return( NULL );
+}
+
+void FFParallelFor(int cnt, void (*func)(void *data, int index), void *data) {
+    struct parallel_for pf;
+    GThread **threads;
+    int i, tcnt = FFThreadCount();
+
+    if ( tcnt>cnt )
+	tcnt = cnt;
+    /* A loop started from inside another one just runs in its thread */
+    if ( tcnt>1 && !g_atomic_int_compare_and_exchange(&running,0,1) )
+	tcnt = 1;
+    if ( tcnt<=1 ) {
+	for ( i=0; i<cnt; ++i )
+	    (func)(data,i);
+return;
+    }
+
+    memset(&pf,0,sizeof(pf));
+    pf.func = func;
+    pf.data = data;
+    pf.cnt = cnt;
+    g_mutex_init(&pf.log_lock);
+    /* The calling thread does its share of the work too */
+    threads = malloc((tcnt-1)*sizeof(GThread *));
+    for ( i=0; i<tcnt-1; ++i )
+	threads[i] = g_thread_new("fontforge-worker",ParallelWorker,&pf);
+    ParallelWorker(&pf);
+    for ( i=0; i<tcnt-1; ++i )
+	g_thread_join(threads[i]);
+    free(threads);
+    g_mutex_clear(&pf.log_lock);
+    g_atomic_int_set(&running,0);
+    FlushDeferredLog(&pf);
+}
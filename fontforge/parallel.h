@@ -0,0 +1,23 @@
+#ifndef FONTFORGE_PARALLEL_H
+#define FONTFORGE_PARALLEL_H
+
+#include <stdarg.h>
+
+/* Calls func(data,i) for every i in [0,cnt), spread over one thread per */
+/*  processor (or $FONTFORGE_THREADS of them). Indices are handed out one */
+/*  at a time, so items of very different cost still balance. func must  */
+/*  not touch the UI, python, or any shared state which is not its own;   */
+/*  it should leave its results in a slot belonging to i and let the      */
+/*  caller merge them afterwards, so the outcome doesn't depend on the    */
+/*  order in which the threads happened to run. Anything passed to      */
+/*  LogError while the threads run is held back, and logged once they    */
+/*  are all done, in order of index */
+extern void FFParallelFor(int cnt, void (*func)(void *data, int index), void *data);
+/* The number of threads FFParallelFor will use */
+extern int FFThreadCount(void);
+/* Called by the LogError hooks. If the current thread is working for */
+/*  FFParallelFor, keeps the message to be logged when the loop is done */
+/*  and returns true. Otherwise returns false and the hook logs it as usual */
+extern int FFParallelDeferLog(const char *format, va_list ap);
+
+#endif /* FONTFORGE_PARALLEL_H */
@@ -45,6 +45,9 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
+#if !defined(__MINGW32__)
+# include <sys/mman.h>
+#endif
 
 struct fontparse {
     FontDict *fd, *mainfd;
@@ -79,6 +82,9 @@ struct fontparse {
 
     char *vbuf, *vmax, *vpt;
     int depth;
+
+    const uint8_t *data;		/* The whole of the file being read */
+    long datalen;
 };
 
 static void copyenc(char *encoding[256], const char *std[256]) {
@@ -1202,34 +1208,20 @@ static int hex(int ch1, int ch2) {
     return( (ch1<<4)|ch2 );
 }
 
-unsigned short r;
+#define EEXEC_KEY	55665
+#define CHARSTRING_KEY	4330
 #define c1	52845
 #define c2	22719
 
-static void initcode(void) {
-    r = 55665;
-}
-
-static int decode(unsigned char cypher) {
-    unsigned char plain = ( cypher ^ (r>>8));
-    r = (cypher + r) * c1 + c2;
-return( plain );
-}
-
-static void dumpzeros(FILE *out, unsigned char *zeros, int zcnt) {
-    while ( --zcnt >= 0 )
-	fputc(*zeros++,out);
-}
-
-static void decodestr(unsigned char *str, int len) {
-    unsigned short r = 4330;
-    unsigned char plain, cypher;
+/* Each byte's key depends on the cyphertext before it, so this can only */
+/*  go one byte after another. Decrypts in place */
+static void t1decrypt(uint8_t *str, size_t len, unsigned short r) {
+    uint8_t *end = str+len, cypher;
 
-    while ( len-->0 ) {
+    while ( str<end ) {
 	cypher = *str;
-	plain = ( cypher ^ (r>>8));
+	*str++ = cypher ^ (r>>8);
 	r = (cypher + r) * c1 + c2;
-	*str++ = plain;
     }
 }
 
@@ -1258,7 +1250,7 @@ static void findstring(struct fontparse *fp,struct pschars *subrs,int index,char
 	    if ( bpt<end )
 		*bpt++ = val;
 	}
-	decodestr((unsigned char *) buffer,bpt-buffer);
+	t1decrypt((uint8_t *) buffer,bpt-buffer,CHARSTRING_KEY);
 	bs = buffer + fp->fd->private->leniv;
 	if ( bpt<bs ) bs=bpt;		/* garbage */ 
 	subrs->lens[index] = bpt-bs;
@@ -1981,7 +1973,8 @@ return;
 static void addinfo(struct fontparse *fp,char *line,char *tok,char *binstart,int binlen,FILE *in) {
     char *pt;
 
-    decodestr((unsigned char *) binstart,binlen);
+    if ( binlen>0 )
+	t1decrypt((uint8_t *) binstart,binlen,CHARSTRING_KEY);
     binstart += fp->fd->private->leniv;
     binlen -= fp->fd->private->leniv;
     if ( binlen<0 ) {
@@ -2263,34 +2256,72 @@ return( 0 );
 return( 1 );
 }
 
-static int nrandombytes[4];
 #define EODMARKLEN	16
 
-#define bgetc(extra,in)	(*(extra)=='\0' ? getc(in) : (unsigned char ) *(extra)++ )
+/* The eexec section is read from the file's data in memory, but it may */
+/*  begin with whatever followed "eexec" on the line already read */
+struct t1source {
+    const char *extra;
+    const uint8_t *pt, *end;
+};
+
+#define sgetc(s)	(*(s)->extra!='\0' ? (unsigned char) *(s)->extra++ : \
+			 (s)->pt<(s)->end ? *(s)->pt++ : EOF)
+
+/* A stream over a block of memory. Where fmemopen is missing the block */
+/*  goes through a temporary file instead */
+static FILE *PSMemFile(const uint8_t *data, size_t len) {
+    FILE *f;
+
+#if !defined(__MINGW32__)
+    if ( len>0 && (f = fmemopen((void *) data,len,"rb"))!=NULL )
+return( f );
+#endif
+    f = GFileTmpfile();
+    if ( f!=NULL ) {
+	fwrite(data,1,len,f);
+	rewind(f);
+    }
+return( f );
+}
 
-static void decrypteexec(FILE *in,FILE *temp, int hassectionheads,char *extra) {
+/* Collects the cyphertext of the eexec section (which starts at in's */
+/*  current position) and decrypts it in one pass. Returns the plaintext */
+/*  without its four random bytes, and leaves in after the section */
+static uint8_t *decrypteexec(struct fontparse *fp,FILE *in, int hassectionheads,
+	char *extra, size_t *_len) {
     int ch1, ch2, ch3, ch4, binary;
     int zcnt;
-    unsigned char zeros[EODMARKLEN+6+1];
     int sect_len=0x7fffffff;
+    struct t1source src;
+    const uint8_t *start;
+    uint8_t *cypher;
+    size_t len, n;
+    long pos = ftell(in);
 
+    *_len = 0;
     if ( extra==(void *) 5 ) extra = "";
+    if ( pos<0 || pos>fp->datalen )
+	pos = fp->datalen;
+    src.extra = extra;
+    src.pt = start = fp->data+pos;
+    src.end = fp->data+fp->datalen;
 
     /* The PLRM defines white space to include form-feed and null. The t1_spec*/
     /*  does not. The t1_spec wins here. Someone gave me a font which began */
     /*  with a formfeed and that was part of the encrypted body */
-    while ( (ch1=bgetc(extra,in))!=EOF && (ch1==' ' || ch1=='\t' || ch1=='\n' || ch1=='\r'));
+    while ( (ch1=sgetc(&src))!=EOF && (ch1==' ' || ch1=='\t' || ch1=='\n' || ch1=='\r'));
     if ( ch1==0200 && hassectionheads ) {
 	/* skip the 6 byte section header in pfb files that follows eexec */
-	ch1 = bgetc(extra,in);
-	sect_len = bgetc(extra,in);
-	sect_len |= bgetc(extra,in)<<8;
-	sect_len |= bgetc(extra,in)<<16;
-	sect_len |= bgetc(extra,in)<<24;
+	ch1 = sgetc(&src);
+	sect_len = sgetc(&src);
+	sect_len |= sgetc(&src)<<8;
+	sect_len |= sgetc(&src)<<16;
+	sect_len |= sgetc(&src)<<24;
 	sect_len -= 3;
-	ch1 = bgetc(extra,in);
+	ch1 = sgetc(&src);
     }
-    ch2 = bgetc(extra,in); ch3 = bgetc(extra,in); ch4 = bgetc(extra,in);
+    ch2 = sgetc(&src); ch3 = sgetc(&src); ch4 = sgetc(&src);
     binary = 0;
     if ( ch1<'0' || (ch1>'9' && ch1<'A') || ( ch1>'F' && ch1<'a') || (ch1>'f') ||
 	     ch2<'0' || (ch2>'9' && ch2<'A') || (ch2>'F' && ch2<'a') || (ch2>'f') ||
@@ -2298,64 +2329,76 @@ static void decrypteexec(FILE *in,FILE *temp, int hassectionheads,char *extra) {
 	     ch4<'0' || (ch4>'9' && ch4<'A') || (ch4>'F' && ch4<'a') || (ch4>'f') )
 	binary = 1;
     if ( ch1==EOF || ch2==EOF || ch3==EOF || ch4==EOF ) {
-return;
+	fseek(in,fp->datalen,SEEK_SET);
+return( NULL );
     }
 
-    initcode();
+    /* Every byte of cyphertext uses up at least one byte of input */
+    cypher = malloc(strlen(src.extra)+(src.end-src.pt)+4+1);
+    len = 0;
+    zcnt = 0;
     if ( binary ) {
-	nrandombytes[0] = decode(ch1);
-	nrandombytes[1] = decode(ch2);
-	nrandombytes[2] = decode(ch3);
-	nrandombytes[3] = decode(ch4);
-	zcnt = 0;
-	while (( ch1=bgetc(extra,in))!=EOF ) {
+	cypher[len++] = ch1; cypher[len++] = ch2;
+	cypher[len++] = ch3; cypher[len++] = ch4;
+	for (;;) {
+	    if ( hassectionheads && sect_len>1 && *src.extra=='\0' && src.pt<src.end ) {
+		/* Take the rest of the section in one go */
+		n = src.end-src.pt;
+		if ( n>(size_t) (sect_len-1) )
+		    n = sect_len-1;
+		memcpy(cypher+len,src.pt,n);
+		len += n; src.pt += n; sect_len -= n;
+	    }
+	    if ( (ch1=sgetc(&src))==EOF )
+	break;
 	    --sect_len;
 	    if ( hassectionheads ) {
 		if ( sect_len==0 && ch1==0200 ) {
-		    ch1 = bgetc(extra,in);
-		    sect_len = bgetc(extra,in);
-		    sect_len |= bgetc(extra,in)<<8;
-		    sect_len |= bgetc(extra,in)<<16;
-		    sect_len |= bgetc(extra,in)<<24;
+		    ch1 = sgetc(&src);
+		    sect_len = sgetc(&src);
+		    sect_len |= sgetc(&src)<<8;
+		    sect_len |= sgetc(&src)<<16;
+		    sect_len |= sgetc(&src)<<24;
 		    sect_len += 1;
 		    if ( ch1=='\1' )
 	break;
-		} else {
-		    dumpzeros(temp,zeros,zcnt);
-		    zcnt = 0;
-		    putc(decode(ch1),temp);
-		}
+		} else
+		    cypher[len++] = ch1;
 	    } else {
-		if ( ch1=='0' ) ++zcnt; else {dumpzeros(temp,zeros,zcnt); zcnt = 0; }
+		/* A run of zeros marks the end of the section, and isn't part of it */
+		cypher[len++] = ch1;
+		if ( ch1=='0' ) ++zcnt; else zcnt = 0;
 		if ( zcnt>EODMARKLEN )
 	break;
-		if ( zcnt==0 )
-		    putc(decode(ch1),temp);
-		else
-		    zeros[zcnt-1] = decode(ch1);
 	    }
 	}
     } else {
-	nrandombytes[0] = decode(hex(ch1,ch2));
-	nrandombytes[1] = decode(hex(ch3,ch4));
-	ch1 = bgetc(extra,in); ch2 = bgetc(extra,in); ch3 = bgetc(extra,in); ch4 = bgetc(extra,in);
-	nrandombytes[2] = decode(hex(ch1,ch2));
-	nrandombytes[3] = decode(hex(ch3,ch4));
-	zcnt = 0;
-	while (( ch1=bgetc(extra,in))!=EOF ) {
-	    while ( ch1!=EOF && isspace(ch1)) ch1 = bgetc(extra,in);
-	    while ( (ch2=bgetc(extra,in))!=EOF && isspace(ch2));
-	    if ( ch1=='0' && ch2=='0' ) ++zcnt; else { dumpzeros(temp,zeros,zcnt); zcnt = 0;}
+	cypher[len++] = hex(ch1,ch2);
+	cypher[len++] = hex(ch3,ch4);
+	ch1 = sgetc(&src); ch2 = sgetc(&src); ch3 = sgetc(&src); ch4 = sgetc(&src);
+	cypher[len++] = hex(ch1,ch2);
+	cypher[len++] = hex(ch3,ch4);
+	while (( ch1=sgetc(&src))!=EOF ) {
+	    while ( ch1!=EOF && isspace(ch1)) ch1 = sgetc(&src);
+	    while ( (ch2=sgetc(&src))!=EOF && isspace(ch2));
+	    cypher[len++] = hex(ch1,ch2);
+	    if ( ch1=='0' && ch2=='0' ) ++zcnt; else zcnt = 0;
 	    if ( zcnt>EODMARKLEN )
 	break;
-	    if ( zcnt==0 )
-		putc(decode(hex(ch1,ch2)),temp);
-	    else
-		zeros[zcnt-1] = decode(hex(ch1,ch2));
 	}
     }
-    while (( ch1=bgetc(extra,in))=='0' || isspace(ch1) );
-    if ( ch1!=EOF ) ungetc(ch1,in);
+    len -= zcnt;
+
+    while (( ch1=sgetc(&src))=='0' || isspace(ch1) );
+    /* Unless everything came from the line already read, ch1 came from the file */
+    fseek(in,(src.pt-fp->data)-(ch1!=EOF && src.pt>start ? 1 : 0),SEEK_SET);
+
+    t1decrypt(cypher,len,EEXEC_KEY);
+    len -= 4;
+    memmove(cypher,cypher+4,len);
+    cypher[len] = '\0';
+    *_len = len;
+return( cypher );
 }
 
 static void decryptagain(struct fontparse *fp,FILE *temp,char *rdtok) {
@@ -2366,42 +2409,46 @@ static void parsetype3(struct fontparse *fp,FILE *in) {
     PSFontInterpretPS(in,fp->fd->charprocs,fp->fd->encoding );
 }
 
-static unsigned char *readt1str(FILE *temp,int offset,int len,int leniv) {
-    int i;
-    unsigned char *str, *pt;
-    unsigned short r = 4330;
-    unsigned char plain, cypher;
+static unsigned char *readt1str(const uint8_t *data,int datalen,int offset,int len,int leniv) {
+    unsigned char *str;
+    int avail;
     /* The CID spec doesn't mention this, but the type 1 strings are all */
     /*  eexec encrypted (with the nested encryption). Remember leniv varies */
     /*  from fd to fd (potentially) */
     /* I'm told (by Ian Kemmish) that leniv==-1 => no eexec encryption */
 
-    fseek(temp,offset,SEEK_SET);
-    if ( leniv<0 ) {
-	str = pt = malloc(len+1);
-	for ( i=0 ; i<len; ++i )
-	    *pt++ = getc(temp);
-    } else {
-	for ( i=0; i<leniv; ++i ) {
-	    cypher = getc(temp);
-	    plain = ( cypher ^ (r>>8));
-	    r = (cypher + r) * c1 + c2;
-	}
-	str = pt = malloc(len-leniv+1);
-	for (; i<len; ++i ) {
-	    cypher = getc(temp);
-	    plain = ( cypher ^ (r>>8));
-	    r = (cypher + r) * c1 + c2;
-	    *pt++ = plain;
-	}
+    if ( len<0 )
+	len = 0;
+    avail = offset<0 || offset>datalen ? 0 : datalen-offset;
+    if ( avail>len )
+	avail = len;
+    str = malloc(len+1);
+    memcpy(str,data+offset,avail);
+    memset(str+avail,0xff,len-avail);	/* As though read at end of file */
+    if ( leniv>=0 ) {
+	t1decrypt(str,len,CHARSTRING_KEY);
+	if ( leniv>len )
+	    leniv = len;
+	memmove(str,str+leniv,len-leniv);
+	len -= leniv;
     }
-    *pt = '\0';
+    str[len] = '\0';
 return( str );
 }
 
-static void figurecids(struct fontparse *fp,FILE *temp) {
+static int t1getnum(const uint8_t *data,int datalen,int *pos,int bytes) {
+    int val = 0;
+
+    while ( --bytes>=0 ) {
+	val = (val<<8) + (*pos>=0 && *pos<datalen ? data[*pos] : -1);
+	++*pos;
+    }
+return( val );
+}
+
+static void figurecids(struct fontparse *fp,const uint8_t *data,int datalen) {
     struct fontdict *fd = fp->mainfd;
-    int i,j,k,val;
+    int i,k,val,pos;
     int *offsets;
     int cidcnt = fd->cidcnt;
     int leniv;
@@ -2413,18 +2460,15 @@ static void figurecids(struct fontparse *fp,FILE *temp) {
     offsets = malloc((cidcnt+1)*sizeof(int));
     ff_progress_change_total(cidcnt);
 
-    fseek(temp,fd->mapoffset,SEEK_SET);
+    pos = fd->mapoffset;
     for ( i=0; i<=fd->cidcnt; ++i ) {
-	for ( j=val=0; j<fd->fdbytes; ++j )
-	    val = (val<<8) + getc(temp);
+	val = t1getnum(data,datalen,&pos,fd->fdbytes);
 	if ( val >= fd->fdcnt && val!=255 ) {	/* 255 is a special mark */
 	    LogError( _("Invalid FD (%d) assigned to CID %d.\n"), val, i );
 	    val = 0;
 	}
 	fd->cidfds[i] = val;
-	for ( j=val=0; j<fd->gdbytes; ++j )
-	    val = (val<<8) + getc(temp);
-	offsets[i] = val;
+	offsets[i] = t1getnum(data,datalen,&pos,fd->gdbytes);
 	if ( i!=0 ) {
 	    fd->cidlens[i-1] = offsets[i]-offsets[i-1];
 	    if ( fd->cidlens[i-1]<0 ) {
@@ -2438,7 +2482,7 @@ static void figurecids(struct fontparse *fp,FILE *temp) {
 	if ( fd->cidlens[i]== 0 )
 	    fd->cidstrs[i] = NULL;
 	else {
-	    fd->cidstrs[i] = readt1str(temp,offsets[i],fd->cidlens[i],
+	    fd->cidstrs[i] = readt1str(data,datalen,offsets[i],fd->cidlens[i],
 		    fd->fds[fd->cidfds[i]]->private->leniv);
 	    fd->cidlens[i] -= fd->fds[fd->cidfds[i]]->private->leniv;
 	}
@@ -2462,16 +2506,14 @@ static void figurecids(struct fontparse *fp,FILE *temp) {
 	    private->subrs->lens = calloc(subrcnt,sizeof(int));
 	    leniv = private->leniv;
 	    offsets = malloc((subrcnt+1)*sizeof(int));
-	    fseek(temp,subroff,SEEK_SET);
+	    pos = subroff;
 	    for ( i=0; i<=subrcnt; ++i ) {
-		for ( j=val=0; j<sdbytes; ++j )
-		    val = (val<<8) + getc(temp);
-		offsets[i] = val;
+		offsets[i] = t1getnum(data,datalen,&pos,sdbytes);
 		if ( i!=0 )
 		    private->subrs->lens[i-1] = offsets[i]-offsets[i-1];
 	    }
 	    for ( i=0; i<subrcnt; ++i ) {
-		private->subrs->values[i] = readt1str(temp,offsets[i],
+		private->subrs->values[i] = readt1str(data,datalen,offsets[i],
 			private->subrs->lens[i],leniv);
 	    }
 	    private->subrs->next = i;
@@ -2483,11 +2525,15 @@ static void figurecids(struct fontparse *fp,FILE *temp) {
     }
 }
 
-static void dodata( struct fontparse *fp, FILE *in, FILE *temp) {
+static void dodata( struct fontparse *fp, FILE *in) {
     int binary, cnt, len;
     int ch, ch2;
     char *pt;
     char fontsetname[256];
+    uint8_t *hexdata = NULL;
+    const uint8_t *data;
+    long pos;
+    FILE *temp;
 
     while ( (ch=getc(in))!='(' && ch!='/' && ch!=EOF );
     if ( ch=='/' ) {
@@ -2518,32 +2564,39 @@ static void dodata( struct fontparse *fp, FILE *in, FILE *temp) {
     for ( pt="StartData "; *pt; ++pt )
 	getc(in);			/* And if it didn't match, what could I do about it? */
     if ( binary ) {
-	while ( cnt>0 ) {
-	    ch = getc(in);
-	    putc(ch,temp);
-	    --cnt;
-	}
+	/* Binary data can be used where they lie */
+	pos = ftell(in);
+	if ( pos<0 || pos>fp->datalen )
+	    pos = fp->datalen;
+	if ( cnt>fp->datalen-pos )
+	    cnt = fp->datalen-pos;
+	data = fp->data+pos;
+	fseek(in,pos+cnt,SEEK_SET);
     } else {
-	while ( cnt>0 ) {
+	data = hexdata = malloc(len+1);
+	for ( cnt=0; cnt<len; ++cnt ) {
 	    /* Hex data are allowed to contain whitespace */
 	    while ( isspace(ch=getc(in)) );
 	    while ( isspace(ch2=getc(in)) );
-	    ch = hex(ch,ch2);
-	    putc(ch,temp);
-	    --cnt;
+	    hexdata[cnt] = hex(ch,ch2);
 	}
 	if ( (ch=getc(in))!='>' ) ungetc(ch,in);
     }
-    rewind(temp);
     if ( fp->iscid )
-	figurecids(fp,temp);
+	figurecids(fp,data,cnt);
     else {
-	fp->fd->sf = _CFFParse(temp,len,fontsetname);
+	if ( (temp = PSMemFile(data,cnt))==NULL )
+	    LogError( _("Cannot open a temporary file\n") );
+	else {
+	    fp->fd->sf = _CFFParse(temp,cnt,fontsetname);
+	    fclose(temp);
+	}
 	fp->fd->wascff = true;
     }
+    free(hexdata);
 }
 
-static void realdecrypt(struct fontparse *fp,FILE *in, FILE *temp) {
+static void realdecrypt(struct fontparse *fp,FILE *in) {
     char buffer[1024]; /* 256 was okay, but need this much now when some lines are concatenated */
     int first, hassectionheads;
     char rdtok[20];
@@ -2611,11 +2664,20 @@ return;
 
     if ( strstr(buffer,"%%BeginData: ")!=NULL ) {
 	/* used by both CID fonts and CFF fonts (and chameleons, whatever they are) */
-	dodata(fp,in,temp);
+	dodata(fp,in);
     } else if ( strstr(buffer,"eexec")!=NULL ) {
-	decrypteexec(in,temp,hassectionheads,strstr(buffer, "eexec")+5);
-	rewind(temp);
-	decryptagain(fp,temp,rdtok);
+	size_t len;
+	uint8_t *plain = decrypteexec(fp,in,hassectionheads,strstr(buffer, "eexec")+5,&len);
+	FILE *temp;
+	if ( plain!=NULL ) {
+	    if ( (temp = PSMemFile(plain,len))==NULL )
+		LogError( _("Cannot open a temporary file\n") );
+	    else {
+		decryptagain(fp,temp,rdtok);
+		fclose(temp);
+	    }
+	    free(plain);
+	}
 	while ( myfgets(buffer,sizeof(buffer),in)!=NULL ) {
 	    if ( buffer[0]!='\200' || !hassectionheads )
 		parseline(fp,buffer,in);
@@ -2626,28 +2688,83 @@ return;
     }
 }
 
+/* Makes the whole of an ordinary file available in memory, mapped where */
+/*  the system allows */
+static int PSLoadFile(struct fontparse *fp,FILE *in,int *mapped) {
+    struct stat b;
+    long pos = ftell(in);
+    uint8_t *mem;
+
+    *mapped = false;
+    if ( pos<0 || fstat(fileno(in),&b)==-1 || !S_ISREG(b.st_mode) )
+return( false );
+    fp->datalen = b.st_size;
+#if !defined(__MINGW32__)
+    if ( fp->datalen>0 ) {
+	mem = mmap(NULL,fp->datalen,PROT_READ,MAP_PRIVATE,fileno(in),0);
+	if ( mem!=MAP_FAILED ) {
+	    fp->data = mem;
+	    *mapped = true;
+return( true );
+	}
+    }
+#endif
+    mem = malloc(fp->datalen+1);
+    fseek(in,0,SEEK_SET);
+    if ( fread(mem,1,fp->datalen,in)!=(size_t) fp->datalen ) {
+	free(mem);
+	fseek(in,pos,SEEK_SET);
+return( false );
+    }
+    fseek(in,pos,SEEK_SET);
+    fp->data = mem;
+return( true );
+}
+
+static void PSUnloadFile(struct fontparse *fp,int mapped) {
+#if !defined(__MINGW32__)
+    if ( mapped ) {
+	munmap((void *) fp->data,fp->datalen);
+return;
+    }
+#endif
+    free((void *) fp->data);
+}
+
 FontDict *_ReadPSFont(FILE *in) {
-    FILE *temp;
+    FILE *spool = NULL;
     struct fontparse fp;
     struct stat b;
+    int mapped, ch;
 
-    temp = GFileTmpfile();
-    if ( temp==NULL ) {
-	LogError( _("Cannot open a temporary file\n") );
-	fclose(in); 
+    memset(&fp,'\0',sizeof(fp));
+    if ( !PSLoadFile(&fp,in,&mapped) ) {
+	/* Not an ordinary file (a pipe, say), so copy it into one */
+	if ( (spool = GFileTmpfile())!=NULL ) {
+	    while ( (ch=getc(in))!=EOF )
+		putc(ch,spool);
+	    rewind(spool);
+	}
+	if ( spool==NULL || !PSLoadFile(&fp,spool,&mapped) ) {
+	    LogError( _("Cannot open a temporary file\n") );
+	    if ( spool!=NULL )
+		fclose(spool);
+	    fclose(in);
 return(NULL);
+	}
     }
 
     locale_t tmplocale; locale_t oldlocale; // Declare temporary locale storage.
     switch_to_c_locale(&tmplocale, &oldlocale); // Switch to the C locale temporarily and cache the old locale.
-    memset(&fp,'\0',sizeof(fp));
     fp.fd = fp.mainfd = PSMakeEmptyFont();
     fp.fdindex = -1;
-    realdecrypt(&fp,in,temp);
+    realdecrypt(&fp,spool!=NULL ? spool : in);
     free(fp.vbuf);
     switch_to_old_locale(&tmplocale, &oldlocale); // Switch to the cached locale.
 
-    fclose(temp);
+    PSUnloadFile(&fp,mapped);
+    if ( spool!=NULL )
+	fclose(spool);
 
     if ( fstat(fileno(in),&b)!=-1 ) {
 	fp.fd->modificationtime = GetST_MTime(b);
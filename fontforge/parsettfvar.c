@@ -333,7 +333,7 @@ static int PointCount(SplineChar *sc) {
 return( i );
 }
 
-static void SCShiftAllBy(SplineChar *sc,int xd, int yd) {
+static void SCShiftAllBy(SplineChar *sc,real xd, real yd) {
     /* If they change the left/right side-bearing, I think that means everything */
     /*  should be shifted over */
     SplineSet *ss;
@@ -369,108 +369,52 @@ return;
     }
 }
 
-static void VaryGlyph(SplineChar *sc,int *points, int *xdeltas, int *ydeltas,
-	int pcnt) {
+static void VaryGlyph(SplineChar *sc,real *xdeltas, real *ydeltas, int pcnt) {
     /* A character contains either composites or contours */
-    int i,j;
+    /* There is a delta for every point, including the four phantom ones */
+    int i;
     RefChar *ref;
     SplineSet *ss;
     SplinePoint *sp;
     Spline *s, *first;
 
-    if ( points[0]==ALL_POINTS ) {
-	if ( sc->layers[ly_fore].refs!=NULL ) {
-	    for ( i=0, ref=sc->layers[ly_fore].refs; ref!=NULL; ++i, ref=ref->next ) {
-		if ( xdeltas[i]!=0 || ydeltas[i]!=0 ) {
-		    ref->transform[4] += xdeltas[i];
-		    ref->transform[5] += ydeltas[i];
-		    SCReinstanciateRefChar(sc,ref,ly_fore);
-		}
-	    }
-	} else {
-	    for ( ss = sc->layers[ly_fore].splines; ss!=NULL; ss=ss->next ) {
-		for ( sp=ss->first; sp!=NULL ; ) {
-		    if ( sp->ttfindex!=0xffff && sp->ttfindex!=0xfffe ) {
-			sp->me.x += xdeltas[sp->ttfindex];
-			sp->me.y += ydeltas[sp->ttfindex];
-		    }
-		    if ( sp->nextcpindex!=0xffff && sp->nextcpindex!=0xfffe ) {
-			sp->nextcp.x += xdeltas[sp->nextcpindex];
-			sp->nextcp.y += ydeltas[sp->nextcpindex];
-			if ( sp->next!=NULL )
-			    sp->next->to->prevcp = sp->nextcp;
-		    }
-		    if ( sp->next==NULL )
-		break;
-		    sp = sp->next->to;
-		    if ( sp == ss->first )
-		break;
-		}
+    if ( sc->layers[ly_fore].refs!=NULL ) {
+	for ( i=0, ref=sc->layers[ly_fore].refs; ref!=NULL && i<pcnt-4; ++i, ref=ref->next ) {
+	    if ( xdeltas[i]!=0 || ydeltas[i]!=0 ) {
+		ref->transform[4] += xdeltas[i];
+		ref->transform[5] += ydeltas[i];
+		SCReinstanciateRefChar(sc,ref,ly_fore);
 	    }
 	}
-	SCShiftAllBy(sc,-xdeltas[pcnt-4],0);
-	SCShiftAllBy(sc,0,-ydeltas[pcnt-2]);
-	sc->width += xdeltas[pcnt-3];
-	sc->vwidth += ydeltas[pcnt-1];
     } else {
-	j = 0;
-	if ( sc->layers[ly_fore].refs!=NULL ) {
-	    for ( i=0, ref=sc->layers[ly_fore].refs; ref!=NULL; ++i, ref=ref->next ) {
-		if ( points[j]==i ) {
-		    if ( xdeltas[j]!=0 || ydeltas[j]!=0 ) {
-			ref->transform[4] += xdeltas[j];
-			ref->transform[5] += ydeltas[j];
-			SCReinstanciateRefChar(sc,ref,ly_fore);
-		    }
-		    ++j;
-		}
-	    }
-	} else {
-	    for ( i=0, ss = sc->layers[ly_fore].splines; ss!=NULL; ss=ss->next ) {
-		if ( ss->first->prev!=NULL && ss->first->prev->from->nextcpindex==points[j] ) {
-		    ss->first->prevcp.x += xdeltas[j];
-		    ss->first->prevcp.y += ydeltas[j];
-		    ss->first->prev->from->nextcp = ss->first->prevcp;
-		    ++j;
+	for ( ss = sc->layers[ly_fore].splines; ss!=NULL; ss=ss->next ) {
+	    for ( sp=ss->first; sp!=NULL ; ) {
+		if ( sp->ttfindex<pcnt-4 ) {
+		    sp->me.x += xdeltas[sp->ttfindex];
+		    sp->me.y += ydeltas[sp->ttfindex];
 		}
-		for ( sp=ss->first; sp!=NULL ; ++i ) {
-		    if ( sp->ttfindex!=0xffff && sp->ttfindex!=0xfffe )
-			++i;
-		    if ( sp->ttfindex==points[j] ) {
-			sp->me.x += xdeltas[j];
-			sp->me.y += ydeltas[j++];
-		    }
-		    if ( sp->nextcpindex!=0xffff && sp->nextcpindex!=0xfffe )
-			++i;
-		    if ( sp->nextcpindex==points[j] ) {
-			sp->nextcp.x += xdeltas[j];
-			sp->nextcp.y += ydeltas[j++];
-			if ( sp->next!=NULL )
-			    sp->next->to->prevcp = sp->nextcp;
-		    } else if ( sp->nonextcp ) {
-			sp->nextcp = sp->me;
-		    }
-		    if ( sp->next==NULL )
-		break;
-		    sp = sp->next->to;
-		    if ( sp == ss->first )
-		break;
+		if ( sp->nextcpindex<pcnt-4 ) {
+		    sp->nextcp.x += xdeltas[sp->nextcpindex];
+		    sp->nextcp.y += ydeltas[sp->nextcpindex];
+		    if ( sp->next!=NULL )
+			sp->next->to->prevcp = sp->nextcp;
 		}
-		first = NULL;
+		if ( sp->next==NULL )
+	    break;
+		sp = sp->next->to;
+		if ( sp == ss->first )
+	    break;
 	    }
 	}
-	if ( points[j]==i )
-	    SCShiftAllBy(sc,-xdeltas[j++],0);
-	if ( points[j]==i+1 )
-	    sc->width += xdeltas[j++];
-	if ( points[j]==i+2 )
-	    SCShiftAllBy(sc,0,-ydeltas[j++]);
-	if ( points[j]==i+3 )
-	    sc->vwidth += ydeltas[j++];
     }
+    SCShiftAllBy(sc,-xdeltas[pcnt-4],0);
+    SCShiftAllBy(sc,0,-ydeltas[pcnt-2]);
+    sc->width += rint(xdeltas[pcnt-3]);
+    sc->vwidth += rint(ydeltas[pcnt-1]);
+
     if ( sc->layers[ly_fore].refs==NULL ) {
 	for ( ss = sc->layers[ly_fore].splines; ss!=NULL; ss=ss->next ) {
-	    for ( sp=ss->first; sp!=NULL ; ++i ) {
+	    for ( sp=ss->first; sp!=NULL ; ) {
 		if ( sp->ttfindex==0xffff ) {
 		    sp->me.x = ( sp->nextcp.x + sp->prevcp.x )/2;
 		    sp->me.y = ( sp->nextcp.y + sp->prevcp.y )/2;
@@ -491,13 +435,108 @@ static void VaryGlyph(SplineChar *sc,int *points, int *xdeltas, int *ydeltas,
     }
 }
 
+static real IUPDelta(real c, real c1, real c2, real d1, real d2) {
+    if ( c1==c2 )
+return( d1==d2 ? d1 : 0 );
+    if ( c1>c2 ) {
+	real t;
+	t = c1; c1 = c2; c2 = t;
+	t = d1; d1 = d2; d2 = t;
+    }
+    if ( c<=c1 )
+return( d1 );
+    if ( c>=c2 )
+return( d2 );
+return( d1 + (c-c1)*(d2-d1)/(c2-c1) );
+}
+
+static void IUPContour(const real *x, const real *y, real *xd, real *yd,
+	const uint8_t *touched, int start, int end) {
+    /* Untouched points between two touched ones take their deltas by */
+    /*  interpolating between them, separately in x and in y */
+    int n = end-start+1, i, k, p, first, p1, p2, cnt;
+
+    for ( i=start, cnt=0, first=-1; i<=end; ++i ) if ( touched[i] ) {
+	if ( first==-1 ) first = i;
+	++cnt;
+    }
+    if ( cnt==0 )
+return;
+    if ( cnt==1 ) {
+	/* A single touched point moves the whole contour */
+	for ( i=start; i<=end; ++i ) {
+	    xd[i] = xd[first];
+	    yd[i] = yd[first];
+	}
+return;
+    }
+    p1 = first;
+    do {
+	for ( k=1; !touched[p2 = start+(p1-start+k)%n]; ++k );
+	for ( k=1; (p = start+(p1-start+k)%n)!=p2; ++k ) {
+	    xd[p] = IUPDelta(x[p],x[p1],x[p2],xd[p1],xd[p2]);
+	    yd[p] = IUPDelta(y[p],y[p1],y[p2],yd[p1],yd[p2]);
+	}
+	p1 = p2;
+    } while ( p1!=first );
+}
+
+static void InferDeltas(SplineChar *sc, int *points, int *xdeltas, int *ydeltas,
+	int dcnt, real *xd, real *yd, int pcnt) {
+    /* A tuple which lists only some of the points leaves the rest to be */
+    /*  inferred (IUP) from the outline of the default glyph. Points on a */
+    /*  contour with no listed point don't move, nor do unlisted component */
+    /*  offsets and phantom points */
+    uint8_t *touched;
+    real *x, *y;
+    SplineSet *ss;
+    SplinePoint *sp;
+    int j, k, idx, start, end;
+
+    touched = calloc(pcnt,1);
+    for ( j=0; j<dcnt; ++j ) if ( points[j]<pcnt ) {
+	xd[points[j]] = xdeltas[j];
+	yd[points[j]] = ydeltas[j];
+	touched[points[j]] = true;
+    }
+    if ( sc->layers[ly_fore].refs==NULL && pcnt>4 ) {
+	x = malloc(2*(pcnt-4)*sizeof(real));
+	y = x+pcnt-4;
+	for ( ss = sc->layers[ly_fore].splines; ss!=NULL; ss=ss->next ) {
+	    start = pcnt; end = -1;
+	    for ( sp=ss->first; sp!=NULL ; ) {
+		for ( k=0; k<2; ++k ) {
+		    idx = k==0 ? sp->ttfindex : sp->nextcpindex;
+		    if ( idx>=pcnt-4 )
+		continue;
+		    x[idx] = k==0 ? sp->me.x : sp->nextcp.x;
+		    y[idx] = k==0 ? sp->me.y : sp->nextcp.y;
+		    if ( idx<start ) start = idx;
+		    if ( idx>end ) end = idx;
+		}
+		if ( sp->next==NULL )
+	    break;
+		sp = sp->next->to;
+		if ( sp == ss->first )
+	    break;
+	    }
+	    /* Each contour's points are numbered consecutively */
+	    if ( end!=-1 )
+		IUPContour(x,y,xd,yd,touched,start,end);
+	}
+	free(x);
+    }
+    free(touched);
+}
+
 static void VaryGlyphs(struct ttfinfo *info,int tupleIndex,int gnum,
 	int *points, FILE *ttf ) {
     /* one annoying thing about gvar, is that the variations do not describe */
     /*  designs. well variations for [0,1] describes that design, but the */
     /*  design for [1,1] includes the variations [0,1], [1,0], and [1,1] */
-    int pcnt, tc;
+    int pcnt, dcnt, tc, i;
     int *xdeltas, *ydeltas;
+    real *xd, *yd;
     struct variations *v = info->variations;
 
     if ( info->chars[gnum]==NULL )	/* Apple doesn't support ttc so this */
@@ -507,17 +546,29 @@ return;					/*  can't happen */
 return;
     }
 
+    pcnt = PointCount(info->chars[gnum])+4;
     if ( points[0]==ALL_POINTS )
-	pcnt = PointCount(info->chars[gnum])+4;
+	dcnt = pcnt;
     else {
-	for ( pcnt=0; points[pcnt]!=END_OF_POINTS; ++pcnt );
-    }
-    xdeltas = readpackeddeltas(ttf,pcnt);
-    ydeltas = readpackeddeltas(ttf,pcnt);
-    if ( xdeltas[0]!=BAD_DELTA && ydeltas[0]!=BAD_DELTA )
+	for ( dcnt=0; points[dcnt]!=END_OF_POINTS; ++dcnt );
+    }
+    xdeltas = readpackeddeltas(ttf,dcnt);
+    ydeltas = readpackeddeltas(ttf,dcnt);
+    if ( xdeltas[0]!=BAD_DELTA && ydeltas[0]!=BAD_DELTA ) {
+	xd = calloc(2*pcnt,sizeof(real));
+	yd = xd+pcnt;
+	if ( points[0]==ALL_POINTS ) {
+	    for ( i=0; i<pcnt; ++i ) {
+		xd[i] = xdeltas[i];
+		yd[i] = ydeltas[i];
+	    }
+	} else
+	    InferDeltas(info->chars[gnum],points,xdeltas,ydeltas,dcnt,xd,yd,pcnt);
 	for ( tc = 0; tc<v->tuple_count; ++tc ) {
 	    if ( TuplesMatch(v,tc,tupleIndex))
-		VaryGlyph(v->tuples[tc].chars[gnum],points,xdeltas,ydeltas,pcnt);
+		VaryGlyph(v->tuples[tc].chars[gnum],xd,yd,pcnt);
+	}
+	free(xd);
     } else {
 	static int warned = false;
 	if ( !warned )
@@ -0,0 +1,7324 @@
+/* This is a generated file, made by generate_psnames_hash.py from */
+/*  namelist.c. Do not edit it, rerun the script instead */
+
+#ifndef FONTFORGE_PSNAMES_HASH_H
+#define FONTFORGE_PSNAMES_HASH_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define PSNAMES_CNT	7104
+#define PSNAMES_BUCKETS	1776
+
+static const uint32_t psnames_disp[PSNAMES_BUCKETS] = {
+	2, 41, 58, 5, 1, 18, 9, 54, 150, 32,
+	110, 6, 122, 4, 103, 11, 54, 65, 83, 4,
+	7, 1, 36, 14, 3, 1, 26, 1, 199, 5,
+	640, 6, 0, 38, 11, 30, 180, 6, 5, 38,
+	43, 19, 45, 12, 2, 112, 31, 5, 1, 53,
+	32, 14, 79, 100, 4, 49, 15, 142, 1, 4,
+	29, 1, 1, 4, 9, 212, 14, 53, 1, 6,
+	302, 21, 3, 302, 29, 5, 13, 24, 12, 111,
+	46, 2, 4, 6, 40, 10, 38, 24, 6, 23,
+	9, 21, 17, 1, 22, 226, 1, 215, 2, 8,
+	75, 3, 3, 15, 13, 3, 13, 3, 15, 1,
+	219, 39, 178, 19, 0, 65, 58, 2, 1, 26,
+	3, 37, 3, 23, 61, 17, 4, 1, 3, 45,
+	17, 63, 8, 1, 4, 135, 169, 12, 18, 14,
+	3, 31, 116, 26, 6, 44, 2, 155, 25, 1,
+	80, 617, 52, 11, 36, 220, 42, 22, 14, 0,
+	129, 46, 280, 65, 4, 14, 3, 28, 5, 1,
+	2, 1, 146, 143, 130, 22, 11, 55, 73, 2,
+	108, 17, 30, 119, 7, 208, 71, 47, 98, 3,
+	61, 39, 240, 97, 41, 14, 47, 81, 52, 1,
+	4, 1, 3, 4, 93, 376, 17, 3, 65, 2,
+	4, 2, 56, 7, 63, 14, 1, 3, 2, 22,
+	8, 34, 48, 0, 188, 224, 70, 21, 335, 2,
+	47, 80, 238, 55, 126, 1, 40, 88, 76, 1,
+	5, 17, 195, 22, 28, 2, 189, 18, 46, 11,
+	106, 28, 35, 4, 47, 1, 156, 105, 12, 48,
+	98, 27, 21, 200, 3, 0, 44, 40, 2, 42,
+	96, 3, 95, 1, 31, 1, 106, 3, 13, 6,
+	18, 2, 70, 29, 1, 434, 473, 1, 54, 273,
+	82, 5, 4, 37, 157, 215, 221, 46, 23, 2,
+	92, 135, 95, 28, 22, 66, 79, 3, 6, 1,
+	51, 145, 4, 32, 179, 2, 33, 1, 26, 32,
+	224, 23, 23, 28, 8, 11, 226, 1, 6, 640,
+	47, 2, 1, 6, 0, 97, 60, 19, 4, 2,
+	117, 70, 3, 17, 35, 14, 1, 9, 31, 104,
+	73, 25, 93, 108, 15, 71, 2, 161, 1, 130,
+	44, 64, 47, 1, 0, 11, 4, 24, 154, 7,
+	1, 13, 13, 31, 63, 20, 76, 3, 30, 324,
+	73, 8, 2, 37, 259, 21, 2, 28, 178, 24,
+	2, 2, 1, 623, 380, 79, 98, 1, 3, 68,
+	360, 1, 28, 1, 1, 7, 1, 324, 2, 23,
+	4, 13, 38, 51, 129, 28, 6, 129, 109, 203,
+	15, 87, 10, 70, 1, 31, 46, 10, 257, 4,
+	368, 16, 66, 71, 14, 310, 100, 265, 7, 1,
+	6, 98, 43, 30, 20, 3, 14, 1, 12, 49,
+	3, 118, 1, 108, 38, 25, 26, 11, 61, 108,
+	11, 1, 600, 70, 15, 143, 1, 462, 3, 6,
+	6, 3, 32, 292, 1, 2, 27, 82, 91, 21,
+	28, 12, 25, 1, 13, 6, 21, 9, 189, 18,
+	1, 3, 1, 72, 74, 24, 11, 30, 11, 10,
+	130, 89, 2, 353, 31, 113, 24, 3, 185, 3,
+	10, 42, 3, 0, 42, 14, 30, 116, 78, 0,
+	41, 100, 18, 8, 3, 37, 8, 18, 51, 1,
+	3, 465, 116, 60, 3, 15, 3, 5, 14, 64,
+	198, 65, 53, 0, 187, 4, 7, 7, 116, 2,
+	49, 271, 149, 17, 14, 6, 198, 261, 33, 85,
+	1, 153, 17, 1, 134, 103, 91, 269, 36, 347,
+	120, 59, 6, 192, 102, 95, 365, 41, 21, 162,
+	34, 12, 46, 253, 28, 14, 939, 219, 105, 74,
+	315, 310, 77, 5, 39, 14, 20, 154, 106, 1,
+	112, 219, 34, 15, 1, 69, 109, 71, 178, 1,
+	5, 279, 3, 251, 3, 35, 361, 43, 4, 80,
+	52, 441, 290, 286, 287, 121, 122, 83, 9, 10,
+	50, 13, 11, 10, 489, 372, 8, 25, 306, 316,
+	279, 131, 503, 188, 2, 41, 48, 7, 198, 2,
+	6, 238, 52, 144, 4, 186, 517, 13, 202, 20,
+	110, 17, 32, 173, 2, 2, 145, 230, 35, 125,
+	7, 37, 7, 33, 31, 2, 4, 34, 13, 187,
+	159, 58, 513, 2, 1, 61, 2, 10, 0, 180,
+	2, 1, 20, 132, 142, 131, 219, 1, 19, 329,
+	1, 1, 4, 16, 92, 1, 11, 3, 47, 13,
+	5, 114, 187, 372, 139, 50, 191, 72, 41, 2,
+	265, 20, 301, 62, 1, 185, 276, 2, 1, 111,
+	89, 168, 63, 41, 169, 131, 68, 4, 372, 76,
+	4, 330, 22, 752, 28, 2, 59, 343, 4, 278,
+	38, 11, 96, 125, 154, 11, 6, 20, 74, 7,
+	57, 22, 3, 14, 139, 112, 16, 31, 67, 8,
+	82, 155, 142, 36, 104, 2, 19, 474, 2, 176,
+	24, 51, 72, 41, 0, 10, 80, 1, 0, 3,
+	198, 34, 4, 2, 154, 59, 3, 2, 54, 4,
+	48, 0, 14, 3, 74, 102, 30, 1, 3, 74,
+	9, 388, 5, 105, 1, 0, 43, 10, 106, 14,
+	103, 1, 304, 5, 9, 419, 182, 312, 11, 155,
+	5, 14, 257, 8, 246, 1, 188, 6, 223, 98,
+	1, 1, 1, 21, 16, 86, 1, 687, 38, 140,
+	11, 54, 41, 168, 178, 117, 54, 180, 297, 577,
+	471, 278, 22, 13, 209, 88, 17, 97, 93, 818,
+	75, 16, 5, 1, 270, 205, 15, 3, 17, 138,
+	8, 382, 13, 140, 81, 241, 31, 68, 382, 32,
+	29, 1, 22, 386, 113, 95, 9, 1, 1, 71,
+	95, 133, 1, 27, 64, 192, 25, 223, 11, 9,
+	37, 27, 11, 126, 145, 1, 43, 190, 187, 213,
+	34, 1, 4, 80, 102, 1, 17, 217, 225, 343,
+	269, 312, 9, 14, 411, 507, 84, 5, 230, 211,
+	46, 135, 3, 4, 498, 61, 68, 32, 303, 29,
+	8, 211, 476, 33, 3, 33, 52, 96, 1, 23,
+	65, 14, 29, 180, 619, 200, 3, 880, 86, 661,
+	29, 169, 211, 286, 422, 78, 3, 9, 525, 1234,
+	2, 14, 331, 187, 26, 4, 46, 400, 143, 5,
+	619, 105, 935, 12, 1, 17, 1, 1, 2, 6,
+	23, 324, 17, 42, 148, 11, 7, 3, 77, 583,
+	9, 2, 33, 83, 40, 51, 6, 9, 25, 517,
+	1, 5, 6, 54, 923, 520, 204, 539, 6, 752,
+	4, 50, 264, 2407, 466, 68, 1383, 109, 143, 399,
+	913, 21, 142, 280, 609, 11, 1881, 707, 62, 188,
+	8, 26, 25, 15, 115, 95, 101, 297, 72, 1,
+	297, 166, 486, 58, 9, 21, 944, 9, 7, 451,
+	243, 255, 3, 107, 23, 212, 105, 4, 236, 29,
+	46, 71, 123, 3, 38, 49, 0, 268, 2, 36,
+	446, 29, 1, 375, 1, 48, 3, 6, 157, 204,
+	57, 26, 2, 165, 0, 3, 39, 5, 5, 225,
+	92, 24, 54, 150, 159, 2, 320, 37, 1, 83,
+	638, 1338, 209, 6, 22, 2, 536, 805, 25, 264,
+	3, 1, 4, 3, 77, 17, 47, 238, 85, 55,
+	17, 143, 32, 16, 41, 308, 72, 235, 8, 1856,
+	3, 16, 37, 132, 76, 231, 1, 583, 55, 0,
+	150, 225, 159, 390, 276, 656, 11, 4, 1, 37,
+	65, 255, 673, 130, 4, 369, 31, 245, 22, 126,
+	1716, 5, 36, 12, 22, 5, 445, 122, 1287, 2,
+	0, 39, 1, 101, 23, 256, 877, 113, 5, 340,
+	25, 4, 11, 331, 2, 54, 22, 1, 1, 4,
+	868, 1, 361, 8, 226, 864, 153, 720, 294, 411,
+	513, 446, 340, 1307, 22, 1, 2, 20, 308, 378,
+	64, 0, 29, 87, 477, 115, 508, 11, 632, 20,
+	13, 105, 644, 1, 187, 62, 2, 2, 3, 478,
+	24, 37, 2, 62, 2, 5, 292, 13, 4, 27,
+	3, 185, 186, 29, 188, 40, 3, 121, 201, 3,
+	6, 15, 34, 987, 3, 245, 76, 88, 27, 3,
+	17, 1008, 656, 254, 171, 64, 50, 3, 350, 2,
+	21, 443, 30, 8, 419, 83, 109, 116, 5, 480,
+	43, 476, 28, 114, 84, 548, 0, 5, 2, 100,
+	762, 25, 109, 4, 10, 236, 107, 497, 25, 77,
+	26, 248, 423, 609, 1357, 2, 385, 71, 36, 1,
+	100, 3074, 994, 19, 1321, 372, 285, 69, 39, 2,
+	0, 1, 2748, 331, 55, 2, 447, 107, 65, 3,
+	53, 1, 305, 239, 343, 48, 1164, 63, 279, 83,
+	16, 2, 77, 397, 95, 79, 4, 12, 43, 105,
+	24, 52, 73, 48, 7, 777, 1, 674, 480, 870,
+	273, 154, 36, 10, 12, 1496, 4, 38, 237, 232,
+	717, 3, 930, 2, 3, 163, 321, 1111, 193, 31,
+	1, 758, 74, 4, 130, 10, 2564, 58, 1393, 37,
+	8, 2948, 91, 69, 7, 1368, 290, 220, 2, 146,
+	2, 1278, 75, 101, 55, 47, 262, 7, 533, 530,
+	120, 155, 6, 128, 139, 172, 23, 24, 128, 43,
+	818, 110, 1860, 1095, 230, 1, 224, 66, 4, 0,
+	98, 178, 401, 455, 11, 878, 944, 582, 343, 52,
+	39, 467, 113, 500, 5, 2, 94, 57, 83, 7,
+	616, 2, 48, 824, 152, 33, 263, 1870, 64, 578,
+	315, 22, 142, 9, 2534, 208, 1548, 493, 132, 893,
+	2, 1504, 25, 95, 13, 55, 301, 349, 14, 7,
+	0, 145, 8, 25, 211, 1749, 16, 187, 7, 14,
+	34, 36, 71, 144, 245, 40, 375, 1032, 3, 65,
+	248, 364, 109, 1409, 1115, 81, 197, 614, 9, 107,
+	1, 549, 5, 11, 1, 404, 1616, 2258, 19, 27,
+	123, 1, 1, 95, 426, 44, 1267, 203, 21, 67,
+	239, 33, 524, 122, 536, 215, 106, 103, 31, 504,
+	136, 3, 404, 15, 112, 43, 359, 24, 177, 191,
+	506, 3687, 95, 143, 112, 470, 628, 563, 221, 502,
+	2, 15, 28, 166, 84, 42, 23, 0, 4, 1920,
+	410, 1287, 630, 2322, 23, 0, 72, 794, 105, 205,
+	1321, 4, 613, 779, 18, 1638, 1, 2, 803, 715,
+	99, 3, 417, 243, 475, 13, 1200, 547, 4, 13,
+	1617, 1, 1, 381, 31, 10, 536, 5169, 1881, 312,
+	13, 160, 30, 1677, 79, 1343, 635, 744, 1021, 11,
+	319, 542, 943, 191, 2, 771, 146, 299, 29, 854,
+	13, 7, 1, 22, 1889, 122, 10895, 23, 790, 11,
+	404, 121, 250, 44, 2566, 860, 151, 4089, 1758, 352,
+	1756, 237, 2000, 2752, 107, 3431, 22, 18, 92, 6,
+	1867, 82, 15, 323, 14, 24, 7, 451, 342, 661,
+	135, 696, 111, 333, 10, 9, 655, 25, 152, 16,
+	429, 486, 510, 1224, 128, 320, 518, 899, 1248, 129,
+	11, 17, 2791, 152, 375, 449, 189, 5, 70, 2,
+	1195, 150, 17, 3861, 11, 185, 25, 44, 139, 49,
+	1282, 803, 1, 6949, 404, 5, 2158, 2423, 2975, 6,
+	131, 74, 187, 4501, 17, 31, 34, 7, 5, 4,
+	80, 4574, 1, 2431, 675, 15, 92, 4967, 11, 46,
+	93, 6479, 18, 5611, 1777, 696, 129, 27, 1422, 1881,
+	1, 7, 14, 114, 153, 1908,
+};
+
+static const struct psname { const char *name; int32_t uni; } psnames[PSNAMES_CNT] = {
+	{ "pageup", 0x21de },
+	{ "angkhankhuthai", 0x0e5a },
+	{ "dzhacek", 0x01c6 },
+	{ "yr", 0x01a6 },
+	{ "brevecmb", 0x0306 },
+	{ "omicronlenisacute", 0x1f44 },
+	{ "twoarabic", 0x0662 },
+	{ "onegurmukhi", 0x0a67 },
+	{ "Jcircumflex.small", 0xf688 },
+	{ "upeighthblock", 0x2594 },
+	{ "circledot", 0x2299 },
+	{ "kdotbelow", 0x1e33 },
+	{ "dcircle", 0x24d3 },
+	{ "downarrowbarred", 0x2908 },
+	{ "jhacek", 0x01f0 },
+	{ "cmcubedsquare", 0x33a4 },
+	{ "spaceliteral", 0x2420 },
+	{ "ecircumflexdotbelow", 0x1ec7 },
+	{ "stixEEC0", 0xeec0 },
+	{ "omegaround", 0x047b },
+	{ "etaiotasubasperacute", 0x1f95 },
+	{ "Zeta", 0x0396 },
+	{ "surfintegral", 0x222f },
+	{ "dsuperior", 0xf6eb },
+	{ "controlLF", 0x000a },
+	{ "Ocyrillic", 0x041e },
+	{ "Alphaiotasublenis", 0x1f88 },
+	{ "uni219D0338", 0xe21b },
+	{ "uni2ACBFE00", 0xe2b8 },
+	{ "upsilon.sc", 0xf514 },
+	{ "a172", 0x27a1 },
+	{ "Ka", 0x041a },
+	{ "triaglf", 0x25c4 },
+	{ "sixteenperiod", 0x2497 },
+	{ "leftbkarrow", 0x290c },
+	{ "nnabengali", 0x09a3 },
+	{ "enghecyrillic", 0x04a5 },
+	{ "stixEE23", 0xee23 },
+	{ "nrthook", 0x0273 },
+	{ "oacute.sc", 0xf7f3 },
+	{ "a58", 0x273f },
+	{ "sakatakanahalfwidth", 0xff7b },
+	{ "Omegaiotasubaspergrave", 0x1fab },
+	{ "leftangleabovecmb", 0x031a },
+	{ "Koppacyrillic", 0x0480 },
+	{ "El", 0x041b },
+	{ "pi1", 0x03d6 },
+	{ "sofpasuq", 0x05c3 },
+	{ "perthousand", 0x2030 },
+	{ "controlHT", 0x0009 },
+	{ "Pecyrillic", 0x041f },
+	{ "uugujarati", 0x0a8a },
+	{ "leftuphvrtdnltform", 0x2543 },
+	{ "controlEOT", 0x0004 },
+	{ "buhiragana", 0x3076 },
+	{ "omgujarati", 0x0ad0 },
+	{ "uni2AA10338", 0xf423 },
+	{ "dnrtdblform", 0x2552 },
+	{ "siosparenkorean", 0x3206 },
+	{ "Udieresiscaron", 0x01d9 },
+	{ "drthook", 0x0256 },
+	{ "Macute", 0x1e3e },
+	{ "omegacyrillic", 0x0461 },
+	{ "yoghhacek", 0x01ef },
+	{ "bracerightbt", 0xf8fe },
+	{ "phiscript", 0x03d5 },
+	{ "minustilde", 0x2242 },
+	{ "dnseveneighthblock", 0x2587 },
+	{ "lownumeralsign", 0x0375 },
+	{ "Upsilondieresis", 0x03ab },
+	{ "Ercyrillic", 0x0420 },
+	{ "Tcommaaccent", 0x0162 },
+	{ "nuktabengali", 0x09bc },
+	{ "colontriangularhalfmod", 0x02d1 },
+	{ "ltvertleftform", 0x2524 },
+	{ "eight.oldstyle", 0xf738 },
+	{ "sphericalangle", 0x2222 },
+	{ "uni22F90338", 0xe39f },
+	{ "diamondmath", 0x22c4 },
+	{ "perafehebrew", 0xfb4e },
+	{ "enquad", 0x2000 },
+	{ "mlonglegturned", 0x0270 },
+	{ "Omicronasper", 0x1f49 },
+	{ "Cheabkhasiancyrillic", 0x04bc },
+	{ "vagurmukhi", 0x0a35 },
+	{ "ideographicstockparen", 0x3231 },
+	{ "rieultikeutkorean", 0x316a },
+	{ "sheva2e", 0x05b0 },
+	{ "bsolhsub", 0xe34d },
+	{ "underscoredbl", 0x2017 },
+	{ "Iotadieresissmall", 0xf519 },
+	{ "dotbelowcmb", 0x0323 },
+	{ "esdescendercyrillic", 0x04ab },
+	{ "onecircle", 0x2460 },
+	{ "clwintegral", 0x2231 },
+	{ "ugurmukhi", 0x0a09 },
+	{ "hokatakana", 0x30db },
+	{ "cieucparenkorean", 0x3208 },
+	{ "Gcedilla", 0x0122 },
+	{ "Threeroman", 0x2162 },
+	{ "alphaacute", 0x1f71 },
+	{ "mparen", 0x24a8 },
+	{ "ideographnamecircle", 0x3294 },
+	{ "hatafqamatsnarrowhebrew", 0x05b3 },
+	{ "Ohm", 0x2126 },
+	{ "barupharpoonright", 0x2954 },
+	{ "arrowdblsw", 0x21d9 },
+	{ "tortoiseshellbracketleftsmall", 0xfe5d },
+	{ "pdf", 0x202c },
+	{ "dalet", 0x05d3 },
+	{ "qamats", 0x05b8 },
+	{ "Gangia", 0x03ea },
+	{ "hparen", 0x24a3 },
+	{ "Utilde.small", 0xf6a4 },
+	{ "hvuphorizform", 0x253b },
+	{ "vhook", 0x028b },
+	{ "klsquare", 0x3398 },
+	{ "litre", 0x2113 },
+	{ "lefthvrtvertltform", 0x253d },
+	{ "Eightroman", 0x2167 },
+	{ "zedieresiscyrillic", 0x04df },
+	{ "IJ.small", 0xf684 },
+	{ "nonmarkingreturn", 0x000d },
+	{ "equalparallel", 0x22d5 },
+	{ "diamondsuitwhite", 0x2662 },
+	{ "thzsquare", 0x3394 },
+	{ "Xsmall", 0xf778 },
+	{ "Icircle", 0x24be },
+	{ "righttail", 0x291a },
+	{ "rhabengali", 0x09dd },
+	{ "Ecaron", 0x011a },
+	{ "holam32", 0x05b9 },
+	{ "rrvocalicvowelsigndeva", 0x0944 },
+	{ "zerogujarati", 0x0ae6 },
+	{ "udieresismacron", 0x01d6 },
+	{ "obarredcyrillic", 0x04e9 },
+	{ "fofathai", 0x0e1d },
+	{ "kafmedialarabic", 0xfedc },
+	{ "Keharmenian", 0x0554 },
+	{ "arrowopendown", 0x21e9 },
+	{ "ereversed", 0x0258 },
+	{ "emonospace", 0xff45 },
+	{ "minuscircle", 0x2296 },
+	{ "shortrightarrow", 0x2192 },
+	{ "imatragurmukhi", 0x0a3f },
+	{ "lenisacute", 0x1fce },
+	{ "supdsub", 0x2ad8 },
+	{ "stixEE04", 0xee04 },
+	{ "ya", 0x044f },
+	{ "uni2A13.up", 0xe398 },
+	{ "Iotalenisacute", 0x1f3c },
+	{ "shindageshsindot", 0xfb2d },
+	{ "Aogonek", 0x0104 },
+	{ "yaadosquare", 0x334e },
+	{ "nnagurmukhi", 0x0a23 },
+	{ "gbar", 0x01e5 },
+	{ "eiotifiedcyrillic", 0x0465 },
+	{ "male", 0x2642 },
+	{ "segol13", 0x05b6 },
+	{ "cornerbracketleftvertical", 0xfe41 },
+	{ "yturn", 0x028e },
+	{ "dalethmath", 0x2138 },
+	{ "a51", 0x2738 },
+	{ "noonghunnaarabic", 0x06ba },
+	{ "Etaiotasubaspergrave", 0x1f9b },
+	{ "grave", 0x0060 },
+	{ "ideographfirecircle", 0x328b },
+	{ "Macronsmall", 0xf7af },
+	{ "fourbengali", 0x09ea },
+	{ "upltdnhorizhvform", 0x2548 },
+	{ "afii57687", 0x05e7 },
+	{ "wsuper", 0x02b7 },
+	{ "Iotaaspertilde", 0x1f3f },
+	{ "squaremultiply", 0x22a0 },
+	{ "Ocircumflextilde", 0x1ed6 },
+	{ "lrthook", 0x026d },
+	{ "jagujarati", 0x0a9c },
+	{ "radicalex", 0xf8e5 },
+	{ "nvLeftrightarrow", 0x2904 },
+	{ "etalenistilde", 0x1f26 },
+	{ "supersetdbl", 0x22d1 },
+	{ "arrowdown", 0x2193 },
+	{ "tserenarrowhebrew", 0x05b5 },
+	{ "mssquare", 0x33b3 },
+	{ "Rfraktur", 0x211c },
+	{ "stixEE76", 0xee76 },
+	{ "alephmath", 0x2135 },
+	{ "uni22F50338", 0xe39d },
+	{ "u.short", 0x045e },
+	{ "stixEEC8", 0xeec8 },
+	{ "bcircle", 0x24d1 },
+	{ "circleP", 0x2117 },
+	{ "cadeva", 0x091a },
+	{ "notcontains", 0x220c },
+	{ "omegaiotasubleniscircumflex", 0x1fa6 },
+	{ "Wsmall", 0xf777 },
+	{ "aarusquare", 0x3303 },
+	{ "squaresubnosp", 0x033b },
+	{ "Ethsmall", 0xf7f0 },
+	{ "afii57667", 0x05d3 },
+	{ "alphaiotasub", 0x1fb3 },
+	{ "hasquare", 0x33ca },
+	{ "vikatakana", 0x30f8 },
+	{ "uhorntilde", 0x1eef },
+	{ "lamkhahinitialarabic", 0xfccb },
+	{ "three.fitted", 0xf63b },
+	{ "uni22660338", 0xe2a8 },
+	{ "pecyrillic", 0x043f },
+	{ "Scedilla.small", 0xf699 },
+	{ "khagurmukhi", 0x0a16 },
+	{ "afii10063", 0xf6c4 },
+	{ "afii57797", 0x05b8 },
+	{ "arrowleftbothalf", 0x21bd },
+	{ "measuredangle", 0x2221 },
+	{ "gscript", 0x0261 },
+	{ "afii57423", 0x062f },
+	{ "Ncommaaccent.small", 0xf690 },
+	{ "slongdotaccent", 0x1e9b },
+	{ "gafmedialarabic", 0xfb95 },
+	{ "Ie", 0x0415 },
+	{ "veharabic", 0x06a4 },
+	{ "lmsquare", 0x33d0 },
+	{ "chi.sc", 0xf516 },
+	{ "uni226420D2", 0xe2c1 },
+	{ "twothai", 0x0e52 },
+	{ "stixEED7", 0xeed7 },
+	{ "notlessequivlnt", 0x2274 },
+	{ "Cheverticalstrokecyrillic", 0x04b8 },
+	{ "tortoiseshellbracketleftvertical", 0xfe39 },
+	{ "ideographiclaborcircle", 0x3298 },
+	{ "peharmenian", 0x057a },
+	{ "ttagujarati", 0x0a9f },
+	{ "Ecyril", 0x0404 },
+	{ "ringrighthalfsuper", 0x02be },
+	{ "amonospace", 0xff41 },
+	{ "Rscript", 0x211b },
+	{ "Bmonospace", 0xff22 },
+	{ "wakorean", 0x3158 },
+	{ "Zedieresiscyrillic", 0x04de },
+	{ "stixEE33", 0xee33 },
+	{ "triangleright1", 0x25b7 },
+	{ "uni03310330", 0xea34 },
+	{ "ucaron", 0x01d4 },
+	{ "uni2269FE00", 0xe2a1 },
+	{ "afii57801", 0x05b1 },
+	{ "afii10071", 0x0451 },
+	{ "a206", 0x2770 },
+	{ "acutetonecmb", 0x0341 },
+	{ "Alphalenis", 0x1f08 },
+	{ "diamondsolid", 0x25c6 },
+	{ "verthorizdblform", 0x256a },
+	{ "uuvowelsignbengali", 0x09c2 },
+	{ "aleph", 0x2135 },
+	{ "uniondbl", 0x22d2 },
+	{ "dasia", 0x1ffe },
+	{ "uphvdnhorizltform", 0x2540 },
+	{ "afii10039", 0x0425 },
+	{ "yotgreek", 0x03f3 },
+	{ "integraltop", 0x2320 },
+	{ "Dieresis", 0xf6cb },
+	{ "hhooksuperior", 0x02b1 },
+	{ "alefmaksurafinalarabic", 0xfef0 },
+	{ "two.oldstyle", 0xf732 },
+	{ "arrowvertex", 0xf8e6 },
+	{ "xdieresis", 0x1e8d },
+	{ "atilde", 0x00e3 },
+	{ "shadelight", 0x2591 },
+	{ "squarebelowcmb", 0x033b },
+	{ "dnltleftuphvform", 0x2529 },
+	{ "afii57425", 0x0631 },
+	{ "eqeq", 0x2a75 },
+	{ "Gje", 0x0403 },
+	{ "acircle", 0x24d0 },
+	{ "uni227620D2", 0xea65 },
+	{ "Omicronsmall", 0xf50e },
+	{ "stixEE9F", 0xee9f },
+	{ "suphsub", 0x2ad7 },
+	{ "yeri", 0x044b },
+	{ "dblarrowheaddown", 0x21a1 },
+	{ "dtopbar", 0x018c },
+	{ "DD070", 0x2014 },
+	{ "rtdnhvleftupltform", 0x2546 },
+	{ "Uring.small", 0xf6a3 },
+	{ "etaiotasubtilde", 0x1fc7 },
+	{ "controlSO", 0x000e },
+	{ "degreekelvin", 0x212a },
+	{ "Umacrondieresis", 0x1e7a },
+	{ "ssabengali", 0x09b7 },
+	{ "shaddadammaarabic", 0xfc61 },
+	{ "home", 0x21b8 },
+	{ "tsere", 0x05b5 },
+	{ "caarmenian", 0x056e },
+	{ "leftrightharpoonsup", 0x2966 },
+	{ "uphvhorizltform", 0x2538 },
+	{ "wattosquare", 0x3357 },
+	{ "dndblleftform", 0x2556 },
+	{ "Epsilonasper", 0x1f19 },
+	{ "Ohornacute", 0x1eda },
+	{ "ygrave", 0x1ef3 },
+	{ "enge", 0x04a5 },
+	{ "a137", 0x277d },
+	{ "Wcircle", 0x24cc },
+	{ "questionarmenian", 0x055e },
+	{ "uni2A7E20D2", 0xed61 },
+	{ "a8", 0x271f },
+	{ "mmsquaredsquare", 0x339f },
+	{ "sqoriginornotequal", 0x22e5 },
+	{ "SF060000", 0x252c },
+	{ "fathaarabic", 0x064e },
+	{ "bethebrew", 0x05d1 },
+	{ "semicolon", 0x003b },
+	{ "Vhook", 0x01b2 },
+	{ "ideographicwoodparen", 0x322d },
+	{ "dhook", 0x0257 },
+	{ "afii57505", 0x06a4 },
+	{ "twogujarati", 0x0ae8 },
+	{ "alphatonos", 0x03ac },
+	{ "etarmenian", 0x0568 },
+	{ "Ihookabove", 0x1ec8 },
+	{ "afii57412", 0x0624 },
+	{ "heartsuitblack", 0x2665 },
+	{ "Swarrow", 0x21d9 },
+	{ "bbopomofo", 0x3105 },
+	{ "xeharmenian", 0x056d },
+	{ "Nwarrow", 0x21d6 },
+	{ "intisquare", 0x3305 },
+	{ "tikeutparenkorean", 0x3202 },
+	{ "alphamacron", 0x1fb1 },
+	{ "Hbb", 0x210d },
+	{ "Shhacyrillic", 0x04ba },
+	{ "Msmall", 0xf76d },
+	{ "blacklowerrighttriangle", 0x25e2 },
+	{ "a91", 0x276c },
+	{ "blacksquare", 0x25a0 },
+	{ "anglebracketleft", 0x3008 },
+	{ "Ocircumflexdotbelow", 0x1ed8 },
+	{ "u1D6FB.narrow", 0xedf6 },
+	{ "subsetnotequal", 0x228a },
+	{ "wcircumflex", 0x0175 },
+	{ "jcaron", 0x01f0 },
+	{ "stixEE35", 0xee35 },
+	{ "arrowrighttophalf", 0x21c0 },
+	{ "rhookturnedsuperior", 0x02b5 },
+	{ "Kcommaaccent.small", 0xf689 },
+	{ "Gebar", 0x0492 },
+	{ "eightsuperior", 0x2078 },
+	{ "hcircumflex", 0x0125 },
+	{ "poplathai", 0x0e1b },
+	{ "a146", 0x2786 },
+	{ "he", 0x05d4 },
+	{ "controlDEL", 0x007f },
+	{ "rvocalicdeva", 0x090b },
+	{ "rightbkarrow", 0x290d },
+	{ "hook", 0x2440 },
+	{ "parallelto", 0x2225 },
+	{ "habengali", 0x09b9 },
+	{ "aemacron", 0x01e3 },
+	{ "stixEEC7", 0xeec7 },
+	{ "igujarati", 0x0a87 },
+	{ "radeva", 0x0930 },
+	{ "shagurmukhi", 0x0a36 },
+	{ "a17", 0x2711 },
+	{ "abrevegrave", 0x1eb1 },
+	{ "maihanakatthai", 0x0e31 },
+	{ "curvearrowleftplus", 0x293d },
+	{ "afii10026", 0x0418 },
+	{ "equivalence", 0x2261 },
+	{ "acE", 0xe290 },
+	{ "uhookabove", 0x1ee7 },
+	{ "DD106", 0x2595 },
+	{ "vehfinalarabic", 0xfb6b },
+	{ "nineideographicparen", 0x3228 },
+	{ "THORN", 0x00de },
+	{ "stixEECE", 0xeece },
+	{ "spadesuitblack", 0x2660 },
+	{ "a191", 0x27be },
+	{ "eukorean", 0x3161 },
+	{ "Pehook", 0x04a6 },
+	{ "seagullbelowcmb", 0x033c },
+	{ "Udieresisacute", 0x01d7 },
+	{ "stixEE19", 0xee19 },
+	{ "exclamlatin", 0x01c3 },
+	{ "gabengali", 0x0997 },
+	{ "Eopen", 0x0190 },
+	{ "echarmenian", 0x0565 },
+	{ "twooldstyle", 0xf732 },
+	{ "rieulkiyeokkorean", 0x313a },
+	{ "foursuperior", 0x2074 },
+	{ "twelveparen", 0x247f },
+	{ "a166", 0x279b },
+	{ "elsdot", 0x2a97 },
+	{ "a88", 0x2773 },
+	{ "heart", 0x2665 },
+	{ "ogonek.cap", 0xeff1 },
+	{ "prosgegrammeni.sc", 0xf51e },
+	{ "xsuperior", 0x02e3 },
+	{ "quotesinglrev", 0x201b },
+	{ "rradeva", 0x0931 },
+	{ "SF490000", 0x2559 },
+	{ "breveinvertedbelowcmb", 0x032f },
+	{ "ideographearthcircle", 0x328f },
+	{ "stixEEB9", 0xeeb9 },
+	{ "Ntilde", 0x00d1 },
+	{ "etatilde", 0x1fc6 },
+	{ "alef", 0x05d0 },
+	{ "estimated", 0x212e },
+	{ "vagujarati", 0x0ab5 },
+	{ "squareleftsld", 0x25e7 },
+	{ "geomproportion", 0x223a },
+	{ "vdotbelow", 0x1e7f },
+	{ "a9", 0x2720 },
+	{ "Lcaron", 0x013d },
+	{ "onequarter", 0x00bc },
+	{ "notpropersubset", 0x2284 },
+	{ "notforcesextra", 0x22af },
+	{ "parenrightvertical", 0xfe36 },
+	{ "afii10061", 0x040c },
+	{ "ssangieungkorean", 0x3180 },
+	{ "Iscript", 0x2110 },
+	{ "gla", 0x2aa5 },
+	{ "udeva", 0x0909 },
+	{ "oangthai", 0x0e2d },
+	{ "three.denominator", 0xf658 },
+	{ "afii57674", 0x05da },
+	{ "Dotaccentsmall", 0xf6f7 },
+	{ "nokatakana", 0x30ce },
+	{ "zohiragana", 0x305e },
+	{ "dollar.denominator", 0xf62a },
+	{ "squarevertbisect", 0x25eb },
+	{ "shortuparrow", 0x2191 },
+	{ "ssuperior", 0xf6f2 },
+	{ "fiveroman", 0x2174 },
+	{ "dnhvleftupltform", 0x2527 },
+	{ "Omegaiotasubaspertilde", 0x1faf },
+	{ "f", 0x0066 },
+	{ "ycircumflex", 0x0177 },
+	{ "abbreviationsigndeva", 0x0970 },
+	{ "etaiotasublenisgrave", 0x1f92 },
+	{ "kaf", 0x05db },
+	{ "ddotbelow", 0x1e0d },
+	{ "j.dotless", 0xf6be },
+	{ "Ldotbelow", 0x1e36 },
+	{ "Jcircle", 0x24bf },
+	{ "blackstar", 0x2605 },
+	{ "a100", 0x275e },
+	{ "etnahtafoukhlefthebrew", 0x0591 },
+	{ "uni033103310331", 0xea20 },
+	{ "afii57670", 0x05d6 },
+	{ "forcesbar", 0x22aa },
+	{ "mieumparenkorean", 0x3204 },
+	{ "Alphalenistilde", 0x1f0e },
+	{ "Edot", 0x0116 },
+	{ "tilde.cap", 0xeff5 },
+	{ "gdot", 0x0121 },
+	{ "uugurmukhi", 0x0a0a },
+	{ "uni220A20D2", 0xed30 },
+	{ "filledvertrect", 0x25ae },
+	{ "acutedblnosp", 0x030b },
+	{ "khhagurmukhi", 0x0a59 },
+	{ "k", 0x006b },
+	{ "nnagujarati", 0x0aa3 },
+	{ "otildedieresis", 0x1e4f },
+	{ "uuvowelsigndeva", 0x0942 },
+	{ "sevenperiod", 0x248e },
+	{ "hsuper", 0x02b0 },
+	{ "stixEE93", 0xee93 },
+	{ "lowlinedashed", 0xfe4d },
+	{ "thetascript", 0x03d1 },
+	{ "Udieresisbelow", 0x1e72 },
+	{ "Jheharmenian", 0x054b },
+	{ "precedes", 0x227a },
+	{ "ideographiciterationmark", 0x3005 },
+	{ "Omacrongrave", 0x1e50 },
+	{ "grave.cap", 0xf6ce },
+	{ "Fei", 0x03e4 },
+	{ "gesles", 0x2a94 },
+	{ "hvupleftform", 0x251b },
+	{ "merkhakefulahebrew", 0x05a6 },
+	{ "Klinebelow", 0x1e34 },
+	{ "E.cyr", 0x042d },
+	{ "Abreve.small", 0xf66d },
+	{ "Lacute", 0x0139 },
+	{ "SF500000", 0x2558 },
+	{ "afii10037", 0x0423 },
+	{ "sheicoptic", 0x03e3 },
+	{ "parenleftmonospace", 0xff08 },
+	{ "rdotbelowmacron", 0x1e5d },
+	{ "Dslash", 0x0110 },
+	{ "stixEE82", 0xee82 },
+	{ "pi.math", 0xf636 },
+	{ "Deltagreek", 0x0394 },
+	{ "omegaiotasubaspertilde", 0x1fa7 },
+	{ "hsuperior", 0x02b0 },
+	{ "onefifth", 0x2155 },
+	{ "uni2A6D0338", 0xe2c5 },
+	{ "ascript", 0x0251 },
+	{ "guilsinglleft.cap", 0xf6b8 },
+	{ "underscorevertical", 0xfe33 },
+	{ "dialytikaperispomeni", 0x1fc1 },
+	{ "emacronacute", 0x1e17 },
+	{ "sheenfinalarabic", 0xfeb6 },
+	{ "eighthackarabic", 0x0668 },
+	{ "yoddbl", 0x05f2 },
+	{ "memfinal", 0x05dd },
+	{ "Eturn", 0x018e },
+	{ "saraothai", 0x0e42 },
+	{ "hatafpatah2f", 0x05b2 },
+	{ "lladeva", 0x0933 },
+	{ "dialytika_oxia", 0x1fee },
+	{ "dotbelowcomb", 0x0323 },
+	{ "verticallinemod", 0x02c8 },
+	{ "dabengali", 0x09a6 },
+	{ "uni2A3DFE00", 0xec02 },
+	{ "muvsquare", 0x33b6 },
+	{ "nwquadarc", 0x25dc },
+	{ "pisymbolgreek", 0x03d6 },
+	{ "hungarumlaut.sc", 0xf6f8 },
+	{ "telishaqetanahebrew", 0x05a9 },
+	{ "Lambdasmall", 0xf50a },
+	{ "iotalatin", 0x0269 },
+	{ "dagesh", 0x05bc },
+	{ "tokatakanahalfwidth", 0xff84 },
+	{ "arrowupleft", 0x2196 },
+	{ "khokhwaithai", 0x0e04 },
+	{ "sixhackarabic", 0x0666 },
+	{ "ltrivb", 0x29cf },
+	{ "a26", 0x271a },
+	{ "squareoriginal", 0x2290 },
+	{ "khahinitialarabic", 0xfea7 },
+	{ "Je", 0x0408 },
+	{ "rhadeva", 0x095d },
+	{ "karoriisquare", 0x330d },
+	{ "scaron.sc", 0xf6fd },
+	{ "Khacek", 0x01e8 },
+	{ "ideographiccomma", 0x3001 },
+	{ "afii10108", 0x045b },
+	{ "jcircumflex", 0x0135 },
+	{ "acute.cap", 0xf6c9 },
+	{ "Khartdes", 0x04b2 },
+	{ "dalethebrew", 0x05d3 },
+	{ "rightleftharpoonsup", 0x2968 },
+	{ "holamnarrowhebrew", 0x05b9 },
+	{ "thanthakhatlowleftthai", 0xf898 },
+	{ "f_f_i", 0xfb03 },
+	{ "arrowlongbothnot", 0x21ae },
+	{ "twoheadrightarrowtail", 0x2916 },
+	{ "stixEEC1", 0xeec1 },
+	{ "behnoonfinalarabic", 0xfc6d },
+	{ "gravemonospace", 0xff40 },
+	{ "afii57398", 0x0666 },
+	{ "filledbox", 0x25a0 },
+	{ "utildeacute", 0x1e79 },
+	{ "Itilde", 0x0128 },
+	{ "apostrophemod", 0x02bc },
+	{ "ralowerdiagonalbengali", 0x09f1 },
+	{ "underscorenosp", 0x0332 },
+	{ "dieresis.cap", 0xf6cb },
+	{ "w.sc", 0xf777 },
+	{ "zmonospace", 0xff5a },
+	{ "asteriskarabic", 0x066d },
+	{ "SM750002", 0x25d9 },
+	{ "herutusquare", 0x3339 },
+	{ "colonmonetary.taboldstyle", 0xf64d },
+	{ "ucircumflex.sc", 0xf7fb },
+	{ "wasmallhiragana", 0x308e },
+	{ "segolnarrowhebrew", 0x05b6 },
+	{ "uni2A16.up", 0xe377 },
+	{ "leftrightharpoonupdown", 0x294a },
+	{ "glottalstop", 0x0294 },
+	{ "Ubreve", 0x016c },
+	{ "tdotaccent", 0x1e6b },
+	{ "female", 0x2640 },
+	{ "vekatakana", 0x30f9 },
+	{ "Adieresissmall", 0xf7e4 },
+	{ "tie1", 0x2040 },
+	{ "Chertdes", 0x04b6 },
+	{ "cieucuparenkorean", 0x321c },
+	{ "sevenoldstyle", 0xf737 },
+	{ "heartsuitwhite", 0x2661 },
+	{ "dbsquare", 0x33c8 },
+	{ "cruzeiro", 0x20a2 },
+	{ "yakorean", 0x3151 },
+	{ "dividemultiply", 0x22c7 },
+	{ "qamatsqatanwidehebrew", 0x05b8 },
+	{ "Ogoneksmall", 0xf6fb },
+	{ "etaiotasubcircumflex", 0x1fc7 },
+	{ "upblock", 0x2580 },
+	{ "eopenreversed", 0x025c },
+	{ "Adblgrave", 0x0200 },
+	{ "afii57407", 0x061f },
+	{ "gysquare", 0x33c9 },
+	{ "Tetsecyrillic", 0x04b4 },
+	{ "Kcaron", 0x01e8 },
+	{ "nokatakanahalfwidth", 0xff89 },
+	{ "rightanglese", 0x2518 },
+	{ "atilde.sc", 0xf7e3 },
+	{ "boxverthatch", 0x25a5 },
+	{ "adieresis", 0x00e4 },
+	{ "Upsilontonos", 0x038e },
+	{ "uhiragana", 0x3046 },
+	{ "Upsilonafrican", 0x01b1 },
+	{ "sterling.taboldstyle", 0xf651 },
+	{ "onehalf", 0x00bd },
+	{ "intersection", 0x2229 },
+	{ "afii57388", 0x060c },
+	{ "minute", 0x2032 },
+	{ "schwa", 0x0259 },
+	{ "stixEEBC", 0xeebc },
+	{ "Eharmenian", 0x0537 },
+	{ "leftltrtverthvform", 0x254a },
+	{ "e.superior", 0xf6ec },
+	{ "a21", 0x2715 },
+	{ "Ringsmall", 0xf6fc },
+	{ "Uhungarumlaut", 0x0170 },
+	{ "dagujarati", 0x0aa6 },
+	{ "Er", 0x0420 },
+	{ "uni2014.alt", 0xf6de },
+	{ "bridgebelowcmb", 0x032a },
+	{ "macroncmb", 0x0304 },
+	{ "stixEE98", 0xee98 },
+	{ "aringacute", 0x01fb },
+	{ "Ncaron.small", 0xf68f },
+	{ "Shaarmenian", 0x0547 },
+	{ "Breve", 0xefee },
+	{ "pbopomofo", 0x3106 },
+	{ "floorleft", 0x230a },
+	{ "eight.inferior", 0x2088 },
+	{ "omegaaspertilde", 0x1f67 },
+	{ "commaturnedmod", 0x02bb },
+	{ "lammedialarabic", 0xfee0 },
+	{ "candrabindubengali", 0x0981 },
+	{ "zadeva", 0x095b },
+	{ "etaiotasubgrave", 0x1fc2 },
+	{ "Omicronaspergrave", 0x1f4b },
+	{ "paragraphseparator", 0x2029 },
+	{ "hyphennobreak", 0x2011 },
+	{ "ecandravowelsigndeva", 0x0945 },
+	{ "ghemiddlehookcyrillic", 0x0495 },
+	{ "ieungparenkorean", 0x3207 },
+	{ "en", 0x043d },
+	{ "omegaiotasubtilde", 0x1ff7 },
+	{ "Y", 0x0059 },
+	{ "breve.cyr", 0xf6d4 },
+	{ "Odieresissmall", 0xf7f6 },
+	{ "rieulpieupkorean", 0x313c },
+	{ "Shcha", 0x0429 },
+	{ "glottalstopbar", 0x02a1 },
+	{ "lamalefhamzaaboveisolatedarabic", 0xfef7 },
+	{ "anusvaragujarati", 0x0a82 },
+	{ "tonos", 0x0384 },
+	{ "negacknowledge", 0x2415 },
+	{ "Euro.taboldstyle", 0xf64e },
+	{ "odieresiscyrillic", 0x04e7 },
+	{ "a68", 0x2749 },
+	{ "issharbengali", 0x09fa },
+	{ "odblacute", 0x0151 },
+	{ "ainmedialarabic", 0xfecc },
+	{ "uni2A9520D2", 0xed66 },
+	{ "a143", 0x2783 },
+	{ "maieklowrightthai", 0xf88b },
+	{ "uni2A0A.lgdisplay", 0xed9e },
+	{ "uni223F.reversed", 0xed58 },
+	{ "tonetwo", 0x01a8 },
+	{ "shima", 0x03ed },
+	{ "stixEE01", 0xee01 },
+	{ "a99", 0x275d },
+	{ "afii57645", 0x05be },
+	{ "afii10030", 0x041c },
+	{ "notbardbl", 0x2226 },
+	{ "vertltrthvform", 0x251d },
+	{ "sdotbelowdotaccent", 0x1e69 },
+	{ "yiwnarmenian", 0x0582 },
+	{ "cornerbracketrighthalfwidth", 0xff63 },
+	{ "rightharpoonaccent", 0x20d1 },
+	{ "greaterequal", 0x2265 },
+	{ "uni006C0321", 0xea0d },
+	{ "Omegaiotasub", 0x1ffc },
+	{ "yiarmenian", 0x0575 },
+	{ "uni0077.subscript", 0xe631 },
+	{ "yodyodhebrew", 0x05f2 },
+	{ "afii64937", 0x02bd },
+	{ "kcircle", 0x24da },
+	{ "lffiveeighthblock", 0x258b },
+	{ "iotalenisacute", 0x1f34 },
+	{ "eightoldstyle", 0xf738 },
+	{ "ezhtail", 0x01ba },
+	{ "stixEE9A", 0xee9a },
+	{ "alefmaddaabovearabic", 0x0622 },
+	{ "puhiragana", 0x3077 },
+	{ "Uhorngrave", 0x1eea },
+	{ "hyphen.cap", 0xf6ba },
+	{ "Aringacute", 0x01fa },
+	{ "Fiveroman", 0x2164 },
+	{ "triagdn", 0x25bc },
+	{ "abrevehookabove", 0x1eb3 },
+	{ "epsilonlatinrevhook", 0x025d },
+	{ "SF220000", 0x2555 },
+	{ "lessequivlnt", 0x2272 },
+	{ "ampersandmonospace", 0xff06 },
+	{ "nundageshhebrew", 0xfb40 },
+	{ "uni2A0F.up", 0xe3d3 },
+	{ "dialytikaoxia", 0x1fee },
+	{ "epsilonaspergrave", 0x1f13 },
+	{ "gravetonecmb", 0x0340 },
+	{ "zerowidthnonjoiner", 0x200c },
+	{ "afii10086", 0x0444 },
+	{ "Omicronlenis", 0x1f48 },
+	{ "onegujarati", 0x0ae7 },
+	{ "a169", 0x279e },
+	{ "dasiapneumatacyrilliccmb", 0x0485 },
+	{ "Iotabreve", 0x1fd8 },
+	{ "nvLeftarrow", 0x2902 },
+	{ "tsadihebrew", 0x05e6 },
+	{ "FleuronLeft", 0x2619 },
+	{ "apostrophearmenian", 0x055a },
+	{ "eshshortrev", 0x0285 },
+	{ "Ocenteredtilde", 0x019f },
+	{ "alefpatahhebrew", 0xfb2e },
+	{ "shaddakasratanarabic", 0xfc5f },
+	{ "nnnadeva", 0x0929 },
+	{ "ayinhebrew", 0x05e2 },
+	{ "obreve", 0x014f },
+	{ "Yhook", 0x01b3 },
+	{ "fbowtie", 0x29d3 },
+	{ "Dotaccent", 0xefed },
+	{ "afii10058", 0x0409 },
+	{ "es", 0x0441 },
+	{ "tcaron", 0x0165 },
+	{ "nieunhieuhkorean", 0x3136 },
+	{ "sorusithai", 0x0e29 },
+	{ "qubuts", 0x05bb },
+	{ "decyrillic", 0x0434 },
+	{ "ddotaccent", 0x1e0b },
+	{ "triangleinv", 0x25bd },
+	{ "Ustraightstrokecyrillic", 0x04b0 },
+	{ "satisfies", 0x22a8 },
+	{ "one.oldstyle", 0xf731 },
+	{ "gihiragana", 0x304e },
+	{ "preceedsnotequal", 0x22e0 },
+	{ "Tertdes", 0x04ac },
+	{ "greaternotdblequal", 0x2269 },
+	{ "aspertilde", 0x1fdf },
+	{ "arrowdblup", 0x21d1 },
+	{ "germandbls", 0x00df },
+	{ "leftharpoondownbar", 0x295e },
+	{ "Zdotbelow", 0x1e92 },
+	{ "asciitildemonospace", 0xff5e },
+	{ "uni2248.bold", 0xe306 },
+	{ "quotedash", 0x2015 },
+	{ "primereversed", 0x2035 },
+	{ "afii10044", 0x042a },
+	{ "kirosquare", 0x3314 },
+	{ "Gammalatin", 0x0194 },
+	{ "a177", 0x27a7 },
+	{ "filledrect", 0x25ac },
+	{ "tildeverticalcmb", 0x033e },
+	{ "SF150000", 0x2592 },
+	{ "De", 0x0414 },
+	{ "qamatsquarterhebrew", 0x05b8 },
+	{ "shhacyrillic", 0x04bb },
+	{ "alpha", 0x03b1 },
+	{ "stixEE9E", 0xee9e },
+	{ "equalmonospace", 0xff1d },
+	{ "afii57668", 0x05d4 },
+	{ "stixEE10", 0xee10 },
+	{ "apostrophesupnosp", 0x0313 },
+	{ "afii57683", 0x05e3 },
+	{ "zero.fitted", 0xf639 },
+	{ "aadeva", 0x0906 },
+	{ "suplarr", 0x297b },
+	{ "yukatakana", 0x30e6 },
+	{ "lcaron", 0x013e },
+	{ "afii10099", 0x0452 },
+	{ "Nbb", 0x2115 },
+	{ "anticlockwise", 0x21ba },
+	{ "zakatakana", 0x30b6 },
+	{ "quoteleft", 0x2018 },
+	{ "dyogh", 0x02a4 },
+	{ "yyadeva", 0x095f },
+	{ "SF280000", 0x255b },
+	{ "uni227B20D2", 0xed77 },
+	{ "kenarmenian", 0x056f },
+	{ "lsime", 0x2a8d },
+	{ "fscript", 0x0192 },
+	{ "Epsilonasperacute", 0x1f1d },
+	{ "a20", 0x2714 },
+	{ "idieresis.sc", 0xf7ef },
+	{ "afii00208", 0x2015 },
+	{ "Alphaasper", 0x1f09 },
+	{ "uni2A9A0338", 0xed6d },
+	{ "subset", 0x2282 },
+	{ "a107", 0x2766 },
+	{ "o.cyr", 0x043e },
+	{ "rieulyeorinhieuhkorean", 0x316d },
+	{ "Zedescendercyrillic", 0x0498 },
+	{ "notturnstileleft", 0x22ac },
+	{ "Omegatitlocyrillic", 0x047c },
+	{ "stixEE18", 0xee18 },
+	{ "beta.alt", 0x03d0 },
+	{ "arrowleftwhite", 0x21e6 },
+	{ "etaiotasublenisacute", 0x1f94 },
+	{ "tdieresis", 0x1e97 },
+	{ "Pacute", 0x1e54 },
+	{ "sbopomofo", 0x3119 },
+	{ "BorderRightVertical1", 0x2595 },
+	{ "Omegagreek", 0x03a9 },
+	{ "Edieresissmall", 0xf7eb },
+	{ "ubreve", 0x016d },
+	{ "araeakorean", 0x318d },
+	{ "Ebreve", 0x0114 },
+	{ "enspace", 0x2002 },
+	{ "pipedblbar", 0x01c2 },
+	{ "nineteencircle", 0x2472 },
+	{ "equalsuperior", 0x207c },
+	{ "ihookabove", 0x1ec9 },
+	{ "xi.sc", 0xf50d },
+	{ "ngadeva", 0x0919 },
+	{ "qafarabic", 0x0642 },
+	{ "Ogonek", 0xeff1 },
+	{ "dollar", 0x0024 },
+	{ "greaterornotsimilar", 0x22e7 },
+	{ "dadinitialarabic", 0xfebf },
+	{ "hookcmb", 0x0309 },
+	{ "dokatakana", 0x30c9 },
+	{ "pvsquare", 0x33b4 },
+	{ "equal", 0x003d },
+	{ "iimatragurmukhi", 0x0a40 },
+	{ "tenideographicparen", 0x3229 },
+	{ "udieresis.sc", 0xf7fc },
+	{ "a145", 0x2785 },
+	{ "ffi", 0xfb03 },
+	{ "gekarev", 0x04a1 },
+	{ "underscorewavy", 0xfe4f },
+	{ "stixEE24", 0xee24 },
+	{ "Omegaroundcyrillic", 0x047a },
+	{ "epsilonlatin", 0x025b },
+	{ "noonarabic", 0x0646 },
+	{ "acwhalfcirclearrow", 0x2939 },
+	{ "alpha.sc", 0xf500 },
+	{ "newsheqel", 0x20aa },
+	{ "zecyrillic", 0x0437 },
+	{ "hvdashdblvertform", 0x254f },
+	{ "breve.sc", 0xf6f4 },
+	{ "a12", 0x261e },
+	{ "Gcircumflex.small", 0xf67e },
+	{ "a37", 0x272a },
+	{ "etaiotasubaspergrave", 0x1f93 },
+	{ "ysuper", 0x02b8 },
+	{ "phosamphaothai", 0x0e20 },
+	{ "arrowrightdown", 0x21b4 },
+	{ "controlESC", 0x001b },
+	{ "tildebelowcmb", 0x0330 },
+	{ "afii57453", 0x064d },
+	{ "Rcaron.small", 0xf696 },
+	{ "naira", 0x20a6 },
+	{ "daletmath", 0x2138 },
+	{ "stixEE9D", 0xee9d },
+	{ "gammalatin", 0x0263 },
+	{ "triangleright", 0x22b2 },
+	{ "ringhalfrightcentered", 0x02d2 },
+	{ "Omegasmall", 0xf518 },
+	{ "sdotbelow", 0x1e63 },
+	{ "dieresistilde", 0x1fc1 },
+	{ "followsequivlnt", 0x227f },
+	{ "iniarmenian", 0x056b },
+	{ "theta.alt", 0x03d1 },
+	{ "caronbelowcmb", 0x032c },
+	{ "pieuptikeutkorean", 0x3173 },
+	{ "magujarati", 0x0aae },
+	{ "iotadiaeresistonos", 0x0390 },
+	{ "g", 0x0067 },
+	{ "Ghacek", 0x01e6 },
+	{ "vokatakana", 0x30fa },
+	{ "iotasubscript", 0x1fbe },
+	{ "parenleft", 0x0028 },
+	{ "k.sc", 0xf76b },
+	{ "fivethai", 0x0e55 },
+	{ "epsilonlenis", 0x1f10 },
+	{ "notidentical", 0x2262 },
+	{ "stixEEAB", 0xeeab },
+	{ "afii57666", 0x05d2 },
+	{ "dasiaperispomeni", 0x1fdf },
+	{ "lscript", 0x2113 },
+	{ "tikeutkorean", 0x3137 },
+	{ "arrowupdnbse", 0x21a8 },
+	{ "visiblespace", 0x2420 },
+	{ "dorusquare", 0x3326 },
+	{ "ohacek", 0x01d2 },
+	{ "Pmonospace", 0xff30 },
+	{ "deicoptic", 0x03ef },
+	{ "arrowleftoverright", 0x21c6 },
+	{ "a136", 0x277c },
+	{ "tortoiseshellbracketright", 0x3015 },
+	{ "Enhookcyrillic", 0x04c7 },
+	{ "agrave", 0x00e0 },
+	{ "pihiragana", 0x3074 },
+	{ "hehfinalalttwoarabic", 0xfeea },
+	{ "Wdiaeresis", 0x1e84 },
+	{ "becyrillic", 0x0431 },
+	{ "rvocalicvowelsigndeva", 0x0943 },
+	{ "existential", 0x2203 },
+	{ "imageorapproxequal", 0x2253 },
+	{ "Liwnarmenian", 0x053c },
+	{ "lamlamhehisolatedarabic", 0xfdf2 },
+	{ "six", 0x0036 },
+	{ "telephoneblack", 0x260e },
+	{ "hooksupnosp", 0x0309 },
+	{ "uni2A12.up", 0xe397 },
+	{ "Etaiotasublenisgrave", 0x1f9a },
+	{ "rikatakana", 0x30ea },
+	{ "izhitsacyrillic", 0x0475 },
+	{ "phieuphaparenkorean", 0x321a },
+	{ "stixEE73", 0xee73 },
+	{ "angbracketright", 0x3009 },
+	{ "upsilonacute", 0x1f7b },
+	{ "E", 0x0045 },
+	{ "psili_varia", 0x1fcd },
+	{ "Tcaron", 0x0164 },
+	{ "Emacron.small", 0xf67a },
+	{ "parenleftsuperior", 0x207d },
+	{ "stixEE96", 0xee96 },
+	{ "epsilon.sc", 0xf504 },
+	{ "four", 0x0034 },
+	{ "iubopomofo", 0x3129 },
+	{ "dnleftdblform", 0x2555 },
+	{ "viramagujarati", 0x0acd },
+	{ "hiriq14", 0x05b4 },
+	{ "ghacek", 0x01e7 },
+	{ "Mdotbelow", 0x1e42 },
+	{ "upsilonleniscircumflex", 0x1f56 },
+	{ "n", 0x006e },
+	{ "avagrahadeva", 0x093d },
+	{ "Lcircumflexbelow", 0x1e3c },
+	{ "a195", 0x27b9 },
+	{ "Iotaacute", 0x1fdb },
+	{ "afii57448", 0x0648 },
+	{ "uni2A17.up", 0xe39a },
+	{ "Icyril", 0x0406 },
+	{ "Wdieresis", 0x1e84 },
+	{ "a46", 0x2733 },
+	{ "Ecircumflexdotbelow", 0x1ec6 },
+	{ "Omegaround", 0x047a },
+	{ "eshcurl", 0x0286 },
+	{ "stixEECD", 0xeecd },
+	{ "sevencircle", 0x2466 },
+	{ "e", 0x0065 },
+	{ "muasquare", 0x3382 },
+	{ "arrowwaveboth", 0x21ad },
+	{ "psili", 0x1fbf },
+	{ "ncommaaccent", 0x0146 },
+	{ "v", 0x0076 },
+	{ "llladeva", 0x0934 },
+	{ "wsuperior", 0x02b7 },
+	{ "parallelogram", 0x25b1 },
+	{ "afii57793", 0x05b4 },
+	{ "ddhadeva", 0x0922 },
+	{ "yehthreedotsbelowarabic", 0x06d1 },
+	{ "meeminitialarabic", 0xfee3 },
+	{ "rftimes", 0x29d5 },
+	{ "uni2272FE00", 0xed70 },
+	{ "threearabic", 0x0663 },
+	{ "twoparen", 0x2475 },
+	{ "q.sc", 0xf771 },
+	{ "truestate", 0x22a7 },
+	{ "eokorean", 0x3153 },
+	{ "figurespace", 0x2007 },
+	{ "stixEE37", 0xee37 },
+	{ "fourarabic", 0x0664 },
+	{ "micro", 0x00b5 },
+	{ "rragurmukhi", 0x0a5c },
+	{ "ucyrillic", 0x0443 },
+	{ "afii10019", 0x0412 },
+	{ "uni2A700338", 0xe2c7 },
+	{ "diamondrhombsolid", 0x25c6 },
+	{ "Kacute", 0x1e30 },
+	{ "ocyrillic", 0x043e },
+	{ "circumflex.cyr", 0xf6d5 },
+	{ "equalsdots", 0x2251 },
+	{ "ljecyrillic", 0x0459 },
+	{ "leftarrowless", 0x2977 },
+	{ "chabengali", 0x099b },
+	{ "twocircle", 0x2461 },
+	{ "plusinferior", 0x208a },
+	{ "thousandcyrillic", 0x0482 },
+	{ "arrowdblleft", 0x21d0 },
+	{ "dblanglebracketright", 0x300b },
+	{ "seven.numerator", 0xf668 },
+	{ "i.superior", 0xf6ed },
+	{ "smte", 0x2aac },
+	{ "upsilonlenis", 0x1f50 },
+	{ "one.taboldstyle", 0xf644 },
+	{ "cuberoot", 0x221b },
+	{ "twelveperiod", 0x2493 },
+	{ "greatermuch", 0x226b },
+	{ "Hdieresis", 0x1e26 },
+	{ "dhagurmukhi", 0x0a27 },
+	{ "ntilde.sc", 0xf7f1 },
+	{ "Thorn", 0x00de },
+	{ "onenumerator", 0x215f },
+	{ "a31", 0x2724 },
+	{ "vavholam", 0xfb4b },
+	{ "ltdnleftform", 0x2510 },
+	{ "a61", 0x2742 },
+	{ "adblgrave", 0x0201 },
+	{ "fiveideographicparen", 0x3224 },
+	{ "asmallkatakana", 0x30a1 },
+	{ "segoltahebrew", 0x0592 },
+	{ "asterisksmall", 0xfe61 },
+	{ "fathalowarabic", 0x064e },
+	{ "DD112", 0x231f },
+	{ "upsilondieresistonos", 0x03b0 },
+	{ "notbar", 0x2224 },
+	{ "ohornacute", 0x1edb },
+	{ "pacute", 0x1e55 },
+	{ "eacute", 0x00e9 },
+	{ "saraethai", 0x0e40 },
+	{ "Zcaron", 0x017d },
+	{ "lessorsimilar", 0x2272 },
+	{ "f_i", 0xfb01 },
+	{ "dollarmonospace", 0xff04 },
+	{ "Tildesmall", 0xf6fe },
+	{ "Ugrave", 0x00d9 },
+	{ "fourteencircle", 0x246d },
+	{ "zeropersian", 0x06f0 },
+	{ "stixEE3A", 0xee3a },
+	{ "Icyrillic", 0x0406 },
+	{ "afii57669", 0x05d5 },
+	{ "perispomenigreekcmb", 0x0342 },
+	{ "Iotaaspergrave", 0x1f3b },
+	{ "omacron", 0x014d },
+	{ "pansioskorean", 0x317f },
+	{ "a197", 0x27b4 },
+	{ "righttackbelowcmb", 0x0319 },
+	{ "notgreater", 0x226f },
+	{ "Iotadiaeresis", 0x03aa },
+	{ "rrvocalicdeva", 0x0960 },
+	{ "alphaiotasublenis", 0x1f80 },
+	{ "patahwidehebrew", 0x05b7 },
+	{ "zeta", 0x03b6 },
+	{ "afii10146", 0x0462 },
+	{ "hturned", 0x0265 },
+	{ "esmallhiragana", 0x3047 },
+	{ "bridgesubnosp", 0x032a },
+	{ "smt", 0x2aaa },
+	{ "followsorcurly", 0x227d },
+	{ "backwarddiagonal", 0x2572 },
+	{ "saraamthai", 0x0e33 },
+	{ "Ddotaccent", 0x1e0a },
+	{ "feharmenian", 0x0586 },
+	{ "jparen", 0x24a5 },
+	{ "yhook", 0x01b4 },
+	{ "behmeeminitialarabic", 0xfc9f },
+	{ "Etalenistilde", 0x1f2e },
+	{ "Benarmenian", 0x0532 },
+	{ "similar", 0x223c },
+	{ "equaldotrightleft", 0x2253 },
+	{ "hvdnleftform", 0x2513 },
+	{ "lefttackbelowcmb", 0x0318 },
+	{ "Acaron", 0x01cd },
+	{ "itilde", 0x0129 },
+	{ "schwadieresiscyrillic", 0x04db },
+	{ "Ereversedcyrillic", 0x042d },
+	{ "Gmonospace", 0xff27 },
+	{ "sqimageornotequal", 0x22e4 },
+	{ "ngagurmukhi", 0x0a19 },
+	{ "qarneyparahebrew", 0x059f },
+	{ "yasmallkatakana", 0x30e3 },
+	{ "omegaiotasubacute", 0x1ff4 },
+	{ "yehhamzaabovearabic", 0x0626 },
+	{ "dialytikagrave", 0x1fed },
+	{ "Igrave", 0x00cc },
+	{ "ideographichighcircle", 0x32a4 },
+	{ "aringbelow", 0x1e01 },
+	{ "Ohorndotbelow", 0x1ee2 },
+	{ "suchthat", 0x220b },
+	{ "blankb", 0x2422 },
+	{ "erbopomofo", 0x3126 },
+	{ "invsmileface", 0x263b },
+	{ "multimap", 0x22b8 },
+	{ "a163", 0x2194 },
+	{ "rmonospace", 0xff52 },
+	{ "arrowupdn", 0x2195 },
+	{ "whitestar", 0x2606 },
+	{ "maitaikhuleftthai", 0xf889 },
+	{ "maitholowrightthai", 0xf88e },
+	{ "dbluphorizform", 0x2569 },
+	{ "Dje", 0x0402 },
+	{ "che", 0x0447 },
+	{ "stixEEA3", 0xeea3 },
+	{ "six.numerator", 0xf667 },
+	{ "kasraarabic", 0x0650 },
+	{ "afii57675", 0x05db },
+	{ "degreefarenheit", 0x2109 },
+	{ "Pemiddlehookcyrillic", 0x04a6 },
+	{ "Ncircle", 0x24c3 },
+	{ "Amacron", 0x0100 },
+	{ "ringbelowcmb", 0x0325 },
+	{ "khacek", 0x01e9 },
+	{ "Epsilonacute", 0x1fc9 },
+	{ "stixEEA1", 0xeea1 },
+	{ "asterism", 0x2042 },
+	{ "arrowupwhite", 0x21e7 },
+	{ "bhagujarati", 0x0aad },
+	{ "ninepersian", 0x06f9 },
+	{ "stixEE51", 0xee51 },
+	{ "force", 0x22a9 },
+	{ "afii57440", 0x0640 },
+	{ "lessorequivalent", 0x2272 },
+	{ "ngabengali", 0x0999 },
+	{ "Uhungarumlautcyrillic", 0x04f2 },
+	{ "omegaiota.sc", 0xf51d },
+	{ "endash", 0x2013 },
+	{ "assertion", 0x22a6 },
+	{ "stixEED0", 0xeed0 },
+	{ "Chi", 0x03a7 },
+	{ "four.oldstyle", 0xf734 },
+	{ "mekatakanahalfwidth", 0xff92 },
+	{ "tsadi", 0x05e6 },
+	{ "ampersandsmall", 0xf726 },
+	{ "Escedilla", 0x04aa },
+	{ "eibopomofo", 0x311f },
+	{ "eightcircle", 0x2467 },
+	{ "thothahanthai", 0x0e17 },
+	{ "yesieungkorean", 0x3181 },
+	{ "Etaasper", 0x1f29 },
+	{ "cent", 0x00a2 },
+	{ "leftharpoonaccent", 0x20d0 },
+	{ "afii10104", 0x0457 },
+	{ "sheenmedialarabic", 0xfeb8 },
+	{ "two.numerator", 0xf663 },
+	{ "gebar", 0x0493 },
+	{ "beharabic", 0x0628 },
+	{ "hihiragana", 0x3072 },
+	{ "finalmem", 0x05dd },
+	{ "longrightzigzagarrow", 0x27ff },
+	{ "Musmall", 0xf50b },
+	{ "threeoldstyle", 0xf733 },
+	{ "afii10084", 0x0442 },
+	{ "Ygrave.small", 0xf6aa },
+	{ "one", 0x0031 },
+	{ "registered.serif", 0xf6da },
+	{ "sadmedialarabic", 0xfebc },
+	{ "horizdblbar", 0x2550 },
+	{ "dotminus", 0x2238 },
+	{ "Oi", 0x01a2 },
+	{ "a35", 0x2605 },
+	{ "uni00640321", 0xea38 },
+	{ "one.denominator", 0xf656 },
+	{ "rdescend", 0x027c },
+	{ "Zstroke", 0x01b5 },
+	{ "tthagujarati", 0x0aa0 },
+	{ "Vsmall", 0xf776 },
+	{ "uni2A9620D2", 0xed67 },
+	{ "dje", 0x0452 },
+	{ "Ecircumflexgrave", 0x1ec0 },
+	{ "Fmonospace", 0xff26 },
+	{ "afii61574", 0x202d },
+	{ "hagujarati", 0x0ab9 },
+	{ "arrowaxisright", 0x2192 },
+	{ "Ahacek", 0x01cd },
+	{ "a92", 0x276d },
+	{ "afii57470", 0x0647 },
+	{ "dadarabic", 0x0636 },
+	{ "cornerbracketright", 0x300d },
+	{ "beta.sc", 0xf501 },
+	{ "adieresismacron", 0x01df },
+	{ "kafarabic", 0x0643 },
+	{ "rightcurvedarrow", 0x2933 },
+	{ "squarehorizontalfill", 0x25a4 },
+	{ "fei", 0x03e5 },
+	{ "a66", 0x2747 },
+	{ "ismallkatakanahalfwidth", 0xff68 },
+	{ "quotedbl", 0x0022 },
+	{ "ymonospace", 0xff59 },
+	{ "lslash.sc", 0xf6f9 },
+	{ "angbopomofo", 0x3124 },
+	{ "dukatakana", 0x30c5 },
+	{ "whitetelephone", 0x260f },
+	{ "tav", 0x05ea },
+	{ "parenleft.denominator", 0xf62c },
+	{ "ownersmall", 0x220d },
+	{ "ocandravowelsigngujarati", 0x0ac9 },
+	{ "fourinferior", 0x2084 },
+	{ "gravebelowcmb", 0x0316 },
+	{ "Schwadieresiscyrillic", 0x04da },
+	{ "alphaiotasubaspergrave", 0x1f83 },
+	{ "yoikorean", 0x3189 },
+	{ "gcursive", 0x0261 },
+	{ "colonmonospace", 0xff1a },
+	{ "notprecedesoreql", 0x22e0 },
+	{ "thagujarati", 0x0aa5 },
+	{ "rtblock", 0x2590 },
+	{ "viramabengali", 0x09cd },
+	{ "circle", 0x25cb },
+	{ "newline", 0x2424 },
+	{ "image", 0x22b7 },
+	{ "finalkafhebrew", 0x05da },
+	{ "clear", 0x2327 },
+	{ "hangulfiller", 0x3164 },
+	{ "stixEE05", 0xee05 },
+	{ "hieuhacirclekorean", 0x327b },
+	{ "bracketright", 0x005d },
+	{ "decimalseparatorpersian", 0x066b },
+	{ "dbopomofo", 0x3109 },
+	{ "uni00680321", 0xea39 },
+	{ "ecircumflextilde", 0x1ec5 },
+	{ "hiriqwidehebrew", 0x05b4 },
+	{ "stixEE78", 0xee78 },
+	{ "yatcyrillic", 0x0463 },
+	{ "olehebrew", 0x05ab },
+	{ "mohmsquare", 0x33c1 },
+	{ "arrowleftdbl", 0x21d0 },
+	{ "Chismall", 0xf516 },
+	{ "uphvrtltform", 0x2516 },
+	{ "arrowbarup", 0x21a5 },
+	{ "uni2A9B0338", 0xe3da },
+	{ "fathatanarabic", 0x064b },
+	{ "khieukhkorean", 0x314b },
+	{ "thieuthparenkorean", 0x320b },
+	{ "a36", 0x2729 },
+	{ "a151", 0x278b },
+	{ "patahhebrew", 0x05b7 },
+	{ "nwovnearrow", 0x2932 },
+	{ "uni29D00338", 0xf413 },
+	{ "hadeva", 0x0939 },
+	{ "Voarmenian", 0x0548 },
+	{ "lineseparator", 0x2028 },
+	{ "aibengali", 0x0990 },
+	{ "tonefive", 0x01bd },
+	{ "Pluto", 0x2647 },
+	{ "Iniarmenian", 0x053b },
+	{ "hatafqamats28", 0x05b3 },
+	{ "clwcontintegral", 0x2232 },
+	{ "decimalseparatorarabic", 0x066b },
+	{ "koronis", 0x1fbd },
+	{ "rightanglene", 0x2510 },
+	{ "hvvertrtform", 0x2523 },
+	{ "gohiragana", 0x3054 },
+	{ "ttadeva", 0x091f },
+	{ "macronlowmod", 0x02cd },
+	{ "vecyrillic", 0x0432 },
+	{ "Tbar", 0x0166 },
+	{ "fraction", 0x2044 },
+	{ "afii10078", 0x043c },
+	{ "minusplus", 0x2213 },
+	{ "a202", 0x2703 },
+	{ "shin", 0x05e9 },
+	{ "kohiragana", 0x3053 },
+	{ "a41", 0x272e },
+	{ "hatafpatah23", 0x05b2 },
+	{ "tatweelarabic", 0x0640 },
+	{ "parenleftvertical", 0xfe35 },
+	{ "stixEE5C", 0xee5c },
+	{ "sigma.end", 0x03c2 },
+	{ "veeeq", 0x225a },
+	{ "zeronojoin", 0x200c },
+	{ "eegurmukhi", 0x0a0f },
+	{ "hoonsquare", 0x3342 },
+	{ "uni226520D2", 0xe2c2 },
+	{ "lamaleffinalarabic", 0xfefc },
+	{ "weokorean", 0x315d },
+	{ "yeorinhieuhkorean", 0x3186 },
+	{ "register.sans", 0xf8e8 },
+	{ "addresssubject", 0x2101 },
+	{ "arrowdblnw", 0x21d6 },
+	{ "upltleftdnhvform", 0x252a },
+	{ "Agrave", 0x00c0 },
+	{ "mpasquare", 0x33ab },
+	{ "lamalefhamzabelowfinalarabic", 0xfefa },
+	{ "jhagujarati", 0x0a9d },
+	{ "whitedownpointingsmalltriangle", 0x25bf },
+	{ "dnhvrtupltform", 0x251f },
+	{ "Lslashsmall", 0xf6f9 },
+	{ "Tworoman", 0x2161 },
+	{ "afii10098", 0x0491 },
+	{ "Hardsigncyrillic", 0x042a },
+	{ "rieulkorean", 0x3139 },
+	{ "parenlefttp", 0xf8eb },
+	{ "Ukcyrillic", 0x0478 },
+	{ "Alphaaspergrave", 0x1f0b },
+	{ "efcyrillic", 0x0444 },
+	{ "S", 0x0053 },
+	{ "ringlefthalfsup", 0x02d3 },
+	{ "aacute.sc", 0xf7e1 },
+	{ "arrowdownleft", 0x2199 },
+	{ "I.ukran", 0x0406 },
+	{ "parenrightex", 0xf8f7 },
+	{ "SF590000", 0x2590 },
+	{ "Rdblgrave", 0x0210 },
+	{ "fouroldstyle", 0xf734 },
+	{ "j.sc", 0xf76a },
+	{ "rectangle", 0x25ad },
+	{ "ocircumflex.sc", 0xf7f4 },
+	{ "arrowheaddownmod", 0x02c5 },
+	{ "five.taboldstyle", 0xf648 },
+	{ "glj", 0x2aa4 },
+	{ "arrowopenup", 0x21e7 },
+	{ "stixEE47", 0xee47 },
+	{ "stixEEDB", 0xeedb },
+	{ "upharpoonleftbar", 0x2960 },
+	{ "a168", 0x279d },
+	{ "nyagujarati", 0x0a9e },
+	{ "ninecircle", 0x2468 },
+	{ "u.cyr", 0x0443 },
+	{ "oneideographicparen", 0x3220 },
+	{ "CL", 0x2104 },
+	{ "noonjeemisolatedarabic", 0xfc4b },
+	{ "aigujarati", 0x0a90 },
+	{ "oneparen", 0x2474 },
+	{ "gangiacoptic", 0x03eb },
+	{ "emcyrillic", 0x043c },
+	{ "Searrow", 0x21d8 },
+	{ "Vewarmenian", 0x054e },
+	{ "meemmeeminitialarabic", 0xfcd1 },
+	{ "huhiragana", 0x3075 },
+	{ "Llinebelow", 0x1e3a },
+	{ "guilsinglright", 0x203a },
+	{ "tehmeeminitialarabic", 0xfca4 },
+	{ "boxrounded", 0x25a2 },
+	{ "getamark", 0x3013 },
+	{ "vewarmenian", 0x057e },
+	{ "afii57508", 0x0698 },
+	{ "afii10052", 0x0403 },
+	{ "Ndotaccent", 0x1e44 },
+	{ "radsquare", 0x33ad },
+	{ "hermitconjmatrix", 0x22b9 },
+	{ "Emacrongrave", 0x1e14 },
+	{ "yodhebrew", 0x05d9 },
+	{ "gammasuper", 0x02e0 },
+	{ "arrowbardown", 0x21a7 },
+	{ "ringhalfrightbelowcmb", 0x0339 },
+	{ "Etaaspertilde", 0x1f2f },
+	{ "finalnunhebrew", 0x05df },
+	{ "cadauna", 0x2106 },
+	{ "echyiwnarmenian", 0x0587 },
+	{ "centoldstyle", 0xf7a2 },
+	{ "peseta", 0x20a7 },
+	{ "sixteencurrencydenominatorbengali", 0x09f9 },
+	{ "braceleft.cap", 0xf6b2 },
+	{ "macronsubnosp", 0x0331 },
+	{ "cacute", 0x0107 },
+	{ "shei", 0x03e3 },
+	{ "lamalefisolatedarabic", 0xfefb },
+	{ "ninemonospace", 0xff19 },
+	{ "nyadeva", 0x091e },
+	{ "iibreve", 0x0439 },
+	{ "omegaiotasub", 0x1ff3 },
+	{ "zahinitialarabic", 0xfec7 },
+	{ "alefarabic", 0x0627 },
+	{ "a82", 0x2758 },
+	{ "triangleftequal", 0x22b4 },
+	{ "forkv", 0x2ad9 },
+	{ "stixEE31", 0xee31 },
+	{ "afii10832", 0xf6c8 },
+	{ "maiekupperleftthai", 0xf88a },
+	{ "rangledownzigzagarrow", 0x237c },
+	{ "smalltriangle", 0x25b5 },
+	{ "keharmenian", 0x0584 },
+	{ "pe.ital", 0xf6c7 },
+	{ "caron", 0x02c7 },
+	{ "Izhitsagravedbl", 0x0476 },
+	{ "ia", 0x044f },
+	{ "afii57700", 0xfb4b },
+	{ "ideographiccommaleft", 0xff64 },
+	{ "uni2A9B20D2", 0xe3d8 },
+	{ "a187", 0x27ba },
+	{ "yagurmukhi", 0x0a2f },
+	{ "kha", 0x0445 },
+	{ "ukatakanahalfwidth", 0xff73 },
+	{ "similarequal", 0x2243 },
+	{ "laminitialarabic", 0xfedf },
+	{ "wawhamzaabovearabic", 0x0624 },
+	{ "DD102", 0x2594 },
+	{ "lparen", 0x24a7 },
+	{ "bracketleftex", 0xf8ef },
+	{ "ssangpieupkorean", 0x3143 },
+	{ "pcircle", 0x24df },
+	{ "Nlinebelow", 0x1e48 },
+	{ "eightarabic", 0x0668 },
+	{ "a29", 0x2722 },
+	{ "ssangsioskorean", 0x3146 },
+	{ "Moon", 0x263e },
+	{ "afii57417", 0x0629 },
+	{ "a125", 0x2465 },
+	{ "yerudieresiscyrillic", 0x04f9 },
+	{ "weierstrass", 0x2118 },
+	{ "phi", 0x03c6 },
+	{ "breve.cyrcap", 0xf6d1 },
+	{ "stixEED6", 0xeed6 },
+	{ "pi", 0x03c0 },
+	{ "lameddageshhebrew", 0xfb3c },
+	{ "Ghe", 0x0413 },
+	{ "rieulhieuhkorean", 0x3140 },
+	{ "breveinverteddoublecmb", 0x0361 },
+	{ "a23", 0x2717 },
+	{ "Grave", 0xf6ce },
+	{ "emdashvertical", 0xfe31 },
+	{ "omonospace", 0xff4f },
+	{ "a87", 0x2772 },
+	{ "a28", 0x271c },
+	{ "eogonek", 0x0119 },
+	{ "lnot", 0x00ac },
+	{ "gradient", 0x2207 },
+	{ "ecaron", 0x011b },
+	{ "rrvocalicvowelsigngujarati", 0x0ac4 },
+	{ "thehinitialarabic", 0xfe9b },
+	{ "smalltriangleleftsld", 0x25c2 },
+	{ "upsilonlatin", 0x028a },
+	{ "SF540000", 0x256a },
+	{ "uragurmukhi", 0x0a73 },
+	{ "tackleftsubnosp", 0x0318 },
+	{ "b.superior", 0xf6ea },
+	{ "uni002820090029", 0xedf7 },
+	{ "DD010", 0x231c },
+	{ "Ya", 0x042f },
+	{ "hyphentwo", 0x2010 },
+	{ "SF480000", 0x2565 },
+	{ "iotatilde", 0x1fd6 },
+	{ "a131", 0x2777 },
+	{ "datalinkescape", 0x2410 },
+	{ "uni003D20D2", 0xed59 },
+	{ "nyagurmukhi", 0x0a1e },
+	{ "kmonospace", 0xff4b },
+	{ "ocyril", 0x043e },
+	{ "bracketrightmonospace", 0xff3d },
+	{ "turnstileleft", 0x22a2 },
+	{ "tonesix", 0x0185 },
+	{ "Gemini", 0x264a },
+	{ "stixEE75", 0xee75 },
+	{ "zayinhebrew", 0x05d6 },
+	{ "follows", 0x227b },
+	{ "kukatakanahalfwidth", 0xff78 },
+	{ "nikatakana", 0x30cb },
+	{ "asymptequal", 0x2243 },
+	{ "a108", 0x2767 },
+	{ "ringinequal", 0x2256 },
+	{ "dieresiscircumflex", 0x1fc1 },
+	{ "yoghtail", 0x01ba },
+	{ "logicaland", 0x2227 },
+	{ "ydotbelow", 0x1ef5 },
+	{ "verthvrtltform", 0x2520 },
+	{ "stixEED4", 0xeed4 },
+	{ "wdiaeresis", 0x1e85 },
+	{ "hvvertform", 0x2503 },
+	{ "finalpe", 0x05e3 },
+	{ "Odiaeresis", 0x00d6 },
+	{ "omegatitlo", 0x047d },
+	{ "pazerhebrew", 0x05a1 },
+	{ "qadeva", 0x0958 },
+	{ "a71", 0x25cf },
+	{ "Yusbig", 0x046a },
+	{ "Fscript", 0x2131 },
+	{ "centmonospace", 0xffe0 },
+	{ "telephone", 0x2121 },
+	{ "lamedhebrew", 0x05dc },
+	{ "a200", 0x27ae },
+	{ "kaffinalarabic", 0xfeda },
+	{ "period.denominator", 0xf660 },
+	{ "twoinferior", 0x2082 },
+	{ "scE", 0x2ab4 },
+	{ "TeTse", 0x04b4 },
+	{ "mturned", 0x026f },
+	{ "nwsearrow", 0x2921 },
+	{ "chieuchkorean", 0x314a },
+	{ "lcommaaccent", 0x013c },
+	{ "stixEEB7", 0xeeb7 },
+	{ "afii57795", 0x05b6 },
+	{ "ninedeva", 0x096f },
+	{ "ccedillaacute", 0x1e09 },
+	{ "Ldotaccent", 0x013f },
+	{ "bdotbelow", 0x1e05 },
+	{ "ka", 0x043a },
+	{ "origof", 0x22b6 },
+	{ "glottalstopinverted", 0x0296 },
+	{ "haitusquare", 0x332a },
+	{ "three.oldstyle", 0xf733 },
+	{ "icircumflex.sc", 0xf7ee },
+	{ "thorn.sc", 0xf7fe },
+	{ "rightzigzagarrow", 0x21dd },
+	{ "hknwarrow", 0x2923 },
+	{ "Iotalatin", 0x0196 },
+	{ "omegalenistilde", 0x1f66 },
+	{ "afii10057", 0x0408 },
+	{ "ideographiccongratulationparen", 0x3237 },
+	{ "onedotenleader", 0x2024 },
+	{ "scarondotaccent", 0x1e67 },
+	{ "icyrillic", 0x0456 },
+	{ "gheupturncyrillic", 0x0491 },
+	{ "Wgrave", 0x1e80 },
+	{ "omegalenis", 0x1f60 },
+	{ "fourfifths", 0x2158 },
+	{ "Zhecyrillic", 0x0416 },
+	{ "followsequal1", 0x227d },
+	{ "omega", 0x03c9 },
+	{ "khahfinalarabic", 0xfea6 },
+	{ "uni2A0B.up", 0xea57 },
+	{ "uni006A.dotless", 0xe2d4 },
+	{ "uuvowelsigngujarati", 0x0ac2 },
+	{ "ubengali", 0x0989 },
+	{ "Yi", 0x0407 },
+	{ "alefmaddaabovefinalarabic", 0xfe82 },
+	{ "etaiotasubaspertilde", 0x1f97 },
+	{ "checyrillic", 0x0447 },
+	{ "righttriangle", 0x22bf },
+	{ "Alphasmall", 0xf500 },
+	{ "idieresisacute", 0x1e2f },
+	{ "Coloneq", 0x2a74 },
+	{ "Udieresissmall", 0xf7fc },
+	{ "circlevertbar", 0x229d },
+	{ "Vdotbelow", 0x1e7e },
+	{ "stixEEAA", 0xeeaa },
+	{ "Ccedillaacute", 0x1e08 },
+	{ "acircumflex.sc", 0xf7e2 },
+	{ "bracerighttp", 0xf8fc },
+	{ "qubutsquarterhebrew", 0x05bb },
+	{ "yehinitialarabic", 0xfef3 },
+	{ "smalltriangleright", 0x25b9 },
+	{ "afii57418", 0x062a },
+	{ "stixEE84", 0xee84 },
+	{ "muhiragana", 0x3080 },
+	{ "thothongthai", 0x0e18 },
+	{ "Hard", 0x042a },
+	{ "a165", 0x2799 },
+	{ "afii57794", 0x05b5 },
+	{ "nmsquare", 0x339a },
+	{ "mu.sc", 0xf50b },
+	{ "thieuthkorean", 0x314c },
+	{ "iotaaspergrave", 0x1f33 },
+	{ "upsilondiaeresis", 0x03cb },
+	{ "vav", 0x05d5 },
+	{ "ahiragana", 0x3042 },
+	{ "iotabreve", 0x1fd0 },
+	{ "afii57804", 0x05c1 },
+	{ "threefifths", 0x2157 },
+	{ "mmonospace", 0xff4d },
+	{ "dblarrowup", 0x21c8 },
+	{ "apple", 0xf8ff },
+	{ "bethmath", 0x2136 },
+	{ "ayinaltonehebrew", 0xfb20 },
+	{ "onesuperior", 0x00b9 },
+	{ "period.superior", 0xf6e8 },
+	{ "a120", 0x2460 },
+	{ "afii10107", 0x045a },
+	{ "Ccedilla", 0x00c7 },
+	{ "notequivalence", 0x2262 },
+	{ "subsetdblequal", 0x2286 },
+	{ "vehmedialarabic", 0xfb6d },
+	{ "prime", 0x2032 },
+	{ "upsilonaspercircumflex", 0x1f57 },
+	{ "Fturn", 0x2132 },
+	{ "Gstroke", 0x01e4 },
+	{ "aulengthmarkbengali", 0x09d7 },
+	{ "sallallahoualayhewasallamarabic", 0xfdfa },
+	{ "DD104", 0x231d },
+	{ "eta.sc", 0xf506 },
+	{ "ograve.sc", 0xf7f2 },
+	{ "Cmonospace", 0xff23 },
+	{ "Upsilonlatin", 0x01b1 },
+	{ "rokatakana", 0x30ed },
+	{ "stixEEDA", 0xeeda },
+	{ "uni2205.var", 0xe623 },
+	{ "alphaiotasubasperacute", 0x1f85 },
+	{ "afii10195", 0x0473 },
+	{ "ncaron", 0x0148 },
+	{ "erev", 0x0258 },
+	{ "vavyod", 0x05f1 },
+	{ "yod", 0x05d9 },
+	{ "second", 0x2033 },
+	{ "contintegral", 0x222e },
+	{ "perspcorrespond", 0x2306 },
+	{ "barrightharpoonup", 0x295b },
+	{ "oekorean", 0x315a },
+	{ "pehook", 0x04a7 },
+	{ "gammasuperior", 0x02e0 },
+	{ "servicemark", 0x2120 },
+	{ "lowlinecenterline", 0xfe4e },
+	{ "upsilondieresis.sc", 0xf51a },
+	{ "hieuhparenkorean", 0x320d },
+	{ "seven.taboldstyle", 0xf64a },
+	{ "Epsilongrave", 0x1fc8 },
+	{ "nnadeva", 0x0923 },
+	{ "dammatanarabic", 0x064c },
+	{ "dieresiscmb", 0x0308 },
+	{ "interrobang", 0x203d },
+	{ "bracketright.cap", 0xf6b1 },
+	{ "Em", 0x041c },
+	{ "supersetsqequal", 0x2292 },
+	{ "holamhebrew", 0x05b9 },
+	{ "afii57381", 0x066a },
+	{ "takatakanahalfwidth", 0xff80 },
+	{ "toparc", 0x25e0 },
+	{ "brevenosp", 0x0306 },
+	{ "rightarrowbar", 0x21e5 },
+	{ "lsuperior", 0xf6ee },
+	{ "OT", 0x047e },
+	{ "notforce", 0x22ae },
+	{ "horncmb", 0x031b },
+	{ "Ncedilla", 0x0145 },
+	{ "Ecircumflexacute", 0x1ebe },
+	{ "Not", 0x2aec },
+	{ "a83", 0x2759 },
+	{ "holam26", 0x05b9 },
+	{ "ideographmooncircle", 0x328a },
+	{ "afii57409", 0x0621 },
+	{ "fcircle", 0x24d5 },
+	{ "uumatragurmukhi", 0x0a42 },
+	{ "Etasmall", 0xf506 },
+	{ "cornerbracketleft", 0x300c },
+	{ "stixEE55", 0xee55 },
+	{ "Ecircle", 0x24ba },
+	{ "commaaccent", 0xf6c3 },
+	{ "ringlefthalfsuper", 0x02bf },
+	{ "upsiloncircumflex", 0x1fe6 },
+	{ "a39", 0x272c },
+	{ "afii10054", 0x0405 },
+	{ "stixEE1A", 0xee1a },
+	{ "threeperemspace", 0x2004 },
+	{ "dollar.superior", 0xf6e4 },
+	{ "a65", 0x2746 },
+	{ "uni2A0F.lgdisplay", 0xe3d3 },
+	{ "omegaleniscircumflex", 0x1f66 },
+	{ "trademark.sans", 0xf8ea },
+	{ "dbllowline", 0x2017 },
+	{ "zehiragana", 0x305c },
+	{ "nonuthai", 0x0e19 },
+	{ "rukatakanahalfwidth", 0xff99 },
+	{ "lfthreequarterblock", 0x258a },
+	{ "dnblock", 0x2584 },
+	{ "rokatakanahalfwidth", 0xff9b },
+	{ "SF440000", 0x256c },
+	{ "arrowopenright", 0x21e8 },
+	{ "lagurmukhi", 0x0a32 },
+	{ "rturnascend", 0x027a },
+	{ "khei", 0x03e7 },
+	{ "aybarmenian", 0x0561 },
+	{ "madeva", 0x092e },
+	{ "yat", 0x0463 },
+	{ "endtext", 0x2403 },
+	{ "nine.denominator", 0xf65e },
+	{ "triaglfopen", 0x25c5 },
+	{ "omegaiotasubasperacute", 0x1fa5 },
+	{ "Wacute.small", 0xf6a5 },
+	{ "sixideographicparen", 0x3225 },
+	{ "integralex", 0xf8f5 },
+	{ "gcaron", 0x01e7 },
+	{ "edot", 0x0117 },
+	{ "mostpos", 0xe407 },
+	{ "kiroguramusquare", 0x3315 },
+	{ "hdotbelow", 0x1e25 },
+	{ "curlor", 0x22ce },
+	{ "alphaiotasubaspertilde", 0x1f87 },
+	{ "uni2AAF0338", 0xe5dc },
+	{ "Acircumflexsmall", 0xf7e2 },
+	{ "DieresisAcute", 0xf6cc },
+	{ "f.sc", 0xf766 },
+	{ "Umacron.small", 0xf6a1 },
+	{ "ttagurmukhi", 0x0a1f },
+	{ "Imonospace", 0xff29 },
+	{ "ocandravowelsigndeva", 0x0949 },
+	{ "afii10049", 0x042f },
+	{ "afii57689_afii57803", 0xfb2b },
+	{ "rightanglesw", 0x2514 },
+	{ "hooksubpalatnosp", 0x0321 },
+	{ "hvdashtriphorizform", 0x2505 },
+	{ "arrowrightheavy", 0x279e },
+	{ "yehhamzaaboveinitialarabic", 0xfe8b },
+	{ "acuterightnosp", 0x0341 },
+	{ "quotesinglemonospace", 0xff07 },
+	{ "fita", 0x0473 },
+	{ "a47", 0x2734 },
+	{ "parenright.inferior", 0x208e },
+	{ "bekatakana", 0x30d9 },
+	{ "gbreve", 0x011f },
+	{ "SM760000", 0x2195 },
+	{ "Fcircle", 0x24bb },
+	{ "numeralsign", 0x0374 },
+	{ "khokhaithai", 0x0e02 },
+	{ "ssuper", 0x02e2 },
+	{ "notgreaterequivlnt", 0x2275 },
+	{ "SF570000", 0x2584 },
+	{ "arrowdashup", 0x21e1 },
+	{ "Ohacek", 0x01d1 },
+	{ "Osmall", 0xf76f },
+	{ "meetorusquare", 0x334d },
+	{ "Pecyril", 0x041f },
+	{ "nikatakanahalfwidth", 0xff86 },
+	{ "nlegrightlong", 0x019e },
+	{ "house", 0x2302 },
+	{ "hatafqamats34", 0x05b3 },
+	{ "fiveoldstyle", 0xf735 },
+	{ "blackleftpointingtriangle", 0x25c0 },
+	{ "nuktagurmukhi", 0x0a3c },
+	{ "Xi", 0x039e },
+	{ "barmonospace", 0xff5c },
+	{ "four.numerator", 0xf665 },
+	{ "Ucaron", 0x01d3 },
+	{ "phi.sc", 0xf515 },
+	{ "Acircumflexgrave", 0x1ea6 },
+	{ "SF250000", 0x2557 },
+	{ "dotaccent.cap", 0xefed },
+	{ "Lje", 0x0409 },
+	{ "finalnun", 0x05df },
+	{ "stixEEBF", 0xeebf },
+	{ "stixEE54", 0xee54 },
+	{ "onecircleinversesansserif", 0x278a },
+	{ "uni2A17.lgdisplay", 0xe39a },
+	{ "ayin", 0x05e2 },
+	{ "diamondrhombnested", 0x25c8 },
+	{ "rukatakana", 0x30eb },
+	{ "etaasperacute", 0x1f25 },
+	{ "ssangcieuckorean", 0x3149 },
+	{ "SV040000", 0x25bc },
+	{ "slurabove", 0x2322 },
+	{ "Ng", 0x014a },
+	{ "dageshhebrew", 0x05bc },
+	{ "khaharabic", 0x062e },
+	{ "lbopomofo", 0x310c },
+	{ "vavvavhebrew", 0x05f0 },
+	{ "Esdescendercyrillic", 0x04aa },
+	{ "Alphaaspertilde", 0x1f0f },
+	{ "uni2A14.lgdisplay", 0xe399 },
+	{ "Oogonek", 0x01ea },
+	{ "kahookcyrillic", 0x04c4 },
+	{ "uphorizdblform", 0x2567 },
+	{ "a40", 0x272d },
+	{ "u0scrip", 0x2134 },
+	{ "dnfiveeighthblock", 0x2585 },
+	{ "gravesub", 0x02ce },
+	{ "kmsquaredsquare", 0x33a2 },
+	{ "blackupperrighttriangle", 0x25e5 },
+	{ "samekh", 0x05e1 },
+	{ "nunfinal", 0x05df },
+	{ "fourthai", 0x0e54 },
+	{ "digamma", 0x03dd },
+	{ "upsilondieresiscircumflex", 0x1fe7 },
+	{ "Gcaron", 0x01e6 },
+	{ "sixdeva", 0x096c },
+	{ "Eogonek.small", 0xf67c },
+	{ "downarrowbar", 0x2913 },
+	{ "SF020000", 0x2514 },
+	{ "ubar", 0x0289 },
+	{ "boxcrossdiaghatch", 0x25a9 },
+	{ "ts", 0x02a6 },
+	{ "Odblacute", 0x0150 },
+	{ "SF380000", 0x255a },
+	{ "leftarrowsubset", 0x297a },
+	{ "enbopomofo", 0x3123 },
+	{ "tranglenwsld", 0x25e4 },
+	{ "SF270000", 0x255c },
+	{ "Alphaiotasubasper", 0x1f89 },
+	{ "stixEE80", 0xee80 },
+	{ "parenleft.inferior", 0x208d },
+	{ "saraithai", 0x0e34 },
+	{ "ltuprtform", 0x2514 },
+	{ "a179", 0x27a9 },
+	{ "Rdotbelow", 0x1e5a },
+	{ "aivowelsignbengali", 0x09c8 },
+	{ "Otilde", 0x00d5 },
+	{ "yoddagesh", 0xfb39 },
+	{ "a126", 0x2466 },
+	{ "devcon2", 0x2412 },
+	{ "hehaltonearabic", 0x06c1 },
+	{ "gereshmuqdamhebrew", 0x059d },
+	{ "Kheicoptic", 0x03e6 },
+	{ "nun", 0x05e0 },
+	{ "upsilondieresisgrave", 0x1fe2 },
+	{ "vparen", 0x24b1 },
+	{ "block", 0x2588 },
+	{ "feharabic", 0x0641 },
+	{ "SF080000", 0x251c },
+	{ "fourparen", 0x2477 },
+	{ "a98", 0x275c },
+	{ "ringhalfleftcentered", 0x02d3 },
+	{ "lagujarati", 0x0ab2 },
+	{ "sadinitialarabic", 0xfebb },
+	{ "ringcmb", 0x030a },
+	{ "threecircle", 0x2462 },
+	{ "edieresis", 0x00eb },
+	{ "triagrtopen", 0x25bb },
+	{ "afii10050", 0x0490 },
+	{ "kafinitialarabic", 0xfedb },
+	{ "afii57669_afii57807", 0xfb35 },
+	{ "Ysmallcap", 0x028f },
+	{ "Barv", 0x2ae7 },
+	{ "tuhiragana", 0x3064 },
+	{ "ringnosp", 0x030a },
+	{ "curlyand", 0x22cf },
+	{ "Schwa", 0x018f },
+	{ "kturned", 0x029e },
+	{ "tehnoonfinalarabic", 0xfc73 },
+	{ "dargalefthebrew", 0x05a7 },
+	{ "afii10084.ital", 0xf6c8 },
+	{ "akatakanahalfwidth", 0xff71 },
+	{ "ccurl", 0x0255 },
+	{ "beamedsixteenthnotes", 0x266c },
+	{ "nihiragana", 0x306b },
+	{ "macron.sc", 0xf7af },
+	{ "threeroman", 0x2172 },
+	{ "diamondleftarrowbar", 0x291f },
+	{ "forceextr", 0x22ab },
+	{ "Atildesmall", 0xf7e3 },
+	{ "ringrighthalfsubnosp", 0x0339 },
+	{ "ieungkorean", 0x3147 },
+	{ "Chevertbar", 0x04b8 },
+	{ "kehiragana", 0x3051 },
+	{ "fdiagovnearrow", 0x292f },
+	{ "qamatsqatannarrowhebrew", 0x05b8 },
+	{ "voicedmarkkanahalfwidth", 0xff9e },
+	{ "sixpersian", 0x06f6 },
+	{ "dadfinalarabic", 0xfebe },
+	{ "whitediamond", 0x25c7 },
+	{ "lenistilde", 0x1fcf },
+	{ "chagurmukhi", 0x0a1b },
+	{ "eth", 0x00f0 },
+	{ "Kappa", 0x039a },
+	{ "subsub", 0x2ad5 },
+	{ "paseqhebrew", 0x05c0 },
+	{ "afii57393", 0x0661 },
+	{ "arrowtableft", 0x21e4 },
+	{ "seven.inferior", 0x2087 },
+	{ "Omonospace", 0xff2f },
+	{ "Gimarmenian", 0x0533 },
+	{ "shindagesh", 0xfb49 },
+	{ "coproduct", 0x2210 },
+	{ "Ohornhookabove", 0x1ede },
+	{ "omegaiotasubasper", 0x1fa1 },
+	{ "Uogonek", 0x0172 },
+	{ "telishagedolahebrew", 0x05a0 },
+	{ "Softsigncyrillic", 0x042c },
+	{ "ydieresis", 0x00ff },
+	{ "gimeldageshhebrew", 0xfb32 },
+	{ "yacute", 0x00fd },
+	{ "uni226720D2", 0xed63 },
+	{ "plusmod", 0x02d6 },
+	{ "circleplus", 0x2295 },
+	{ "Nmonospace", 0xff2e },
+	{ "uni22DAFE00", 0xe32b },
+	{ "ghagurmukhi", 0x0a18 },
+	{ "hedageshhebrew", 0xfb34 },
+	{ "threesuperior", 0x00b3 },
+	{ "maitaikhuthai", 0x0e47 },
+	{ "dblarrowheadright", 0x21a0 },
+	{ "GBsquare", 0x3387 },
+	{ "infinity", 0x221e },
+	{ "uni1D0B.reversed", 0xe637 },
+	{ "Daarmenian", 0x0534 },
+	{ "zerowidthspace", 0x200b },
+	{ "hatafqamats1b", 0x05b3 },
+	{ "barmidshortnosp", 0x0335 },
+	{ "Upsilonhookdiaeresis", 0x03d4 },
+	{ "hagurmukhi", 0x0a39 },
+	{ "plus", 0x002b },
+	{ "Omegalenisacute", 0x1f6c },
+	{ "whitesmilingface", 0x263a },
+	{ "afii10079", 0x043d },
+	{ "registersans", 0xf8e8 },
+	{ "alefdageshhebrew", 0xfb30 },
+	{ "l", 0x006c },
+	{ "onethai", 0x0e51 },
+	{ "percentsmall", 0xfe6a },
+	{ "Ifractur", 0x2111 },
+	{ "whiteleftpointingsmalltriangle", 0x25c3 },
+	{ "yasmallhiragana", 0x3083 },
+	{ "trianglebullet", 0x2023 },
+	{ "dblarrowupdown", 0x21c5 },
+	{ "ruthai", 0x0e24 },
+	{ "a6", 0x271d },
+	{ "otilde", 0x00f5 },
+	{ "Acute", 0xf6c9 },
+	{ "braceleftvertical", 0xfe37 },
+	{ "pwsquare", 0x33ba },
+	{ "afii57682", 0x05e2 },
+	{ "notequivasymptotic", 0x226d },
+	{ "pagurmukhi", 0x0a2a },
+	{ "yasmallkatakanahalfwidth", 0xff6c },
+	{ "upleftdblform", 0x255b },
+	{ "diamondrhomb", 0x25c7 },
+	{ "tildevertsupnosp", 0x033e },
+	{ "a198", 0x27b7 },
+	{ "afii57798", 0x05b7 },
+	{ "gmonospace", 0xff47 },
+	{ "ohiragana", 0x304a },
+	{ "rieulkiyeoksioskorean", 0x3169 },
+	{ "iinvertedbreve", 0x020b },
+	{ "Pbb", 0x2119 },
+	{ "lammeeminitialarabic", 0xfccc },
+	{ "multiopenleft", 0x22cb },
+	{ "rtriltri", 0x29ce },
+	{ "uni22420338", 0xe84e },
+	{ "overlinedashed", 0xfe49 },
+	{ "nkatakanahalfwidth", 0xff9d },
+	{ "eturned", 0x01dd },
+	{ "eighthangzhou", 0x3028 },
+	{ "ring.cap", 0xeff3 },
+	{ "ideographicperiod", 0x3002 },
+	{ "nooninitialarabic", 0xfee7 },
+	{ "aininitialarabic", 0xfecb },
+	{ "longs", 0x017f },
+	{ "TheSun", 0x2609 },
+	{ "rho", 0x03c1 },
+	{ "ieungacirclekorean", 0x3275 },
+	{ "xbsol", 0x29f9 },
+	{ "T", 0x0054 },
+	{ "reshhebrew", 0x05e8 },
+	{ "ehiragana", 0x3048 },
+	{ "rupeemarkbengali", 0x09f2 },
+	{ "rieulparenkorean", 0x3203 },
+	{ "downupharpoonsleftright", 0x296f },
+	{ "Atilde", 0x00c3 },
+	{ "nabla", 0x2207 },
+	{ "controlDC2", 0x0012 },
+	{ "stixEE1E", 0xee1e },
+	{ "omegaiotasublenistilde", 0x1fa6 },
+	{ "greaterorequivalent", 0x2273 },
+	{ "acircumflextilde", 0x1eab },
+	{ "uni2A14.up", 0xe399 },
+	{ "proportional", 0x221d },
+	{ "L", 0x004c },
+	{ "Ccircumflex", 0x0108 },
+	{ "ninecircleinversesansserif", 0x2792 },
+	{ "Icircumflex", 0x00ce },
+	{ "radoverssquaredsquare", 0x33af },
+	{ "Tcircumflexbelow", 0x1e70 },
+	{ "Dze", 0x0405 },
+	{ "Mdotaccent", 0x1e40 },
+	{ "ramiddlediagonalbengali", 0x09f0 },
+	{ "tcheharabic", 0x0686 },
+	{ "quoteright", 0x2019 },
+	{ "etaleniscircumflex", 0x1f26 },
+	{ "uni025402DE", 0xe646 },
+	{ "angle", 0x2220 },
+	{ "phagujarati", 0x0aab },
+	{ "kappa", 0x03ba },
+	{ "dparen", 0x249f },
+	{ "tonehigh", 0x02e6 },
+	{ "breveinvsubnosp", 0x032f },
+	{ "lazysinv", 0x223e },
+	{ "circleS", 0x24c8 },
+	{ "asciicircummonospace", 0xff3e },
+	{ "Rx", 0x211e },
+	{ "ghestrokecyrillic", 0x0493 },
+	{ "whiteuppointingsmalltriangle", 0x25b5 },
+	{ "p", 0x0070 },
+	{ "ubopomofo", 0x3128 },
+	{ "multiset", 0x228c },
+	{ "GeKarev", 0x04a0 },
+	{ "yehhamzaabovemedialarabic", 0xfe8c },
+	{ "P", 0x0050 },
+	{ "Ucircumflexbelow", 0x1e76 },
+	{ "samekhdagesh", 0xfb41 },
+	{ "Sigmasmall", 0xf512 },
+	{ "a103", 0x2763 },
+	{ "q", 0x0071 },
+	{ "osmallhiragana", 0x3049 },
+	{ "hungarumlautcmb", 0x030b },
+	{ "ceilingright", 0x2309 },
+	{ "stixEE06", 0xee06 },
+	{ "masoracirclehebrew", 0x05af },
+	{ "shaddaarabic", 0x0651 },
+	{ "uparrowbarred", 0x2909 },
+	{ "endmedium", 0x2419 },
+	{ "Dzhacek", 0x01c5 },
+	{ "A", 0x0041 },
+	{ "Ohorngrave", 0x1edc },
+	{ "fournumeratorbengali", 0x09f7 },
+	{ "tilde.sc", 0xf6fe },
+	{ "hhooksuper", 0x02b1 },
+	{ "R", 0x0052 },
+	{ "l.sc", 0xf76c },
+	{ "hungarumlaut.cap", 0xf6cf },
+	{ "zhertdes", 0x0497 },
+	{ "Acircumflexacute", 0x1ea4 },
+	{ "ltarcuprtform", 0x2570 },
+	{ "stixEEA7", 0xeea7 },
+	{ "Hcircumflex", 0x0124 },
+	{ "Alphaacute", 0x1fbb },
+	{ "oslash", 0x00f8 },
+	{ "Zmonospace", 0xff3a },
+	{ "ideographicmoonparen", 0x322a },
+	{ "gukatakana", 0x30b0 },
+	{ "Tmonospace", 0xff34 },
+	{ "mvmegasquare", 0x33b9 },
+	{ "mbopomofo", 0x3107 },
+	{ "Upsilonaspercircumflex", 0x1f5f },
+	{ "nkatakana", 0x30f3 },
+	{ "ddhabengali", 0x09a2 },
+	{ "arrowboth", 0x2194 },
+	{ "whitecornerbracketrightvertical", 0xfe44 },
+	{ "longs_t", 0xfb05 },
+	{ "Gehook", 0x0494 },
+	{ "lbbar", 0x2114 },
+	{ "twoheaddownarrow", 0x21a1 },
+	{ "Rcedilla", 0x0156 },
+	{ "contourintegral", 0x222e },
+	{ "omicronaspergrave", 0x1f43 },
+	{ "Vcircle", 0x24cb },
+	{ "alphaiotasubleniscircumflex", 0x1f86 },
+	{ "thagurmukhi", 0x0a25 },
+	{ "Gjecyrillic", 0x0403 },
+	{ "thehfinalarabic", 0xfe9a },
+	{ "a184", 0x27b3 },
+	{ "arrowtailright", 0x21a3 },
+	{ "thophuthaothai", 0x0e12 },
+	{ "sevendeva", 0x096d },
+	{ "khartdes", 0x04b3 },
+	{ "Zhedieresiscyrillic", 0x04dc },
+	{ "sequadarc", 0x25de },
+	{ "iideva", 0x0908 },
+	{ "Io", 0x0401 },
+	{ "notgreaternorless", 0x2279 },
+	{ "khzsquare", 0x3391 },
+	{ "recipe", 0x211e },
+	{ "igrave", 0x00ec },
+	{ "slash", 0x002f },
+	{ "a138", 0x277e },
+	{ "Pr", 0x2abb },
+	{ "yusbig", 0x046b },
+	{ "koppacyrillic", 0x0481 },
+	{ "zero.numerator", 0xf661 },
+	{ "gstroke", 0x01e5 },
+	{ "asciigrave", 0x0060 },
+	{ "Rmonospace", 0xff32 },
+	{ "lthorizform", 0x2500 },
+	{ "Yuslittleiotifiedcyrillic", 0x0468 },
+	{ "acutemodifier", 0x02ca },
+	{ "nuhiragana", 0x306c },
+	{ "alefhamzabelowfinalarabic", 0xfe88 },
+	{ "quotedblprimereversed", 0x301d },
+	{ "intersectionsq", 0x2293 },
+	{ "ramshorn", 0x0264 },
+	{ "a43", 0x2730 },
+	{ "bracketrightbt", 0xf8fb },
+	{ "downharpoonleftbar", 0x2959 },
+	{ "uni224D20D2", 0xed57 },
+	{ "smileface", 0x263a },
+	{ "holamquarterhebrew", 0x05b9 },
+	{ "nagurmukhi", 0x0a28 },
+	{ "hatafsegolwidehebrew", 0x05b1 },
+	{ "nine", 0x0039 },
+	{ "dollar.inferior", 0xf6e3 },
+	{ "Etaiotasub", 0x1fcc },
+	{ "afii57717", 0x05f1 },
+	{ "ghe.ital", 0xf6c4 },
+	{ "a102", 0x2762 },
+	{ "vertellipsis", 0x22ee },
+	{ "a49", 0x2736 },
+	{ "Upsilonasper", 0x1f59 },
+	{ "mieumkorean", 0x3141 },
+	{ "haceknosp", 0x030c },
+	{ "a117", 0x2709 },
+	{ "a59", 0x2740 },
+	{ "Aybarmenian", 0x0531 },
+	{ "four.taboldstyle", 0xf647 },
+	{ "saraueeleftthai", 0xf888 },
+	{ "haharabic", 0x062d },
+	{ "a52", 0x2739 },
+	{ "afii10018", 0x0411 },
+	{ "zero.superior", 0x2070 },
+	{ "tipehalefthebrew", 0x0596 },
+	{ "enquiry", 0x2405 },
+	{ "Shima", 0x03ec },
+	{ "Flower2dr", 0x2595 },
+	{ "ragurmukhi", 0x0a30 },
+	{ "won", 0x20a9 },
+	{ "eta", 0x03b7 },
+	{ "qamatsnarrowhebrew", 0x05b8 },
+	{ "thanthakhatlowrightthai", 0xf897 },
+	{ "fourgujarati", 0x0aea },
+	{ "a4", 0x260e },
+	{ "uni0331033103310331", 0xea21 },
+	{ "maitrithai", 0x0e4a },
+	{ "ghe", 0x0433 },
+	{ "Omicronasperacute", 0x1f4d },
+	{ "Yoghhacek", 0x01ee },
+	{ "okorean", 0x3157 },
+	{ "threegurmukhi", 0x0a69 },
+	{ "uni2A3CFE00", 0xe5ac },
+	{ "pipe", 0x01c0 },
+	{ "arceq", 0x2258 },
+	{ "dnthreequarterblock", 0x2586 },
+	{ "Rsmallcapinv", 0x0281 },
+	{ "saraaethai", 0x0e41 },
+	{ "afii57395", 0x0663 },
+	{ "dblarchinvertedbelowcmb", 0x032b },
+	{ "thothanthai", 0x0e10 },
+	{ "hyphensmall", 0xfe63 },
+	{ "v.sc", 0xf776 },
+	{ "amacron", 0x0101 },
+	{ "copyright.serif", 0xf6d9 },
+	{ "Bdotaccent", 0x1e02 },
+	{ "SF050000", 0x253c },
+	{ "Acyril", 0x0410 },
+	{ "a105", 0x2710 },
+	{ "candrabindunosp", 0x0310 },
+	{ "ringhalfleftbelowcmb", 0x031c },
+	{ "blackuppointingsmalltriangle", 0x25b4 },
+	{ "shevawidehebrew", 0x05b0 },
+	{ "OEsmall", 0xf6fa },
+	{ "tehjeeminitialarabic", 0xfca1 },
+	{ "afii57514", 0x06ba },
+	{ "Iishortcyrillic", 0x0419 },
+	{ "rturn", 0x0279 },
+	{ "ragujarati", 0x0ab0 },
+	{ "ltdashtriphorizform", 0x2504 },
+	{ "bracerightsmall", 0xfe5c },
+	{ "YR", 0x01a6 },
+	{ "palatalizationcyrilliccmb", 0x0484 },
+	{ "babengali", 0x09ac },
+	{ "integraltrpl", 0x222d },
+	{ "nineroman", 0x2178 },
+	{ "breve.cap", 0xefee },
+	{ "summation", 0x2211 },
+	{ "barleftharpoondown", 0x2956 },
+	{ "sheeninitialarabic", 0xfeb7 },
+	{ "coloncurrency", 0x20a1 },
+	{ "uni2A16.lgdisplay", 0xe377 },
+	{ "circumflex.cap", 0xeff7 },
+	{ "Cacute.small", 0xf671 },
+	{ "Omicronlenisacute", 0x1f4c },
+	{ "a194", 0x27b6 },
+	{ "Ecircumflextilde", 0x1ec4 },
+	{ "element", 0x2208 },
+	{ "eopen", 0x025b },
+	{ "dbldnhorizform", 0x2566 },
+	{ "afii10036", 0x0422 },
+	{ "ellipsis", 0x2026 },
+	{ "Sampigreek", 0x03e0 },
+	{ "ringsubnosp", 0x0325 },
+	{ "hatafpatahhebrew", 0x05b2 },
+	{ "afii10080", 0x043e },
+	{ "moverssquaredsquare", 0x33a8 },
+	{ "zeroinferior", 0x2080 },
+	{ "zukatakana", 0x30ba },
+	{ "adotbelow", 0x1ea1 },
+	{ "ohorn", 0x01a1 },
+	{ "benarmenian", 0x0562 },
+	{ "fparen", 0x24a1 },
+	{ "izhitsa", 0x0475 },
+	{ "Horicoptic", 0x03e8 },
+	{ "iivowelsignbengali", 0x09c0 },
+	{ "ideographicenterpriseparen", 0x323d },
+	{ "nis", 0x22fc },
+	{ "tshecyrillic", 0x045b },
+	{ "padeva", 0x092a },
+	{ "pikatakana", 0x30d4 },
+	{ "Lj", 0x01c8 },
+	{ "mieumaparenkorean", 0x3212 },
+	{ "ibengali", 0x0987 },
+	{ "tackleft", 0x22a3 },
+	{ "underscoremonospace", 0xff3f },
+	{ "abopomofo", 0x311a },
+	{ "dblarrowright", 0x21d2 },
+	{ "Idieresis", 0x00cf },
+	{ "gtcir", 0x2a7a },
+	{ "afii10081", 0x043f },
+	{ "Zbb", 0x2124 },
+	{ "be", 0x0431 },
+	{ "thanthakhatthai", 0x0e4c },
+	{ "Gbar", 0x01e4 },
+	{ "Upsilon1", 0x03d2 },
+	{ "dammalowarabic", 0x064f },
+	{ "Uacutesmall", 0xf7fa },
+	{ "V", 0x0056 },
+	{ "alefhamzaabovefinalarabic", 0xfe84 },
+	{ "Idblgrave", 0x0208 },
+	{ "aabengali", 0x0986 },
+	{ "vertlthorizhvform", 0x253f },
+	{ "propersubset", 0x2282 },
+	{ "Hcircle", 0x24bd },
+	{ "U.cyr", 0x0423 },
+	{ "mieumacirclekorean", 0x3272 },
+	{ "slashlongnosp", 0x0338 },
+	{ "afii57718", 0x05f2 },
+	{ "leftfishtail", 0x297c },
+	{ "epsilonlenisacute", 0x1f14 },
+	{ "hookretroflexbelowcmb", 0x0322 },
+	{ "tchehinitialarabic", 0xfb7c },
+	{ "hturn", 0x0265 },
+	{ "kikatakana", 0x30ad },
+	{ "onesixth", 0x2159 },
+	{ "ruledelayed", 0x29f4 },
+	{ "stixEEA9", 0xeea9 },
+	{ "henghook", 0x0267 },
+	{ "Tsmall", 0xf774 },
+	{ "secondtonechinese", 0x02ca },
+	{ "ktsquare", 0x33cf },
+	{ "uphvrtdnltform", 0x251e },
+	{ "invnot", 0x2310 },
+	{ "questionarabic", 0x061f },
+	{ "arrowsquiggleleft", 0x21dc },
+	{ "SM690000", 0x263c },
+	{ "verymuchless", 0x22d8 },
+	{ "Ibreve", 0x012c },
+	{ "circleverthatch", 0x25cd },
+	{ "stixEE7F", 0xee7f },
+	{ "psilicomb", 0x0313 },
+	{ "boxcrosshatch", 0x25a6 },
+	{ "braceleftmid", 0xf8f2 },
+	{ "ocircumflex", 0x00f4 },
+	{ "afii57684", 0x05e4 },
+	{ "acutecmb", 0x0301 },
+	{ "a124", 0x2464 },
+	{ "ltquest", 0x2a7b },
+	{ "zdotaccent", 0x017c },
+	{ "a74", 0x274f },
+	{ "subsetdot", 0x2abd },
+	{ "exclam.sc", 0xf721 },
+	{ "rieulsioskorean", 0x313d },
+	{ "vehinitialarabic", 0xfb6c },
+	{ "followsequal", 0x227d },
+	{ "tacktrpl", 0x22aa },
+	{ "memdagesh", 0xfb3e },
+	{ "Imacron.small", 0xf685 },
+	{ "evowelsignbengali", 0x09c7 },
+	{ "stixEEBE", 0xeebe },
+	{ "arrowhookright", 0x21aa },
+	{ "six.superior", 0x2076 },
+	{ "zhe", 0x0436 },
+	{ "H18551", 0x25ab },
+	{ "equivDD", 0x2a78 },
+	{ "zainfinalarabic", 0xfeb0 },
+	{ "seven.superior", 0x2077 },
+	{ "ddalfinalarabic", 0xfb89 },
+	{ "meemmedialarabic", 0xfee4 },
+	{ "gesdotol", 0x2a84 },
+	{ "uni220A.narrow", 0xedf3 },
+	{ "Circumflexsmall", 0xf6f6 },
+	{ "jsuperior", 0x02b2 },
+	{ "uni2A11.uplgdisplay", 0xe39b },
+	{ "breveinvnosp", 0x0311 },
+	{ "khieukhparenkorean", 0x320a },
+	{ "uvowelsigndeva", 0x0941 },
+	{ "backslashmath", 0x2216 },
+	{ "a134", 0x277a },
+	{ "Acircle", 0x24b6 },
+	{ "Gecyrillic", 0x0413 },
+	{ "uni2223.short", 0xe301 },
+	{ "Gheupturncyrillic", 0x0490 },
+	{ "jaarmenian", 0x0571 },
+	{ "kashidaautonosidebearingarabic", 0x0640 },
+	{ "proportion", 0x2237 },
+	{ "nabengali", 0x09a8 },
+	{ "auvowelsigndeva", 0x094c },
+	{ "hatafqamatsquarterhebrew", 0x05b3 },
+	{ "twelveroman", 0x217b },
+	{ "yyabengali", 0x09df },
+	{ "greater", 0x003e },
+	{ "holamwidehebrew", 0x05b9 },
+	{ "upsilonbreve", 0x1fe0 },
+	{ "oslashacute", 0x01ff },
+	{ "a50", 0x2737 },
+	{ "jcircle", 0x24d9 },
+	{ "fourroman", 0x2173 },
+	{ "Tonesix", 0x0184 },
+	{ "notsign", 0x00ac },
+	{ "trianglerightsld1", 0x25b6 },
+	{ "tenparen", 0x247d },
+	{ "zecedilla", 0x0499 },
+	{ "X", 0x0058 },
+	{ "circlenesld", 0x25d4 },
+	{ "a110", 0x2665 },
+	{ "iotagrave", 0x1f76 },
+	{ "yoyakorean", 0x3187 },
+	{ "endash.cap", 0xf6bb },
+	{ "rvocalicgujarati", 0x0a8b },
+	{ "sindot", 0x05c2 },
+	{ "dohiragana", 0x3069 },
+	{ "ae", 0x00e6 },
+	{ "stixEE32", 0xee32 },
+	{ "hahinitialarabic", 0xfea3 },
+	{ "Rcircle", 0x24c7 },
+	{ "zagurmukhi", 0x0a5b },
+	{ "kagujarati", 0x0a95 },
+	{ "dndblrtform", 0x2553 },
+	{ "llvocalicbengali", 0x09e1 },
+	{ "chi", 0x03c7 },
+	{ "lacute", 0x013a },
+	{ "blacklenticularbracketrightvertical", 0xfe3c },
+	{ "dkshade", 0x2593 },
+	{ "zstroke", 0x01b6 },
+	{ "thereexists", 0x2203 },
+	{ "backslash", 0x005c },
+	{ "afii10145", 0x040f },
+	{ "bindigurmukhi", 0x0a02 },
+	{ "etnahtahebrew", 0x0591 },
+	{ "arrowtripleright", 0x21db },
+	{ "Dcroat.small", 0xf676 },
+	{ "Oslashsmall", 0xf7f8 },
+	{ "Sdotbelow", 0x1e62 },
+	{ "gravesubnosp", 0x0316 },
+	{ "ideographicsunparen", 0x3230 },
+	{ "twohangzhou", 0x3022 },
+	{ "a199", 0x27ac },
+	{ "strictequivalence", 0x2263 },
+	{ "pecyril", 0x043f },
+	{ "Yhookabove", 0x1ef6 },
+	{ "semicirclelertsld", 0x25d7 },
+	{ "Gcommaaccent", 0x0122 },
+	{ "atmonospace", 0xff20 },
+	{ "corresponds", 0x2258 },
+	{ "mekatakana", 0x30e1 },
+	{ "thirteenperiod", 0x2494 },
+	{ "ef", 0x0444 },
+	{ "a140", 0x2780 },
+	{ "pi.sc", 0xf50f },
+	{ "shevahebrew", 0x05b0 },
+	{ "otilde.sc", 0xf7f5 },
+	{ "hvuprtform", 0x2517 },
+	{ "Hscript", 0x210b },
+	{ "raarmenian", 0x057c },
+	{ "wavyunderscorevertical", 0xfe34 },
+	{ "dblGrave", 0xf6d3 },
+	{ "fourhackarabic", 0x0664 },
+	{ "SF190000", 0x2561 },
+	{ "stixEE42", 0xee42 },
+	{ "Dzhecyrillic", 0x040f },
+	{ "zero.taboldstyle", 0xf643 },
+	{ "Sacute", 0x015a },
+	{ "Caron", 0xf6ca },
+	{ "Nearrow", 0x21d7 },
+	{ "brevecomb", 0x0306 },
+	{ "ihacek", 0x01d0 },
+	{ "slashmonospace", 0xff0f },
+	{ "followsnotequal", 0x22e1 },
+	{ "Omega.math", 0x2126 },
+	{ "nine.inferior", 0x2089 },
+	{ "idieresis", 0x00ef },
+	{ "eshsquatreversed", 0x0285 },
+	{ "tehjeemisolatedarabic", 0xfc0b },
+	{ "bracketleft", 0x005b },
+	{ "afii10060", 0x040b },
+	{ "stixEECA", 0xeeca },
+	{ "lessorequalslant", 0x2264 },
+	{ "afii57690", 0x05ea },
+	{ "tcedilla", 0x0163 },
+	{ "stixEEA6", 0xeea6 },
+	{ "unionmulti", 0x228e },
+	{ "emacrongrave", 0x1e15 },
+	{ "uni2AACFE00", 0xe33d },
+	{ "Psmall", 0xf770 },
+	{ "gimel", 0x05d2 },
+	{ "arrowbarleft", 0x21a4 },
+	{ "slashmath", 0x2215 },
+	{ "afii57678", 0x05de },
+	{ "dblprimemod", 0x02ba },
+	{ "option", 0x2325 },
+	{ "uni2226.short", 0xe2ab },
+	{ "uhorngrave", 0x1eeb },
+	{ "musicalnotedbl", 0x266b },
+	{ "mapsup", 0x21a5 },
+	{ "afii10042", 0x0428 },
+	{ "stixEEAC", 0xeeac },
+	{ "z.sc", 0xf77a },
+	{ "leftltrtdnhvform", 0x2532 },
+	{ "ercyrillic", 0x0440 },
+	{ "mukatakana", 0x30e0 },
+	{ "gamma.sc", 0xf502 },
+	{ "quotedblmonospace", 0xff02 },
+	{ "rightarrowplus", 0x2945 },
+	{ "wparen", 0x24b2 },
+	{ "afii57796", 0x05bb },
+	{ "odieresis", 0x00f6 },
+	{ "stixEE30", 0xee30 },
+	{ "dasiavaria", 0x1fdd },
+	{ "aeacute", 0x01fd },
+	{ "etaaspercircumflex", 0x1f27 },
+	{ "saraiithai", 0x0e35 },
+	{ "sixgujarati", 0x0aec },
+	{ "lj", 0x01c9 },
+	{ "Alphaasperacute", 0x1f0d },
+	{ "dblverticallineabovecmb", 0x030e },
+	{ "Twelveroman", 0x216b },
+	{ "stixEEB5", 0xeeb5 },
+	{ "hyphen.superior", 0xf6e6 },
+	{ "dhabengali", 0x09a7 },
+	{ "fadeva", 0x095e },
+	{ "Xcircle", 0x24cd },
+	{ "eshortvowelsigndeva", 0x0946 },
+	{ "horicoptic", 0x03e9 },
+	{ "ghagujarati", 0x0a98 },
+	{ "check", 0x2713 },
+	{ "Icaron", 0x01cf },
+	{ "rfishhookreversed", 0x027f },
+	{ "iotaaspertilde", 0x1f37 },
+	{ "cwundercurvearrow", 0x293e },
+	{ "trthook", 0x0288 },
+	{ "squaredot", 0x22a1 },
+	{ "a19", 0x2713 },
+	{ "ninebengali", 0x09ef },
+	{ "iotadieresis.sc", 0xf519 },
+	{ "circlebottomsld", 0x25d2 },
+	{ "subsetdbl", 0x22d0 },
+	{ "takatakana", 0x30bf },
+	{ "yoghrev", 0x01b9 },
+	{ "uni03070302", 0xea2b },
+	{ "Psi", 0x03a8 },
+	{ "Dmonospace", 0xff24 },
+	{ "afii300", 0x200f },
+	{ "prurel", 0x22b0 },
+	{ "firsttonechinese", 0x02c9 },
+	{ "stixEED2", 0xeed2 },
+	{ "triangleleft", 0x22b3 },
+	{ "uni03040304", 0xea10 },
+	{ "arrowlefttophalf", 0x21bc },
+	{ "sixteenparen", 0x2483 },
+	{ "quotesingle", 0x0027 },
+	{ "parenleftaltonearabic", 0xfd3e },
+	{ "squaremsquared", 0x33a1 },
+	{ "braceright.cap", 0xf6b3 },
+	{ "uni2A0B.lgdisplay", 0xea57 },
+	{ "followornoteqvlnt", 0x22e9 },
+	{ "Hsmall", 0xf768 },
+	{ "dzecyrillic", 0x0455 },
+	{ "engbopomofo", 0x3125 },
+	{ "Dhook", 0x018a },
+	{ "AEacute", 0x01fc },
+	{ "sixthai", 0x0e56 },
+	{ "ogonek.sc", 0xf6fb },
+	{ "threeeighths", 0x215c },
+	{ "venus", 0x2640 },
+	{ "a89", 0x2768 },
+	{ "upsilonlenisgrave", 0x1f52 },
+	{ "Hoarmenian", 0x0540 },
+	{ "dalarabic", 0x062f },
+	{ "controlSUB", 0x001a },
+	{ "guilsinglleft", 0x2039 },
+	{ "ivowelsigngujarati", 0x0abf },
+	{ "backslashmonospace", 0xff3c },
+	{ "SF010000", 0x250c },
+	{ "khomutthai", 0x0e5b },
+	{ "uni2AA20338", 0xf428 },
+	{ "Hmonospace", 0xff28 },
+	{ "Kavertbar", 0x049c },
+	{ "aparen", 0x249c },
+	{ "barrightharpoondown", 0x295f },
+	{ "Tshecyrillic", 0x040b },
+	{ "bobaimaithai", 0x0e1a },
+	{ "measurequal", 0x225e },
+	{ "afii10038", 0x0424 },
+	{ "i.ukran", 0x0456 },
+	{ "hiriq", 0x05b4 },
+	{ "ot", 0x047f },
+	{ "Gcommaaccent.small", 0xf67f },
+	{ "umatragurmukhi", 0x0a41 },
+	{ "SM600000", 0x25b2 },
+	{ "questionmonospace", 0xff1f },
+	{ "triangleleftsld", 0x25ed },
+	{ "stixEED9", 0xeed9 },
+	{ "afii299", 0x200e },
+	{ "ebreve", 0x0115 },
+	{ "ahookabove", 0x1ea3 },
+	{ "circumflex", 0x02c6 },
+	{ "cmonospace", 0xff43 },
+	{ "h.sc", 0xf768 },
+	{ "uubengali", 0x098a },
+	{ "squarediagonalcrosshatchfill", 0x25a9 },
+	{ "afii57803", 0x05c2 },
+	{ "holam19", 0x05b9 },
+	{ "saraathai", 0x0e30 },
+	{ "munahlefthebrew", 0x05a3 },
+	{ "four.fitted", 0xf63c },
+	{ "duhiragana", 0x3065 },
+	{ "squarerightsld", 0x25e8 },
+	{ "eqqsim", 0x2a73 },
+	{ "smalltrianglerightsld", 0x25b8 },
+	{ "i.sc", 0xf769 },
+	{ "afii57392", 0x0660 },
+	{ "five.superior", 0x2075 },
+	{ "upsilondiaeresistonos", 0x03b0 },
+	{ "zayin", 0x05d6 },
+	{ "phinthuthai", 0x0e3a },
+	{ "leftharpoonsupdown", 0x2962 },
+	{ "between", 0x226c },
+	{ "parenright", 0x0029 },
+	{ "leftrightharpoondownup", 0x294b },
+	{ "Acircumflexdotbelow", 0x1eac },
+	{ "lje", 0x0459 },
+	{ "circlewithlefthalfblack", 0x25d0 },
+	{ "recordright", 0x2117 },
+	{ "stixEE16", 0xee16 },
+	{ "whiterightpointingsmalltriangle", 0x25b9 },
+	{ "tencircle", 0x2469 },
+	{ "commasubnosp", 0x0326 },
+	{ "kahiragana", 0x304b },
+	{ "rightwavyarrow", 0x219d },
+	{ "verticallinelowmod", 0x02cc },
+	{ "Mturned", 0x019c },
+	{ "a72", 0x274d },
+	{ "Wdotaccent", 0x1e86 },
+	{ "udieresisgrave", 0x01dc },
+	{ "uni224320D2", 0xed51 },
+	{ "uni002822C50029", 0xedf8 },
+	{ "miribaarusquare", 0x334a },
+	{ "Omegaiotasubleniscircumflex", 0x1fae },
+	{ "anglebracketright", 0x3009 },
+	{ "oneperiod", 0x2488 },
+	{ "leftrightharpoondowndown", 0x2950 },
+	{ "mieumsioskorean", 0x316f },
+	{ "ldotaccent", 0x0140 },
+	{ "Etilde", 0x1ebc },
+	{ "stixEEA5", 0xeea5 },
+	{ "Amacron.small", 0xf66e },
+	{ "vertrtdblform", 0x255e },
+	{ "ikatakanahalfwidth", 0xff72 },
+	{ "uni006B0321", 0xea3a },
+	{ "yoghcurl", 0x0293 },
+	{ "numeralsignlowergreek", 0x0375 },
+	{ "maichattawaupperleftthai", 0xf893 },
+	{ "kheicoptic", 0x03e7 },
+	{ "pieupsioskiyeokkorean", 0x3174 },
+	{ "eqless", 0x22dc },
+	{ "leftarrowsimilar", 0x2973 },
+	{ "hatafsegolnarrowhebrew", 0x05b1 },
+	{ "congruence", 0xe3c9 },
+	{ "ltdashquadvertform", 0x250a },
+	{ "alphaiotasubacute", 0x1fb4 },
+	{ "SS260000", 0x2320 },
+	{ "lfeighthblock", 0x258f },
+	{ "ssangtikeutkorean", 0x3138 },
+	{ ".null", 0x0000 },
+	{ "Sacutedotaccent", 0x1e64 },
+	{ "tackdown", 0x22a4 },
+	{ "raised", 0x02c4 },
+	{ "Tcommaaccent.small", 0xf69e },
+	{ "nisd", 0x22fa },
+	{ "DZcaron", 0x01c4 },
+	{ "glottalstopreversedsuperior", 0x02e4 },
+	{ "ainfinalarabic", 0xfeca },
+	{ "exclamarmenian", 0x055c },
+	{ "ograve", 0x00f2 },
+	{ "filledparallelogram", 0x25b0 },
+	{ "bparen", 0x249d },
+	{ "stixEECB", 0xeecb },
+	{ "Yacutesmall", 0xf7fd },
+	{ "uni03040308", 0xea35 },
+	{ "etaiotasubacute", 0x1fc4 },
+	{ "dekatakana", 0x30c7 },
+	{ "squaresolid", 0x25a0 },
+	{ "yerahbenyomohebrew", 0x05aa },
+	{ "uni0252.superscript", 0xe3cf },
+	{ "r.superior", 0xf6f1 },
+	{ "qofdageshhebrew", 0xfb47 },
+	{ "nuktadeva", 0x093c },
+	{ "tse", 0x0446 },
+	{ "uni2A16.uplgdisplay", 0xe377 },
+	{ "dotaccent", 0x02d9 },
+	{ "parenleft.cap", 0xf6ae },
+	{ "afii10072", 0x0436 },
+	{ "acute.sc", 0xf7b4 },
+	{ "chedieresiscyrillic", 0x04f5 },
+	{ "cagurmukhi", 0x0a1a },
+	{ "hcyril", 0x04bb },
+	{ "dblarrowleft", 0x21d4 },
+	{ "sagurmukhi", 0x0a38 },
+	{ "middledotkatakanahalfwidth", 0xff65 },
+	{ "omegaiotasubaspercircumflex", 0x1fa7 },
+	{ "ringrighthalfcenter", 0x02d2 },
+	{ "alefmaksuraarabic", 0x0649 },
+	{ "diaeresistonos", 0x0385 },
+	{ "afii10100", 0x0453 },
+	{ "verthvleftltform", 0x2528 },
+	{ "Alphalenisacute", 0x1f0c },
+	{ "kiyeoksioskorean", 0x3133 },
+	{ "Ddotbelow", 0x1e0c },
+	{ "afii10109", 0x045c },
+	{ "hbar", 0x0127 },
+	{ "question.sc", 0xf73f },
+	{ "sindothebrew", 0x05c2 },
+	{ "oi", 0x01a3 },
+	{ "a132", 0x2778 },
+	{ "asteriskmath", 0x2217 },
+	{ "ideographiccorrectcircle", 0x32a3 },
+	{ "epsilonasper", 0x1f11 },
+	{ "equalprecedes", 0x22de },
+	{ "tpalatalhook", 0x01ab },
+	{ "reviahebrew", 0x0597 },
+	{ "ltrpar", 0x2222 },
+	{ "circleot", 0x2299 },
+	{ "afii57399", 0x0667 },
+	{ "Udotbelow", 0x1ee4 },
+	{ "Udieresis", 0x00dc },
+	{ "diaeresis", 0x00a8 },
+	{ "supmult", 0x2ac2 },
+	{ "shiftleft", 0x2196 },
+	{ "perthousand.oldstyle", 0xf628 },
+	{ "rrehfinalarabic", 0xfb8d },
+	{ "integraltp", 0x2320 },
+	{ "omegaiotasubgrave", 0x1ff2 },
+	{ "ncircle", 0x24dd },
+	{ "blackupperlefttriangle", 0x25e4 },
+	{ "odotbelow", 0x1ecd },
+	{ "etalenisgrave", 0x1f22 },
+	{ "psicyril", 0x0471 },
+	{ "ideographicrepresentparen", 0x3239 },
+	{ "Vtilde", 0x1e7c },
+	{ "ltdnrtform", 0x250c },
+	{ "Upsilon", 0x03a5 },
+	{ "noonmeemisolatedarabic", 0xfc4e },
+	{ "afii10033", 0x041f },
+	{ "bottomarc", 0x25e1 },
+	{ "downharpoonrightbar", 0x2955 },
+	{ "circleR", 0x00ae },
+	{ "notsubsetsqequal", 0x22e2 },
+	{ "noonghunnafinalarabic", 0xfb9f },
+	{ "enhook", 0x04c8 },
+	{ "khabengali", 0x0996 },
+	{ "musicalnote", 0x266a },
+	{ "hieuhaparenkorean", 0x321b },
+	{ "d.superior", 0xf6eb },
+	{ "Digammagreek", 0x03dc },
+	{ "ecandradeva", 0x090d },
+	{ "a77", 0x25bc },
+	{ "thanthakhatupperleftthai", 0xf896 },
+	{ "Abrevecyrillic", 0x04d0 },
+	{ "afii10110", 0x045e },
+	{ "rtltleftverthvform", 0x2549 },
+	{ "a25", 0x2719 },
+	{ "edeva", 0x090f },
+	{ "gadeva", 0x0917 },
+	{ "trianglerightsld", 0x25ee },
+	{ "omegaasper", 0x1f61 },
+	{ "a79", 0x2756 },
+	{ "paseq", 0x05c0 },
+	{ "supersetorequal", 0x2287 },
+	{ "candrabindudeva", 0x0901 },
+	{ "lambdabar", 0x019b },
+	{ "ohm", 0x2126 },
+	{ "tildecomb", 0x0303 },
+	{ "aibopomofo", 0x311e },
+	{ "ccaron", 0x010d },
+	{ "afii57414", 0x0626 },
+	{ "khook", 0x0199 },
+	{ "overline", 0x203e },
+	{ "ninegujarati", 0x0aef },
+	{ "uni03030303", 0xea1f },
+	{ "stixEEC6", 0xeec6 },
+	{ "stixEEBB", 0xeebb },
+	{ "iibengali", 0x0988 },
+	{ "ebengali", 0x098f },
+	{ "zainarabic", 0x0632 },
+	{ "Mcircle", 0x24c2 },
+	{ "supsetplus", 0x2ac0 },
+	{ "lfseveneighthblock", 0x2589 },
+	{ "lcircle", 0x24db },
+	{ "subsetsqequal", 0x2291 },
+	{ "aacute", 0x00e1 },
+	{ "iotaasperacute", 0x1f35 },
+	{ "nekatakanahalfwidth", 0xff88 },
+	{ "fivedeva", 0x096b },
+	{ "Bsmall", 0xf762 },
+	{ "arrowhookleft", 0x21a9 },
+	{ "dnlthorizhvform", 0x252f },
+	{ "Ocircumflexhookabove", 0x1ed4 },
+	{ "cyrFlex", 0xf6d2 },
+	{ "tshe", 0x045b },
+	{ "fivecircleinversesansserif", 0x278e },
+	{ "mhzsquare", 0x3392 },
+	{ "icircle", 0x24d8 },
+	{ "Lsmallcap", 0x029f },
+	{ "ahacek", 0x01ce },
+	{ "dnltlefthvform", 0x2511 },
+	{ "uni007A0321", 0xea42 },
+	{ "LJ", 0x01c7 },
+	{ "a27", 0x271b },
+	{ "behinitialarabic", 0xfe91 },
+	{ "mcapturn", 0x019c },
+	{ "uptackmod", 0x02d4 },
+	{ "iotalenisgrave", 0x1f32 },
+	{ "pagedown", 0x21df },
+	{ "djecyrillic", 0x0452 },
+	{ "ideographicfestivalparen", 0x3240 },
+	{ "Reharmenian", 0x0550 },
+	{ "smallboxfilled", 0x25aa },
+	{ "kvsquare", 0x33b8 },
+	{ "clickretroflex", 0x01c3 },
+	{ "yukatakanahalfwidth", 0xff95 },
+	{ "Thetasmall", 0xf507 },
+	{ "iocyrillic", 0x0451 },
+	{ "blank", 0x2423 },
+	{ "sevengurmukhi", 0x0a6d },
+	{ "approxnotequal", 0x2246 },
+	{ "afii57676", 0x05dc },
+	{ "thalarabic", 0x0630 },
+	{ "stixEE99", 0xee99 },
+	{ "blackdiamond", 0x25c6 },
+	{ "stixEE94", 0xee94 },
+	{ "rtltleftuphvform", 0x2539 },
+	{ "dnquarterblock", 0x2582 },
+	{ "threeperiod", 0x248a },
+	{ "aavowelsigndeva", 0x093e },
+	{ "Iotalenis", 0x1f38 },
+	{ "Pts", 0x20a7 },
+	{ "endashvertical", 0xfe32 },
+	{ "arrowaxisleft", 0x2190 },
+	{ "pieupcieuckorean", 0x3176 },
+	{ "Hsmallcap", 0x029c },
+	{ "Mars", 0x2642 },
+	{ "supsetdot", 0x2abe },
+	{ "stixEE39", 0xee39 },
+	{ "eurocurrency", 0x20a0 },
+	{ "oneinferior", 0x2081 },
+	{ "hethebrew", 0x05d7 },
+	{ "Udieresishacek", 0x01d9 },
+	{ "hyphenbullet", 0x2043 },
+	{ "el", 0x043b },
+	{ "Emacronacute", 0x1e16 },
+	{ "Umacroncyrillic", 0x04ee },
+	{ "paragraph", 0x00b6 },
+	{ "IUcyrillic", 0x042e },
+	{ "apostrophe", 0x02bc },
+	{ "afii57800", 0x05b2 },
+	{ "Vcursive", 0x01b2 },
+	{ "Omegaacute", 0x1ffb },
+	{ "revasymptequal", 0x22cd },
+	{ "Qbb", 0x211a },
+	{ "upsilonlenistilde", 0x1f56 },
+	{ "Uhornhookabove", 0x1eec },
+	{ "afii57413", 0x0625 },
+	{ "Fdotaccent", 0x1e1e },
+	{ "ustraightstrokecyrillic", 0x04b1 },
+	{ "iigurmukhi", 0x0a08 },
+	{ "zuhiragana", 0x305a },
+	{ "Upsilonasperacute", 0x1f5d },
+	{ "scircumflex", 0x015d },
+	{ "fivebengali", 0x09eb },
+	{ "zokatakana", 0x30be },
+	{ "FleuronCenter", 0x2766 },
+	{ "Idieresissmall", 0xf7ef },
+	{ "SM590000", 0x25b6 },
+	{ "tsere1e", 0x05b5 },
+	{ "Cblackletter", 0x212d },
+	{ "edotbelow", 0x1eb9 },
+	{ "finalkafdagesh", 0xfb3a },
+	{ "harpoonrightbarbup", 0x21c0 },
+	{ "notequal", 0x2260 },
+	{ "stixEE62", 0xee62 },
+	{ "imageof", 0x22b7 },
+	{ "dblverthorizform", 0x256c },
+	{ "BorderLLCorner1", 0x231e },
+	{ "parenrighttp", 0xf8f6 },
+	{ "squiggleright", 0x21dd },
+	{ "DD034", 0x258f },
+	{ "largecircle", 0x25ef },
+	{ "stixEE97", 0xee97 },
+	{ "fronted", 0x02c2 },
+	{ "postalmark", 0x3012 },
+	{ "zerosuperior", 0x2070 },
+	{ "nine.numerator", 0xf66a },
+	{ "tesh", 0x02a7 },
+	{ "encyrillic", 0x043d },
+	{ "Gammasmall", 0xf502 },
+	{ "a139", 0x277f },
+	{ "tusmallhiragana", 0x3063 },
+	{ "eight.fitted", 0xf640 },
+	{ "Uhorn", 0x01af },
+	{ "afii57429", 0x0635 },
+	{ "pparen", 0x24ab },
+	{ "Itilde.small", 0xf687 },
+	{ "umacron", 0x016b },
+	{ "a118", 0x2708 },
+	{ "hadescendercyrillic", 0x04b3 },
+	{ "yosmallkatakana", 0x30e7 },
+	{ "notelement", 0x2209 },
+	{ "eightcircleinversesansserif", 0x2791 },
+	{ "eightideographicparen", 0x3227 },
+	{ "kasratanarabic", 0x064d },
+	{ "cedillanosp", 0x0327 },
+	{ "Idotaccent", 0x0130 },
+	{ "rturnsuper", 0x02b4 },
+	{ "fivesixths", 0x215a },
+	{ "tertdes", 0x04ad },
+	{ "Es", 0x0421 },
+	{ "lmidtilde", 0x026b },
+	{ "subsetorequal", 0x2286 },
+	{ "tagujarati", 0x0aa4 },
+	{ "sadfinalarabic", 0xfeba },
+	{ "deltaturned", 0x018d },
+	{ "hvhorizform", 0x2501 },
+	{ "lsuper", 0x02e1 },
+	{ "Aries", 0x2648 },
+	{ "integral", 0x222b },
+	{ "twothirds", 0x2154 },
+	{ "breveinvertedcmb", 0x0311 },
+	{ "abrevedotbelow", 0x1eb7 },
+	{ "bracketrighttp", 0xf8f9 },
+	{ "onenumeratorbengali", 0x09f4 },
+	{ "uni2224.short", 0xe2aa },
+	{ "kokatakana", 0x30b3 },
+	{ "eight.superior", 0x2078 },
+	{ "twomonospace", 0xff12 },
+	{ "uni2A9C0338", 0xe3db },
+	{ "parenleftbt", 0xf8ed },
+	{ "sosalathai", 0x0e28 },
+	{ "hahiragana", 0x306f },
+	{ "Xeharmenian", 0x053d },
+	{ "oogonekmacron", 0x01ed },
+	{ "Thornsmall", 0xf7fe },
+	{ "yeru", 0x044b },
+	{ "oneoldstyle", 0xf731 },
+	{ "pehebrew", 0x05e4 },
+	{ "stixEE13", 0xee13 },
+	{ "excess", 0x2239 },
+	{ "periodmonospace", 0xff0e },
+	{ "kcalsquare", 0x3389 },
+	{ "bhagurmukhi", 0x0a2d },
+	{ "kiyeokcirclekorean", 0x3260 },
+	{ "sheqelhebrew", 0x20aa },
+	{ "ecandravowelsigngujarati", 0x0ac5 },
+	{ "ninehangzhou", 0x3029 },
+	{ "sarauethai", 0x0e36 },
+	{ "startofhead", 0x2401 },
+	{ "Njecyrillic", 0x040a },
+	{ "s_t", 0xfb06 },
+	{ "arrowdblleftnot", 0x21cd },
+	{ "thook", 0x01ad },
+	{ "nakatakana", 0x30ca },
+	{ "difference", 0x223c },
+	{ "rdiagovfdiag", 0x292b },
+	{ "arrowdbldown", 0x21d3 },
+	{ "isindot", 0x22f5 },
+	{ "afii57456", 0x0650 },
+	{ "a182", 0x27af },
+	{ "pehfinalarabic", 0xfb57 },
+	{ "Ysmall", 0xf779 },
+	{ "palochkacyrillic", 0x04c0 },
+	{ "patah", 0x05b7 },
+	{ "sixsuperior", 0x2076 },
+	{ "pahiragana", 0x3071 },
+	{ "leftdnhvrtupltform", 0x2545 },
+	{ "lfbowtie", 0x29d1 },
+	{ "devcon4", 0x2414 },
+	{ "hyphendot", 0x2027 },
+	{ "a109", 0x2660 },
+	{ "dblupleftform", 0x255d },
+	{ "dieresis", 0x00a8 },
+	{ "ha", 0x0445 },
+	{ "Imacroncyrillic", 0x04e2 },
+	{ "upltlefthvform", 0x2519 },
+	{ "isinvb", 0x22f8 },
+	{ "sahiragana", 0x3055 },
+	{ "afii57688", 0x05e8 },
+	{ "qubutshebrew", 0x05bb },
+	{ "leftwavyarrow", 0x219c },
+	{ "overlinedblwavy", 0xfe4c },
+	{ "Lcircle", 0x24c1 },
+	{ "breve", 0x02d8 },
+	{ "stixEEB2", 0xeeb2 },
+	{ "Amonospace", 0xff21 },
+	{ "etaiotasub", 0x1fc3 },
+	{ "Mu", 0x039c },
+	{ "mieumpansioskorean", 0x3170 },
+	{ "onehangzhou", 0x3021 },
+	{ "sigma1", 0x03c2 },
+	{ "stixEE50", 0xee50 },
+	{ "dotlessjstrokehook", 0x0284 },
+	{ "space", 0x0020 },
+	{ "Cedillasmall", 0xf7b8 },
+	{ "omicronlenis", 0x1f40 },
+	{ "seventeencircle", 0x2470 },
+	{ "ij", 0x0133 },
+	{ "primedblrev", 0x2036 },
+	{ "upsilondieresistilde", 0x1fe7 },
+	{ "commaaboverightcmb", 0x0315 },
+	{ "Gsmallhook", 0x029b },
+	{ "ghhagurmukhi", 0x0a5a },
+	{ "Rinvertedbreve", 0x0212 },
+	{ "rhotichook", 0x02de },
+	{ "primedblmod", 0x02ba },
+	{ "elementsmall", 0x220a },
+	{ "lefthvrtupltform", 0x2535 },
+	{ "afii57799", 0x05b0 },
+	{ "khacyrillic", 0x0445 },
+	{ "stixEE70", 0xee70 },
+	{ "space_uni0308_uni0301.cap", 0xf6cc },
+	{ "atsmall", 0xfe6b },
+	{ "Sigma", 0x03a3 },
+	{ "asperacute", 0x1fde },
+	{ "philatin", 0x0278 },
+	{ "Aringsmall", 0xf7e5 },
+	{ "triangledownsld", 0x25bc },
+	{ "yuikorean", 0x318c },
+	{ "usmallkatakanahalfwidth", 0xff69 },
+	{ "arrowupright", 0x2197 },
+	{ "omegatilde", 0x1ff6 },
+	{ "lesssmall", 0xfe64 },
+	{ "uni222AFE00", 0xe274 },
+	{ "ucyril", 0x0443 },
+	{ "Tbar.small", 0xf69c },
+	{ "hvverthorizform", 0x254b },
+	{ "Koppa", 0x03de },
+	{ "equalgreater", 0x22dd },
+	{ "Ccaron", 0x010c },
+	{ "kafdageshhebrew", 0xfb3b },
+	{ "afii57432", 0x0638 },
+	{ "stixEEB8", 0xeeb8 },
+	{ "cyrflex", 0xf6d5 },
+	{ "SF200000", 0x2562 },
+	{ "omega.sc", 0xf518 },
+	{ "Kahook", 0x04c3 },
+	{ "ismallhiragana", 0x3043 },
+	{ "Phismall", 0xf515 },
+	{ "mugreek", 0x03bc },
+	{ "Peharmenian", 0x054a },
+	{ "kafhebrew", 0x05db },
+	{ "afii57679", 0x05df },
+	{ "ohook", 0x04a9 },
+	{ "wreathproduct", 0x2240 },
+	{ "downtackmod", 0x02d5 },
+	{ "Kaverticalstrokecyrillic", 0x049c },
+	{ "delta", 0x03b4 },
+	{ "iota.sc", 0xf508 },
+	{ "a97", 0x275b },
+	{ "refmark", 0x203b },
+	{ "hvdashquadhorizform", 0x2509 },
+	{ "wasmallkatakana", 0x30ee },
+	{ "afii63167", 0x066d },
+	{ "thothungthai", 0x0e16 },
+	{ "shinhebrew", 0x05e9 },
+	{ "nlinebelow", 0x1e49 },
+	{ "supersetnoteql", 0x228b },
+	{ "muchless", 0x226a },
+	{ "periodcentered.cap", 0xf6bd },
+	{ "eshlooprev", 0x01aa },
+	{ "Gbreve.small", 0xf67d },
+	{ "ocircumflexhookabove", 0x1ed5 },
+	{ "kavertbar", 0x049d },
+	{ "dbldnleftform", 0x2557 },
+	{ "finalmemhebrew", 0x05dd },
+	{ "paiyannoithai", 0x0e2f },
+	{ "jhagurmukhi", 0x0a1d },
+	{ "nand", 0x22bc },
+	{ "Coarmenian", 0x0551 },
+	{ "forces", 0x22a9 },
+	{ "seeninitialarabic", 0xfeb3 },
+	{ "lre", 0x202a },
+	{ "egrave.sc", 0xf7e8 },
+	{ "kjecyrillic", 0x045c },
+	{ "rightimply", 0x2970 },
+	{ "bakatakana", 0x30d0 },
+	{ "commasuprightnosp", 0x0315 },
+	{ "ideographiccallparen", 0x323a },
+	{ "uni224B0338", 0xe2bc },
+	{ "SF510000", 0x2552 },
+	{ "Abrevetilde", 0x1eb4 },
+	{ "D", 0x0044 },
+	{ "acutebelowcmb", 0x0317 },
+	{ "dotaccentcmb", 0x0307 },
+	{ "midhorizellipsis", 0x22ef },
+	{ "yeokorean", 0x3155 },
+	{ "Omegalenis", 0x1f68 },
+	{ "hatafsegol", 0x05b1 },
+	{ "nequadarc", 0x25dd },
+	{ "Utildebelow", 0x1e74 },
+	{ "uni00780321", 0xea3b },
+	{ "J", 0x004a },
+	{ "ddagujarati", 0x0aa1 },
+	{ "a56", 0x273d },
+	{ "twoheaduparrowcircle", 0x2949 },
+	{ "omicron.sc", 0xf50e },
+	{ "Seharmenian", 0x054d },
+	{ "a176", 0x27a6 },
+	{ "Ucyril", 0x0423 },
+	{ "approachlimit", 0x2250 },
+	{ "psili_oxia", 0x1fce },
+	{ "akorean", 0x314f },
+	{ "evowelsigngujarati", 0x0ac7 },
+	{ "ocaron", 0x01d2 },
+	{ "etagrave", 0x1f74 },
+	{ "liwnarmenian", 0x056c },
+	{ "stixEEC9", 0xeec9 },
+	{ "macute", 0x1e3f },
+	{ "whiteuppointingtriangle", 0x25b3 },
+	{ "uni22F620D2", 0xed34 },
+	{ "augujarati", 0x0a94 },
+	{ "M", 0x004d },
+	{ "SF400000", 0x2569 },
+	{ "groupseparator", 0x241d },
+	{ "afii10090", 0x0448 },
+	{ "yusbigiotifiedcyrillic", 0x046d },
+	{ "d", 0x0064 },
+	{ "uni227F0338", 0xe837 },
+	{ "nvsquare", 0x33b5 },
+	{ "a154", 0x278e },
+	{ "lessnotdblequal", 0x2268 },
+	{ "i", 0x0069 },
+	{ "ecandragujarati", 0x0a8d },
+	{ "precedesequal1", 0x227c },
+	{ "asper", 0x1ffe },
+	{ "ltdashtripvertform", 0x2506 },
+	{ "x", 0x0078 },
+	{ "nine.fitted", 0xf641 },
+	{ "twocircleinversesansserif", 0x278b },
+	{ "rightdotarrow", 0x2911 },
+	{ "careof", 0x2105 },
+	{ "kapyeounmieumkorean", 0x3171 },
+	{ "cwopencirclearrow", 0x21bb },
+	{ "Rcommaaccent", 0x0156 },
+	{ "arrowbothv", 0x2195 },
+	{ "notlessnorequal", 0x2270 },
+	{ "blackrightpointingpointer", 0x25ba },
+	{ "abrevecyrillic", 0x04d1 },
+	{ "ge", 0x0433 },
+	{ "seharmenian", 0x057d },
+	{ "controlEM", 0x0019 },
+	{ "twobengali", 0x09e8 },
+	{ "arrowloopleft", 0x21ab },
+	{ "Virgo", 0x264d },
+	{ "dblgravecmb", 0x030f },
+	{ "hehebrew", 0x05d4 },
+	{ "uni22670338", 0xe2a5 },
+	{ "Theta", 0x0398 },
+	{ "lamalefmaddaabovefinalarabic", 0xfef6 },
+	{ "candrabindugujarati", 0x0a81 },
+	{ "squaremm", 0x339c },
+	{ "gokatakana", 0x30b4 },
+	{ "etaiotasublenis", 0x1f90 },
+	{ "afii10147", 0x0472 },
+	{ "Edotbelow", 0x1eb8 },
+	{ "controlVT", 0x000b },
+	{ "parenright.superior", 0x207e },
+	{ "phisymbolgreek", 0x03d5 },
+	{ "afii57839", 0x05bd },
+	{ "ideographicmetalparen", 0x322e },
+	{ "glottalstopmod", 0x02c0 },
+	{ "hiriq21", 0x05b4 },
+	{ "afii57427", 0x0633 },
+	{ "ntilde", 0x00f1 },
+	{ "dnhvleftltform", 0x2512 },
+	{ "notforceextr", 0x22af },
+	{ "afii10055", 0x0406 },
+	{ "onearabic", 0x0661 },
+	{ "rieulaparenkorean", 0x3211 },
+	{ "space_uni0308_uni0300.cap", 0xf6cd },
+	{ "Uring", 0x016e },
+	{ "Feharmenian", 0x0556 },
+	{ "notprecedes", 0x2280 },
+	{ "six.fitted", 0xf63e },
+	{ "uni003E20D2", 0xe2c4 },
+	{ "ogujarati", 0x0a93 },
+	{ "Rsmallcap", 0x0280 },
+	{ "almostorequal", 0x224a },
+	{ "asuperior", 0xf6e9 },
+	{ "Uhungarumlaut.small", 0xf6a0 },
+	{ "adiaeresis", 0x00e4 },
+	{ "umacrondieresis", 0x1e7b },
+	{ "psi", 0x03c8 },
+	{ "be.alt", 0xf6c5 },
+	{ "nj", 0x01cc },
+	{ "saraueleftthai", 0xf887 },
+	{ "shinsindot", 0xfb2b },
+	{ "iehookogonek", 0x04bf },
+	{ "ssangnieunkorean", 0x3165 },
+	{ "satisfy", 0x22a8 },
+	{ "ninearabic", 0x0669 },
+	{ "ssharp", 0x00df },
+	{ "zero", 0x0030 },
+	{ "glottalstopstroke", 0x02a1 },
+	{ "zerodeva", 0x0966 },
+	{ "mihiragana", 0x307f },
+	{ "tehfinalarabic", 0xfe96 },
+	{ "dashleftharpoondown", 0x296b },
+	{ "cornerbracketlefthalfwidth", 0xff62 },
+	{ "Iotaasperacute", 0x1f3d },
+	{ "arrowlongbothv", 0x2195 },
+	{ "tahmedialarabic", 0xfec4 },
+	{ "uni2273FE00", 0xed71 },
+	{ "dikatakana", 0x30c2 },
+	{ "Equiv", 0x2263 },
+	{ "rrabengali", 0x09dc },
+	{ "a13", 0x270c },
+	{ "diamondopen", 0x2662 },
+	{ "Oslash", 0x00d8 },
+	{ "Stigmagreek", 0x03da },
+	{ "guillemotleft", 0x00ab },
+	{ "cent.oldstyle", 0xf7a2 },
+	{ "dieresistonos", 0x0385 },
+	{ "shortrightarrowleftarrow", 0x2944 },
+	{ "threethai", 0x0e53 },
+	{ "whitetortoiseshellbracketright", 0x3019 },
+	{ "btopbar", 0x0183 },
+	{ "ttehmedialarabic", 0xfb69 },
+	{ "nadeva", 0x0928 },
+	{ "Nj", 0x01cb },
+	{ "curlyleft", 0x21ab },
+	{ "shalshelethebrew", 0x0593 },
+	{ "stixEE57", 0xee57 },
+	{ "etilde", 0x1ebd },
+	{ "pdotaccent", 0x1e57 },
+	{ "odiaeresis", 0x00f6 },
+	{ "turnstileright", 0x22a3 },
+	{ "piwrarmenian", 0x0583 },
+	{ "rfishhookrev", 0x027f },
+	{ "Tlinebelow", 0x1e6e },
+	{ "Alphaiotasubasperacute", 0x1f8d },
+	{ "ivowelsignbengali", 0x09bf },
+	{ "rightleftharpoonsdown", 0x2969 },
+	{ "esuperior", 0xf6ec },
+	{ "Yatcyrillic", 0x0462 },
+	{ "pieupaparenkorean", 0x3213 },
+	{ "yoddageshhebrew", 0xfb39 },
+	{ "quotesinglbase", 0x201a },
+	{ "yparen", 0x24b4 },
+	{ "notasymptequal", 0x2244 },
+	{ "phieuphacirclekorean", 0x327a },
+	{ "Cdot", 0x010a },
+	{ "simgtr", 0x2a9e },
+	{ "agrave.sc", 0xf7e0 },
+	{ "Usmall", 0xf775 },
+	{ "hdieresis", 0x1e27 },
+	{ "cent.superior", 0xf6e0 },
+	{ "Iotalenisgrave", 0x1f3a },
+	{ "SF360000", 0x255e },
+	{ "dottedcircle", 0x25cc },
+	{ "anusvarabengali", 0x0982 },
+	{ "circumflex.sc", 0xf6f6 },
+	{ "stixEEA4", 0xeea4 },
+	{ "oe.sc", 0xf6fa },
+	{ "kabengali", 0x0995 },
+	{ "omacronacute", 0x1e53 },
+	{ "upharpoonrightbar", 0x295c },
+	{ "eightparen", 0x247b },
+	{ "hikatakana", 0x30d2 },
+	{ "scircle", 0x24e2 },
+	{ "ideographmetalcircle", 0x328e },
+	{ "trademark.serif", 0xf6db },
+	{ "Aiecyrillic", 0x04d4 },
+	{ "nunhebrew", 0x05e0 },
+	{ "qubutswidehebrew", 0x05bb },
+	{ "Bcircle", 0x24b7 },
+	{ "Hdotaccent", 0x1e22 },
+	{ "ainvertedbreve", 0x0203 },
+	{ "ezh", 0x0292 },
+	{ "afii10103", 0x0456 },
+	{ "pilcrow", 0x00b6 },
+	{ "afii57705", 0xfb1f },
+	{ "afii57443", 0x0643 },
+	{ "Digamma", 0x03dc },
+	{ "hamzaarabic", 0x0621 },
+	{ "kpasquare", 0x33aa },
+	{ "at", 0x0040 },
+	{ "doubleyodpatahhebrew", 0xfb1f },
+	{ "percentmonospace", 0xff05 },
+	{ "a24", 0x2718 },
+	{ "controlSTX", 0x0001 },
+	{ "blacklenticularbracketright", 0x3011 },
+	{ "afii57534", 0x06d5 },
+	{ "openbullet", 0x25e6 },
+	{ "leftltrtuphvform", 0x253a },
+	{ "iotaturn", 0x2129 },
+	{ "exclamdown.sc", 0xf7a1 },
+	{ "vmonospace", 0xff56 },
+	{ "Ntildesmall", 0xf7f1 },
+	{ "ninethai", 0x0e59 },
+	{ "Tsecyrillic", 0x0426 },
+	{ "Hcyril", 0x04ba },
+	{ "sokatakana", 0x30bd },
+	{ "Rdotaccent", 0x1e58 },
+	{ "Ring", 0xeff3 },
+	{ "sterling", 0x00a3 },
+	{ "afii57802", 0x05b3 },
+	{ "imacroncyrillic", 0x04e3 },
+	{ "Abrevehookabove", 0x1eb2 },
+	{ "visargagujarati", 0x0a83 },
+	{ "hokatakanahalfwidth", 0xff8e },
+	{ "rturnrthook", 0x027b },
+	{ "hatafqamatshebrew", 0x05b3 },
+	{ "bahtthai", 0x0e3f },
+	{ "anoteleia", 0x0387 },
+	{ "afii61248", 0x2105 },
+	{ "hatafqamats", 0x05b3 },
+	{ "rrthook", 0x027d },
+	{ "eqgtr", 0x22dd },
+	{ "Iota", 0x0399 },
+	{ "earth", 0x2641 },
+	{ "yusmallhiragana", 0x3085 },
+	{ "halantgurmukhi", 0x0a4d },
+	{ "lamhahinitialarabic", 0xfcca },
+	{ "lowerrank", 0x22b0 },
+	{ "yukorean", 0x3160 },
+	{ "sakatakana", 0x30b5 },
+	{ "Alpha", 0x0391 },
+	{ "tonsquare", 0x3327 },
+	{ "zihiragana", 0x3058 },
+	{ "a185", 0x27b5 },
+	{ "a5", 0x2706 },
+	{ "nieunsioskorean", 0x3167 },
+	{ "gangia", 0x03eb },
+	{ "zbar", 0x01b6 },
+	{ "sevenparen", 0x247a },
+	{ "oogonek", 0x01eb },
+	{ "eshortdeva", 0x090e },
+	{ "xmonospace", 0xff58 },
+	{ "a150", 0x278a },
+	{ "referencemark", 0x203b },
+	{ "maqaf", 0x05be },
+	{ "Pi", 0x03a0 },
+	{ "approxequalorimage", 0x2252 },
+	{ "OI", 0x01a2 },
+	{ "d.sc", 0xf764 },
+	{ "arrowloopright", 0x21ac },
+	{ "seenmedialarabic", 0xfeb4 },
+	{ "slong", 0x017f },
+	{ "a15", 0x270e },
+	{ "Ydieresis", 0x0178 },
+	{ "uni2A7020D2", 0xed56 },
+	{ "maihanakatleftthai", 0xf884 },
+	{ "ringequal", 0x2257 },
+	{ "nine.superior", 0x2079 },
+	{ "Zbar", 0x01b5 },
+	{ "mturn", 0x026f },
+	{ "etaaspertilde", 0x1f27 },
+	{ "zhearmenian", 0x056a },
+	{ "Dzeabkhasiancyrillic", 0x04e0 },
+	{ "supersetnotequal", 0x228b },
+	{ "pemiddlehookcyrillic", 0x04a7 },
+	{ "zerooldstyle", 0xf730 },
+	{ "meemfinalarabic", 0xfee2 },
+	{ "yu", 0x044e },
+	{ "hookpalatalizedbelowcmb", 0x0321 },
+	{ "pointingindexupwhite", 0x261d },
+	{ "Khook", 0x0198 },
+	{ "stixEE7B", 0xee7b },
+	{ "threeparen", 0x2476 },
+	{ "gpasquare", 0x33ac },
+	{ "Omegaleniscircumflex", 0x1f6e },
+	{ "stixEEC4", 0xeec4 },
+	{ "upsilonasperacute", 0x1f55 },
+	{ "khokhonthai", 0x0e05 },
+	{ "lozenge", 0x25ca },
+	{ "t.superior", 0xf6f3 },
+	{ "dblarrowdwn", 0x21ca },
+	{ "abbreviationmarkarmenian", 0x055f },
+	{ "rlo", 0x202e },
+	{ "uacute", 0x00fa },
+	{ "sigmafinal", 0x03c2 },
+	{ "daletdageshhebrew", 0xfb33 },
+	{ "Upsilonhooktonos", 0x03d3 },
+	{ "Upsilonaspertilde", 0x1f5f },
+	{ "squarekg", 0x338f },
+	{ "acaron", 0x01ce },
+	{ "blackrectangle", 0x25ac },
+	{ "merkhalefthebrew", 0x05a5 },
+	{ "jeemfinalarabic", 0xfe9e },
+	{ "arrowwaveright", 0x219d },
+	{ "Iecyrillic", 0x0415 },
+	{ "a.superior", 0xf6e9 },
+	{ "owner", 0x220b },
+	{ "zayindagesh", 0xfb36 },
+	{ "plussubnosp", 0x031f },
+	{ "rhosymbolgreek", 0x03f1 },
+	{ "gdotaccent", 0x0121 },
+	{ "Nu", 0x039d },
+	{ "rightharpoondownbar", 0x2957 },
+	{ "ogonek", 0x02db },
+	{ "DD110", 0x2581 },
+	{ "seenfinalarabic", 0xfeb2 },
+	{ "hehhamzaaboveisolatedarabic", 0xfba4 },
+	{ "upltrtdnhvform", 0x2522 },
+	{ "integraldbl", 0x222c },
+	{ "Acutesmall", 0xf7b4 },
+	{ "Iotaafrican", 0x0196 },
+	{ "Euler", 0x2107 },
+	{ "a54", 0x273b },
+	{ "verymuchgreater", 0x22d9 },
+	{ "overlinecmb", 0x0305 },
+	{ "one.numerator", 0xf662 },
+	{ "rightdbltail", 0x291c },
+	{ "Etaacute", 0x1fcb },
+	{ "memdageshhebrew", 0xfb3e },
+	{ "a170", 0x279f },
+	{ "mlsquare", 0x3396 },
+	{ "rtltrtdnhvform", 0x2531 },
+	{ "asterisk", 0x002a },
+	{ "Nje", 0x040a },
+	{ "dehiragana", 0x3067 },
+	{ "Ndotbelow", 0x1e46 },
+	{ "multiply", 0x00d7 },
+	{ "deltaturn", 0x018d },
+	{ "plusminus", 0x00b1 },
+	{ "rho.sc", 0xf510 },
+	{ "Umacron", 0x016a },
+	{ "stixEE5D", 0xee5d },
+	{ "iotasubnosp", 0x0345 },
+	{ "propersuperset", 0x2283 },
+	{ "hookabovecomb", 0x0309 },
+	{ "emptyset", 0x2205 },
+	{ "stixEE03", 0xee03 },
+	{ "ltdnhorizform", 0x252c },
+	{ "aivowelsigngujarati", 0x0ac8 },
+	{ "controlDC3", 0x0013 },
+	{ "stixEE38", 0xee38 },
+	{ "chedescenderabkhasiancyrillic", 0x04bf },
+	{ "afii10069.ital", 0xf6c6 },
+	{ "paasentosquare", 0x332b },
+	{ "nuktagujarati", 0x0abc },
+	{ "threegujarati", 0x0ae9 },
+	{ "Zblackletter", 0x2128 },
+	{ "ascriptturn", 0x0252 },
+	{ "qafinitialarabic", 0xfed7 },
+	{ "yesieungsioskorean", 0x3182 },
+	{ "linevertnosp", 0x030d },
+	{ "harpoonupleft", 0x21bf },
+	{ "threeideographicparen", 0x3222 },
+	{ "shiftright", 0x2197 },
+	{ "lfquarterblock", 0x258e },
+	{ "uni227320D2", 0xe3bd },
+	{ "smalltrianglesld", 0x25b4 },
+	{ "stixEE15", 0xee15 },
+	{ "afii57672", 0x05d8 },
+	{ "twodeva", 0x0968 },
+	{ "downfall", 0x22ce },
+	{ "fileseparator", 0x241c },
+	{ "mvsquare", 0x33b7 },
+	{ "tahfinalarabic", 0xfec2 },
+	{ "dezh", 0x02a4 },
+	{ "dndblhorizform", 0x2565 },
+	{ "Scircle", 0x24c8 },
+	{ "pefinaldageshhebrew", 0xfb43 },
+	{ "parenrightmonospace", 0xff09 },
+	{ "thieuthaparenkorean", 0x3219 },
+	{ "agurmukhi", 0x0a05 },
+	{ "Enghecyrillic", 0x04a4 },
+	{ "emdash", 0x2014 },
+	{ "heartopen", 0x2661 },
+	{ "yusmallkatakanahalfwidth", 0xff6d },
+	{ "ninesuperior", 0x2079 },
+	{ "stixEE46", 0xee46 },
+	{ "a84", 0x275a },
+	{ "uni2A0F.uplgdisplay", 0xe3d3 },
+	{ "zero.slash", 0xf638 },
+	{ "a48", 0x2735 },
+	{ "comma.superior", 0xf6e2 },
+	{ "Emonospace", 0xff25 },
+	{ "tavdageshhebrew", 0xfb4a },
+	{ "arrowleft", 0x2190 },
+	{ "kcommaaccent", 0x0137 },
+	{ "glottalinvertedstroke", 0x01be },
+	{ "Zhearmenian", 0x053a },
+	{ "yericyrillic", 0x044b },
+	{ "afii57689_afii57804", 0xfb2a },
+	{ "sadeva", 0x0938 },
+	{ "uni228620D2", 0xe2ad },
+	{ "Iinvertedbreve", 0x020a },
+	{ "stixEEB6", 0xeeb6 },
+	{ "endescendercyrillic", 0x04a3 },
+	{ "oshortdeva", 0x0912 },
+	{ "Omacron.small", 0xf693 },
+	{ "zeromonospace", 0xff10 },
+	{ "deltaequal", 0x225c },
+	{ "gagurmukhi", 0x0a17 },
+	{ "moverssquare", 0x33a7 },
+	{ "daggerdbl", 0x2021 },
+	{ "a133", 0x2779 },
+	{ "lefttail", 0x2919 },
+	{ "Iotadieresis", 0x03aa },
+	{ "ecircumflexacute", 0x1ebf },
+	{ "stixEE7C", 0xee7c },
+	{ "Pe", 0x041f },
+	{ "a205", 0x276e },
+	{ "qafmedialarabic", 0xfed8 },
+	{ "Yu", 0x042e },
+	{ "bracketleft.cap", 0xf6b0 },
+	{ "pehinitialarabic", 0xfb58 },
+	{ "stixEE90", 0xee90 },
+	{ "hkswarrow", 0x2926 },
+	{ "nukatakanahalfwidth", 0xff87 },
+	{ "negationslash", 0x2215 },
+	{ "yakatakana", 0x30e4 },
+	{ "jhabengali", 0x099d },
+	{ "ldotbelowmacron", 0x1e39 },
+	{ "nrightcurvedarrow", 0xe21d },
+	{ "dblarrowheadleft", 0x219e },
+	{ "Hungarumlaut", 0xf6cf },
+	{ "aubopomofo", 0x3120 },
+	{ "uni22D80338", 0xe2cd },
+	{ "hatafsegolquarterhebrew", 0x05b1 },
+	{ "feicoptic", 0x03e5 },
+	{ "a73", 0x25a0 },
+	{ "forall", 0x2200 },
+	{ "qamats29", 0x05b8 },
+	{ "lessmuch", 0x226a },
+	{ "tteharabic", 0x0679 },
+	{ "SF390000", 0x2554 },
+	{ "hori", 0x03e9 },
+	{ "rcaron", 0x0159 },
+	{ "xi", 0x03be },
+	{ "uni223E0332.reversed", 0xe28f },
+	{ "ltvertrightform", 0x251c },
+	{ "aogonek", 0x0105 },
+	{ "uni22DF20D2", 0xed7b },
+	{ "wawfinalarabic", 0xfeee },
+	{ "rhookturned", 0x027b },
+	{ "arrowheadrightmod", 0x02c3 },
+	{ "zhedieresiscyrillic", 0x04dd },
+	{ "Ytilde", 0x1ef8 },
+	{ "circlecopyrt", 0x00a9 },
+	{ "betacurled", 0x03d0 },
+	{ "uni2A10.up", 0xe395 },
+	{ "epsilonacute", 0x1f73 },
+	{ "Rfractur", 0x211c },
+	{ "afii10025", 0x0417 },
+	{ "Etalenis", 0x1f28 },
+	{ "ecircumflex.sc", 0xf7ea },
+	{ "universal", 0x2200 },
+	{ "updownharpoonsleftright", 0x296e },
+	{ "iu", 0x044e },
+	{ "afii10023", 0x0401 },
+	{ "rakatakanahalfwidth", 0xff97 },
+	{ "Tecyrillic", 0x0422 },
+	{ "lesdotor", 0x2a83 },
+	{ "stixEEB0", 0xeeb0 },
+	{ "definequal", 0x225d },
+	{ "Ocaron", 0x01d1 },
+	{ "Zcircumflex", 0x1e90 },
+	{ "nieuntikeutkorean", 0x3166 },
+	{ "commasuprevnosp", 0x0314 },
+	{ "ovowelsigngujarati", 0x0acb },
+	{ "Iehookogonek", 0x04be },
+	{ "Omicrontonos", 0x038c },
+	{ "twonumeratorbengali", 0x09f5 },
+	{ "dblarrowheadup", 0x219f },
+	{ "Wdieresis.small", 0xf6a7 },
+	{ "barupharpoonleft", 0x2958 },
+	{ "DD014", 0x231e },
+	{ "rieulpieupsioskorean", 0x316b },
+	{ "iucyrillic", 0x044e },
+	{ "arrownorthwest", 0x2196 },
+	{ "wgrave", 0x1e81 },
+	{ "uni223E.reversed", 0xe3c9 },
+	{ "controlDC1", 0x0011 },
+	{ "kcedilla", 0x0137 },
+	{ "squaresmallsolid", 0x25aa },
+	{ "ordmasculine", 0x00ba },
+	{ "ideographicnameparen", 0x3234 },
+	{ "kapyeounssangpieupkorean", 0x3179 },
+	{ "Ahookabove", 0x1ea2 },
+	{ "alphabreve", 0x1fb0 },
+	{ "gereshhebrew", 0x05f3 },
+	{ "kabar", 0x049f },
+	{ "ideographicselfparen", 0x3242 },
+	{ "Gdotaccent", 0x0120 },
+	{ "tlinebelow", 0x1e6f },
+	{ "rparen", 0x24ad },
+	{ "comma.numerator", 0xf66b },
+	{ "uphvleftdnltform", 0x2526 },
+	{ "afii10085", 0x0443 },
+	{ "three.inferior", 0x2083 },
+	{ "ocircumflexdotbelow", 0x1ed9 },
+	{ "kaverticalstrokecyrillic", 0x049d },
+	{ "gereshaccenthebrew", 0x059c },
+	{ "epsilontonos", 0x03ad },
+	{ "elevenperiod", 0x2492 },
+	{ "segol1f", 0x05b6 },
+	{ "enrtdes", 0x04a3 },
+	{ "Obreve", 0x014e },
+	{ "hieuhcirclekorean", 0x326d },
+	{ "arrowrightdblstroke", 0x21cf },
+	{ "yhookabove", 0x1ef7 },
+	{ "stixEE11", 0xee11 },
+	{ "Ecircumflexhookabove", 0x1ec2 },
+	{ "Alphatonos", 0x0386 },
+	{ "glottalstoprevinv", 0x0295 },
+	{ "kacute", 0x1e31 },
+	{ "shortleftarrow", 0x2190 },
+	{ "hungarumlaut", 0x02dd },
+	{ "ringhalfleftarmenian", 0x0559 },
+	{ "chook", 0x0188 },
+	{ "jsuper", 0x02b2 },
+	{ "followsnotequivlnt", 0x22e9 },
+	{ "Pisces", 0x2653 },
+	{ "Iehook", 0x04bc },
+	{ "Ocircumflexgrave", 0x1ed2 },
+	{ "oxia", 0x1ffd },
+	{ "greaterequalorless", 0x22db },
+	{ "iotalenistilde", 0x1f36 },
+	{ "tonebarlowmod", 0x02e8 },
+	{ "notdblarrowright", 0x21cf },
+	{ "stixEEC2", 0xeec2 },
+	{ "Kahookcyrillic", 0x04c3 },
+	{ "Epsilontonos", 0x0388 },
+	{ "Etildebelow", 0x1e1a },
+	{ "Gdot", 0x0120 },
+	{ "sheva115", 0x05b0 },
+	{ "Cdotaccent.small", 0xf674 },
+	{ "a201", 0x27b1 },
+	{ "kiyeokaparenkorean", 0x320e },
+	{ "blackdownpointingtriangle", 0x25bc },
+	{ "threenumeratorbengali", 0x09f6 },
+	{ "circledash", 0x25cc },
+	{ "tdotbelow", 0x1e6d },
+	{ "Iacutesmall", 0xf7ed },
+	{ "simgE", 0x2aa0 },
+	{ "parenleftinferior", 0x208d },
+	{ "tildecmb", 0x0303 },
+	{ "uni228720D2", 0xe2b1 },
+	{ "aturn", 0x0250 },
+	{ "shade", 0x2592 },
+	{ "maichattawathai", 0x0e4b },
+	{ "middot", 0x00b7 },
+	{ "dbar", 0x0111 },
+	{ "Acircumflexhookabove", 0x1ea8 },
+	{ "bracerightmonospace", 0xff5d },
+	{ "iotalenis", 0x1f30 },
+	{ "Ii", 0x0418 },
+	{ "eshreversedloop", 0x01aa },
+	{ "whitecornerbracketleftvertical", 0xfe43 },
+	{ "DZ", 0x01f1 },
+	{ "yoyaekorean", 0x3188 },
+	{ "Tcircle", 0x24c9 },
+	{ "radoverssquare", 0x33ae },
+	{ "hv", 0x0195 },
+	{ "kabashkircyrillic", 0x04a1 },
+	{ "shiftout", 0x240e },
+	{ "three.numerator", 0xf664 },
+	{ "guillemotright.cap", 0xf6b7 },
+	{ "dollar.numerator", 0xf62f },
+	{ "voarmenian", 0x0578 },
+	{ "a10", 0x2721 },
+	{ "Lscript", 0x2112 },
+	{ "yoyingthai", 0x0e0d },
+	{ "u", 0x0075 },
+	{ "Trthook", 0x01ae },
+	{ "wmonospace", 0xff57 },
+	{ "leftarrowshortrightarrow", 0x2943 },
+	{ "thadeva", 0x0925 },
+	{ "ShootingStar", 0x2604 },
+	{ "Rsmallinvertedsuperior", 0x02b6 },
+	{ "gikatakana", 0x30ae },
+	{ "uni2268FE00", 0xe2a4 },
+	{ "qbopomofo", 0x3111 },
+	{ "Iacute", 0x00cd },
+	{ "uni228320D2", 0xe2af },
+	{ "arrowsemanticlockw", 0x21b6 },
+	{ "five.denominator", 0xf65a },
+	{ "pertenmill", 0x2031 },
+	{ "dotplus", 0x2214 },
+	{ "nssquare", 0x33b1 },
+	{ "Flower1l", 0x2581 },
+	{ "Ecircumflex", 0x00ca },
+	{ "curvearrowrightminus", 0x293c },
+	{ "arrowclockw", 0x21bb },
+	{ "afii10088", 0x0446 },
+	{ "Yicyrillic", 0x0407 },
+	{ "Scedilla", 0x015e },
+	{ "whitedownpointingtriangle", 0x25bd },
+	{ "patahquarterhebrew", 0x05b7 },
+	{ "notreflexsubset", 0x2288 },
+	{ "Jaarmenian", 0x0541 },
+	{ "afii57689", 0x05e9 },
+	{ "ghzsquare", 0x3393 },
+	{ "ruhiragana", 0x308b },
+	{ "shaddakasraarabic", 0xfc62 },
+	{ "Ismallcap", 0x026a },
+	{ "a34", 0x2727 },
+	{ "acircumflexhookabove", 0x1ea9 },
+	{ "rightarrowx", 0x2947 },
+	{ "Bhook", 0x0181 },
+	{ "succeeds", 0x227b },
+	{ "lamalefhamzabelowisolatedarabic", 0xfef9 },
+	{ "saraaimaimuanthai", 0x0e43 },
+	{ "uhungarumlaut", 0x0171 },
+	{ "whitecornerbracketleft", 0x300e },
+	{ "ellipsisvertical", 0x22ee },
+	{ "asmallkatakanahalfwidth", 0xff67 },
+	{ "hiriq2d", 0x05b4 },
+	{ "hatafsegol24", 0x05b1 },
+	{ "varrightfishtail", 0xe654 },
+	{ "auvowelsigngujarati", 0x0acc },
+	{ "a69", 0x274a },
+	{ "afii61352", 0x2116 },
+	{ "uni220D20D2", 0xed31 },
+	{ "hukatakana", 0x30d5 },
+	{ "tonebarmidmod", 0x02e7 },
+	{ "arrowheadleftmod", 0x02c2 },
+	{ "Vbar", 0x2aeb },
+	{ "upslopeellipsis", 0x22f0 },
+	{ "stixEE74", 0xee74 },
+	{ "prosgegrammeni", 0x1fbe },
+	{ "iotaasper", 0x1f31 },
+	{ "fiveinferior", 0x2085 },
+	{ "oe", 0x0153 },
+	{ "sevenhangzhou", 0x3027 },
+	{ "eight.numerator", 0xf669 },
+	{ "rthvleftdnltform", 0x252e },
+	{ "rfbowtie", 0x29d2 },
+	{ "maieklowleftthai", 0xf88c },
+	{ "tehmedialarabic", 0xfe98 },
+	{ "a57", 0x273e },
+	{ "lamarabic", 0x0644 },
+	{ "rieulcirclekorean", 0x3263 },
+	{ "ocircumflexacute", 0x1ed1 },
+	{ "qcircle", 0x24e0 },
+	{ "elevenparen", 0x247e },
+	{ "Omegaiotasublenis", 0x1fa8 },
+	{ "ustraightcyrillic", 0x04af },
+	{ "afii57396", 0x0664 },
+	{ "tusmallkatakana", 0x30c3 },
+	{ "khieukhacirclekorean", 0x3278 },
+	{ "eop", 0x220e },
+	{ "Ecircumflexbelow", 0x1e18 },
+	{ "Kje", 0x040c },
+	{ "Dbar", 0x0189 },
+	{ "nfsquare", 0x338b },
+	{ "afii10046", 0x042c },
+	{ "Uinvertedbreve", 0x0216 },
+	{ "BorderLRCorner1", 0x231f },
+	{ "stixEEB4", 0xeeb4 },
+	{ "tildesubnosp", 0x0330 },
+	{ "uni2294FE00", 0xe276 },
+	{ "zero.denominator", 0xf655 },
+	{ "afii10059", 0x040a },
+	{ "dieresisacute", 0xf6d7 },
+	{ "controlDC4", 0x0014 },
+	{ "esmallkatakanahalfwidth", 0xff6a },
+	{ "simless", 0x2a9d },
+	{ "tecyrillic", 0x0442 },
+	{ "fivearabic", 0x0665 },
+	{ "notsuperseteql", 0x2289 },
+	{ "tet", 0x05d8 },
+	{ "radical", 0x221a },
+	{ "het", 0x05d7 },
+	{ "Omicron", 0x039f },
+	{ "uni224E0338", 0xe616 },
+	{ "equalinferior", 0x208c },
+	{ "zcircle", 0x24e9 },
+	{ "Ainvertedbreve", 0x0202 },
+	{ "commaarmenian", 0x055d },
+	{ "lammeemhahinitialarabic", 0xfd88 },
+	{ "udblacute", 0x0171 },
+	{ "svsquare", 0x33dc },
+	{ "vBar", 0x2ae8 },
+	{ "ezhreversed", 0x01b9 },
+	{ "yehmedialarabic", 0xfef4 },
+	{ "Ha", 0x0425 },
+	{ "a55", 0x273c },
+	{ "kekatakanahalfwidth", 0xff79 },
+	{ "notsucceeds", 0x2281 },
+	{ "yahiragana", 0x3084 },
+	{ "sukatakana", 0x30b9 },
+	{ "box", 0x25a1 },
+	{ "Epsilon", 0x0395 },
+	{ "stixEE9B", 0xee9b },
+	{ "cedilla", 0x00b8 },
+	{ "afii57507", 0x0686 },
+	{ "Jecyrillic", 0x0408 },
+	{ "iecyrillic", 0x0435 },
+	{ "pssquare", 0x33b0 },
+	{ "whitecornerbracketright", 0x300f },
+	{ "onedeva", 0x0967 },
+	{ "tau.sc", 0xf513 },
+	{ "afii57665", 0x05d1 },
+	{ "odieresis.sc", 0xf7f6 },
+	{ "ypogegrammenigreekcmb", 0x0345 },
+	{ "afii10067", 0x0432 },
+	{ "tcircle", 0x24e3 },
+	{ "xdotaccent", 0x1e8b },
+	{ "arrowdblne", 0x21d7 },
+	{ "iotamacron", 0x1fd1 },
+	{ "Feicoptic", 0x03e4 },
+	{ "updownharpoonrightright", 0x294f },
+	{ "triagup", 0x25b2 },
+	{ "Etaiotasublenistilde", 0x1f9e },
+	{ "zcaron", 0x017e },
+	{ "Decyrillic", 0x0414 },
+	{ "Iotalenistilde", 0x1f3e },
+	{ "stixEE07", 0xee07 },
+	{ "circleminus", 0x2296 },
+	{ "Dcaron", 0x010e },
+	{ "danda", 0x0964 },
+	{ "mieumpieupkorean", 0x316e },
+	{ "shaddadammatanarabic", 0xfc5e },
+	{ "Thook", 0x01ac },
+	{ "downtackbelowcmb", 0x031e },
+	{ "greatermonospace", 0xff1e },
+	{ "utilde", 0x0169 },
+	{ "SF100000", 0x2500 },
+	{ "SF460000", 0x2568 },
+	{ "equalcolon", 0x2255 },
+	{ "qmonospace", 0xff51 },
+	{ "rbopomofo", 0x3116 },
+	{ "lessequalorgreater", 0x22da },
+	{ "shaddafathaarabic", 0xfc60 },
+	{ "vuhiragana", 0x3094 },
+	{ "SA420000", 0x2319 },
+	{ "Abreveacute", 0x1eae },
+	{ "Nsmall", 0xf76e },
+	{ "verttab", 0x240b },
+	{ "uni226120D2", 0xed5b },
+	{ "toneextralow", 0x02e9 },
+	{ "rekatakanahalfwidth", 0xff9a },
+	{ "reflexsuperset", 0x2287 },
+	{ "sabengali", 0x09b8 },
+	{ "greaterequalless", 0x22db },
+	{ "Mercury", 0x263f },
+	{ "two.fitted", 0xf63a },
+	{ "twoheaduparrow", 0x219f },
+	{ "cstretch", 0x0297 },
+	{ "uni2AF40338", 0xed98 },
+	{ "anglebracketrightvertical", 0xfe40 },
+	{ "periodsmall", 0xfe52 },
+	{ "Lt", 0x2aa1 },
+	{ "bracketlefttp", 0xf8ee },
+	{ "bihiragana", 0x3073 },
+	{ "okatakana", 0x30aa },
+	{ "Ogravesmall", 0xf7f2 },
+	{ "harpoonrightleft", 0x21cc },
+	{ "l.superior", 0xf6ee },
+	{ "uni2225.short", 0xe302 },
+	{ "shindageshsindothebrew", 0xfb2d },
+	{ "tildeoverlaycmb", 0x0334 },
+	{ "aring.sc", 0xf7e5 },
+	{ "integralbottom", 0x2321 },
+	{ "controlCAN", 0x0018 },
+	{ "hyphenmonospace", 0xff0d },
+	{ "stixEED5", 0xeed5 },
+	{ "i.cyr", 0x0438 },
+	{ "mehiragana", 0x3081 },
+	{ "twentyperiod", 0x249b },
+	{ "theta.sc", 0xf507 },
+	{ "Acircumflex", 0x00c2 },
+	{ "ttabengali", 0x099f },
+	{ "sixparen", 0x2479 },
+	{ "Obarreddieresiscyrillic", 0x04ea },
+	{ "maitholowleftthai", 0xf88f },
+	{ "otildeacute", 0x1e4d },
+	{ "kparen", 0x24a6 },
+	{ "obopomofo", 0x311b },
+	{ "akatakana", 0x30a2 },
+	{ "revsimilar", 0x223d },
+	{ "ocircumflexgrave", 0x1ed3 },
+	{ "leftrightwavyarrow", 0x21ad },
+	{ "aivowelsigndeva", 0x0948 },
+	{ "Lcommaaccent", 0x013b },
+	{ "qamatshebrew", 0x05b8 },
+	{ "qaffinalarabic", 0xfed6 },
+	{ "hehinitialarabic", 0xfeeb },
+	{ "uni2026.em", 0xe3b4 },
+	{ "Tedescendercyrillic", 0x04ac },
+	{ "uni210F.var", 0xe2d5 },
+	{ "tthabengali", 0x09a0 },
+	{ "underscoredblnosp", 0x0333 },
+	{ "tackupmid", 0x02d4 },
+	{ "iotadieresistonos", 0x0390 },
+	{ "a3", 0x2704 },
+	{ "xcircle", 0x24e7 },
+	{ "Epsilonsmall", 0xf504 },
+	{ "lessdblequal", 0x2266 },
+	{ "Kartdes", 0x049a },
+	{ "tavhebrew", 0x05ea },
+	{ "ideographsuncircle", 0x3290 },
+	{ "iebrevecyrillic", 0x04d7 },
+	{ "afii10094", 0x044c },
+	{ "ikorean", 0x3163 },
+	{ "omegapi", 0x03d6 },
+	{ "epsilongrave", 0x1f72 },
+	{ "tserehebrew", 0x05b5 },
+	{ "IAcyrillic", 0x042f },
+	{ "iotadiaeresis", 0x03ca },
+	{ "stareq", 0x225b },
+	{ "gsime", 0x2a8e },
+	{ "lamjeeminitialarabic", 0xfcc9 },
+	{ "tehhahinitialarabic", 0xfca2 },
+	{ "barleftarrow", 0x21e4 },
+	{ "idotbelow", 0x1ecb },
+	{ "Zacute", 0x0179 },
+	{ "Be", 0x0411 },
+	{ "intersectiondbl", 0x22d3 },
+	{ "gravedeva", 0x0953 },
+	{ "rieulthieuthkorean", 0x313e },
+	{ "bullet", 0x2022 },
+	{ "afii10066.ital", 0xf6c5 },
+	{ "ssagujarati", 0x0ab7 },
+	{ "c.sc", 0xf763 },
+	{ "hairspace", 0x200a },
+	{ "twodotleadervertical", 0xfe30 },
+	{ "gimelhebrew", 0x05d2 },
+	{ "Cancer", 0x264b },
+	{ "ohungarumlaut", 0x0151 },
+	{ "nineinferior", 0x2089 },
+	{ "notfollowsoreql", 0x22e1 },
+	{ "anbopomofo", 0x3122 },
+	{ "udieresisbelow", 0x1e73 },
+	{ "Aquarius", 0x2652 },
+	{ "psicyrillic", 0x0471 },
+	{ "fivehackarabic", 0x0665 },
+	{ "triangleleft1", 0x25c1 },
+	{ "Omegagrave", 0x1ffa },
+	{ "arrowdblboth", 0x21d4 },
+	{ "sevensuperior", 0x2077 },
+	{ "Fourroman", 0x2163 },
+	{ "periodinferior", 0xf6e7 },
+	{ "Yacute", 0x00dd },
+	{ "stixEE7D", 0xee7d },
+	{ "nine.oldstyle", 0xf739 },
+	{ "five.numerator", 0xf666 },
+	{ "taharabic", 0x0637 },
+	{ "arrowwaveleft", 0x219c },
+	{ "semicolonsmall", 0xfe54 },
+	{ "Escyrillic", 0x0421 },
+	{ "omacrongrave", 0x1e51 },
+	{ "lgE", 0x2a91 },
+	{ "kra", 0x0138 },
+	{ "xabovecmb", 0x033d },
+	{ "pi.alt", 0x03d6 },
+	{ "dzeabkhasiancyrillic", 0x04e1 },
+	{ "fork", 0x22d4 },
+	{ "dialytika", 0x0308 },
+	{ "lamalefmaddaaboveisolatedarabic", 0xfef5 },
+	{ "makatakana", 0x30de },
+	{ "vertdblrtform", 0x255f },
+	{ "deleteright", 0x2326 },
+	{ "jagurmukhi", 0x0a1c },
+	{ "omicron", 0x03bf },
+	{ "narylogicaland", 0x22c0 },
+	{ "SF600000", 0x2580 },
+	{ "Edotaccent.small", 0xf679 },
+	{ "Ediaeresis", 0x00cb },
+	{ "kwsquare", 0x33be },
+	{ "oinvertedbreve", 0x020f },
+	{ "sevenmonospace", 0xff17 },
+	{ "schwahook", 0x025a },
+	{ "a38", 0x272b },
+	{ "phi.alt", 0x03d5 },
+	{ "ucyrilbreve", 0x045e },
+	{ "uni22B420D2", 0xe2d0 },
+	{ "rittorusquare", 0x3351 },
+	{ "Omega", 0x2126 },
+	{ "equalsmall", 0xfe66 },
+	{ "hehmedialaltonearabic", 0xfba9 },
+	{ "etatonos", 0x03ae },
+	{ "Dlinebelow", 0x1e0e },
+	{ "jcrossedtail", 0x029d },
+	{ "tsadidageshhebrew", 0xfb46 },
+	{ "stixEE14", 0xee14 },
+	{ "seven.fitted", 0xf63f },
+	{ "tchehfinalarabic", 0xfb7b },
+	{ "iivowelsigngujarati", 0x0ac0 },
+	{ "endtrans", 0x2404 },
+	{ "Upsilongrave", 0x1fea },
+	{ "arrowparrrightleft", 0x21c4 },
+	{ "dieresis.sc", 0xf7a8 },
+	{ "anglebracketleftvertical", 0xfe3f },
+	{ "asteriskaltonearabic", 0x066d },
+	{ "rieulphieuphkorean", 0x313f },
+	{ "aavowelsignbengali", 0x09be },
+	{ "Finv", 0x2132 },
+	{ "macron", 0x00af },
+	{ "ikatakana", 0x30a4 },
+	{ "Eta", 0x0397 },
+	{ "nvRightarrow", 0x2903 },
+	{ "uni2A13.uplgdisplay", 0xe398 },
+	{ "squarelog", 0x33d2 },
+	{ "jheharmenian", 0x057b },
+	{ "corporationsquare", 0x337f },
+	{ "shaarmenian", 0x0577 },
+	{ "khagujarati", 0x0a96 },
+	{ "igurmukhi", 0x0a07 },
+	{ "rihiragana", 0x308a },
+	{ "imonospace", 0xff49 },
+	{ "calsquare", 0x3388 },
+	{ "SF430000", 0x2550 },
+	{ "mem", 0x05de },
+	{ "tortoiseshellbracketrightvertical", 0xfe3a },
+	{ "five.fitted", 0xf63d },
+	{ "uni2216.var", 0xe844 },
+	{ "arighthalfring", 0x1e9a },
+	{ "squareln", 0x33d1 },
+	{ "blackuppointingtriangle", 0x25b2 },
+	{ "twothird", 0x2154 },
+	{ "dzaltone", 0x02a3 },
+	{ "smalltriangleleft", 0x25c3 },
+	{ "B", 0x0042 },
+	{ "afii10089", 0x0447 },
+	{ "O.cyr", 0x041e },
+	{ "pedageshhebrew", 0xfb44 },
+	{ "arrowdownright", 0x2198 },
+	{ "obarred", 0x0275 },
+	{ "arrowdbllongboth", 0x21d4 },
+	{ "eight.denominator", 0xf65d },
+	{ "circlesolid", 0x25cf },
+	{ "etaacute", 0x1f75 },
+	{ "macronnosp", 0x0304 },
+	{ "lezh", 0x026e },
+	{ "dzhecyrillic", 0x045f },
+	{ "a130", 0x2776 },
+	{ "topfork", 0x2ada },
+	{ "ideographiclaborparen", 0x3238 },
+	{ "dammatanaltonearabic", 0x064c },
+	{ "Kcommaaccent", 0x0136 },
+	{ "bowtie", 0x22c8 },
+	{ "Ecedillabreve", 0x1e1c },
+	{ "nieunpansioskorean", 0x3168 },
+	{ "two", 0x0032 },
+	{ "m.sc", 0xf76d },
+	{ "xsol", 0x29f8 },
+	{ "mokatakanahalfwidth", 0xff93 },
+	{ "m", 0x006d },
+	{ "perpendicular", 0x22a5 },
+	{ "Iebrevecyrillic", 0x04d6 },
+	{ "SS000000", 0x263a },
+	{ "numbersign.taboldstyle", 0xf650 },
+	{ "questiondownsmall", 0xf7bf },
+	{ "Lmonospace", 0xff2c },
+	{ "Ushortcyrillic", 0x040e },
+	{ "Egrave", 0x00c8 },
+	{ "gjecyrillic", 0x0453 },
+	{ "backspace", 0x2408 },
+	{ "ze", 0x0437 },
+	{ "Etalenisgrave", 0x1f2a },
+	{ "Kabashkircyrillic", 0x04a0 },
+	{ "tekatakana", 0x30c6 },
+	{ "gershayimhebrew", 0x05f4 },
+	{ "Zlinebelow", 0x1e94 },
+	{ "edieresis.sc", 0xf7eb },
+	{ "iotaaspercircumflex", 0x1f37 },
+	{ "multiplymultiset", 0x228d },
+	{ "dblarrowdown", 0x21ca },
+	{ "shindot", 0x05c1 },
+	{ "notless", 0x226e },
+	{ "questiondown", 0x00bf },
+	{ "Uacute", 0x00da },
+	{ "Bsmallcap", 0x0299 },
+	{ "uni2A14.uplgdisplay", 0xe399 },
+	{ "trianglerightequal", 0x22b5 },
+	{ "overscoredblnosp", 0x033f },
+	{ "hiriqquarterhebrew", 0x05b4 },
+	{ "yen.taboldstyle", 0xf652 },
+	{ "shiftin", 0x240f },
+	{ "afii57401", 0x0669 },
+	{ "afii57842", 0x05c0 },
+	{ "emdash.cap", 0xf6bc },
+	{ "cornerbracketrightvertical", 0xfe42 },
+	{ "six.inferior", 0x2086 },
+	{ "Yoghrev", 0x01b8 },
+	{ "questiongreek", 0x037e },
+	{ "llinebelow", 0x1e3b },
+	{ "ccedilla", 0x00e7 },
+	{ "acircumflexacute", 0x1ea5 },
+	{ "yeharabic", 0x064a },
+	{ "ucircle", 0x24e4 },
+	{ "sioscirclekorean", 0x3266 },
+	{ "glottalrevsuper", 0x02e4 },
+	{ "epsiloninv", 0x220a },
+	{ "Ugravesmall", 0xf7f9 },
+	{ "a149", 0x2789 },
+	{ "parenrightbt", 0xf8f8 },
+	{ "pashtahebrew", 0x0599 },
+	{ "glottalstopstrokereversed", 0x02a2 },
+	{ "omicronasperacute", 0x1f45 },
+	{ "tparen", 0x24af },
+	{ "ediaeresis", 0x00eb },
+	{ "similarrightarrow", 0x2972 },
+	{ "uni2191.short", 0xf52a },
+	{ "commasuperior", 0xf6e2 },
+	{ "ltvertform", 0x2502 },
+	{ "tehinitialarabic", 0xfe97 },
+	{ "istroke", 0x0268 },
+	{ "pekatakana", 0x30da },
+	{ "rupeesignbengali", 0x09f3 },
+	{ "uni2AA220D2", 0xe2ca },
+	{ "ukorean", 0x315c },
+	{ "Q", 0x0051 },
+	{ "osmallkatakana", 0x30a9 },
+	{ "uni003D20E5", 0xe388 },
+	{ "Ghook", 0x0193 },
+	{ "aturned", 0x0250 },
+	{ "a", 0x0061 },
+	{ "uni2A990338", 0xed6c },
+	{ "uni2A6C0338", 0xed54 },
+	{ "smalltriangleinvsld", 0x25be },
+	{ "leftharpoonupdash", 0x296a },
+	{ "W", 0x0057 },
+	{ "wawhamzaabovefinalarabic", 0xfe86 },
+	{ "Abrevegrave", 0x1eb0 },
+	{ "ksicyrillic", 0x046f },
+	{ "question", 0x003f },
+	{ "K", 0x004b },
+	{ "semivoicedmarkkanahalfwidth", 0xff9f },
+	{ "psilivaria", 0x1fcd },
+	{ "controlUS", 0x001f },
+	{ "ideographicclose", 0x3006 },
+	{ "Uuparrow", 0x290a },
+	{ "adieresis.sc", 0xf7e4 },
+	{ "primerev", 0x2035 },
+	{ "thehmedialarabic", 0xfe9c },
+	{ "Aring", 0x00c5 },
+	{ "Oslashacute.small", 0xf694 },
+	{ "afii10192", 0xf6c6 },
+	{ "Ge", 0x0413 },
+	{ "bulletmath", 0x2219 },
+	{ "guillemotleft.cap", 0xf6b6 },
+	{ "Gcircumflex", 0x011c },
+	{ "kartdes", 0x049b },
+	{ "circlenwopen", 0x25d5 },
+	{ "threecircleinversesansserif", 0x278c },
+	{ "Istroke", 0x0197 },
+	{ "fivepersian", 0x06f5 },
+	{ "Uhookabove", 0x1ee6 },
+	{ "sine", 0x223f },
+	{ "uni00730336", 0xea0b },
+	{ "noonmedialarabic", 0xfee8 },
+	{ "oshortvowelsigndeva", 0x094a },
+	{ "kashidaautoarabic", 0x0640 },
+	{ "Chekhakassiancyrillic", 0x04cb },
+	{ "teharabic", 0x062a },
+	{ "qamatsde", 0x05b8 },
+	{ "munahhebrew", 0x05a3 },
+	{ "Omegaiotasublenisacute", 0x1fac },
+	{ "yerahbenyomolefthebrew", 0x05aa },
+	{ "tmonospace", 0xff54 },
+	{ "reviamugrashhebrew", 0x0597 },
+	{ "Ie.ukran", 0x0404 },
+	{ "ngonguthai", 0x0e07 },
+	{ "ghook", 0x0260 },
+	{ "ocandradeva", 0x0911 },
+	{ "yosmallhiragana", 0x3087 },
+	{ "shevaquarterhebrew", 0x05b0 },
+	{ "qamats1a", 0x05b8 },
+	{ "diamondleftarrow", 0x291d },
+	{ "Idot", 0x0130 },
+	{ "omegaiotasublenisgrave", 0x1fa2 },
+	{ "deleteleft", 0x232b },
+	{ "uptackbelowcmb", 0x031d },
+	{ "apaatosquare", 0x3300 },
+	{ "fifteencircle", 0x246e },
+	{ "formfeed", 0x240c },
+	{ "uni228AFE00", 0xe2b9 },
+	{ "afii57411", 0x0623 },
+	{ "afii10096", 0x044e },
+	{ "dzhe", 0x045f },
+	{ "chagujarati", 0x0a9b },
+	{ "zinorhebrew", 0x05ae },
+	{ "qamats27", 0x05b8 },
+	{ "uni2A6C20D2", 0xed55 },
+	{ "Omegaasper", 0x1f69 },
+	{ "dasia_oxia", 0x1fde },
+	{ "curland", 0x22cf },
+	{ "Ibreve.small", 0xf683 },
+	{ "Tenroman", 0x2169 },
+	{ "omegaiotasublenis", 0x1fa0 },
+	{ "a189", 0x27bc },
+	{ "Iibreve", 0x0419 },
+	{ "lessmonospace", 0xff1c },
+	{ "downzigzagarrow", 0x21af },
+	{ "uni2A10.lgdisplay", 0xe395 },
+	{ "okatakanahalfwidth", 0xff75 },
+	{ "twodotleader", 0x2025 },
+	{ "a164", 0x2195 },
+	{ "dargahebrew", 0x05a7 },
+	{ "gtquest", 0x2a7c },
+	{ "glottalstopbarinv", 0x01be },
+	{ "backed", 0x02c3 },
+	{ "afii57511", 0x0679 },
+	{ "dittomark", 0x3003 },
+	{ "Te", 0x0422 },
+	{ "bell", 0x2407 },
+	{ "caretinsert", 0x2041 },
+	{ "cieuccirclekorean", 0x3268 },
+	{ "dieresisnosp", 0x0308 },
+	{ "jeeminitialarabic", 0xfe9f },
+	{ "afii10035", 0x0421 },
+	{ "abengali", 0x0985 },
+	{ "eight", 0x0038 },
+	{ "controlSOT", 0x0002 },
+	{ "threequarters", 0x00be },
+	{ "alphaiotasublenisgrave", 0x1f82 },
+	{ "zdotbelow", 0x1e93 },
+	{ "uni22DBFE00", 0xe32c },
+	{ "braceex", 0xf8f4 },
+	{ "stixEE77", 0xee77 },
+	{ "Ze", 0x0417 },
+	{ "ideographicreachparen", 0x3243 },
+	{ "Efcyrillic", 0x0424 },
+	{ "fivehangzhou", 0x3025 },
+	{ "dong", 0x20ab },
+	{ "Ydiaeresis", 0x0178 },
+	{ "controlCR", 0x000d },
+	{ "cturn", 0x0254 },
+	{ "omegatonos", 0x03ce },
+	{ "tetse", 0x04b5 },
+	{ "Enhook", 0x04c7 },
+	{ "uni2A11.up", 0xe39b },
+	{ "lessorgreater", 0x2276 },
+	{ "SF070000", 0x2534 },
+	{ "a53", 0x273a },
+	{ "SF610000", 0x2588 },
+	{ "Yusbigcyrillic", 0x046a },
+	{ "auvowelsignbengali", 0x09cc },
+	{ "lambda", 0x03bb },
+	{ "asymptoticallyequal", 0x2243 },
+	{ "Wmonospace", 0xff37 },
+	{ "uring", 0x016f },
+	{ "stixEE53", 0xee53 },
+	{ "uni226620D2", 0xed62 },
+	{ "afii10028", 0x041a },
+	{ "ezhcurl", 0x0293 },
+	{ "Kha", 0x0425 },
+	{ "yuyeokorean", 0x318a },
+	{ "de", 0x0434 },
+	{ "lro", 0x202d },
+	{ "stixEE17", 0xee17 },
+	{ "onemonospace", 0xff11 },
+	{ "fmonospace", 0xff46 },
+	{ "DieresisGrave", 0xf6cd },
+	{ "uni2A15.lgdisplay", 0xe376 },
+	{ "eacute.sc", 0xf7e9 },
+	{ "shinshindothebrew", 0xfb2a },
+	{ "SF580000", 0x258c },
+	{ "lxsquare", 0x33d3 },
+	{ "psilipneumatacyrilliccmb", 0x0486 },
+	{ "Lambda", 0x039b },
+	{ "seventhai", 0x0e57 },
+	{ "phieuphparenkorean", 0x320c },
+	{ "phadeva", 0x092b },
+	{ "adeva", 0x0905 },
+	{ "alphacircumflex", 0x1fb6 },
+	{ "rrvocalicvowelsignbengali", 0x09c4 },
+	{ "khokhuatthai", 0x0e03 },
+	{ "orthogonal", 0x221f },
+	{ "blackrightpointingtriangle", 0x25b6 },
+	{ "at.cap", 0xf633 },
+	{ "yikorean", 0x3162 },
+	{ "Koppagreek", 0x03de },
+	{ "FleuronRight", 0x2767 },
+	{ "dblintegral", 0x222c },
+	{ "ampersand.sc", 0xf726 },
+	{ "prime1", 0x2032 },
+	{ "arrowdashdown", 0x21e3 },
+	{ "maitrilowrightthai", 0xf891 },
+	{ "hakatakanahalfwidth", 0xff8a },
+	{ "seovnearrow", 0x292d },
+	{ "cedilla.sc", 0xf7b8 },
+	{ "birusquare", 0x3331 },
+	{ "because", 0x2235 },
+	{ "afii57403", 0x061b },
+	{ "a188", 0x27bb },
+	{ "Chedescenderabkhasiancyrillic", 0x04be },
+	{ "harpoonleftbarbup", 0x21bc },
+	{ "nottriangleleft", 0x22ea },
+	{ "upharpoonsleftright", 0x2963 },
+	{ "elevencircle", 0x246a },
+	{ "upsilonaspergrave", 0x1f53 },
+	{ "caret", 0x2038 },
+	{ "arrowparrleftright", 0x21c6 },
+	{ "ogonekcmb", 0x0328 },
+	{ "neovsearrow", 0x292e },
+	{ "theharabic", 0x062b },
+	{ "a101", 0x2761 },
+	{ "zhecyrillic", 0x0436 },
+	{ "afii10102", 0x0455 },
+	{ "bmonospace", 0xff42 },
+	{ "ysuperior", 0x02b8 },
+	{ "squareimage", 0x228f },
+	{ "ilde", 0x02dc },
+	{ "iotadieresistilde", 0x1fd7 },
+	{ "Upsilonaspergrave", 0x1f5b },
+	{ "commaaccent.small", 0xf635 },
+	{ "alefhebrew", 0x05d0 },
+	{ "elevenroman", 0x217a },
+	{ "lvocalicdeva", 0x090c },
+	{ "rhook", 0x027d },
+	{ "zdot", 0x017c },
+	{ "Deicoptic", 0x03ee },
+	{ "colonequal", 0x2254 },
+	{ "kappascript", 0x03f0 },
+	{ "tie", 0x2040 },
+	{ "twofifths", 0x2156 },
+	{ "afii57519", 0x06d2 },
+	{ "nhookleft", 0x0272 },
+	{ "yokatakana", 0x30e8 },
+	{ "Macron", 0xf6d0 },
+	{ "higherrank", 0x22b1 },
+	{ "Fhook", 0x0191 },
+	{ "Jupiter", 0x2643 },
+	{ "SM570001", 0x25d8 },
+	{ "oneroman", 0x2170 },
+	{ "a90", 0x2769 },
+	{ "comma", 0x002c },
+	{ "Ifraktur", 0x2111 },
+	{ "zerothai", 0x0e50 },
+	{ "chedescendercyrillic", 0x04b7 },
+	{ "alphalenis", 0x1f00 },
+	{ "uni003C20D2", 0xe2c3 },
+	{ "jeemmedialarabic", 0xfea0 },
+	{ "angleleft", 0x2329 },
+	{ "trianglenesld", 0x25e5 },
+	{ "hatafsegol17", 0x05b1 },
+	{ "LL", 0xf6bf },
+	{ "vertdblbar", 0x2551 },
+	{ "ghabengali", 0x0998 },
+	{ "original", 0x22b6 },
+	{ "Omegaiotasubasper", 0x1fa9 },
+	{ "acute", 0x00b4 },
+	{ "dbldnrtform", 0x2554 },
+	{ "yabengali", 0x09af },
+	{ "iotadieresisacute", 0x1fd3 },
+	{ "blacksmilingface", 0x263b },
+	{ "tikeutcirclekorean", 0x3262 },
+	{ "ghaininitialarabic", 0xfecf },
+	{ "dotkatakana", 0x30fb },
+	{ "twodotlead", 0x2025 },
+	{ "Tilde", 0xeff5 },
+	{ "slashshortnosp", 0x0337 },
+	{ "cstretched", 0x0297 },
+	{ "sha", 0x0448 },
+	{ "horiztab", 0x2409 },
+	{ "notexistential", 0x2204 },
+	{ "Sheicoptic", 0x03e2 },
+	{ "tchehmedialarabic", 0xfb7d },
+	{ "Xmonospace", 0xff38 },
+	{ "stixEEA8", 0xeea8 },
+	{ "Upsilonhook", 0x03d2 },
+	{ "cdotaccent", 0x010b },
+	{ "hyphen-minus", 0x002d },
+	{ "Icircumflexsmall", 0xf7ee },
+	{ "prE", 0x2ab3 },
+	{ "tworoman", 0x2171 },
+	{ "twodotenleader", 0x2025 },
+	{ "Cdotaccent", 0x010a },
+	{ "lessornotsimilar", 0x22e6 },
+	{ "parenleft.numerator", 0xf631 },
+	{ "Lcedilla", 0x013b },
+	{ "nleg", 0x019e },
+	{ "uplthorizhvform", 0x2537 },
+	{ "Khei", 0x03e6 },
+	{ "omegaasperacute", 0x1f65 },
+	{ "almostequal", 0x2248 },
+	{ "arrowsquiggleright", 0x21dd },
+	{ "Bdotbelow", 0x1e04 },
+	{ "fivegurmukhi", 0x0a6b },
+	{ "fmsquare", 0x3399 },
+	{ "voicedmarkkana", 0x309b },
+	{ "uhacek", 0x01d4 },
+	{ "finaltsadihebrew", 0x05e5 },
+	{ "bohiragana", 0x307c },
+	{ "dbllowlinecmb", 0x0333 },
+	{ "Yeri", 0x042b },
+	{ "Kjecyrillic", 0x040c },
+	{ "mapsdown", 0x21a7 },
+	{ "rsuper", 0x02b3 },
+	{ "ohorntilde", 0x1ee1 },
+	{ "sevenpersian", 0x06f7 },
+	{ "qamatsqatanquarterhebrew", 0x05b8 },
+	{ "rthvleftvertltform", 0x253e },
+	{ "Dcroat", 0x0110 },
+	{ "sukatakanahalfwidth", 0xff7d },
+	{ "afii57513", 0x0691 },
+	{ "ideographicsecretcircle", 0x3299 },
+	{ "mill", 0x20a5 },
+	{ "udblgrave", 0x0215 },
+	{ "lefthvrtdnltform", 0x252d },
+	{ "lcircumflexbelow", 0x1e3d },
+	{ "Kappasmall", 0xf509 },
+	{ "finalpehebrew", 0x05e3 },
+	{ "ostrokeacute", 0x01ff },
+	{ "spaceopenbox", 0x2423 },
+	{ "dashrightharpoondown", 0x296d },
+	{ "lates", 0xe33e },
+	{ "noonjeeminitialarabic", 0xfcd2 },
+	{ "mbsquare", 0x33d4 },
+	{ "Csmall", 0xf763 },
+	{ "angbracketleft", 0x3008 },
+	{ "TheMoon", 0x263d },
+	{ "projective", 0x2305 },
+	{ "a161", 0x2192 },
+	{ "arrowheadupmod", 0x02c4 },
+	{ "nieunacirclekorean", 0x326f },
+	{ "race", 0xe28f },
+	{ "ltcc", 0x2aa6 },
+	{ "fl", 0xfb02 },
+	{ "makatakanahalfwidth", 0xff8f },
+	{ "b.sc", 0xf762 },
+	{ "eqvparsl", 0x29e5 },
+	{ "closure", 0x2050 },
+	{ "kafdagesh", 0xfb3b },
+	{ "lolingthai", 0x0e25 },
+	{ "finalkafdageshhebrew", 0xfb3a },
+	{ "ncedilla", 0x0146 },
+	{ "two.inferior", 0x2082 },
+	{ "alphaiotasubtilde", 0x1fb7 },
+	{ "jdotlessstroke", 0x025f },
+	{ "sheva", 0x05b0 },
+	{ "ushortcyrillic", 0x045e },
+	{ "softhyphen", 0x00ad },
+	{ "Omega.greek", 0x03a9 },
+	{ "seventeenperiod", 0x2498 },
+	{ "zigzagoverscorenosp", 0x0343 },
+	{ "nbspace", 0x00a0 },
+	{ "haceksubnosp", 0x032c },
+	{ "Ohook", 0x04a8 },
+	{ "squarewhitewithsmallblack", 0x25a3 },
+	{ "onethird", 0x2153 },
+	{ "iicyrillic", 0x0438 },
+	{ "afii57419", 0x062b },
+	{ "afii57441", 0x0641 },
+	{ "sevenroman", 0x2176 },
+	{ "hehfinalarabic", 0xfeea },
+	{ "arrowdblbothv", 0x21d5 },
+	{ "stixEE5A", 0xee5a },
+	{ "vertleftdblform", 0x2561 },
+	{ "iotaleniscircumflex", 0x1f36 },
+	{ "acircumflexdotbelow", 0x1ead },
+	{ "Wcircumflex", 0x0174 },
+	{ "caretinverted", 0x2304 },
+	{ "mulsquare", 0x3395 },
+	{ "afii10066", 0x0431 },
+	{ "Scarondotaccent", 0x1e66 },
+	{ "sekatakanahalfwidth", 0xff7e },
+	{ "dblvertrtform", 0x2560 },
+	{ "a204", 0x2752 },
+	{ "upsilon", 0x03c5 },
+	{ "rehfinalarabic", 0xfeae },
+	{ "kje", 0x045c },
+	{ "logicalnotreversed", 0x2310 },
+	{ "ecyrillic", 0x0454 },
+	{ "arrowrightnot", 0x219b },
+	{ "sixinferior", 0x2086 },
+	{ "DD031", 0x2595 },
+	{ "colonsmall", 0xfe55 },
+	{ "leftrightharpoonupup", 0x294e },
+	{ "qamats10", 0x05b8 },
+	{ "wokatakana", 0x30f2 },
+	{ "kapyeounphieuphkorean", 0x3184 },
+	{ "luthai", 0x0e26 },
+	{ "ldot", 0x0140 },
+	{ "turnednot", 0x2319 },
+	{ "eightinferior", 0x2088 },
+	{ "Oacutesmall", 0xf7f3 },
+	{ "Brevesmall", 0xf6f4 },
+	{ "Gbreve", 0x011e },
+	{ "Hcedilla", 0x1e28 },
+	{ "dotmath", 0x22c5 },
+	{ "sixcircle", 0x2465 },
+	{ "ohorndotbelow", 0x1ee3 },
+	{ "Scircumflex.small", 0xf69a },
+	{ "SS010000", 0x263b },
+	{ "kakatakanahalfwidth", 0xff76 },
+	{ "chieuchacirclekorean", 0x3277 },
+	{ "afii10021", 0x0414 },
+	{ "seveneighths", 0x215e },
+	{ "braceleft", 0x007b },
+	{ "gagujarati", 0x0a97 },
+	{ "Yericyrillic", 0x042b },
+	{ "stixEE41", 0xee41 },
+	{ "prescription", 0x211e },
+	{ "numbersignmonospace", 0xff03 },
+	{ "shook", 0x0282 },
+	{ "ringoperator", 0x2218 },
+	{ "uphvleftltform", 0x251a },
+	{ "SF140000", 0x2591 },
+	{ "blacksmallsquare", 0x25aa },
+	{ "seven", 0x0037 },
+	{ "aring", 0x00e5 },
+	{ "etaiota.sc", 0xf51c },
+	{ "squarenwsld", 0x25e9 },
+	{ "circlerightsld", 0x25d1 },
+	{ "a22", 0x2716 },
+	{ "eematragurmukhi", 0x0a47 },
+	{ "behiragana", 0x3079 },
+	{ "waekorean", 0x3159 },
+	{ "nieunkorean", 0x3134 },
+	{ "afii57636", 0x20aa },
+	{ "thieuthcirclekorean", 0x326b },
+	{ "o.superior", 0xf6f0 },
+	{ "klinebelow", 0x1e35 },
+	{ "intercal", 0x22ba },
+	{ "eopenreversedhook", 0x025d },
+	{ "shindageshshindot", 0xfb2c },
+	{ "Echarmenian", 0x0535 },
+	{ "etaaspergrave", 0x1f23 },
+	{ "verticallineabovecmb", 0x030d },
+	{ "Zdotaccent.small", 0xf6ac },
+	{ "stixEE85", 0xee85 },
+	{ "BorderURCorner1", 0x231d },
+	{ "Vmonospace", 0xff36 },
+	{ "recordseparator", 0x241e },
+	{ "copyright", 0x00a9 },
+	{ "hvvertleftform", 0x252b },
+	{ "tackdownmid", 0x02d5 },
+	{ "kturn", 0x029e },
+	{ "eighteencircle", 0x2471 },
+	{ "a67", 0x2748 },
+	{ "kagurmukhi", 0x0a15 },
+	{ "a121", 0x2461 },
+	{ "yehnoonfinalarabic", 0xfc94 },
+	{ "lowcomma", 0x037a },
+	{ "iehook", 0x04bd },
+	{ "acircumflex", 0x00e2 },
+	{ "saraiileftthai", 0xf886 },
+	{ "IJ", 0x0132 },
+	{ "controlDLE", 0x0010 },
+	{ "izhitsagravedbl", 0x0477 },
+	{ "uparen", 0x24b0 },
+	{ "a180", 0x27ab },
+	{ "macronbelowcmb", 0x0331 },
+	{ "kastrokecyrillic", 0x049f },
+	{ "er", 0x0440 },
+	{ "hukatakanahalfwidth", 0xff8c },
+	{ "odblgrave", 0x020d },
+	{ "twelvecircle", 0x246b },
+	{ "Gmacron", 0x1e20 },
+	{ "afii10027", 0x0419 },
+	{ "afii10093", 0x044b },
+	{ "alphaiotasubasper", 0x1f81 },
+	{ "dieresisbelowcmb", 0x0324 },
+	{ "Pdotaccent", 0x1e56 },
+	{ "spadeopen", 0x2664 },
+	{ "ng", 0x014b },
+	{ "rafe", 0x05bf },
+	{ "control", 0x2303 },
+	{ "checkmark", 0x2713 },
+	{ "tihiragana", 0x3061 },
+	{ "wbsquare", 0x33dd },
+	{ "registered", 0x00ae },
+	{ "acknowledge", 0x2406 },
+	{ "maichattawalowrightthai", 0xf894 },
+	{ "afii57431", 0x0637 },
+	{ "jcrosstail", 0x029d },
+	{ "yetivhebrew", 0x059a },
+	{ "periodarmenian", 0x0589 },
+	{ "Nacute", 0x0143 },
+	{ "tehmarbutafinalarabic", 0xfe94 },
+	{ "Tau", 0x03a4 },
+	{ "uni2297FE00", 0xed41 },
+	{ "vavhebrew", 0x05d5 },
+	{ "ideographicmedicinecircle", 0x32a9 },
+	{ "afii57410", 0x0622 },
+	{ "equalrightarrow", 0x2971 },
+	{ "iishortcyrillic", 0x0439 },
+	{ "alphaiotasubaspercircumflex", 0x1f87 },
+	{ "Ucyrilbreve", 0x040e },
+	{ "squiggleleft", 0x21dc },
+	{ "afii57841", 0x05bf },
+	{ "leftrightharpoonsdown", 0x2967 },
+	{ "Dieresissmall", 0xf7a8 },
+	{ "oubopomofo", 0x3121 },
+	{ "nhookretroflex", 0x0273 },
+	{ "squareupperlefttolowerrightfill", 0x25a7 },
+	{ "dddhadeva", 0x095c },
+	{ "sigma", 0x03c3 },
+	{ "tserewidehebrew", 0x05b5 },
+	{ "centinferior", 0xf6df },
+	{ "rrvocalicbengali", 0x09e0 },
+	{ "sigma.sc", 0xf512 },
+	{ "a81", 0x25d7 },
+	{ "sacutedotaccent", 0x1e65 },
+	{ "zbopomofo", 0x3117 },
+	{ "gcircle", 0x24d6 },
+	{ "omegaiotasubcircumflex", 0x1ff7 },
+	{ "yehmeeminitialarabic", 0xfcdd },
+	{ "wawarabic", 0x0648 },
+	{ "csupe", 0x2ad2 },
+	{ "meemmeemisolatedarabic", 0xfc48 },
+	{ "stixEE21", 0xee21 },
+	{ "patahnarrowhebrew", 0x05b7 },
+	{ "afii57685", 0x05e5 },
+	{ "downharpoonsleftright", 0x2965 },
+	{ "gimarmenian", 0x0563 },
+	{ "yuslittleiotifiedcyrillic", 0x0469 },
+	{ "h.superior", 0xf637 },
+	{ "afii57445", 0x0645 },
+	{ "glE", 0x2a92 },
+	{ "afii57394", 0x0662 },
+	{ "Edotaccent", 0x0116 },
+	{ "ekonkargurmukhi", 0x0a74 },
+	{ "tildetrpl", 0x224b },
+	{ "lsquare", 0x2113 },
+	{ "leftdbkarrow", 0x290e },
+	{ "Iotasmall", 0xf508 },
+	{ "iotadieresis", 0x03ca },
+	{ "cheabkhasiancyrillic", 0x04bd },
+	{ "omegaaspercircumflex", 0x1f67 },
+	{ "ehookabove", 0x1ebb },
+	{ "notlessequal", 0x2270 },
+	{ "ddagurmukhi", 0x0a21 },
+	{ "Zhedescendercyrillic", 0x0496 },
+	{ "lamfinalarabic", 0xfede },
+	{ "SF260000", 0x255d },
+	{ "space_uni030F.cap", 0xf6d3 },
+	{ "arrowtripleleft", 0x21da },
+	{ "Lslash", 0x0141 },
+	{ "afii57420", 0x062c },
+	{ "uni227E0338", 0xe836 },
+	{ "ohookabove", 0x1ecf },
+	{ "ssanghieuhkorean", 0x3185 },
+	{ "Aacutesmall", 0xf7e1 },
+	{ "dhagujarati", 0x0aa7 },
+	{ "mohiragana", 0x3082 },
+	{ "parenleftsmall", 0xfe59 },
+	{ "tehhahisolatedarabic", 0xfc0c },
+	{ "primemod", 0x02b9 },
+	{ "shacyrillic", 0x0448 },
+	{ "gparen", 0x24a2 },
+	{ "uni2AC50338", 0xe2ae },
+	{ "complement", 0x2201 },
+	{ "afii57450", 0x064a },
+	{ "epsilonclosed", 0x029a },
+	{ "uni228BFE00", 0xe2ba },
+	{ "Eng.small", 0xf67b },
+	{ "stixEE56", 0xee56 },
+	{ "nineoldstyle", 0xf739 },
+	{ "agujarati", 0x0a85 },
+	{ "khahmedialarabic", 0xfea8 },
+	{ "seenarabic", 0x0633 },
+	{ "afii57455", 0x064f },
+	{ "mmcubedsquare", 0x33a3 },
+	{ "Qmonospace", 0xff31 },
+	{ "nottriangleright", 0x22eb },
+	{ "omegacircumflex", 0x1ff6 },
+	{ "starequal", 0x225b },
+	{ "two.taboldstyle", 0xf645 },
+	{ "wavyoverscorenosp", 0x0342 },
+	{ "dialytikaacute", 0x1fee },
+	{ "triangleleftequal", 0x22b4 },
+	{ "segolhebrew", 0x05b6 },
+	{ "uhorndotbelow", 0x1ef1 },
+	{ "qamats1c", 0x05b8 },
+	{ "dneighthblock", 0x2581 },
+	{ "Raarmenian", 0x054c },
+	{ "floorright", 0x230b },
+	{ "kahook", 0x04c4 },
+	{ "yen", 0x00a5 },
+	{ "tthagurmukhi", 0x0a20 },
+	{ "afii10068.ital", 0xf6c4 },
+	{ "fivegujarati", 0x0aeb },
+	{ "icaron", 0x01d0 },
+	{ "macronmodifier", 0x02c9 },
+	{ "epsilonlatinrev", 0x025c },
+	{ "tikatakanahalfwidth", 0xff81 },
+	{ "Endescendercyrillic", 0x04a2 },
+	{ "itildebelow", 0x1e2d },
+	{ "bagurmukhi", 0x0a2c },
+	{ "rightthreearrows", 0x21f6 },
+	{ "geomequivalent", 0x224e },
+	{ "Ksicyrillic", 0x046e },
+	{ "afii57454", 0x064e },
+	{ "zero.oldstyle", 0xf730 },
+	{ "fivemonospace", 0xff15 },
+	{ "aspercircumflex", 0x1fdf },
+	{ "vtltlefthvform", 0x2525 },
+	{ "Omegalenistilde", 0x1f6e },
+	{ "lat", 0x2aab },
+	{ "gravemodifier", 0x02cb },
+	{ "Ljecyrillic", 0x0409 },
+	{ "submult", 0x2ac1 },
+	{ "Cheleftdes", 0x04cb },
+	{ "Lacute.small", 0xf68a },
+	{ "Adieresismacron", 0x01de },
+	{ "udieresiscyrillic", 0x04f1 },
+	{ "Odblgrave", 0x020c },
+	{ "tildedoublecmb", 0x0360 },
+	{ "chbopomofo", 0x3114 },
+	{ "vavdbl", 0x05f0 },
+	{ "angstrom", 0x212b },
+	{ "Encyrillic", 0x041d },
+	{ "sosuathai", 0x0e2a },
+	{ "omegaiotasubaspergrave", 0x1fa3 },
+	{ "clickdental", 0x01c0 },
+	{ "stixEE81", 0xee81 },
+	{ "iluyhebrew", 0x05ac },
+	{ "voicediterationhiragana", 0x309e },
+	{ "five.oldstyle", 0xf735 },
+	{ "BorderLower1", 0x2581 },
+	{ "hatafsegolhebrew", 0x05b1 },
+	{ "aubengali", 0x0994 },
+	{ "napostrophe", 0x0149 },
+	{ "caroncmb", 0x030c },
+	{ "forwarddiagonal", 0x2571 },
+	{ "reflexsubset", 0x2286 },
+	{ "Oogonekmacron", 0x01ec },
+	{ "zahmedialarabic", 0xfec8 },
+	{ "greaterequivlnt", 0x2273 },
+	{ "u.sc", 0xf775 },
+	{ "questiondown.cap", 0xf6b5 },
+	{ "overscorenosp", 0x0305 },
+	{ "dnhvuphorizltform", 0x2541 },
+	{ "nineperiod", 0x2490 },
+	{ "spadesuitwhite", 0x2664 },
+	{ "masquare", 0x3383 },
+	{ "Dcaron.small", 0xf675 },
+	{ "patah11", 0x05b7 },
+	{ "sevenideographicparen", 0x3226 },
+	{ "notowner", 0x220c },
+	{ "stixEE12", 0xee12 },
+	{ "Neptune", 0x2646 },
+	{ "numbersign", 0x0023 },
+	{ "ekatakanahalfwidth", 0xff74 },
+	{ "mu.greek", 0x03bc },
+	{ "afii10101", 0x0454 },
+	{ "titlocyrilliccmb", 0x0483 },
+	{ "DD021", 0x2581 },
+	{ "kafrafehebrew", 0xfb4d },
+	{ "harpoonupright", 0x21be },
+	{ "eightmonospace", 0xff18 },
+	{ "a175", 0x27a5 },
+	{ "fourdeva", 0x096a },
+	{ "Wacute", 0x1e82 },
+	{ "Idieresisacute", 0x1e2e },
+	{ "squaremil", 0x33d5 },
+	{ "chadeva", 0x091b },
+	{ "uni2A0B.uplgdisplay", 0xea57 },
+	{ "Upsilondieresissmall", 0xf51a },
+	{ "ocircle", 0x24de },
+	{ "stixEE5F", 0xee5f },
+	{ "Libra", 0x264e },
+	{ "candrabinducmb", 0x0310 },
+	{ "Racute", 0x0154 },
+	{ "o.sc", 0xf76f },
+	{ "quotedblprime", 0x301e },
+	{ "eightpersian", 0x06f8 },
+	{ "afii10048", 0x042e },
+	{ "nottriangeqlright", 0x22ed },
+	{ "a104", 0x2764 },
+	{ "Oharmenian", 0x0555 },
+	{ "ltdashquadhorizform", 0x2508 },
+	{ "apostropherev", 0x02bd },
+	{ "SF160000", 0x2593 },
+	{ "Sevenroman", 0x2166 },
+	{ "hahfinalarabic", 0xfea2 },
+	{ "afii10074", 0x0438 },
+	{ "uni22DE0338", 0xed7c },
+	{ "En", 0x041d },
+	{ "enhookcyrillic", 0x04c8 },
+	{ "zaqefgadolhebrew", 0x0595 },
+	{ "sixgurmukhi", 0x0a6c },
+	{ "ceilingleft", 0x2308 },
+	{ "uni224520D2", 0xed52 },
+	{ "tableftright", 0x21b9 },
+	{ "uni2AA120D2", 0xe2c9 },
+	{ "commaturnsupnosp", 0x0312 },
+	{ "chochangthai", 0x0e0a },
+	{ "Hbrevebelow", 0x1e2a },
+	{ "ideographiccentrecircle", 0x32a5 },
+	{ "usmallkatakana", 0x30a5 },
+	{ "sheqel", 0x20aa },
+	{ "controlFF", 0x000c },
+	{ "meemarabic", 0x0645 },
+	{ "a129", 0x2469 },
+	{ "Wgrave.small", 0xf6a8 },
+	{ "a183", 0x27b2 },
+	{ "a76", 0x25b2 },
+	{ "uni2A12.lgdisplay", 0xe397 },
+	{ "multicloseleft", 0x22c9 },
+	{ "sixperiod", 0x248d },
+	{ "Ihacek", 0x01cf },
+	{ "rightfishtail", 0x297d },
+	{ "quoteleftreversed", 0x201b },
+	{ "uni220A0338", 0xe3bc },
+	{ "linevertsub", 0x02cc },
+	{ "tahinitialarabic", 0xfec3 },
+	{ "SD630000", 0x22c5 },
+	{ "uudeva", 0x090a },
+	{ "wcircle", 0x24e6 },
+	{ "bullseye", 0x25ce },
+	{ "bNot", 0x2aed },
+	{ "stixEEB3", 0xeeb3 },
+	{ "rightarrowshortleftarrow", 0x2942 },
+	{ "ycircle", 0x24e8 },
+	{ "hmonospace", 0xff48 },
+	{ "downslopeellipsis", 0x22f1 },
+	{ "a155", 0x278f },
+	{ "betdagesh", 0xfb31 },
+	{ "nineteenperiod", 0x249a },
+	{ "stigma", 0x03db },
+	{ "Soft", 0x042c },
+	{ "parenrightinferior", 0x208e },
+	{ "Sagittarius", 0x2650 },
+	{ "sosothai", 0x0e0b },
+	{ "Otildesmall", 0xf7f5 },
+	{ "upperdothebrew", 0x05c4 },
+	{ "bokatakana", 0x30dc },
+	{ "approxident", 0x224b },
+	{ "rlongleg", 0x027c },
+	{ "arrowsemclockw", 0x21b7 },
+	{ "commareversedabovecmb", 0x0314 },
+	{ "periodcentered", 0x00b7 },
+	{ "archrightdown", 0x21b7 },
+	{ "tetsecyrillic", 0x04b5 },
+	{ "ideographicstudyparen", 0x323b },
+	{ "Rcaron", 0x0158 },
+	{ "shcha", 0x0449 },
+	{ "alphaasper", 0x1f01 },
+	{ "multicloseright", 0x22ca },
+	{ "pukatakana", 0x30d7 },
+	{ "mumsquare", 0x339b },
+	{ "nwsquare", 0x33bb },
+	{ "sdotaccent", 0x1e61 },
+	{ "f_f", 0xfb00 },
+	{ "linefeed", 0x240a },
+	{ "period", 0x002e },
+	{ "divisionslash", 0x2215 },
+	{ "Capricorn", 0x2651 },
+	{ "fiveparen", 0x2478 },
+	{ "tehiragana", 0x3066 },
+	{ "postalmarkface", 0x3020 },
+	{ "cheleftdes", 0x04cc },
+	{ "dnhorizdblform", 0x2564 },
+	{ "Ezh", 0x01b7 },
+	{ "alphalenistilde", 0x1f06 },
+	{ "alefmaksurainitialarabic", 0xfef3 },
+	{ "shagujarati", 0x0ab6 },
+	{ "dialytikavaria", 0x1fed },
+	{ "beth", 0x2136 },
+	{ "Ccircle", 0x24b8 },
+	{ "abreve", 0x0103 },
+	{ "ekorean", 0x3154 },
+	{ "a96", 0x2775 },
+	{ "circleasterisk", 0x229b },
+	{ "sioskiyeokkorean", 0x317a },
+	{ "parenrightsmall", 0xfe5a },
+	{ "acutelowmod", 0x02cf },
+	{ "pieupparenkorean", 0x3205 },
+	{ "aigurmukhi", 0x0a10 },
+	{ "sfthyphen", 0x00ad },
+	{ "stixEE95", 0xee95 },
+	{ "gimelmath", 0x2137 },
+	{ "ukatakana", 0x30a6 },
+	{ "kiyeokparenkorean", 0x3200 },
+	{ "controlETX", 0x0003 },
+	{ "wakatakana", 0x30ef },
+	{ "AEmacron", 0x01e2 },
+	{ "Sc", 0x2abc },
+	{ "siluqhebrew", 0x05bd },
+	{ "threebengali", 0x09e9 },
+	{ "notpropersuperset", 0x2285 },
+	{ "bridgeinvertedbelowcmb", 0x033a },
+	{ "te.ital", 0xf6c8 },
+	{ "stixEE02", 0xee02 },
+	{ "dblvertleftform", 0x2563 },
+	{ "p.sc", 0xf770 },
+	{ "aavowelsigngujarati", 0x0abe },
+	{ "rrvocalicgujarati", 0x0ae0 },
+	{ "devcon3", 0x2413 },
+	{ "y.sc", 0xf779 },
+	{ "dblanglebracketleftvertical", 0xfe3d },
+	{ "solidusshortoverlaycmb", 0x0337 },
+	{ "aagurmukhi", 0x0a06 },
+	{ "saraueethai", 0x0e37 },
+	{ "rupiah", 0xf6dd },
+	{ "escedilla", 0x04ab },
+	{ "propellor", 0x2318 },
+	{ "nacute", 0x0144 },
+	{ "dei", 0x03ef },
+	{ "harpoondownleft", 0x21c3 },
+	{ "stixEE9C", 0xee9c },
+	{ "thirteencircle", 0x246c },
+	{ "Cedilla", 0xeff2 },
+	{ "Upsilonhooksymbol", 0x03d2 },
+	{ "gsiml", 0x2a90 },
+	{ "longleftzigzagarrow", 0x21dc },
+	{ "qubuts31", 0x05bb },
+	{ "Hzsquare", 0x3390 },
+	{ "geresh", 0x05f3 },
+	{ "guhiragana", 0x3050 },
+	{ "ttehfinalarabic", 0xfb67 },
+	{ "dblgrave", 0xf6d6 },
+	{ "Wcircumflex.small", 0xf6a6 },
+	{ "coarmenian", 0x0581 },
+	{ "mahapakhhebrew", 0x05a4 },
+	{ "lessnotequivlnt", 0x22e6 },
+	{ "omicronacute", 0x1f79 },
+	{ "two.superior", 0x00b2 },
+	{ "newsheqelsign", 0x20aa },
+	{ "afii57718_afii57798", 0xfb1f },
+	{ "fehfinalarabic", 0xfed2 },
+	{ "dadeva", 0x0926 },
+	{ "kadescendercyrillic", 0x049b },
+	{ "khhadeva", 0x0959 },
+	{ "fi", 0xfb01 },
+	{ "comma.inferior", 0xf6e1 },
+	{ "ieungcirclekorean", 0x3267 },
+	{ "bdotaccent", 0x1e03 },
+	{ "uprise", 0x22cf },
+	{ "tethebrew", 0x05d8 },
+	{ "dodekthai", 0x0e14 },
+	{ "dbluprtform", 0x255a },
+	{ "ydieresis.sc", 0xf7ff },
+	{ "theta1", 0x03d1 },
+	{ "divides", 0x2223 },
+	{ "hyphen.numerator", 0xf630 },
+	{ "oharmenian", 0x0585 },
+	{ "omegalatinclosed", 0x0277 },
+	{ "hehhamzaabovefinalarabic", 0xfba5 },
+	{ "uni025B02DE", 0xe645 },
+	{ "gafinitialarabic", 0xfb94 },
+	{ "csub", 0x2acf },
+	{ "Sdotbelowdotaccent", 0x1e68 },
+	{ "a171", 0x27a0 },
+	{ "Etaiotasubasperacute", 0x1f9d },
+	{ "sarauuthai", 0x0e39 },
+	{ "omegalenisacute", 0x1f64 },
+	{ "notturnstile", 0x22ac },
+	{ "sixteencircle", 0x246f },
+	{ "heiseierasquare", 0x337b },
+	{ "wohiragana", 0x3092 },
+	{ "alphaiotasubgrave", 0x1fb2 },
+	{ "zparen", 0x24b5 },
+	{ "overlinewavy", 0xfe4b },
+	{ "nieuncieuckorean", 0x3135 },
+	{ "Circumflex", 0xeff7 },
+	{ "clockwise", 0x21bb },
+	{ "Betasmall", 0xf501 },
+	{ "ltcir", 0x2a79 },
+	{ "caron.sc", 0xf6f5 },
+	{ "vavdageshhebrew", 0xfb35 },
+	{ "hardsigncyrillic", 0x044a },
+	{ "iogonek", 0x012f },
+	{ "pipedbl", 0x01c1 },
+	{ "stixEE1C", 0xee1c },
+	{ "squareminus", 0x229f },
+	{ "uni224820D2", 0xe2c6 },
+	{ "Edblgrave", 0x0204 },
+	{ "a95", 0x2774 },
+	{ "omdeva", 0x0950 },
+	{ "uni2034.notsup", 0xea4b },
+	{ "slurbelow", 0x2323 },
+	{ "gakatakana", 0x30ac },
+	{ "dcroat", 0x0111 },
+	{ "geometricallyequal", 0x2251 },
+	{ "a141", 0x2781 },
+	{ "kbopomofo", 0x310e },
+	{ "afii10081.ital", 0xf6c7 },
+	{ "Ostrokeacute", 0x01fe },
+	{ "nlftlfthook", 0x0272 },
+	{ "Ycircle", 0x24ce },
+	{ "uogonek", 0x0173 },
+	{ "soliduslongoverlaycmb", 0x0338 },
+	{ "afii57422", 0x062e },
+	{ "Agravesmall", 0xf7e0 },
+	{ "ovowelsigndeva", 0x094b },
+	{ "Phook", 0x01a4 },
+	{ "Vecyrillic", 0x0412 },
+	{ "epsilonlenisgrave", 0x1f12 },
+	{ "kikatakanahalfwidth", 0xff77 },
+	{ "yamakkanthai", 0x0e4e },
+	{ "cent.numerator", 0xf62e },
+	{ "eighteenperiod", 0x2499 },
+	{ "wowaenthai", 0x0e27 },
+	{ "commasmall", 0xfe50 },
+	{ "allequal", 0x224c },
+	{ "lsimg", 0x2a8f },
+	{ "squareupperrighttolowerleftfill", 0x25a8 },
+	{ "tserequarterhebrew", 0x05b5 },
+	{ "Qcircle", 0x24c6 },
+	{ "ddhagujarati", 0x0aa2 },
+	{ "segolquarterhebrew", 0x05b6 },
+	{ "iotasub", 0x037a },
+	{ "primereverse", 0x2035 },
+	{ "alphaiotasubcircumflex", 0x1fb7 },
+	{ "siostikeutkorean", 0x317c },
+	{ "Elevenroman", 0x216a },
+	{ "seveninferior", 0x2087 },
+	{ "mhook", 0x0271 },
+	{ "Tshe", 0x040b },
+	{ "yinyang", 0x262f },
+	{ "starttext", 0x2402 },
+	{ "Omegaasperacute", 0x1f6d },
+	{ "uni2229FE00", 0xe275 },
+	{ "subrarr", 0x2979 },
+	{ "minusbelowcmb", 0x0320 },
+	{ "Epsilonlenisacute", 0x1f1c },
+	{ "alphaiota.sc", 0xf51b },
+	{ "Ygrave", 0x1ef2 },
+	{ "DD013", 0x258f },
+	{ "rcedilla", 0x0157 },
+	{ "clubsuitblack", 0x2663 },
+	{ "dotlessj", 0x0237 },
+	{ "a174", 0x27a4 },
+	{ "musicsharpsign", 0x266f },
+	{ "tsadidagesh", 0xfb46 },
+	{ "patah2a", 0x05b7 },
+	{ "stixEE61", 0xee61 },
+	{ "g.sc", 0xf767 },
+	{ "Yiarmenian", 0x0545 },
+	{ "Adieresiscyrillic", 0x04d2 },
+	{ "yosmallkatakanahalfwidth", 0xff6e },
+	{ "alphaiotasublenisacute", 0x1f84 },
+	{ "hypheninferior", 0xf6e5 },
+	{ "t", 0x0074 },
+	{ "dammaarabic", 0x064f },
+	{ "bsuperior", 0xf6ea },
+	{ "three.superior", 0x00b3 },
+	{ "ninehackarabic", 0x0669 },
+	{ "shindothebrew", 0x05c1 },
+	{ "betdageshhebrew", 0xfb31 },
+	{ "ypogegrammeni", 0x037a },
+	{ "Upsilonsmall", 0xf514 },
+	{ "delete", 0x2421 },
+	{ "a193", 0x27aa },
+	{ "afii57457", 0x0651 },
+	{ "wikorean", 0x315f },
+	{ "SS270000", 0x2321 },
+	{ "length", 0x02d0 },
+	{ "Oopen", 0x0186 },
+	{ "dadmedialarabic", 0xfec0 },
+	{ "gmacron", 0x1e21 },
+	{ "sevencircleinversesansserif", 0x2790 },
+	{ "arrowtailleft", 0x21a2 },
+	{ "H", 0x0048 },
+	{ "tipehahebrew", 0x0596 },
+	{ "Uogonek.small", 0xf6a2 },
+	{ "bagujarati", 0x0aac },
+	{ "a1", 0x2701 },
+	{ "etalenis", 0x1f20 },
+	{ "taisyouerasquare", 0x337d },
+	{ "psili_perispomeni", 0x1fcf },
+	{ "approximatelyequal", 0x2245 },
+	{ "uni227D20D2", 0xed79 },
+	{ "Sampi", 0x03e0 },
+	{ "Gdotaccent.small", 0xf680 },
+	{ "zeroslash", 0xf638 },
+	{ "rightdbkarrow", 0xe207 },
+	{ "Djecyrillic", 0x0402 },
+	{ "molsquare", 0x33d6 },
+	{ "a7", 0x271e },
+	{ "six.taboldstyle", 0xf649 },
+	{ "uni2A10.uplgdisplay", 0xe395 },
+	{ "Otcyrillic", 0x047e },
+	{ "eturn", 0x01dd },
+	{ "thonangmonthothai", 0x0e11 },
+	{ "union", 0x222a },
+	{ "zahiragana", 0x3056 },
+	{ "esh", 0x0283 },
+	{ "arrowlongboth", 0x2194 },
+	{ "hyphen.denominator", 0xf62b },
+	{ "viramadeva", 0x094d },
+	{ "zeroarabic", 0x0660 },
+	{ "n.superior", 0x207f },
+	{ "H18533", 0x25cf },
+	{ "arrowupleftofdown", 0x21c5 },
+	{ "omegagrave", 0x1f7c },
+	{ "Adieresis", 0x00c4 },
+	{ "uni2A15.uplgdisplay", 0xe376 },
+	{ "uni2A950338", 0xed64 },
+	{ "etaiotasublenistilde", 0x1f96 },
+	{ "nieunparenkorean", 0x3201 },
+	{ "afii57512", 0x0688 },
+	{ "Gamma", 0x0393 },
+	{ "Zhebrevecyrillic", 0x04c1 },
+	{ "sixmonospace", 0xff16 },
+	{ "uni2192.short", 0xe232 },
+	{ "commaaccent.cap", 0xf634 },
+	{ "Ocyril", 0x041e },
+	{ "uni220D0338", 0xe36d },
+	{ "afii10029", 0x041b },
+	{ "sixbengali", 0x09ec },
+	{ "bracelefttp", 0xf8f1 },
+	{ "quotedblrev", 0x201f },
+	{ "Kenarmenian", 0x053f },
+	{ "nineparen", 0x247c },
+	{ "Alphamacron", 0x1fb9 },
+	{ "vbrtri", 0x29d0 },
+	{ "Ycircumflex.small", 0xf6a9 },
+	{ "onebengali", 0x09e7 },
+	{ "notelementof", 0x2209 },
+	{ "blinebelow", 0x1e07 },
+	{ "xor", 0x22bb },
+	{ "rightarrowapprox", 0x2975 },
+	{ "notdblarrowleft", 0x21cd },
+	{ "ideographiczero", 0x3007 },
+	{ "tccurl", 0x02a8 },
+	{ "hehinitialaltonearabic", 0xfba8 },
+	{ "notreflexsuperset", 0x2289 },
+	{ "Nhook", 0x019d },
+	{ "mahiragana", 0x307e },
+	{ "hvdashtripvertform", 0x2507 },
+	{ "tahiragana", 0x305f },
+	{ "arrowup", 0x2191 },
+	{ "Ydotaccent", 0x1e8e },
+	{ "dzcurl", 0x02a5 },
+	{ "gimeldagesh", 0xfb32 },
+	{ "Yeru", 0x042b },
+	{ "Zecyrillic", 0x0417 },
+	{ "vertdblhorizform", 0x256b },
+	{ "sun", 0x263c },
+	{ "afii57421", 0x062d },
+	{ "sevenhackarabic", 0x0667 },
+	{ "acyril", 0x0430 },
+	{ "saraaathai", 0x0e32 },
+	{ "minussubnosp", 0x0320 },
+	{ "Alphalenisgrave", 0x1f0a },
+	{ "ovowelsignbengali", 0x09cb },
+	{ "florin", 0x0192 },
+	{ "dmacron", 0x0111 },
+	{ "mars", 0x2642 },
+	{ "vcircle", 0x24e5 },
+	{ "uni220B20D2", 0xe36c },
+	{ "st", 0xfb06 },
+	{ "F", 0x0046 },
+	{ "rlonglegturned", 0x027a },
+	{ "Kmonospace", 0xff2b },
+	{ "upsilonasper", 0x1f51 },
+	{ "onefitted", 0xf6dc },
+	{ "Z", 0x005a },
+	{ "arrowsouthwest", 0x2199 },
+	{ "approxorequal", 0x2245 },
+	{ "izhitsadblgravecyrillic", 0x0477 },
+	{ "shindageshhebrew", 0xfb49 },
+	{ "G", 0x0047 },
+	{ "ecircumflexbelow", 0x1e19 },
+	{ "escape", 0x241b },
+	{ "ltupleftform", 0x2518 },
+	{ "fourcircle", 0x2463 },
+	{ "omegaclosed", 0x0277 },
+	{ "lenisgrave", 0x1fcd },
+	{ "pieupkorean", 0x3142 },
+	{ "chekhakassiancyrillic", 0x04cc },
+	{ "yenmonospace", 0xffe5 },
+	{ "gehook", 0x0495 },
+	{ "parenright.numerator", 0xf632 },
+	{ "Dcedilla", 0x1e10 },
+	{ "Venus", 0x2640 },
+	{ "ivowelsigndeva", 0x093f },
+	{ "z", 0x007a },
+	{ "glottal", 0x02c0 },
+	{ "five", 0x0035 },
+	{ "Esh", 0x01a9 },
+	{ "stixEE3D", 0xee3d },
+	{ "eth.sc", 0xf7f0 },
+	{ "ecircle", 0x24d4 },
+	{ "hamzalowarabic", 0x0621 },
+	{ "nieunaparenkorean", 0x320f },
+	{ "registerserif", 0xf6da },
+	{ "glottalrev", 0x02c1 },
+	{ "gesdot", 0x2a80 },
+	{ "Beta", 0x0392 },
+	{ "upsilondieresis", 0x03cb },
+	{ "twopersian", 0x06f2 },
+	{ "centsuperior", 0xf6e0 },
+	{ "udieresisacute", 0x01d8 },
+	{ "Iocyrillic", 0x0401 },
+	{ "anudattadeva", 0x0952 },
+	{ "graveleftnosp", 0x0340 },
+	{ "dnltrthvform", 0x250d },
+	{ "thetasymbolgreek", 0x03d1 },
+	{ "suhiragana", 0x3059 },
+	{ "equalfollows", 0x22df },
+	{ "percent", 0x0025 },
+	{ "rthvleftupltform", 0x2536 },
+	{ "hard", 0x044a },
+	{ "hvdnrtform", 0x250f },
+	{ "tevirhebrew", 0x059b },
+	{ "hatafqamatswidehebrew", 0x05b3 },
+	{ "ae.sc", 0xf7e6 },
+	{ "ii", 0x0438 },
+	{ "uni2A7D20D2", 0xed60 },
+	{ "uni2A9EFE00", 0xed73 },
+	{ "emphasismarkarmenian", 0x055b },
+	{ "eightthai", 0x0e58 },
+	{ "fivesuperior", 0x2075 },
+	{ "kappasymbolgreek", 0x03f0 },
+	{ "Scaronsmall", 0xf6fd },
+	{ "hikatakanahalfwidth", 0xff8b },
+	{ "soft", 0x044c },
+	{ "tippigurmukhi", 0x0a70 },
+	{ "carriagerreturn", 0x21b5 },
+	{ "uni2AFD20E5", 0xe389 },
+	{ "oneeighth", 0x215b },
+	{ "tetdagesh", 0xfb38 },
+	{ "braceleftsmall", 0xfe5b },
+	{ "nikhahitthai", 0x0e4d },
+	{ "Gravesmall", 0xf760 },
+	{ "Alphaiotasub", 0x1fbc },
+	{ "minus", 0x2212 },
+	{ "four.inferior", 0x2084 },
+	{ "a.sc", 0xf761 },
+	{ "ibopomofo", 0x3127 },
+	{ "nineteenparen", 0x2486 },
+	{ "kokaithai", 0x0e01 },
+	{ "omega1", 0x03d6 },
+	{ "lescc", 0x2aa8 },
+	{ "aumatragurmukhi", 0x0a4c },
+	{ "jmonospace", 0xff4a },
+	{ "rehiragana", 0x308c },
+	{ "Lcaron.small", 0xf68b },
+	{ "tukatakana", 0x30c4 },
+	{ "numbersignsmall", 0xfe5f },
+	{ "stixEE36", 0xee36 },
+	{ "kiss", 0x0298 },
+	{ "strokelongoverlaycmb", 0x0336 },
+	{ "precedeornoteqvlnt", 0x22e8 },
+	{ "twentycircle", 0x2473 },
+	{ "Egravesmall", 0xf7e8 },
+	{ "ndotaccent", 0x1e45 },
+	{ "stixEE79", 0xee79 },
+	{ "colon", 0x003a },
+	{ "Qsmall", 0xf771 },
+	{ "arrowopenleft", 0x21e6 },
+	{ "zekatakana", 0x30bc },
+	{ "hekatakanahalfwidth", 0xff8d },
+	{ "siosacirclekorean", 0x3274 },
+	{ "yodyodpatahhebrew", 0xfb1f },
+	{ "fraction1", 0x2215 },
+	{ "icircumflex", 0x00ee },
+	{ "exclam", 0x0021 },
+	{ "Alphaiotasublenistilde", 0x1f8e },
+	{ "eightdeva", 0x096e },
+	{ "three", 0x0033 },
+	{ "schwacyrillic", 0x04d9 },
+	{ "EnGe", 0x04a4 },
+	{ "afii57434", 0x063a },
+	{ "updownharpoonrightleft", 0x294c },
+	{ "Yerudieresiscyrillic", 0x04f8 },
+	{ "stixEE7A", 0xee7a },
+	{ "a106", 0x2765 },
+	{ "jdotlessbar", 0x025f },
+	{ "afii10024", 0x0416 },
+	{ "i.short", 0x0439 },
+	{ "afii57694", 0xfb2a },
+	{ "Aacute", 0x00c1 },
+	{ "circledivide", 0x2298 },
+	{ "vertrectangle", 0x25af },
+	{ "etildebelow", 0x1e1b },
+	{ "quotedblright", 0x201d },
+	{ "afii57695", 0xfb2b },
+	{ "sixhangzhou", 0x3026 },
+	{ "mussquare", 0x33b2 },
+	{ "dbloverlinecmb", 0x033f },
+	{ "ltshade", 0x2591 },
+	{ "tortoiseshellbracketrightsmall", 0xfe5e },
+	{ "DZhacek", 0x01c4 },
+	{ "bracketleftbt", 0xf8f0 },
+	{ "coverkgsquare", 0x33c6 },
+	{ "bardownharpoonleft", 0x2961 },
+	{ "afii10097", 0x044f },
+	{ "edotaccent", 0x0117 },
+	{ "dashdbl", 0x2016 },
+	{ "ismallkatakana", 0x30a3 },
+	{ "leftdbltail", 0x291b },
+	{ "Idotbelow", 0x1eca },
+	{ "tenperiod", 0x2491 },
+	{ "zerospace", 0x200b },
+	{ "onehackarabic", 0x0661 },
+	{ "Scommaaccent", 0x0218 },
+	{ "ideographwatercircle", 0x328c },
+	{ "osmallkatakanahalfwidth", 0xff6b },
+	{ "Ghemiddlehookcyrillic", 0x0494 },
+	{ "tabengali", 0x09a4 },
+	{ "shchacyrillic", 0x0449 },
+	{ "macronmonospace", 0xffe3 },
+	{ "yohiragana", 0x3088 },
+	{ "Alphaiotasubaspertilde", 0x1f8f },
+	{ "magurmukhi", 0x0a2e },
+	{ "logicalor", 0x2228 },
+	{ "space_uni0308_uni0301", 0xf6d7 },
+	{ "Fita", 0x0472 },
+	{ "ecircumflexhookabove", 0x1ec3 },
+	{ "less", 0x003c },
+	{ "asciitilde", 0x007e },
+	{ "commaabovecmb", 0x0313 },
+	{ "gtrarr", 0x2978 },
+	{ "ezhcaron", 0x01ef },
+	{ "tehmarbutaarabic", 0x0629 },
+	{ "equaldotleftright", 0x2252 },
+	{ "H18543", 0x25aa },
+	{ "mabengali", 0x09ae },
+	{ "Ubreve.small", 0xf69f },
+	{ "congruent", 0x2245 },
+	{ "Ocircumflex", 0x00d4 },
+	{ "heharabic", 0x0647 },
+	{ "curlyright", 0x21ac },
+	{ "pabengali", 0x09aa },
+	{ "Dz", 0x01f2 },
+	{ "noonmeeminitialarabic", 0xfcd5 },
+	{ "braceleftmonospace", 0xff5b },
+	{ "a196", 0x2798 },
+	{ "eopenclosed", 0x029a },
+	{ "Yusbigiotifiedcyrillic", 0x046c },
+	{ "arrowright", 0x2192 },
+	{ "ideographicspace", 0x3000 },
+	{ "gravecomb", 0x0300 },
+	{ "Yiwnarmenian", 0x0552 },
+	{ "seagullsubnosp", 0x033c },
+	{ "blacklenticularbracketleft", 0x3010 },
+	{ "afii10022", 0x0415 },
+	{ "hieuhkorean", 0x314e },
+	{ "jis", 0x3004 },
+	{ "rcircle", 0x24e1 },
+	{ "fongmanthai", 0x0e4f },
+	{ "ohornhookabove", 0x1edf },
+	{ "totaothai", 0x0e15 },
+	{ "upsilontilde", 0x1fe6 },
+	{ "rsuperior", 0xf6f1 },
+	{ "semivoicedmarkkana", 0x309c },
+	{ "Eth", 0x00d0 },
+	{ "gammalatinsmall", 0x0263 },
+	{ "etacircumflex", 0x1fc6 },
+	{ "Racute.small", 0xf695 },
+	{ "daleth", 0x2138 },
+	{ "equiangular", 0x225a },
+	{ "pfsquare", 0x338a },
+	{ "gaffinalarabic", 0xfb93 },
+	{ "wavedash", 0x301c },
+	{ "Omacronacute", 0x1e52 },
+	{ "siosaparenkorean", 0x3214 },
+	{ "nasquare", 0x3381 },
+	{ "ideographicexcellentcircle", 0x329d },
+	{ "irigurmukhi", 0x0a72 },
+	{ "sikatakanahalfwidth", 0xff7c },
+	{ "lbar", 0x019a },
+	{ "mwsquare", 0x33bd },
+	{ "period.inferior", 0xf6e7 },
+	{ "stixEE3B", 0xee3b },
+	{ "odeva", 0x0913 },
+	{ "tevirlefthebrew", 0x059b },
+	{ "therefore", 0x2234 },
+	{ "lhookretroflex", 0x026d },
+	{ "smonospace", 0xff53 },
+	{ "phophungthai", 0x0e1c },
+	{ "Dsmall", 0xf764 },
+	{ "dochadathai", 0x0e0e },
+	{ "Chaarmenian", 0x0549 },
+	{ "dasia_perispomeni", 0x1fdf },
+	{ "a158", 0x2792 },
+	{ "Ocircumflexsmall", 0xf7f4 },
+	{ "eqdef", 0x225d },
+	{ "aagujarati", 0x0a86 },
+	{ "Ezhcaron", 0x01ee },
+	{ "zaqefqatanhebrew", 0x0594 },
+	{ "uni2A960338", 0xed65 },
+	{ "I.cyr", 0x0418 },
+	{ "Omicrongrave", 0x1ff8 },
+	{ "Ecyrillic", 0x0404 },
+	{ "tackupsubnosp", 0x031d },
+	{ "dsol", 0x29f6 },
+	{ "SF090000", 0x2524 },
+	{ "peezisquare", 0x333b },
+	{ "Digraphuk", 0x0478 },
+	{ "Utilde", 0x0168 },
+	{ "dollarsuperior", 0xf6e4 },
+	{ "ucircumflex", 0x00fb },
+	{ "SF210000", 0x2556 },
+	{ "wonmonospace", 0xffe6 },
+	{ "etaiotasubleniscircumflex", 0x1f96 },
+	{ "hvdashdblhorizform", 0x254d },
+	{ "sihiragana", 0x3057 },
+	{ "ebopomofo", 0x311c },
+	{ "figuredash", 0x2012 },
+	{ "squarecm", 0x339d },
+	{ "kukatakana", 0x30af },
+	{ "a119", 0x2707 },
+	{ "hatafsegol30", 0x05b1 },
+	{ "etalenisacute", 0x1f24 },
+	{ "cparen", 0x249e },
+	{ "kappa.alt", 0x03f0 },
+	{ "fifteenperiod", 0x2496 },
+	{ "brokenbar", 0x00a6 },
+	{ "compass", 0x263c },
+	{ "bbar", 0x0180 },
+	{ "sikatakana", 0x30b7 },
+	{ "xsuper", 0x02e3 },
+	{ "DD105", 0x258f },
+	{ "sukunarabic", 0x0652 },
+	{ "hbrevebelow", 0x1e2b },
+	{ "stixEEC5", 0xeec5 },
+	{ "sarauthai", 0x0e38 },
+	{ "uni227C20D2", 0xed78 },
+	{ "lameddagesh", 0xfb3c },
+	{ "BorderULCorner1", 0x231c },
+	{ "exclammonospace", 0xff01 },
+	{ "stixEE71", 0xee71 },
+	{ "Ia", 0x042f },
+	{ "notapproxequal", 0x2247 },
+	{ "fourmonospace", 0xff14 },
+	{ "boxhorizhatch", 0x25a4 },
+	{ "Udblgrave", 0x0214 },
+	{ "currency", 0x00a4 },
+	{ "numeralsigngreek", 0x0374 },
+	{ "followsorequal", 0x227d },
+	{ "fisheye", 0x25c9 },
+	{ "Omegatitlo", 0x047c },
+	{ "gravecmb", 0x0300 },
+	{ "cyrBreve", 0xf6d1 },
+	{ "ninegurmukhi", 0x0a6f },
+	{ "equivasymptotic", 0x224d },
+	{ "stixEEC3", 0xeec3 },
+	{ "Izhitsacyrillic", 0x0474 },
+	{ "mirisquare", 0x3349 },
+	{ "circumflex.cyrcap", 0xf6d2 },
+	{ "uni2AB00338", 0xe5f1 },
+	{ "uni22F60338", 0xed32 },
+	{ "gravedblnosp", 0x030f },
+	{ "pieupacirclekorean", 0x3273 },
+	{ "whitetortoiseshellbracketleft", 0x3018 },
+	{ "subsetnoteql", 0x228a },
+	{ "quoteleftmod", 0x02bb },
+	{ "defines", 0x225c },
+	{ "greaterorsimilar", 0x2273 },
+	{ "greaternotequivlnt", 0x22e7 },
+	{ "updblhorizform", 0x2568 },
+	{ "uni2AC520D2", 0xed82 },
+	{ "mansyonsquare", 0x3347 },
+	{ "qubuts25", 0x05bb },
+	{ "Dtopbar", 0x018b },
+	{ "noonnoonfinalarabic", 0xfc8d },
+	{ "uni220820D2", 0xe370 },
+	{ "yuslittlecyrillic", 0x0467 },
+	{ "afii10075", 0x0439 },
+	{ "Shchacyrillic", 0x0429 },
+	{ "seven.oldstyle", 0xf737 },
+	{ "SM630000", 0x25c0 },
+	{ "Epsilonlenis", 0x1f18 },
+	{ "gcircumflex", 0x011d },
+	{ "otcyrillic", 0x047f },
+	{ "uni22D90338", 0xe2ce },
+	{ "unionsq", 0x2294 },
+	{ "Ksmall", 0xf76b },
+	{ "yaekorean", 0x3152 },
+	{ "tikatakana", 0x30c1 },
+	{ "Uhorntilde", 0x1eee },
+	{ "stixEE5E", 0xee5e },
+	{ "four.superior", 0x2074 },
+	{ "Omegaiotasublenistilde", 0x1fae },
+	{ "overscore", 0x00af },
+	{ "sheva22", 0x05b0 },
+	{ "e.cyr", 0x044d },
+	{ "thousandsseparatorarabic", 0x066c },
+	{ "iigujarati", 0x0a88 },
+	{ "tretroflexhook", 0x0288 },
+	{ "zrthook", 0x0290 },
+	{ "afii10047", 0x042d },
+	{ "threepersian", 0x06f3 },
+	{ "kakatakana", 0x30ab },
+	{ "merkhahebrew", 0x05a5 },
+	{ "Omicronlenisgrave", 0x1f4a },
+	{ "lesges", 0x2a93 },
+	{ "wdotbelow", 0x1e89 },
+	{ "dialytikatonoscmb", 0x0344 },
+	{ "hatafpatahwidehebrew", 0x05b2 },
+	{ "SF530000", 0x256b },
+	{ "notsuperset", 0x2285 },
+	{ "afii10082", 0x0440 },
+	{ "Adiaeresis", 0x00c4 },
+	{ "ghainmedialarabic", 0xfed0 },
+	{ "parenright.cap", 0xf6af },
+	{ "sofpasuqhebrew", 0x05c3 },
+	{ "ltverthorizform", 0x253c },
+	{ "rfishhook", 0x027e },
+	{ "greaterdblequal", 0x2267 },
+	{ "Omegaaspergrave", 0x1f6b },
+	{ "degree", 0x00b0 },
+	{ "hvdnhorizform", 0x2533 },
+	{ "Idotaccent.small", 0xf6ad },
+	{ "Elcyrillic", 0x041b },
+	{ "circumflexcomb", 0x0302 },
+	{ "Piwrarmenian", 0x0553 },
+	{ "congdot", 0x2a6d },
+	{ "Nacute.small", 0xf68e },
+	{ "blacklowerlefttriangle", 0x25e3 },
+	{ "tsuperior", 0xf6f3 },
+	{ "uhorn", 0x01b0 },
+	{ "Mmonospace", 0xff2d },
+	{ "exclamsmall", 0xf721 },
+	{ "mturndescend", 0x0270 },
+	{ "zedescendercyrillic", 0x0499 },
+	{ "sioskorean", 0x3145 },
+	{ "kiyeokkorean", 0x3131 },
+	{ "periodsuperior", 0xf6e8 },
+	{ "Gangiacoptic", 0x03ea },
+	{ "meteg", 0x05bd },
+	{ "alphalenisacute", 0x1f04 },
+	{ "diamond", 0x2666 },
+	{ "nehiragana", 0x306d },
+	{ "oslash.sc", 0xf7f8 },
+	{ "afii57430", 0x0636 },
+	{ "uhungarumlautcyrillic", 0x04f3 },
+	{ "lslash", 0x0142 },
+	{ "circleequal", 0x229c },
+	{ "afii10831", 0xf6c7 },
+	{ "Zsmall", 0xf77a },
+	{ "ttehinitialarabic", 0xfb68 },
+	{ "kuhiragana", 0x304f },
+	{ "uni03300331", 0xea36 },
+	{ "esmallkatakana", 0x30a7 },
+	{ "ltarcupleftform", 0x256f },
+	{ "uni0265.superscript", 0xe3ce },
+	{ "triangle", 0x25b3 },
+	{ "lesg", 0xe32b },
+	{ "alefmaksuramedialarabic", 0xfef4 },
+	{ "Caarmenian", 0x053e },
+	{ "quoterightn", 0x0149 },
+	{ "threeinferior", 0x2083 },
+	{ "fiveperiod", 0x248c },
+	{ "rdotaccent", 0x1e59 },
+	{ "ie", 0x0435 },
+	{ "cedillacmb", 0x0327 },
+	{ "Upsilon.alt", 0x03d2 },
+	{ "uni227220D2", 0xe3be },
+	{ "zaharabic", 0x0638 },
+	{ "zerojoin", 0x200d },
+	{ "Udieresisgrave", 0x01db },
+	{ "tbar", 0x0167 },
+	{ "jbopomofo", 0x3110 },
+	{ "Xdotaccent", 0x1e8a },
+	{ "stixEE1F", 0xee1f },
+	{ "smile", 0x263a },
+	{ "uni226B0338", 0xe2cc },
+	{ "Etaiotasubaspertilde", 0x1f9f },
+	{ "stixEE83", 0xee83 },
+	{ "Ucyrillic", 0x0423 },
+	{ "te", 0x0442 },
+	{ "alphaleniscircumflex", 0x1f06 },
+	{ "udieresishacek", 0x01da },
+	{ "Otildeacute", 0x1e4c },
+	{ "udotbelow", 0x1ee5 },
+	{ "oogurmukhi", 0x0a13 },
+	{ "ytilde", 0x1ef9 },
+	{ "vakatakana", 0x30f7 },
+	{ "ideographicfireparen", 0x322b },
+	{ "lamalefhamzaabovefinalarabic", 0xfef8 },
+	{ "squiggleleftright", 0x21ad },
+	{ "Odieresiscyrillic", 0x04e6 },
+	{ "Taurus", 0x2649 },
+	{ "Diaeresis", 0xf6cb },
+	{ "alefqamatshebrew", 0xfb2f },
+	{ "verticalbar", 0x007c },
+	{ "rturned", 0x0279 },
+	{ "afii10087", 0x0445 },
+	{ "colonmonetary", 0x20a1 },
+	{ "swquadarc", 0x25df },
+	{ "Ef", 0x0424 },
+	{ "hatafpatahnarrowhebrew", 0x05b2 },
+	{ "pieupkiyeokkorean", 0x3172 },
+	{ "softsigncyrillic", 0x044c },
+	{ "dz", 0x01f3 },
+	{ "zcircumflex", 0x1e91 },
+	{ "afii57424", 0x0630 },
+	{ "bikatakana", 0x30d3 },
+	{ "pe", 0x05e4 },
+	{ "ounce", 0x2125 },
+	{ "notgreaterless", 0x2279 },
+	{ "acircumflexgrave", 0x1ea7 },
+	{ "a93", 0x276a },
+	{ "arc", 0x2312 },
+	{ "a192", 0x279a },
+	{ "adotmacron", 0x01e1 },
+	{ "nor", 0x22bd },
+	{ "hehiragana", 0x3078 },
+	{ "SF370000", 0x255f },
+	{ "hyphen", 0x002d },
+	{ "zlinebelow", 0x1e95 },
+	{ "harpoondownright", 0x21c2 },
+	{ "controlFS", 0x001c },
+	{ "logicalnot", 0x00ac },
+	{ "geomequal", 0x2251 },
+	{ "omicrongrave", 0x1f78 },
+	{ "equalorsimilar", 0x2242 },
+	{ "dnltrtuphvform", 0x2521 },
+	{ "greateroverequal", 0x2267 },
+	{ "icyril", 0x0456 },
+	{ "DD024", 0x2594 },
+	{ "fourgurmukhi", 0x0a6a },
+	{ "quotedblbase", 0x201e },
+	{ "Gt", 0x2aa2 },
+	{ "nahiragana", 0x306a },
+	{ "rsolbar", 0x29f7 },
+	{ "a85", 0x276f },
+	{ "smalltriangleinv", 0x25bf },
+	{ "betasymbolgreek", 0x03d0 },
+	{ "lyogh", 0x026e },
+	{ "Asmall", 0xf761 },
+	{ "Ocircle", 0x24c4 },
+	{ "Ibar", 0x0197 },
+	{ "Rdsh", 0x21b3 },
+	{ "oacute", 0x00f3 },
+	{ "ringlefthalfsubnosp", 0x031c },
+	{ "de.ital", 0xf6c6 },
+	{ "ddabengali", 0x09a1 },
+	{ "uni2293FE00", 0xe277 },
+	{ "vBarv", 0x2ae9 },
+	{ "estimates", 0x2259 },
+	{ "ustrtbar", 0x04b1 },
+	{ "lvocalicbengali", 0x098c },
+	{ "Acircumflextilde", 0x1eaa },
+	{ "dehihebrew", 0x05ad },
+	{ "katahiraprolongmarkhalfwidth", 0xff70 },
+	{ "pieupsioskorean", 0x3144 },
+	{ "afii57446", 0x0646 },
+	{ "omegatitlocyrillic", 0x047d },
+	{ "fourthtonechinese", 0x02cb },
+	{ "nu.sc", 0xf50c },
+	{ "Ohorntilde", 0x1ee0 },
+	{ "Toarmenian", 0x0539 },
+	{ "uni00730321", 0xea41 },
+	{ "xbopomofo", 0x3112 },
+	{ "Iogonek", 0x012e },
+	{ "bstroke", 0x0180 },
+	{ "eng", 0x014b },
+	{ "sigmalunate", 0x03f2 },
+	{ "afii61664", 0x200c },
+	{ "afii57451", 0x064b },
+	{ "Psicyril", 0x0470 },
+	{ "vscript", 0x028b },
+	{ "mufsquare", 0x338c },
+	{ "dollarinferior", 0xf6e3 },
+	{ "stixEE00", 0xee00 },
+	{ "afii10069", 0x0434 },
+	{ "sentisquare", 0x3322 },
+	{ "Chedieresiscyrillic", 0x04f4 },
+	{ "uni223C20D2", 0xe415 },
+	{ "zhebrevecyrillic", 0x04c2 },
+	{ "Ccaron.small", 0xf672 },
+	{ "x.sc", 0xf778 },
+	{ "fdiagovrdiag", 0x292c },
+	{ "obengali", 0x0993 },
+	{ "udieresis", 0x00fc },
+	{ "volintegral", 0x2230 },
+	{ "a33", 0x2726 },
+	{ "Flower1d", 0x258f },
+	{ "egujarati", 0x0a8f },
+	{ "alphatilde", 0x1fb6 },
+	{ "rieulmieumkorean", 0x313b },
+	{ "parallel", 0x2225 },
+	{ "tohiragana", 0x3068 },
+	{ "imageorapproximatelyequal", 0x2253 },
+	{ "precedesequal", 0x227c },
+	{ "uni2190.short", 0xe233 },
+	{ "uhornhookabove", 0x1eed },
+	{ "Yen", 0x00a5 },
+	{ "ghainarabic", 0x063a },
+	{ "Ehookabove", 0x1eba },
+	{ "pesetas", 0x20a7 },
+	{ "wakatakanahalfwidth", 0xff9c },
+	{ "Obreve.small", 0xf691 },
+	{ "primetriplerev", 0x2037 },
+	{ "Imacron", 0x012a },
+	{ "barV", 0x2aea },
+	{ "tthadeva", 0x0920 },
+	{ "yehfinalarabic", 0xfef2 },
+	{ "ugrave.sc", 0xf7f9 },
+	{ "Shacyrillic", 0x0428 },
+	{ "capslock", 0x21ea },
+	{ "stixEE60", 0xee60 },
+	{ "hcedilla", 0x1e29 },
+	{ "hoarmenian", 0x0570 },
+	{ "jeharabic", 0x0698 },
+	{ "Fitacyrillic", 0x0472 },
+	{ "hknearrow", 0x2924 },
+	{ "Ldot.small", 0xf68d },
+	{ "anglesupnosp", 0x031a },
+	{ "iotadieresisgrave", 0x1fd2 },
+	{ "a18", 0x2712 },
+	{ "bridgeinvsubnosp", 0x033a },
+	{ "Uhacek", 0x01d3 },
+	{ "Leo", 0x264c },
+	{ "Cheharmenian", 0x0543 },
+	{ "saraaimaimalaithai", 0x0e44 },
+	{ "a147", 0x2787 },
+	{ "hatafpatah", 0x05b2 },
+	{ "mikatakana", 0x30df },
+	{ "afii10053", 0x0404 },
+	{ "supsim", 0x2ac8 },
+	{ "pointingindexleftwhite", 0x261c },
+	{ "Scircumflex", 0x015c },
+	{ "linevertsubnosp", 0x0329 },
+	{ "maithothai", 0x0e49 },
+	{ "MBsquare", 0x3386 },
+	{ "uni224F0338", 0xe84d },
+	{ "a128", 0x2468 },
+	{ "section", 0x00a7 },
+	{ "pefinal", 0x05e3 },
+	{ "DD101", 0x231c },
+	{ "Ghestrokecyrillic", 0x0492 },
+	{ "a123", 0x2463 },
+	{ "acutenosp", 0x0301 },
+	{ "gravelowmod", 0x02ce },
+	{ "khadeva", 0x0916 },
+	{ "supedot", 0x2ac4 },
+	{ "homothetic", 0x223b },
+	{ "fourteenparen", 0x2481 },
+	{ "barrightarrowdiamond", 0x2920 },
+	{ "maitrilowleftthai", 0xf892 },
+	{ "semicolonarabic", 0x061b },
+	{ "uprtdblform", 0x2558 },
+	{ "quarternote", 0x2669 },
+	{ "uni223C.bold", 0xe662 },
+	{ "rholenis", 0x1fe4 },
+	{ "approxeqq", 0x2a70 },
+	{ "zerohackarabic", 0x0660 },
+	{ "muwsquare", 0x33bc },
+	{ "stixEE7E", 0xee7e },
+	{ "omegalenisgrave", 0x1f62 },
+	{ "dollar.taboldstyle", 0xf653 },
+	{ "omegaroundcyrillic", 0x047b },
+	{ "subsup", 0x2ad3 },
+	{ "shadedark", 0x2593 },
+	{ "uni224220D2", 0xe5e4 },
+	{ "subsetplus", 0x2abf },
+	{ "alphagrave", 0x1f70 },
+	{ "squareverticalfill", 0x25a5 },
+	{ "invcircle", 0x25d9 },
+	{ "pehmedialarabic", 0xfb59 },
+	{ "supsub", 0x2ad4 },
+	{ "psiliperispomeni", 0x1fcf },
+	{ "afii57506", 0x067e },
+	{ "stixEE45", 0xee45 },
+	{ "Etaasperacute", 0x1f2d },
+	{ "DD109", 0x231e },
+	{ "stixEED3", 0xeed3 },
+	{ "dblverticalbar", 0x2016 },
+	{ "afii10105", 0x0458 },
+	{ "csube", 0x2ad1 },
+	{ "ladeva", 0x0932 },
+	{ "uni22020338", 0xe390 },
+	{ "dtail", 0x0256 },
+	{ "hooksubretronosp", 0x0322 },
+	{ "maiekthai", 0x0e48 },
+	{ "ltarcdnleftform", 0x256e },
+	{ "bracerightmid", 0xf8fd },
+	{ "macron.cap", 0xf6d0 },
+	{ "gekatakana", 0x30b2 },
+	{ "brevebelowcmb", 0x032e },
+	{ "Ohorn", 0x01a0 },
+	{ "jecyrillic", 0x0458 },
+	{ "tehmeemisolatedarabic", 0xfc0e },
+	{ "sioscieuckorean", 0x317e },
+	{ "Ucircumflexsmall", 0xf7fb },
+	{ "acutesubnosp", 0x0317 },
+	{ "questiondown.sc", 0xf7bf },
+	{ "siosnieunkorean", 0x317b },
+	{ "uni22500338", 0xe38a },
+	{ "minusmod", 0x02d7 },
+	{ "sevenarabic", 0x0667 },
+	{ "twentyhangzhou", 0x5344 },
+	{ "qof", 0x05e7 },
+	{ "yekorean", 0x3156 },
+	{ "circlering", 0x229a },
+	{ "wikatakana", 0x30f0 },
+	{ "a159", 0x2793 },
+	{ "uni22FD20D2", 0xed35 },
+	{ "acutesub", 0x02cf },
+	{ "triagrt", 0x25ba },
+	{ "Oacute", 0x00d3 },
+	{ "sigmalunatesymbolgreek", 0x03f2 },
+	{ "hornnosp", 0x031b },
+	{ "osuperior", 0xf6f0 },
+	{ "afii57400", 0x0668 },
+	{ "Jsmall", 0xf76a },
+	{ "Ecyrilrev", 0x042d },
+	{ "threedeva", 0x0969 },
+	{ "srthook", 0x0282 },
+	{ "AEacute.small", 0xf670 },
+	{ "bqsquare", 0x33c3 },
+	{ "a30", 0x2723 },
+	{ "evowelsigndeva", 0x0947 },
+	{ "AEsmall", 0xf7e6 },
+	{ "uhornacute", 0x1ee9 },
+	{ "dasiacomb", 0x0314 },
+	{ "a148", 0x2788 },
+	{ "Kabar", 0x049e },
+	{ "rvocalicbengali", 0x098b },
+	{ "ssangkiyeokkorean", 0x3132 },
+	{ "rdotbelow", 0x1e5b },
+	{ "Fsmall", 0xf766 },
+	{ "tenroman", 0x2179 },
+	{ "product", 0x220f },
+	{ "m.superior", 0xf6ef },
+	{ "whitebullet", 0x25e6 },
+	{ "afii10091", 0x0449 },
+	{ "ghainfinalarabic", 0xfece },
+	{ "Haabkhasiancyrillic", 0x04a8 },
+	{ "Omegaiotasubasperacute", 0x1fad },
+	{ "Zdot", 0x017b },
+	{ "vavdagesh65", 0xfb35 },
+	{ "parenleft.superior", 0x207d },
+	{ "Upsilondiaeresis", 0x03ab },
+	{ "Etarmenian", 0x0538 },
+	{ "uni2AADFE00", 0xe33e },
+	{ "Obar", 0x019f },
+	{ "zerobengali", 0x09e6 },
+	{ "ekatakana", 0x30a8 },
+	{ "iivowelsigndeva", 0x0940 },
+	{ "sixroman", 0x2175 },
+	{ "Rho", 0x03a1 },
+	{ "dcaron", 0x010f },
+	{ "Alphaiotasubaspergrave", 0x1f8b },
+	{ "Ustraightcyrillic", 0x04ae },
+	{ "Ghe.up", 0x0490 },
+	{ "Eiotifiedcyrillic", 0x0464 },
+	{ "cheharmenian", 0x0573 },
+	{ "eighthnotebeamed", 0x266b },
+	{ "segol", 0x05b6 },
+	{ "afii57658", 0x05c3 },
+	{ "leftharpoonupbar", 0x295a },
+	{ "t.sc", 0xf774 },
+	{ "rieulpansioskorean", 0x316c },
+	{ "tonelow", 0x02e8 },
+	{ "kappa.sc", 0xf509 },
+	{ "iterationhiragana", 0x309d },
+	{ "cclwcontintegral", 0x2233 },
+	{ "Jcircumflex", 0x0134 },
+	{ "wturned", 0x028d },
+	{ "iacute.sc", 0xf7ed },
+	{ "smallbox", 0x25ab },
+	{ "abreveacute", 0x1eaf },
+	{ "bhadeva", 0x092d },
+	{ "verthvhorizltform", 0x2542 },
+	{ "eightroman", 0x2177 },
+	{ "leftrightarrowcircle", 0x2948 },
+	{ "tsere12", 0x05b5 },
+	{ "Esmall", 0xf765 },
+	{ "grave.sc", 0xf760 },
+	{ "controlRS", 0x001e },
+	{ "frown", 0x2322 },
+	{ "adieresiscyrillic", 0x04d3 },
+	{ "omicronasper", 0x1f41 },
+	{ "afii57681", 0x05e1 },
+	{ "blackleftpointingpointer", 0x25c4 },
+	{ "accountof", 0x2100 },
+	{ "a45", 0x2732 },
+	{ "daarmenian", 0x0564 },
+	{ "Smonospace", 0xff33 },
+	{ "kasmallkatakana", 0x30f5 },
+	{ "afii10148", 0x0474 },
+	{ "tokatakana", 0x30c8 },
+	{ "tildemidnosp", 0x0334 },
+	{ "diaeresiscomb", 0x0308 },
+	{ "BorderUpper1", 0x2594 },
+	{ "babygamma", 0x0264 },
+	{ "wring", 0x1e98 },
+	{ "Hblackletter", 0x210c },
+	{ "a178", 0x27a8 },
+	{ "a14", 0x270d },
+	{ "updblleftform", 0x255c },
+	{ "arrowdbllongbothv", 0x21d5 },
+	{ "ideographicspecialparen", 0x3235 },
+	{ "Btopbar", 0x0182 },
+	{ "voicediterationkatakana", 0x30fe },
+	{ "ideographicsuperviseparen", 0x323c },
+	{ "afii57723", 0xfb35 },
+	{ "space_uni0308_uni0300", 0xf6d8 },
+	{ "tekatakanahalfwidth", 0xff83 },
+	{ "augurmukhi", 0x0a14 },
+	{ "wokatakanahalfwidth", 0xff66 },
+	{ "hohiragana", 0x307b },
+	{ "a2", 0x2702 },
+	{ "Etagrave", 0x1fca },
+	{ "Menarmenian", 0x0544 },
+	{ "phagurmukhi", 0x0a2b },
+	{ "reshdageshhebrew", 0xfb48 },
+	{ "approaches", 0x2250 },
+	{ "arrowleftdblstroke", 0x21cd },
+	{ "colonsign", 0x20a1 },
+	{ "yehbarreefinalarabic", 0xfbaf },
+	{ "afii57442", 0x0642 },
+	{ "rikatakanahalfwidth", 0xff98 },
+	{ "racute", 0x0155 },
+	{ "Ydieresissmall", 0xf7ff },
+	{ "lmiddletilde", 0x026b },
+	{ "wekorean", 0x315e },
+	{ "zerowidthjoiner", 0xfeff },
+	{ "uni2A17.uplgdisplay", 0xe39a },
+	{ "bukatakana", 0x30d6 },
+	{ "eightgujarati", 0x0aee },
+	{ "cbopomofo", 0x3118 },
+	{ "fagurmukhi", 0x0a5e },
+	{ "dakatakana", 0x30c0 },
+	{ "tortoiseshellbracketleft", 0x3014 },
+	{ "downfishtail", 0x297f },
+	{ "eightgurmukhi", 0x0a6e },
+	{ "stixEEBD", 0xeebd },
+	{ "lesdoto", 0x2a81 },
+	{ "stixEEB1", 0xeeb1 },
+	{ "gahiragana", 0x304c },
+	{ "emspace", 0x2003 },
+	{ "ideographicfinancialcircle", 0x3296 },
+	{ "whiteleftpointingtriangle", 0x25c1 },
+	{ "notalmostequal", 0x2249 },
+	{ "afii10017", 0x0410 },
+	{ "lfthreeeighthblock", 0x258d },
+	{ "arrowsoutheast", 0x2198 },
+	{ "oomatragurmukhi", 0x0a4b },
+	{ "parenleftex", 0xf8ec },
+	{ "lvocalicvowelsignbengali", 0x09e2 },
+	{ "greaterdot", 0x22d7 },
+	{ "zero.inferior", 0x2080 },
+	{ "uni22DF0338", 0xed7d },
+	{ "tavdages", 0xfb4a },
+	{ "questionequal", 0x225f },
+	{ "Upsilonmacron", 0x1fe9 },
+	{ "egrave", 0x00e8 },
+	{ "SF230000", 0x2563 },
+	{ "arrowanticlockw", 0x21ba },
+	{ "synch", 0x2416 },
+	{ "arrowdbllongbothnot", 0x21ce },
+	{ "stixEE43", 0xee43 },
+	{ "preceedsnotsimilar", 0x22e8 },
+	{ "Etaiotasublenis", 0x1f98 },
+	{ "koroniscmb", 0x0343 },
+	{ "qhook", 0x02a0 },
+	{ "Euro", 0x20ac },
+	{ "lochulathai", 0x0e2c },
+	{ "whiterightpointingtriangle", 0x25b7 },
+	{ "nottrianglerightequal", 0x22ed },
+	{ "DD012", 0x231d },
+	{ "commainferior", 0xf6e1 },
+	{ "gescc", 0x2aa9 },
+	{ "uni223E.var", 0xe407 },
+	{ "ghadeva", 0x0918 },
+	{ "ideographwoodcircle", 0x328d },
+	{ "Nusmall", 0xf50c },
+	{ "qamatswidehebrew", 0x05b8 },
+	{ "updownharpoonleftright", 0x294d },
+	{ "notsupersetsqequal", 0x22e3 },
+	{ "afii57449", 0x0649 },
+	{ "Tonetwo", 0x01a7 },
+	{ "stixEEA0", 0xeea0 },
+	{ "Zacute.small", 0xf6ab },
+	{ "Ve", 0x0412 },
+	{ "ccedilla.sc", 0xf7e7 },
+	{ "stixEE34", 0xee34 },
+	{ "nhiragana", 0x3093 },
+	{ "dbldanda", 0x0965 },
+	{ "phook", 0x01a5 },
+	{ "Hdotbelow", 0x1e24 },
+	{ "peharabic", 0x067e },
+	{ "yesieungpansioskorean", 0x3183 },
+	{ "yehbarreearabic", 0x06d2 },
+	{ "syouwaerasquare", 0x337c },
+	{ "nje", 0x045a },
+	{ "nvleftrightarrow", 0x21f9 },
+	{ "Delta.greek", 0x0394 },
+	{ "e.sc", 0xf765 },
+	{ "onedotlead", 0x2024 },
+	{ "mdotaccent", 0x1e41 },
+	{ "labengali", 0x09b2 },
+	{ "Epsilonlatin", 0x0190 },
+	{ "afii10064", 0xf6c5 },
+	{ "Khacyrillic", 0x0425 },
+	{ "jadeva", 0x091c },
+	{ "Zdotaccent", 0x017b },
+	{ "barmidlongnosp", 0x0336 },
+	{ "squarekm", 0x339e },
+	{ "a42", 0x272f },
+	{ "yokorean", 0x315b },
+	{ "fifteenparen", 0x2482 },
+	{ "a111", 0x2666 },
+	{ "bumpeqq", 0x2aae },
+	{ "subedot", 0x2ac3 },
+	{ "phophanthai", 0x0e1e },
+	{ "zhebreve", 0x04c2 },
+	{ "vukatakana", 0x30f4 },
+	{ "ydotaccent", 0x1e8f },
+	{ "dlsquare", 0x3397 },
+	{ "koreanstandardsymbol", 0x327f },
+	{ "ecyrilrev", 0x044d },
+	{ "Omegatonos", 0x038f },
+	{ "elcyrillic", 0x043b },
+	{ "nekatakana", 0x30cd },
+	{ "cent.taboldstyle", 0xf654 },
+	{ "yuyekorean", 0x318b },
+	{ "Udblacute", 0x0170 },
+	{ "ideographichaveparen", 0x3232 },
+	{ "approxequal", 0x2248 },
+	{ "Blinebelow", 0x1e06 },
+	{ "obarreddieresiscyrillic", 0x04eb },
+	{ "Ereversed", 0x018e },
+	{ "afii57671", 0x05d7 },
+	{ "Dei", 0x03ee },
+	{ "linevertdblnosp", 0x030e },
+	{ "a167", 0x279c },
+	{ "Cacute", 0x0106 },
+	{ "wekatakana", 0x30f1 },
+	{ "Kcircle", 0x24c0 },
+	{ "exclamdown.cap", 0xf6b4 },
+	{ "ve", 0x0432 },
+	{ "afii10194", 0x0463 },
+	{ "kiromeetorusquare", 0x3316 },
+	{ "ltlarr", 0x2976 },
+	{ "hdotaccent", 0x1e23 },
+	{ "boxrtdiaghatch", 0x25a8 },
+	{ "a156", 0x2790 },
+	{ "yicyrillic", 0x0457 },
+	{ "shevanarrowhebrew", 0x05b0 },
+	{ "semicircleleftsld", 0x25d6 },
+	{ "brevesubnosp", 0x032e },
+	{ "uni222020D2", 0xe2d8 },
+	{ "harpoonleftright", 0x21cb },
+	{ "surd", 0x221a },
+	{ "Etalenisacute", 0x1f2c },
+	{ "tonebarextrahighmod", 0x02e5 },
+	{ "nsuperior", 0x207f },
+	{ "notsubset", 0x2284 },
+	{ "afii57807", 0x05bc },
+	{ "pmsquare", 0x33d8 },
+	{ "stixEED1", 0xeed1 },
+	{ "linevert", 0x02c8 },
+	{ "nieuncirclekorean", 0x3261 },
+	{ "stixEE59", 0xee59 },
+	{ "rightarrowsimilar", 0x2974 },
+	{ "msuperior", 0xf6ef },
+	{ "phieuphcirclekorean", 0x326c },
+	{ "monospacedash", 0x2014 },
+	{ "chochingthai", 0x0e09 },
+	{ "fbopomofo", 0x3108 },
+	{ "ideographicwaterparen", 0x322c },
+	{ "late", 0x2aad },
+	{ "nagujarati", 0x0aa8 },
+	{ "triangleleftsld1", 0x25c0 },
+	{ "tackdownsubnosp", 0x031e },
+	{ "gbopomofo", 0x310d },
+	{ "eparen", 0x24a0 },
+	{ "tukatakanahalfwidth", 0xff82 },
+	{ "afii10056", 0x0407 },
+	{ "arrowtabright", 0x21e5 },
+	{ "O", 0x004f },
+	{ "isinE", 0x22f9 },
+	{ "two.denominator", 0xf657 },
+	{ "stixEE91", 0xee91 },
+	{ "disin", 0x22f2 },
+	{ "notsatisfy", 0x22ad },
+	{ "glottalstopinv", 0x0296 },
+	{ "permill", 0x2030 },
+	{ "wahiragana", 0x308f },
+	{ "plussmall", 0xfe62 },
+	{ "llvocalicdeva", 0x0961 },
+	{ "vadeva", 0x0935 },
+	{ "uni22DE20D2", 0xed7a },
+	{ "precedesorequal", 0x227e },
+	{ "je", 0x0458 },
+	{ "Iotaasper", 0x1f39 },
+	{ "Dzhe", 0x040f },
+	{ "squareplus", 0x229e },
+	{ "integralbt", 0x2321 },
+	{ "fiveeighths", 0x215d },
+	{ "R_p", 0xf6dd },
+	{ "afii10034", 0x0420 },
+	{ "a160", 0x2794 },
+	{ "tcommaaccent", 0x0163 },
+	{ "response", 0x211f },
+	{ "j", 0x006a },
+	{ "uni226320D2", 0xed5d },
+	{ "zacute", 0x017a },
+	{ "rightangle", 0x221f },
+	{ "degreecentigrade", 0x2103 },
+	{ "downuparrows", 0x21f5 },
+	{ "measeq", 0x225e },
+	{ "Alphagrave", 0x1fba },
+	{ "Tdotaccent", 0x1e6a },
+	{ "ltuphorizform", 0x2534 },
+	{ "reharabic", 0x0631 },
+	{ "five.inferior", 0x2085 },
+	{ "Ebreve.small", 0xf677 },
+	{ "varika", 0x05f5 },
+	{ "pluscircle", 0x2295 },
+	{ "Bscript", 0x212c },
+	{ "siluqlefthebrew", 0x05bd },
+	{ "jhookdblbar", 0x0284 },
+	{ "versicle", 0x2123 },
+	{ "bulletoperator", 0x2219 },
+	{ "chaarmenian", 0x0579 },
+	{ "fourcircleinversesansserif", 0x278d },
+	{ "arrownortheast", 0x2197 },
+	{ "invbullet", 0x25d8 },
+	{ "ibreve", 0x012d },
+	{ "visargabengali", 0x0983 },
+	{ "Ldotbelowmacron", 0x1e38 },
+	{ "umonospace", 0xff55 },
+	{ "gcedilla", 0x0123 },
+	{ "a.cyr", 0x0430 },
+	{ "maqafhebrew", 0x05be },
+	{ "stixEED8", 0xeed8 },
+	{ "scaron", 0x0161 },
+	{ "Shei", 0x03e2 },
+	{ "uni227A20D2", 0xed76 },
+	{ "vavdagesh", 0xfb35 },
+	{ "dblanglebracketrightvertical", 0xfe3e },
+	{ "Omegalenisgrave", 0x1f6a },
+	{ "afii57415", 0x0627 },
+	{ "psilioxia", 0x1fce },
+	{ "ustrt", 0x04af },
+	{ "isins", 0x22f4 },
+	{ "SF420000", 0x2560 },
+	{ "rohiragana", 0x308d },
+	{ "iacute", 0x00ed },
+	{ "sheva15", 0x05b0 },
+	{ "aamatragurmukhi", 0x0a3e },
+	{ "afii10068", 0x0433 },
+	{ "substitute", 0x241a },
+	{ "reversedtilde", 0x223d },
+	{ "qofhebrew", 0x05e7 },
+	{ "llvocalicvowelsigndeva", 0x0963 },
+	{ "Iotamacron", 0x1fd9 },
+	{ "a70", 0x274b },
+	{ "whitesquare", 0x25a1 },
+	{ "thorn", 0x00fe },
+	{ "ghhadeva", 0x095a },
+	{ "udattadeva", 0x0951 },
+	{ "theta", 0x03b8 },
+	{ "trianglesesld", 0x25e2 },
+	{ "I", 0x0049 },
+	{ "f_f_l", 0xfb04 },
+	{ "cdsquare", 0x33c5 },
+	{ "hyphen.inferior", 0xf6e5 },
+	{ "Tile", 0x2588 },
+	{ "kihiragana", 0x304d },
+	{ "OE", 0x0152 },
+	{ "toneextrahigh", 0x02e5 },
+	{ "kekatakana", 0x30b1 },
+	{ "thousandsseparatorpersian", 0x066c },
+	{ "neovnwarrow", 0x2931 },
+	{ "vavholamhebrew", 0xfb4b },
+	{ "seventeenparen", 0x2484 },
+	{ "alefhamzaabovearabic", 0x0623 },
+	{ "caron.cap", 0xf6ca },
+	{ "U", 0x0055 },
+	{ "lowlinecmb", 0x0332 },
+	{ "aimatragurmukhi", 0x0a48 },
+	{ "afii57686", 0x05e6 },
+	{ "umacroncyrillic", 0x04ef },
+	{ "Tdotbelow", 0x1e6c },
+	{ "s.sc", 0xf773 },
+	{ "unitseparator", 0x241f },
+	{ "idieresiscyrillic", 0x04e5 },
+	{ "kesmallkatakana", 0x30f6 },
+	{ "N", 0x004e },
+	{ "hotsprings", 0x2668 },
+	{ "rreharabic", 0x0691 },
+	{ "glottalstopbarrev", 0x02a2 },
+	{ "hehmedialarabic", 0xfeec },
+	{ "h", 0x0068 },
+	{ "afii301", 0x200d },
+	{ "usmallhiragana", 0x3045 },
+	{ "Einvertedbreve", 0x0206 },
+	{ "H22073", 0x25a1 },
+	{ "qubuts18", 0x05bb },
+	{ "narylogicalor", 0x22c1 },
+	{ "stixEE92", 0xee92 },
+	{ "vturn", 0x028c },
+	{ "afii10020", 0x0413 },
+	{ "w", 0x0077 },
+	{ "qofdagesh", 0xfb47 },
+	{ "dahiragana", 0x3060 },
+	{ "Chedescendercyrillic", 0x04b6 },
+	{ "uni223E0333", 0xe290 },
+	{ "lamed", 0x05dc },
+	{ "precedequivlnt", 0x227e },
+	{ "alphaiotasublenistilde", 0x1f86 },
+	{ "cent.denominator", 0xf629 },
+	{ "kcaron", 0x01e9 },
+	{ "dblanglebracketleft", 0x300a },
+	{ "Zcircle", 0x24cf },
+	{ "dollar.oldstyle", 0xf724 },
+	{ "khieukhaparenkorean", 0x3218 },
+	{ "idiaeresis", 0x00ef },
+	{ "gesdoto", 0x2a82 },
+	{ "dnthreeeighthblock", 0x2583 },
+	{ "nvleftarrow", 0x21f7 },
+	{ "huiitosquare", 0x3333 },
+	{ "dnhvrtltform", 0x250e },
+	{ "uni025102DE", 0xe63d },
+	{ "braceright", 0x007d },
+	{ "lessequalgreater", 0x22da },
+	{ "clicklateral", 0x01c1 },
+	{ "tsere2b", 0x05b5 },
+	{ "barleftharpoonup", 0x2952 },
+	{ "mieumcirclekorean", 0x3264 },
+	{ "wynn", 0x01bf },
+	{ "gafarabic", 0x06af },
+	{ "primedbl", 0x2033 },
+	{ "naryintersection", 0x22c2 },
+	{ "dze", 0x0455 },
+	{ "Alphabreve", 0x1fb8 },
+	{ "mcubedsquare", 0x33a5 },
+	{ "ltarcdnrtform", 0x256d },
+	{ "circumflexbelowcmb", 0x032d },
+	{ "space_uni030F", 0xf6d6 },
+	{ "controlACK", 0x0006 },
+	{ "tackrightsubnosp", 0x0319 },
+	{ "mdotbelow", 0x1e43 },
+	{ "sadarabic", 0x0635 },
+	{ "Psismall", 0xf517 },
+	{ "etaiotasubasper", 0x1f91 },
+	{ "a63", 0x2744 },
+	{ "Yat", 0x0462 },
+	{ "dhadeva", 0x0927 },
+	{ "pehiragana", 0x307a },
+	{ "notgreaterequal", 0x2271 },
+	{ "periodhalfwidth", 0xff61 },
+	{ "Ymonospace", 0xff39 },
+	{ "BorderLeftVertical1", 0x258f },
+	{ "tcircumflexbelow", 0x1e71 },
+	{ "iparen", 0x24a4 },
+	{ "muchgreater", 0x226b },
+	{ "chieuchaparenkorean", 0x3217 },
+	{ "rteighthblock", 0x2595 },
+	{ "afii10065", 0x0430 },
+	{ "curlyor", 0x22ce },
+	{ "notpreceeds", 0x2280 },
+	{ "tavdagesh", 0xfb4a },
+	{ "omegaacute", 0x1f7d },
+	{ "SM770000", 0x21a8 },
+	{ "dotaccent.sc", 0xf6f7 },
+	{ "caroncomb", 0x030c },
+	{ "koppa", 0x03df },
+	{ "Itildebelow", 0x1e2c },
+	{ "stixEE22", 0xee22 },
+	{ "cheverticalstrokecyrillic", 0x04b9 },
+	{ "fourpersian", 0x06f4 },
+	{ "resh", 0x05e8 },
+	{ "idblgrave", 0x0209 },
+	{ "Ecircumflexsmall", 0xf7ea },
+	{ "uni29330338", 0xe21d },
+	{ "uni22630338", 0xed5c },
+	{ "io", 0x0451 },
+	{ "Dzcaron", 0x01c5 },
+	{ "ideographiclowcircle", 0x32a6 },
+	{ "iotaacute", 0x1f77 },
+	{ "SM790000", 0x2302 },
+	{ "rle", 0x202b },
+	{ "afii10076", 0x043a },
+	{ "Yogh", 0x01b7 },
+	{ "subsim", 0x2ac7 },
+	{ "behfinalarabic", 0xfe90 },
+	{ "Hcircumflex.small", 0xf682 },
+	{ "clubsuitwhite", 0x2667 },
+	{ "multiopenright", 0x22cc },
+	{ "afii57452", 0x064c },
+	{ "nyabengali", 0x099e },
+	{ "copyrightsans", 0xf8e9 },
+	{ "afii57680", 0x05e0 },
+	{ "eharmenian", 0x0567 },
+	{ "a11", 0x261b },
+	{ "pasquare", 0x33a9 },
+	{ "alphaaspergrave", 0x1f03 },
+	{ "quotedblleft", 0x201c },
+	{ "Zcaronsmall", 0xf6ff },
+	{ "tau", 0x03c4 },
+	{ "dcedilla", 0x1e11 },
+	{ "whitecircleinverse", 0x25d9 },
+	{ "one.superior", 0x00b9 },
+	{ "Iogonek.small", 0xf686 },
+	{ "arrowdownwhite", 0x21e9 },
+	{ "aideva", 0x0910 },
+	{ "revlogicalnot", 0x2310 },
+	{ "nu", 0x03bd },
+	{ "Caronsmall", 0xf6f5 },
+	{ "tiwnarmenian", 0x057f },
+	{ "phi1", 0x03d5 },
+	{ "whitelenticularbracketleft", 0x3016 },
+	{ "ll", 0xf6c0 },
+	{ "visargadeva", 0x0903 },
+	{ "abrevetilde", 0x1eb5 },
+	{ "whitediamondcontainingblacksmalldiamond", 0x25c8 },
+	{ "xsupnosp", 0x033d },
+	{ "uni2A9A20D2", 0xed6f },
+	{ "Checyrillic", 0x0427 },
+	{ "twoideographicparen", 0x3221 },
+	{ "igrave.sc", 0xf7ec },
+	{ "Ncaron", 0x0147 },
+	{ "siospieupkorean", 0x317d },
+	{ "daletdagesh", 0xfb33 },
+	{ "lvocalicvowelsigndeva", 0x0962 },
+	{ "notfollows", 0x2281 },
+	{ "arrowzigzag", 0x21af },
+	{ "upsilonaspertilde", 0x1f57 },
+	{ "lesdot", 0x2a7f },
+	{ "ideographicresourceparen", 0x323e },
+	{ "fourthroot", 0x221c },
+	{ "invsemicircledn", 0x25db },
+	{ "nonenthai", 0x0e13 },
+	{ "chieuchcirclekorean", 0x3269 },
+	{ "rightanglenw", 0x250c },
+	{ "Mscript", 0x2133 },
+	{ "SF450000", 0x2567 },
+	{ "tbopomofo", 0x310a },
+	{ "llagujarati", 0x0ab3 },
+	{ "Uhornacute", 0x1ee8 },
+	{ "nmonospace", 0xff4e },
+	{ "greaterorless", 0x2277 },
+	{ "alefhamzabelowarabic", 0x0625 },
+	{ "a44", 0x2731 },
+	{ "Hungarumlautsmall", 0xf6f8 },
+	{ "Shimacoptic", 0x03ec },
+	{ "prolongedkana", 0x30fc },
+	{ "Izhitsadblgravecyrillic", 0x0476 },
+	{ "ugujarati", 0x0a89 },
+	{ "nrightwavyarrow", 0xe21b },
+	{ "gershayimaccenthebrew", 0x059e },
+	{ "yadeva", 0x092f },
+	{ "controlGS", 0x001d },
+	{ "numero", 0x2116 },
+	{ "kasquare", 0x3384 },
+	{ "leftarrowplus", 0x2946 },
+	{ "maiyamokthai", 0x0e46 },
+	{ "uvowelsignbengali", 0x09c1 },
+	{ "omegaiotasublenisacute", 0x1fa4 },
+	{ "tturned", 0x0287 },
+	{ "Iu", 0x042e },
+	{ "hiriqhebrew", 0x05b4 },
+	{ "Omicronacute", 0x1ff9 },
+	{ "shindageshshindothebrew", 0xfb2c },
+	{ "dagurmukhi", 0x0a26 },
+	{ "mahapakhlefthebrew", 0x05a4 },
+	{ "ideographicallianceparen", 0x323f },
+	{ "afii10092", 0x044a },
+	{ "haabkhasiancyrillic", 0x04a9 },
+	{ "yturned", 0x028e },
+	{ "triangledot", 0x25ec },
+	{ "omicronlenisgrave", 0x1f42 },
+	{ "wehiragana", 0x3091 },
+	{ "jabengali", 0x099c },
+	{ "plusbelowcmb", 0x031f },
+	{ "lcedilla", 0x013c },
+	{ "notgreaternorequal", 0x2271 },
+	{ "rightharpoonupdash", 0x296c },
+	{ "betrafehebrew", 0xfb4c },
+	{ "yoyakthai", 0x0e22 },
+	{ "pakatakana", 0x30d1 },
+	{ "paampssquare", 0x3380 },
+	{ "qubutsnarrowhebrew", 0x05bb },
+	{ "khorakhangthai", 0x0e06 },
+	{ "twobar", 0x01bb },
+	{ "n.sc", 0xf76e },
+	{ "tonebarextralowmod", 0x02e9 },
+	{ "audeva", 0x0914 },
+	{ "aspergrave", 0x1fdd },
+	{ "tadeva", 0x0924 },
+	{ "Omacron", 0x014c },
+	{ "yogh", 0x0292 },
+	{ "yuhiragana", 0x3086 },
+	{ "ghadarmenian", 0x0572 },
+	{ "circlepostalmark", 0x3036 },
+	{ "zerogurmukhi", 0x0a66 },
+	{ "chevertbar", 0x04b9 },
+	{ "afii10077", 0x043b },
+	{ "ordfeminine", 0x00aa },
+	{ "uni03C9.inverted", 0xe648 },
+	{ "Otildedieresis", 0x1e4e },
+	{ "euro", 0x20ac },
+	{ "Dash1cent", 0x2015 },
+	{ "guilsinglright.cap", 0xf6b9 },
+	{ "Icyril1", 0x04c0 },
+	{ "dotnosp", 0x0307 },
+	{ "eight.taboldstyle", 0xf64b },
+	{ "A.cyr", 0x0410 },
+	{ "florin.taboldstyle", 0xf64f },
+	{ "mwmegasquare", 0x33bf },
+	{ "six.denominator", 0xf65b },
+	{ "qamats33", 0x05b8 },
+	{ "archdblsubnosp", 0x032b },
+	{ "pieupcirclekorean", 0x3265 },
+	{ "stixEE44", 0xee44 },
+	{ "devcon1", 0x2411 },
+	{ "stixEEA2", 0xeea2 },
+	{ "blackcircle", 0x25cf },
+	{ "Tretroflexhook", 0x01ae },
+	{ "sixcircleinversesansserif", 0x278f },
+	{ "Saturn", 0x2644 },
+	{ "dslash", 0x0111 },
+	{ "equalorgreater", 0x22dd },
+	{ "SF040000", 0x2518 },
+	{ "lbelt", 0x026c },
+	{ "Iotatonos", 0x038a },
+	{ "uni2ACCFE00", 0xe2bb },
+	{ "vtilde", 0x1e7d },
+	{ "nowarmenian", 0x0576 },
+	{ "segolwidehebrew", 0x05b6 },
+	{ "nohiragana", 0x306e },
+	{ "leniscircumflex", 0x1fcf },
+	{ "Ohookabove", 0x1ece },
+	{ "eightbengali", 0x09ee },
+	{ "dieresisgrave", 0xf6d8 },
+	{ "dasiaoxia", 0x1fde },
+	{ "pertenthousand", 0x2031 },
+	{ "hakatakana", 0x30cf },
+	{ "boxnested", 0x25a3 },
+	{ "gacute", 0x01f5 },
+	{ "Idiaeresis", 0x00cf },
+	{ "wacute", 0x1e83 },
+	{ "einvertedbreve", 0x0207 },
+	{ "smtes", 0xe33d },
+	{ "sentosquare", 0x3323 },
+	{ "arrowdashright", 0x21e2 },
+	{ "underscore", 0x005f },
+	{ "a142", 0x2782 },
+	{ "Zhe", 0x0416 },
+	{ "stixEE72", 0xee72 },
+	{ "afii61573", 0x202c },
+	{ "arrowhorizex", 0xf8e7 },
+	{ "club", 0x2663 },
+	{ "sevengujarati", 0x0aed },
+	{ "partialdiff", 0x2202 },
+	{ "hhook", 0x0266 },
+	{ "Kdotbelow", 0x1e32 },
+	{ "SM680000", 0x2310 },
+	{ "Uhorndotbelow", 0x1ef0 },
+	{ "threehackarabic", 0x0663 },
+	{ "circlemultiply", 0x2297 },
+	{ "uni2A12.uplgdisplay", 0xe397 },
+	{ "uni2A7D0338", 0xe2a7 },
+	{ "nottriangeqlleft", 0x22ec },
+	{ "nonbreakingspace", 0x00a0 },
+	{ "Eacutesmall", 0xf7e9 },
+	{ "ideographicleftcircle", 0x32a7 },
+	{ "divideonmultiply", 0x22c7 },
+	{ "uni2AC60338", 0xe2b0 },
+	{ "araeaekorean", 0x318e },
+	{ "hiriqnarrowhebrew", 0x05b4 },
+	{ "boxleftdiaghatch", 0x25a7 },
+	{ "upltrthvform", 0x2515 },
+	{ "Chook", 0x0187 },
+	{ "DD015", 0x231f },
+	{ "aleffinalarabic", 0xfe8e },
+	{ "a64", 0x2745 },
+	{ "afii10193", 0x045f },
+	{ "chochoethai", 0x0e0c },
+	{ "gtcc", 0x2aa7 },
+	{ "thalfinalarabic", 0xfeac },
+	{ "nundagesh", 0xfb40 },
+	{ "guillemotright", 0x00bb },
+	{ "thabengali", 0x09a5 },
+	{ "baruparrow", 0x2912 },
+	{ "Tcaron.small", 0xf69d },
+	{ "threequartersemdash", 0xf6de },
+	{ "Ccircumflex.small", 0xf673 },
+	{ "r", 0x0072 },
+	{ "Omegacyrillic", 0x0460 },
+	{ "Eogonek", 0x0118 },
+	{ "dasia_varia", 0x1fdd },
+	{ "phieuphkorean", 0x314d },
+	{ "Gammaafrican", 0x0194 },
+	{ "afii57664", 0x05d0 },
+	{ "NJ", 0x01ca },
+	{ "wdieresis", 0x1e85 },
+	{ "uvowelsigngujarati", 0x0ac1 },
+	{ "scommaaccent", 0x0219 },
+	{ "stixEE5B", 0xee5b },
+	{ "Stigma", 0x03da },
+	{ "timescircle", 0x2297 },
+	{ "dialytika_varia", 0x1fed },
+	{ "Udiaeresis", 0x00dc },
+	{ "afii57509", 0x06af },
+	{ "copyrightserif", 0xf6d9 },
+	{ "Tcedilla", 0x0162 },
+	{ "lambda.sc", 0xf50a },
+	{ "C", 0x0043 },
+	{ "cancel", 0x2418 },
+	{ "ukcyrillic", 0x0479 },
+	{ "uni228220D2", 0xe2ac },
+	{ "macroncomb", 0x0304 },
+	{ "squaresesld", 0x25ea },
+	{ "bulletinverse", 0x25d8 },
+	{ "tildeoperator", 0x223c },
+	{ "afii57428", 0x0634 },
+	{ "guramusquare", 0x3318 },
+	{ "etnahtafoukhhebrew", 0x0591 },
+	{ "ccircumflex", 0x0109 },
+	{ "gesl", 0xe32c },
+	{ "cabengali", 0x099a },
+	{ "rupee", 0x20a8 },
+	{ "Scaron", 0x0160 },
+	{ "sterlingmonospace", 0xffe1 },
+	{ "ringhalfright", 0x02be },
+	{ "roruathai", 0x0e23 },
+	{ "afii08941", 0x20a4 },
+	{ "braceleftbt", 0xf8f3 },
+	{ "arrowbarright", 0x21a6 },
+	{ "Upsilonacute", 0x1feb },
+	{ "trianglesolid", 0x25b2 },
+	{ "uni2A9C20D2", 0xe3d9 },
+	{ "Ldot", 0x013f },
+	{ "rightanglearc", 0x22be },
+	{ "a62", 0x2743 },
+	{ "tsadifinal", 0x05e5 },
+	{ "tel", 0x2121 },
+	{ "ihiragana", 0x3044 },
+	{ "register.serif", 0xf6da },
+	{ "arrowdashleft", 0x21e0 },
+	{ "csup", 0x2ad0 },
+	{ "a162", 0x27a3 },
+	{ "Zetasmall", 0xf505 },
+	{ "stixEE40", 0xee40 },
+	{ "Omegainv", 0x2127 },
+	{ "afii10095", 0x044d },
+	{ "hyphenminus", 0x002d },
+	{ "period.numerator", 0xf66c },
+	{ "edblgrave", 0x0205 },
+	{ "Nsmallcap", 0x0274 },
+	{ "Tiwnarmenian", 0x054f },
+	{ "a186", 0x27b8 },
+	{ "chertdes", 0x04b7 },
+	{ "Schwacyrillic", 0x04d8 },
+	{ "afii10045", 0x042b },
+	{ "mugsquare", 0x338d },
+	{ "holam", 0x05b9 },
+	{ "asmallhiragana", 0x3041 },
+	{ "Rhosmall", 0xf510 },
+	{ "amsquare", 0x33c2 },
+	{ "triangrightequal", 0x22b5 },
+	{ "arrowrightbothalf", 0x21c1 },
+	{ "uni2A9920D2", 0xed6e },
+	{ "clickalveolar", 0x01c2 },
+	{ "a122", 0x2462 },
+	{ "llvocalicvowelsignbengali", 0x09e3 },
+	{ "Etaaspergrave", 0x1f2b },
+	{ "whitesmallsquare", 0x25ab },
+	{ "pieupsiostikeutkorean", 0x3175 },
+	{ "circletopsld", 0x25d3 },
+	{ "Obarredcyrillic", 0x04e8 },
+	{ "registered.sans", 0xf8e8 },
+	{ "nparen", 0x24a9 },
+	{ "upsilonlenisacute", 0x1f54 },
+	{ "arrowbothvbase", 0x21a8 },
+	{ "pointingindexdownwhite", 0x261f },
+	{ "maitriupperleftthai", 0xf890 },
+	{ "DD130", 0x2605 },
+	{ "mu1", 0x00b5 },
+	{ "afii10040", 0x0426 },
+	{ "fahrenheit", 0x2109 },
+	{ "a16", 0x270f },
+	{ "squarekmcapital", 0x33ce },
+	{ "updownarrows", 0x21c5 },
+	{ "Earth", 0x2641 },
+	{ "acutedeva", 0x0954 },
+	{ "dotsubnosp", 0x0323 },
+	{ "circumflexcmb", 0x0302 },
+	{ "Omegaaspertilde", 0x1f6f },
+	{ "lambdastroke", 0x019b },
+	{ "controlETB", 0x0017 },
+	{ "Omegaiotasublenisgrave", 0x1faa },
+	{ "fehmedialarabic", 0xfed4 },
+	{ "uni2A9DFE00", 0xed72 },
+	{ "tikeutaparenkorean", 0x3210 },
+	{ "Igravesmall", 0xf7ec },
+	{ "fivecircle", 0x2464 },
+	{ "badeva", 0x092c },
+	{ "Rsmall", 0xf772 },
+	{ "finaltsadi", 0x05e5 },
+	{ "alphaasperacute", 0x1f05 },
+	{ "phabengali", 0x09ab },
+	{ "pagujarati", 0x0aaa },
+	{ "upsilonmacron", 0x1fe1 },
+	{ "uni22900338", 0xe615 },
+	{ "nbopomofo", 0x310b },
+	{ "twoperiod", 0x2489 },
+	{ "fdotaccent", 0x1e1f },
+	{ "Odotbelow", 0x1ecc },
+	{ "etnahtalefthebrew", 0x0591 },
+	{ "arrowdblright", 0x21d2 },
+	{ "notsubseteql", 0x2288 },
+	{ "DD011", 0x2581 },
+	{ "geupturn", 0x0491 },
+	{ "spacehackarabic", 0x0020 },
+	{ "samekhhebrew", 0x05e1 },
+	{ "stixEE52", 0xee52 },
+	{ "Ccedillasmall", 0xf7e7 },
+	{ "arrowdblrightnot", 0x21cf },
+	{ "nikhahitleftthai", 0xf899 },
+	{ "afii57444", 0x0644 },
+	{ "iotacircumflex", 0x1fd6 },
+	{ "Utildeacute", 0x1e78 },
+	{ "aekorean", 0x3150 },
+	{ "ideva", 0x0907 },
+	{ "Upsilonbreve", 0x1fe8 },
+	{ "reharmenian", 0x0580 },
+	{ "uinvertedbreve", 0x0217 },
+	{ "afii57416", 0x0628 },
+	{ "saraileftthai", 0xf885 },
+	{ "iotatonos", 0x03af },
+	{ "vavyodhebrew", 0x05f1 },
+	{ "xparen", 0x24b3 },
+	{ "notarrowboth", 0x21ae },
+	{ "hedagesh", 0xfb34 },
+	{ "ohorngrave", 0x1edd },
+	{ "dnhvhorizltform", 0x2530 },
+	{ "Zecedilla", 0x0498 },
+	{ "Ghadarmenian", 0x0542 },
+	{ "dcircumflexbelow", 0x1e13 },
+	{ "notlessgreater", 0x2278 },
+	{ "semicolonmonospace", 0xff1b },
+	{ "whitelenticularbracketright", 0x3017 },
+	{ "hbopomofo", 0x310f },
+	{ "a86", 0x2771 },
+	{ "Rcommaaccent.small", 0xf697 },
+	{ "yring", 0x1e99 },
+	{ "whitecircle", 0x25cb },
+	{ "merkhakefulalefthebrew", 0x05a6 },
+	{ "commamonospace", 0xff0c },
+	{ "Nineroman", 0x2168 },
+	{ "Pcircle", 0x24c5 },
+	{ "Edieresis", 0x00cb },
+	{ "afii57433", 0x0639 },
+	{ "ngagujarati", 0x0a99 },
+	{ "lfblock", 0x258c },
+	{ "Kcedilla", 0x0136 },
+	{ "commareversedmod", 0x02bd },
+	{ "noonfinalarabic", 0xfee6 },
+	{ "ac", 0x223e },
+	{ "rdiagovsearrow", 0x2930 },
+	{ "lakkhangyaothai", 0x0e45 },
+	{ "lessequal", 0x2264 },
+	{ "upsilondieresisacute", 0x1fe3 },
+	{ "SM750000", 0x25cb },
+	{ "yokatakanahalfwidth", 0xff96 },
+	{ "uni2A7E0338", 0xe2a6 },
+	{ "oopen", 0x0254 },
+	{ "kaffinal", 0x05da },
+	{ "etaiotasubaspercircumflex", 0x1f97 },
+	{ "ie.ukran", 0x0454 },
+	{ "hatafpatah16", 0x05b2 },
+	{ "Rlinebelow", 0x1e5e },
+	{ "plusmonospace", 0xff0b },
+	{ "s.superior", 0xf6f2 },
+	{ "Etaiotasubasper", 0x1f99 },
+	{ "ccircle", 0x24d2 },
+	{ "solbar", 0x233f },
+	{ "Deltasmall", 0xf503 },
+	{ "Epsilonaspergrave", 0x1f1b },
+	{ "trademarkserif", 0xf6db },
+	{ "afii57673", 0x05d9 },
+	{ "ring", 0x02da },
+	{ "Tausmall", 0xf513 },
+	{ "maithoupperleftthai", 0xf88d },
+	{ "yacute.sc", 0xf7fd },
+	{ "squareorthogonalcrosshatchfill", 0x25a6 },
+	{ "sohiragana", 0x305d },
+	{ "Oinvertedbreve", 0x020e },
+	{ "epsilonasperacute", 0x1f15 },
+	{ "afii57716", 0x05f0 },
+	{ "a135", 0x277b },
+	{ "fourperiod", 0x248b },
+	{ "sampi", 0x03e1 },
+	{ "eighteenparen", 0x2485 },
+	{ "Udieresiscyrillic", 0x04f0 },
+	{ "stixEECF", 0xeecf },
+	{ "Hbar", 0x0126 },
+	{ "Tonefive", 0x01bc },
+	{ "ideographicearthparen", 0x322f },
+	{ "Zhebreve", 0x04c1 },
+	{ "a203", 0x2750 },
+	{ "omicrontonos", 0x03cc },
+	{ "Jmonospace", 0xff2a },
+	{ "chair", 0x2441 },
+	{ "omegaaspergrave", 0x1f63 },
+	{ "nakatakanahalfwidth", 0xff85 },
+	{ "updownarrowbar", 0x21a8 },
+	{ "meizierasquare", 0x337e },
+	{ "uni03020302", 0xea1d },
+	{ "Ucircle", 0x24ca },
+	{ "hatafpatahquarterhebrew", 0x05b2 },
+	{ "SP320000", 0x2219 },
+	{ "ring.sc", 0xf6fc },
+	{ "anusvaradeva", 0x0902 },
+	{ "Ucircumflex", 0x00db },
+	{ "Ncircumflexbelow", 0x1e4a },
+	{ "Udieresismacron", 0x01d5 },
+	{ "stixEE1B", 0xee1b },
+	{ "Uranus", 0x2645 },
+	{ "lessoverequal", 0x2266 },
+	{ "Abrevedotbelow", 0x1eb6 },
+	{ "yi", 0x0457 },
+	{ "Umonospace", 0xff35 },
+	{ "ocircumflextilde", 0x1ed7 },
+	{ "Ddownarrow", 0x290b },
+	{ "gcommaaccent", 0x0123 },
+	{ "uni226A0338", 0xe2cb },
+	{ "bracerightvertical", 0xfe38 },
+	{ "afii10043", 0x0429 },
+	{ "Ismall", 0xf769 },
+	{ "iterationkatakana", 0x30fd },
+	{ "rahiragana", 0x3089 },
+	{ "one.fitted", 0xf6dc },
+	{ "Rbb", 0x211d },
+	{ "twentyparen", 0x2487 },
+	{ "exclamdbl", 0x203c },
+	{ "overlinecenterline", 0xfe4a },
+	{ "uni29CF0338", 0xf412 },
+	{ "Ecaron.small", 0xf678 },
+	{ "zretroflexhook", 0x0290 },
+	{ "cieucaparenkorean", 0x3216 },
+	{ "utildebelow", 0x1e75 },
+	{ "Ohungarumlaut", 0x0150 },
+	{ "a75", 0x2751 },
+	{ "bet", 0x05d1 },
+	{ "hyphensuperior", 0xf6e6 },
+	{ "questionsmall", 0xf73f },
+	{ "controlBS", 0x0008 },
+	{ "haaltonearabic", 0x06c1 },
+	{ "Kastrokecyrillic", 0x049e },
+	{ "dlinebelow", 0x1e0f },
+	{ "upfishtail", 0x297e },
+	{ "kiyeokacirclekorean", 0x326e },
+	{ "kohmsquare", 0x33c0 },
+	{ "bardownharpoonright", 0x295d },
+	{ "stixEE58", 0xee58 },
+	{ "Gsmallcaphook", 0x029b },
+	{ "SF520000", 0x2553 },
+	{ "ideographicprintcircle", 0x329e },
+	{ "obar", 0x0275 },
+	{ "sheenarabic", 0x0634 },
+	{ "lowered", 0x02c5 },
+	{ "circlewithrighthalfblack", 0x25d1 },
+	{ "Wdotbelow", 0x1e88 },
+	{ "Alphaiotasublenisgrave", 0x1f8a },
+	{ "Emcyrillic", 0x041c },
+	{ "imacron", 0x012b },
+	{ "kokatakanahalfwidth", 0xff7a },
+	{ "vrachycomb", 0x0306 },
+	{ "upsilongrave", 0x1f7a },
+	{ "Hori", 0x03e8 },
+	{ "afii10073", 0x0437 },
+	{ "punctuationspace", 0x2008 },
+	{ "circumflexnosp", 0x0302 },
+	{ "sacute", 0x015b },
+	{ "cyrbreve", 0xf6d4 },
+	{ "kadeva", 0x0915 },
+	{ "acwopencirclearrow", 0x21ba },
+	{ "Dmacron", 0x0110 },
+	{ "Ohungarumlaut.small", 0xf692 },
+	{ "Eng", 0x014a },
+	{ "twostroke", 0x01bb },
+	{ "thirteenparen", 0x2480 },
+	{ "afii10051", 0x0402 },
+	{ "a190", 0x27bd },
+	{ "commaarabic", 0x060c },
+	{ "egsdot", 0x2a98 },
+	{ "afii10106", 0x0459 },
+	{ "tikeutacirclekorean", 0x3270 },
+	{ "a60", 0x2741 },
+	{ "kacyrillic", 0x043a },
+	{ "orunderscore", 0x22bb },
+	{ "dollaroldstyle", 0xf724 },
+	{ "toarmenian", 0x0569 },
+	{ "fourideographicparen", 0x3223 },
+	{ "kgreenlandic", 0x0138 },
+	{ "squarecc", 0x33c4 },
+	{ "a157", 0x2791 },
+	{ "rabengali", 0x09b0 },
+	{ "iota", 0x03b9 },
+	{ "Alphaiotasublenisacute", 0x1f8c },
+	{ "threemonospace", 0xff13 },
+	{ "ddalarabic", 0x0688 },
+	{ "tonemid", 0x02e7 },
+	{ "Idieresiscyrillic", 0x04e4 },
+	{ "Ooblique", 0x00d8 },
+	{ "uni03040303", 0xea33 },
+	{ "quotereversed", 0x201b },
+	{ "Ncommaaccent", 0x0145 },
+	{ "pmonospace", 0xff50 },
+	{ "ltdiagonalcross", 0x2573 },
+	{ "Eacute", 0x00c9 },
+	{ "circumflexsubnosp", 0x032d },
+	{ "ncircumflexbelow", 0x1e4b },
+	{ "fofanthai", 0x0e1f },
+	{ "percent.oldstyle", 0xf642 },
+	{ "circleleftsld", 0x25d0 },
+	{ "ibar", 0x0268 },
+	{ "Escript", 0x2130 },
+	{ "afii57397", 0x0665 },
+	{ "Ograve", 0x00d2 },
+	{ "epsilonlatinrevclosed", 0x025e },
+	{ "tetdageshhebrew", 0xfb38 },
+	{ "Yuslittlecyrillic", 0x0466 },
+	{ "memhebrew", 0x05de },
+	{ "wdotaccent", 0x1e87 },
+	{ "jeemarabic", 0x062c },
+	{ "vertdblleftform", 0x2562 },
+	{ "shinsindothebrew", 0xfb2b },
+	{ "eightperiod", 0x248f },
+	{ "bar", 0x007c },
+	{ "TeXtext32", 0x0337 },
+	{ "fourhangzhou", 0x3024 },
+	{ "oparen", 0x24aa },
+	{ "rhotichookmod", 0x02de },
+	{ "twosuperior", 0x00b2 },
+	{ "squaremg", 0x338e },
+	{ "angleright", 0x232a },
+	{ "uni220D.narrow", 0xedf4 },
+	{ "Ocircumflexacute", 0x1ed0 },
+	{ "cdot", 0x010b },
+	{ "afii57677", 0x05dd },
+	{ "hlinebelow", 0x1e96 },
+	{ "controlSYN", 0x0016 },
+	{ "emacron", 0x0113 },
+	{ "alphaaspertilde", 0x1f07 },
+	{ "plussuperior", 0x207a },
+	{ "udiaeresis", 0x00fc },
+	{ "thieuthacirclekorean", 0x3279 },
+	{ "StarDingbat1", 0x2605 },
+	{ "Oneroman", 0x2160 },
+	{ "three.taboldstyle", 0xf646 },
+	{ "iotadieresiscircumflex", 0x1fd7 },
+	{ "Hadescendercyrillic", 0x04b2 },
+	{ "etaasper", 0x1f21 },
+	{ "hvdashquadvertform", 0x250b },
+	{ "qadmahebrew", 0x05a8 },
+	{ "ltdashdblhorizform", 0x254c },
+	{ "invsemicircleup", 0x25da },
+	{ "upsilontonos", 0x03cd },
+	{ "cwhalfcirclearrow", 0x2938 },
+	{ "ringhalfleft", 0x02bf },
+	{ "Dcircumflexbelow", 0x1e12 },
+	{ "a94", 0x276b },
+	{ "rhoasper", 0x1fe5 },
+	{ "Enrtdes", 0x04a2 },
+	{ "scurel", 0x22b1 },
+	{ "Scorpio", 0x264f },
+	{ "sagujarati", 0x0ab8 },
+	{ "twoheadmapsto", 0x2905 },
+	{ "Ldsh", 0x21b2 },
+	{ "Nhookleft", 0x019d },
+	{ "seven.denominator", 0xf65c },
+	{ "zarqahebrew", 0x0598 },
+	{ "parenright.denominator", 0xf62d },
+	{ "wihiragana", 0x3090 },
+	{ "ratio", 0x2236 },
+	{ "diaeresistonosnosp", 0x0344 },
+	{ "SF110000", 0x2502 },
+	{ "endtransblock", 0x2417 },
+	{ "notsimilar", 0x2241 },
+	{ "HalfTile", 0x258c },
+	{ "rcommaaccent", 0x0157 },
+	{ "SF410000", 0x2566 },
+	{ "supsup", 0x2ad6 },
+	{ "rekatakana", 0x30ec },
+	{ "beta", 0x03b2 },
+	{ "franc", 0x20a3 },
+	{ "uni22B520D2", 0xe2cf },
+	{ "tilde", 0x02dc },
+	{ "Delta.math", 0x2206 },
+	{ "spade", 0x2660 },
+	{ "arrowrightwhite", 0x21e8 },
+	{ "a127", 0x2467 },
+	{ "ecircumflexgrave", 0x1ec1 },
+	{ "Emacron", 0x0112 },
+	{ "dihiragana", 0x3062 },
+	{ "Etatonos", 0x0389 },
+	{ "notparallel", 0x2226 },
+	{ "arrowupdownbase", 0x21a8 },
+	{ "divide", 0x00f7 },
+	{ "bilabialclick", 0x0298 },
+	{ "cedilla.cap", 0xeff2 },
+	{ "uni2295FE00", 0xed40 },
+	{ "topatakthai", 0x0e0f },
+	{ "pohiragana", 0x307d },
+	{ "Gsmall", 0xf767 },
+	{ "qparen", 0x24ac },
+	{ "greaterorequalslant", 0x2265 },
+	{ "rturnedsuperior", 0x02b4 },
+	{ "zhedescendercyrillic", 0x0497 },
+	{ "psi.sc", 0xf517 },
+	{ "menarmenian", 0x0574 },
+	{ "rvocalicvowelsignbengali", 0x09c3 },
+	{ "cieuckorean", 0x3148 },
+	{ "dnltuphorizhvform", 0x2547 },
+	{ "mu", 0x00b5 },
+	{ "udieresiscaron", 0x01da },
+	{ "Sacute.small", 0xf698 },
+	{ "Oslashacute", 0x01fe },
+	{ "gje", 0x0453 },
+	{ "cmsquaredsquare", 0x33a0 },
+	{ "verticallinebelowcmb", 0x0329 },
+	{ "ampersand", 0x0026 },
+	{ "afii61289", 0x2113 },
+	{ "rinvertedbreve", 0x0213 },
+	{ "hcircle", 0x24d7 },
+	{ "SF470000", 0x2564 },
+	{ "a181", 0x27ad },
+	{ "behmeemisolatedarabic", 0xfc08 },
+	{ "Abreve", 0x0102 },
+	{ "iacyrillic", 0x044f },
+	{ "escript", 0x212f },
+	{ "pedagesh", 0xfb44 },
+	{ "afii57458", 0x0652 },
+	{ "doubleyodpatah", 0xfb1f },
+	{ "ssadeva", 0x0937 },
+	{ "chochanthai", 0x0e08 },
+	{ "Gsmallcap", 0x0262 },
+	{ "zikatakana", 0x30b8 },
+	{ "exclamdownsmall", 0xf7a1 },
+	{ "lftimes", 0x29d4 },
+	{ "superset", 0x2283 },
+	{ "gamma", 0x03b3 },
+	{ "archleftdown", 0x21b6 },
+	{ "ltdashdblvertform", 0x254e },
+	{ "varia", 0x1fef },
+	{ "afii57806", 0x05b9 },
+	{ "hohipthai", 0x0e2b },
+	{ "behmedialarabic", 0xfe92 },
+	{ "st1", 0xfb06 },
+	{ "uni2193.short", 0xf52b },
+	{ "acutecomb", 0x0301 },
+	{ "asteriskmonospace", 0xff0a },
+	{ "colontriangularmod", 0x02d0 },
+	{ "epsilon", 0x03b5 },
+	{ "controlSI", 0x000f },
+	{ "musicflatsign", 0x266d },
+	{ "afii57669_afii57806", 0xfb4b },
+	{ "aleflamedhebrew", 0xfb4f },
+	{ "escyrillic", 0x0441 },
+	{ "Psicyrillic", 0x0470 },
+	{ "Kadescendercyrillic", 0x049a },
+	{ "Odieresis", 0x00d6 },
+	{ "Gcircle", 0x24bc },
+	{ "sparen", 0x24ae },
+	{ "rightharpoonupbar", 0x2953 },
+	{ "Hbar.small", 0xf681 },
+	{ "four.denominator", 0xf659 },
+	{ "lenis", 0x1fbd },
+	{ "ddadeva", 0x0921 },
+	{ "null", 0x2400 },
+	{ "delta.sc", 0xf503 },
+	{ "Pismall", 0xf50f },
+	{ "Ustrtbar", 0x04b0 },
+	{ "zeta.sc", 0xf505 },
+	{ "Geupturn", 0x0490 },
+	{ "kooposquare", 0x331e },
+	{ "comma.denominator", 0xf65f },
+	{ "uni2AC620D2", 0xed83 },
+	{ "yakatakanahalfwidth", 0xff94 },
+	{ "supersetdblequal", 0x2287 },
+	{ "Rturnsuper", 0x02b6 },
+	{ "Ycircumflex", 0x0176 },
+	{ "Aringbelow", 0x1e00 },
+	{ "mcircle", 0x24dc },
+	{ "bahiragana", 0x3070 },
+	{ "rturnrthooksuper", 0x02b5 },
+	{ "dzcaron", 0x01c6 },
+	{ "Iicyrillic", 0x0418 },
+	{ "patah1d", 0x05b7 },
+	{ "bracketrightex", 0xf8fa },
+	{ "mho", 0x2127 },
+	{ "stixEE1D", 0xee1d },
+	{ "afii10083", 0x0441 },
+	{ "Sixroman", 0x2165 },
+	{ "ainarabic", 0x0639 },
+	{ "gravenosp", 0x0300 },
+	{ "ecedillabreve", 0x1e1d },
+	{ "Nowarmenian", 0x0546 },
+	{ "hekatakana", 0x30d8 },
+	{ "uni229CFE00", 0xea13 },
+	{ "uni226120E5", 0xe387 },
+	{ "isuperior", 0xf6ed },
+	{ "a78", 0x25c6 },
+	{ "triangleswsld", 0x25e3 },
+	{ "Kacyrillic", 0x041a },
+	{ "gehiragana", 0x3052 },
+	{ "notdblarrowboth", 0x21ce },
+	{ "pointingindexrightwhite", 0x261e },
+	{ "apostrophereverse", 0x201b },
+	{ "arrowrightoverleft", 0x21c4 },
+	{ "blacklenticularbracketleftvertical", 0xfe3b },
+	{ "arrowleftnot", 0x219a },
+	{ "ff", 0xfb00 },
+	{ "a173", 0x27a2 },
+	{ "planckover2pi", 0x210f },
+	{ "bhook", 0x0253 },
+	{ "Izhitsa", 0x0474 },
+	{ "cross", 0x2629 },
+	{ "tildenosp", 0x0303 },
+	{ "zahfinalarabic", 0xfec6 },
+	{ "Rsmallinverted", 0x0281 },
+	{ "rightdowncurvedarrow", 0x2937 },
+	{ "mukatakanahalfwidth", 0xff91 },
+	{ "Upsilonacutehooksymbolgreek", 0x03d3 },
+	{ "wturn", 0x028d },
+	{ "gecyrillic", 0x0433 },
+	{ "rieulacirclekorean", 0x3271 },
+	{ "glottalstopreversed", 0x0295 },
+	{ "Dzecyrillic", 0x0405 },
+	{ "carriagereturn", 0x21b5 },
+	{ "mikatakanahalfwidth", 0xff90 },
+	{ "Xdieresis", 0x1e8c },
+	{ "srsquare", 0x33db },
+	{ "Delta", 0x2206 },
+	{ "Ezhreversed", 0x01b8 },
+	{ "s", 0x0073 },
+	{ "ghe.up", 0x0491 },
+	{ "AE", 0x00c6 },
+	{ "updblrtform", 0x2559 },
+	{ "yehmeemisolatedarabic", 0xfc58 },
+	{ "ideographicsocietyparen", 0x3233 },
+	{ "dotdblsubnosp", 0x0324 },
+	{ "hksearrow", 0x2925 },
+	{ "parenrightaltonearabic", 0xfd3f },
+	{ "shabengali", 0x09b6 },
+	{ "ETH", 0x00d0 },
+	{ "ecircumflex", 0x00ea },
+	{ "U.short", 0x040e },
+	{ "zhbopomofo", 0x3113 },
+	{ "dmonospace", 0xff44 },
+	{ "OEsmallcap", 0x0276 },
+	{ "kapyeounpieupkorean", 0x3178 },
+	{ "shortdownarrow", 0x2193 },
+	{ "dialytika_perispomeni", 0x1fc1 },
+	{ "afii10032", 0x041e },
+	{ "qamatsqatanhebrew", 0x05b8 },
+	{ "asciicircum", 0x005e },
+	{ "alphalenisgrave", 0x1f02 },
+	{ "halflength", 0x02d1 },
+	{ "ascriptturned", 0x0252 },
+	{ "acwundercurvearrow", 0x293b },
+	{ "qibuts", 0x05bb },
+	{ "khieukhcirclekorean", 0x326a },
+	{ "hahmedialarabic", 0xfea4 },
+	{ "pieupthieuthkorean", 0x3177 },
+	{ "afii10070", 0x0435 },
+	{ "lessdot", 0x22d6 },
+	{ "asciiacute", 0x00b4 },
+	{ "centigrade", 0x2103 },
+	{ "asciidieresis", 0x00a8 },
+	{ "Ustrt", 0x04ae },
+	{ "leftdowncurvedarrow", 0x2936 },
+	{ "cagujarati", 0x0a9a },
+	{ "latticetop", 0x22a4 },
+	{ "zcaron.sc", 0xf6ff },
+	{ "trademark", 0x2122 },
+	{ "six.oldstyle", 0xf736 },
+	{ "addakgurmukhi", 0x0a71 },
+	{ "momathai", 0x0e21 },
+	{ "rightharpoonsupdown", 0x2964 },
+	{ "fehinitialarabic", 0xfed3 },
+	{ "scedilla", 0x015f },
+	{ "cent.inferior", 0xf6df },
+	{ "rtuphvleftdnltform", 0x2544 },
+	{ "Sha", 0x0428 },
+	{ "controlBEL", 0x0007 },
+	{ "shimacoptic", 0x03ed },
+	{ "tturn", 0x0287 },
+	{ "denominatorminusonenumeratorbengali", 0x09f8 },
+	{ "strokeshortoverlaycmb", 0x0335 },
+	{ "em", 0x043c },
+	{ "shinshindot", 0xfb2a },
+	{ "thinspace", 0x2009 },
+	{ "stixEE3C", 0xee3c },
+	{ "Adotmacron", 0x01e0 },
+	{ "zaarmenian", 0x0566 },
+	{ "exclamdown", 0x00a1 },
+	{ "KBsquare", 0x3385 },
+	{ "rightarrowdiamond", 0x291e },
+	{ "nvrightarrow", 0x21f8 },
+	{ "ecyril", 0x0454 },
+	{ "Xismall", 0xf50d },
+	{ "uni22FD0338", 0xed33 },
+	{ "uni2A15.up", 0xe376 },
+	{ "samekhdageshhebrew", 0xfb41 },
+	{ "horizontalbar", 0x2015 },
+	{ "jehfinalarabic", 0xfb8b },
+	{ "tedescendercyrillic", 0x04ad },
+	{ "rdblgrave", 0x0211 },
+	{ "ldotbelow", 0x1e37 },
+	{ "macronsub", 0x02cd },
+	{ "ereversedcyrillic", 0x044d },
+	{ "afii57929", 0x02bc },
+	{ "fourperemspace", 0x2005 },
+	{ "ffl", 0xfb04 },
+	{ "sokatakanahalfwidth", 0xff7f },
+	{ "controlNAK", 0x0015 },
+	{ "ocandragujarati", 0x0a91 },
+	{ "afii10041", 0x0427 },
+	{ "fitacyrillic", 0x0473 },
+	{ "neswarrow", 0x2922 },
+	{ "zcurl", 0x0291 },
+	{ "uni227720D2", 0xea66 },
+	{ "equalless", 0x22dc },
+	{ "onepersian", 0x06f1 },
+	{ "Tse", 0x0426 },
+	{ "ideographicfinancialparen", 0x3236 },
+	{ "ehbopomofo", 0x311d },
+	{ "a32", 0x2725 },
+	{ "tsecyrillic", 0x0446 },
+	{ "cieucacirclekorean", 0x3276 },
+	{ "greaterlessequal", 0x22db },
+	{ "Dafrican", 0x0189 },
+	{ "yusmallkatakana", 0x30e5 },
+	{ "emquad", 0x2001 },
+	{ "jhadeva", 0x091d },
+	{ "chieuchparenkorean", 0x3209 },
+	{ "increment", 0x2206 },
+	{ "sixperemspace", 0x2006 },
+	{ "Etaiotasublenisacute", 0x1f9c },
+	{ "ieungaparenkorean", 0x3215 },
+	{ "lmonospace", 0xff4c },
+	{ "afii10196", 0x0475 },
+	{ "Gacute", 0x01f4 },
+	{ "sehiragana", 0x305b },
+	{ "dollarsmall", 0xfe69 },
+	{ "square", 0x25a1 },
+	{ "copyright.sans", 0xf8e9 },
+	{ "zayindageshhebrew", 0xfb36 },
+	{ "rakatakana", 0x30e9 },
+	{ "uni297D.var", 0xe654 },
+	{ "sevenbengali", 0x09ed },
+	{ "shbopomofo", 0x3115 },
+	{ "kmcubedsquare", 0x33a6 },
+	{ "acyrillic", 0x0430 },
+	{ "Dcircle", 0x24b9 },
+	{ "Che", 0x0427 },
+	{ "stixEEBA", 0xeeba },
+	{ "nottriangleleftequal", 0x22ec },
+	{ "ugrave", 0x00f9 },
+	{ "Scommaaccent.small", 0xf69b },
+	{ "primerev1", 0x2035 },
+	{ "suphsol", 0xe34e },
+	{ "afii10846", 0x04d9 },
+	{ "bracketleftmonospace", 0xff3b },
+	{ "nukatakana", 0x30cc },
+	{ "shademedium", 0x2592 },
+	{ "primetriple", 0x2034 },
+	{ "hehfinalaltonearabic", 0xfba7 },
+	{ "SF030000", 0x2510 },
+	{ "HPsquare", 0x33cb },
+	{ "dalfinalarabic", 0xfeaa },
+	{ "njecyrillic", 0x045a },
+	{ "honokhukthai", 0x0e2e },
+	{ "yehhamzaabovefinalarabic", 0xfe8a },
+	{ "parenrightsuperior", 0x207e },
+	{ "commaturnedabovecmb", 0x0312 },
+	{ "Lsmall", 0xf76c },
+	{ "rvocalicvowelsigngujarati", 0x0ac3 },
+	{ "dagger", 0x2020 },
+	{ "KKsquare", 0x33cd },
+	{ "stixEE20", 0xee20 },
+	{ "Aogonek.small", 0xf66f },
+	{ "Adotbelow", 0x1ea0 },
+	{ "Iotagrave", 0x1fda },
+	{ "y", 0x0079 },
+	{ "cosquare", 0x33c7 },
+	{ "ucircumflexbelow", 0x1e77 },
+	{ "ndotbelow", 0x1e47 },
+	{ "a112", 0x2663 },
+	{ "Sdotaccent", 0x1e60 },
+	{ "ideographicrightcircle", 0x32a8 },
+	{ "tusmallkatakanahalfwidth", 0xff6f },
+	{ "afii61575", 0x202e },
+	{ "Lcommaaccent.small", 0xf68c },
+	{ "uacute.sc", 0xf7fa },
+	{ "rafehebrew", 0x05bf },
+	{ "Ssmall", 0xf773 },
+	{ "hekutaarusquare", 0x3336 },
+	{ "lira", 0x20a4 },
+	{ "c", 0x0063 },
+	{ "r.sc", 0xf772 },
+	{ "dotlessi", 0x0131 },
+	{ "aiecyrillic", 0x04d5 },
+	{ "afii10062", 0x040e },
+	{ "o", 0x006f },
+	{ "scruple", 0x2108 },
+	{ "twohackarabic", 0x0662 },
+	{ "Becyrillic", 0x0411 },
+	{ "percentarabic", 0x066a },
+	{ "b", 0x0062 },
+	{ "controlENQ", 0x0005 },
+	{ "minussuperior", 0x207b },
+	{ "sixoldstyle", 0xf736 },
+	{ "Acyrillic", 0x0410 },
+	{ "simlE", 0x2a9f },
+	{ "arrowdblse", 0x21d8 },
+	{ "SF240000", 0x2551 },
+	{ "updownharpoonleftleft", 0x2951 },
+	{ "rlinebelow", 0x1e5f },
+	{ "afii10031", 0x041d },
+	{ "twogurmukhi", 0x0a68 },
+	{ "eopenreversedclosed", 0x025e },
+	{ "digraphuk", 0x0479 },
+	{ "yagujarati", 0x0aaf },
+	{ "yusbigcyrillic", 0x046b },
+	{ "glottalstopreversedmod", 0x02c1 },
+	{ "ddhagurmukhi", 0x0a22 },
+	{ "tonebarhighmod", 0x02e6 },
+	{ "trademarksans", 0xf8ea },
+	{ "shadeva", 0x0936 },
+	{ "a144", 0x2784 },
+	{ "Upsilondieresishooksymbolgreek", 0x03d4 },
+	{ "uni2A13.lgdisplay", 0xe398 },
+	{ "dialytikatonos", 0x0385 },
+	{ "naryunion", 0x22c3 },
+	{ "afii57426", 0x0632 },
+	{ "Zhertdes", 0x0496 },
+	{ "Cbb", 0x2102 },
+	{ "Ydotbelow", 0x1ef4 },
+	{ "finalkaf", 0x05da },
+	{ "Rhoasper", 0x1fec },
+	{ "planck", 0x210e },
+	{ "nine.taboldstyle", 0xf64c },
+	{ "maichattawalowleftthai", 0xf895 },
+	{ "uni2A11.lgdisplay", 0xe39b },
+	{ "gershayim", 0x05f4 },
+	{ "tagurmukhi", 0x0a24 },
+	{ "Epsilonlenisgrave", 0x1f1a },
+	{ "sekatakana", 0x30bb },
+	{ "threehangzhou", 0x3023 },
+	{ "Zaarmenian", 0x0536 },
+	{ "segol2c", 0x05b6 },
+	{ "pokatakana", 0x30dd },
+	{ "alphaaspercircumflex", 0x1f07 },
+	{ "bhabengali", 0x09ad },
+	{ "stixEE3E", 0xee3e },
+	{ "greatersmall", 0xfe65 },
+	{ "perispomeni", 0x1fc0 },
+	{ "f_l", 0xfb02 },
+	{ "vturned", 0x028c },
+	{ "sixarabic", 0x0666 },
+	{ "ogoneknosp", 0x0328 },
+	{ "Phi", 0x03a6 },
+	{ "fourteenperiod", 0x2495 },
+	{ "one.inferior", 0x2081 },
+	{ "uni228F0338", 0xe604 },
+	{ "Rdotbelowmacron", 0x1e5c },
+	{ "mokatakana", 0x30e2 },
+	{ "a153", 0x278d },
+	{ "a152", 0x278c },
+	{ "I.short", 0x0419 },
+};
+
+static uint32_t psnames_fnv(const char *name, uint32_t seed) {
+    uint32_t h = 0x811c9dc5 ^ seed;
+
+    while ( *name ) {
+	h ^= (unsigned char) *name++;
+	h *= 0x01000193;
+    }
+return( h );
+}
+
+/* The code point of one of the built in names, or -1 */
+static int psnames_lookup(const char *name) {
+    uint32_t d = psnames_disp[psnames_fnv(name,0)%PSNAMES_BUCKETS];
+    const struct psname *pn;
+
+    if ( d==0 )
+return( -1 );
+    pn = &psnames[psnames_fnv(name,d)%PSNAMES_CNT];
+    if ( strcmp(pn->name,name)!=0 )
+return( -1 );
+return( pn->uni );
+}
+
+#endif /* FONTFORGE_PSNAMES_HASH_H */
@@ -4593,6 +4593,7 @@ SplineChar *PSCharStringToSplines(uint8_t *type1, int len, struct pscontext *con
 		    LogError( _("Use of obsolete blend operator.\n") );
 		    context->blend_warn = true;
 		}
+		context->blend_seen = true;
 		cnt = stack[sp-1];
 		sp -= context->instance_count*stack[sp-1]+1;
 		for ( i=0; i<cnt; ++i ) {
@@ -53,6 +53,7 @@
 #include "lookups.h"
 #include "mathconstants.h"
 #include "mem.h"
+#include "mm.h"
 #include "multidialog.h"
 #include "namelist.h"
 #include "nonlineartrans.h"
@@ -98,6 +99,38 @@
 extern int old_sfnt_flags;
 extern int prefRevisionsToRetain;
 
+/* Long running engine calls release the GIL so that other python threads */
+/*  can run meanwhile. This is only done without a UI, where nothing (like */
+/*  a progress dialog dispatching events to python menu callbacks) expects */
+/*  to hold it already. Anything in the engine which calls back into python */
+/*  reacquires it (see PyFF_CallDictFunc and friends).                      */
+/* The engine has process wide state (encodings and their iconv converters, */
+/*  namelists, the FreeType library, the progress indicator, hinting and   */
+/*  instruction preferences), so calls made without the GIL hold the engine */
+/*  lock instead and run one at a time. Closing a font, removing a glyph  */
+/*  or undoing takes it too (keeping the GIL, as freeing may drop python   */
+/*  objects), so that nothing is freed under a running call. The engine    */
+/*  lock is always taken before the GIL, never the other way round.        */
+static GRecMutex engine_lock;
+
+#define PyFF_BEGIN_ALLOW_THREADS { \
+	PyThreadState *_ff_save = no_windowing_ui ? PyEval_SaveThread() : NULL; \
+	if ( _ff_save!=NULL ) g_rec_mutex_lock(&engine_lock);
+#define PyFF_END_ALLOW_THREADS \
+	if ( _ff_save!=NULL ) { \
+	    g_rec_mutex_unlock(&engine_lock); \
+	    PyEval_RestoreThread(_ff_save); \
+	} }
+#define PyFF_BEGIN_EXCLUSIVE { \
+	int _ff_locked = no_windowing_ui; \
+	if ( _ff_locked ) { \
+	    Py_BEGIN_ALLOW_THREADS \
+	    g_rec_mutex_lock(&engine_lock); \
+	    Py_END_ALLOW_THREADS \
+	}
+#define PyFF_END_EXCLUSIVE \
+	if ( _ff_locked ) g_rec_mutex_unlock(&engine_lock); }
+
 /* ========== MODULE DEFINITIONS ========== */
 /* The following types are used to define Python Modules.  For every
  * module, you must create a 'module_definition' structure describing
@@ -896,7 +929,9 @@ static PyObject *PyFF_OpenFont(PyObject *UNUSED(self), PyObject *args) {
      * to LoadSplineFont, so we can't report the filename on an
      * error.
      */
+    PyFF_BEGIN_ALLOW_THREADS
     sf = LoadSplineFont(locfilename,openflags);
+    PyFF_END_ALLOW_THREADS
 
     if ( sf==NULL ) {
 	PyErr_Format(PyExc_EnvironmentError, "Open failed");
@@ -1138,6 +1173,26 @@ static PyObject *PyFF_hasSpiro(PyObject *UNUSED(self), PyObject *UNUSED(args)) {
 return( ret );
 }
 
+static PyObject *PyFF_GlyphCacheStats(PyObject *UNUSED(self), PyObject *UNUSED(args)) {
+    int hits, misses, entries;
+
+    TTFGlyphCacheStats(&hits,&misses,&entries);
+return( Py_BuildValue("(iii)",hits,misses,entries) );
+}
+
+static PyObject *PyFF_ClearGlyphCache(PyObject *UNUSED(self), PyObject *UNUSED(args)) {
+    TTFGlyphCacheClear();
+Py_RETURN_NONE;
+}
+
+static PyObject *PyFF_LayoutTableStats(PyObject *UNUSED(self), PyObject *UNUSED(args)) {
+    int gsublen, gsubsaved, gposlen, gpossaved;
+
+    LayoutTableStats(false,&gsublen,&gsubsaved);
+    LayoutTableStats(true,&gposlen,&gpossaved);
+return( Py_BuildValue("{s:(ii),s:(ii)}","GSUB",gsublen,gsubsaved,"GPOS",gposlen,gpossaved) );
+}
+
 static PyObject *PyFF_SpiroVersion(PyObject *UNUSED(self), PyObject *UNUSED(args)) {
     char *temp;
 
@@ -8518,7 +8573,9 @@ static PyObject *PyFFGlyph_autoHint(PyObject *self, PyObject *UNUSED(args)) {
     SplineChar *sc = ((PyFF_Glyph *) self)->sc;
     int layer = ((PyFF_Glyph *) self)->layer;
 
+    PyFF_BEGIN_ALLOW_THREADS
     SplineCharAutoHint(sc,layer,NULL);
+    PyFF_END_ALLOW_THREADS
     SCUpdateAll(sc);
 Py_RETURN( self );
 }
@@ -8527,9 +8584,11 @@ static PyObject *PyFFGlyph_autoInstr(PyObject *self, PyObject *UNUSED(args)) {
     SplineChar *sc = ((PyFF_Glyph *) self)->sc;
 
     GlobalInstrCt gic;
+    PyFF_BEGIN_ALLOW_THREADS
     InitGlobalInstrCt(&gic,sc->parent,((PyFF_Glyph *) self)->layer,NULL);
     NowakowskiSCAutoInstr(&gic,sc);
     FreeGlobalInstrCt(&gic);
+    PyFF_END_ALLOW_THREADS
 Py_RETURN( self );
 }
 
@@ -9515,14 +9574,18 @@ Py_RETURN( self );
 
 static PyObject *PyFFGlyph_RemoveOverlap(PyFF_Glyph *self, PyObject *UNUSED(args)) {
 
+    PyFF_BEGIN_ALLOW_THREADS
     self->sc->layers[self->layer].splines = SplineSetRemoveOverlap(self->sc,self->sc->layers[self->layer].splines,over_remove);
+    PyFF_END_ALLOW_THREADS
     SCCharChangedUpdate(self->sc,self->layer);
 Py_RETURN( self );
 }
 
 static PyObject *PyFFGlyph_Intersect(PyFF_Glyph *self, PyObject *UNUSED(args)) {
 
+    PyFF_BEGIN_ALLOW_THREADS
     self->sc->layers[self->layer].splines = SplineSetRemoveOverlap(self->sc,self->sc->layers[self->layer].splines,over_intersect);
+    PyFF_END_ALLOW_THREADS
     SCCharChangedUpdate(self->sc,self->layer);
 Py_RETURN( self );
 }
@@ -9591,10 +9654,14 @@ static PyObject *PyFFGlyph_doUndo(PyFF_Glyph *self, PyObject *args) {
         PyErr_Format(PyExc_ValueError, "Layer is out of range" );
         return( NULL );
     }
+    /* A trim to the undo budget, made by a call running without the GIL, */
+    /*  may be dropping undoes of this glyph */
+    PyFF_BEGIN_EXCLUSIVE
     if ( redo )
 	SCDoRedo(sc, layer);
     else
 	SCDoUndo(sc, layer);
+    PyFF_END_EXCLUSIVE
     Py_RETURN( self );
 }
 
@@ -9774,6 +9841,403 @@ static PyObject *PyFFGlyph_setLayer(PyFF_Glyph *self, PyObject *args) {
 	return NULL;
 }
 
+/* ************************************************************************** */
+/* Bulk point access */
+/* ************************************************************************** */
+
+/* Flags used in the per-point array of getPointArrays/setPointArrays */
+#define BULK_ON_CURVE		0x01
+#define BULK_OPEN_CONTOUR	0x02
+#define BULK_INTERPOLATED	0x04
+
+struct bulkpoints {
+    int pt_cnt, pt_max;
+    int cntr_cnt, cntr_max;
+    double *coords;		/* x,y pairs */
+    uint8_t *flags;
+    int32_t *ends;		/* Index of the last point of each contour */
+};
+
+static void BulkPointsFree(struct bulkpoints *bp) {
+    free(bp->coords);
+    free(bp->flags);
+    free(bp->ends);
+}
+
+static void BulkAddPoint(struct bulkpoints *bp, BasePoint *pt, int flags) {
+    if ( bp->pt_cnt>=bp->pt_max ) {
+	bp->pt_max = bp->pt_max==0 ? 256 : 2*bp->pt_max;
+	bp->coords = realloc(bp->coords,2*bp->pt_max*sizeof(double));
+	bp->flags = realloc(bp->flags,bp->pt_max*sizeof(uint8_t));
+    }
+    bp->coords[2*bp->pt_cnt] = pt->x;
+    bp->coords[2*bp->pt_cnt+1] = pt->y;
+    bp->flags[bp->pt_cnt++] = flags;
+}
+
+static void BulkEndContour(struct bulkpoints *bp) {
+    if ( bp->cntr_cnt>=bp->cntr_max ) {
+	bp->cntr_max = bp->cntr_max==0 ? 32 : 2*bp->cntr_max;
+	bp->ends = realloc(bp->ends,bp->cntr_max*sizeof(int32_t));
+    }
+    bp->ends[bp->cntr_cnt++] = bp->pt_cnt-1;
+}
+
+/* Points are produced in the same order as iterating over a contour object */
+static void BulkAddSplineSets(struct bulkpoints *bp, SplineSet *ss) {
+    SplinePoint *sp;
+    int open, on;
+
+    for ( ; ss!=NULL; ss=ss->next ) {
+	if ( ss->first==NULL )
+    continue;
+	open = ss->first->prev==NULL ? BULK_OPEN_CONTOUR : 0;
+	for ( sp=ss->first; ; ) {
+	    on = BULK_ON_CURVE|open;
+	    if ( sp->next!=NULL && sp->next->order2 && SPInterpolate(sp) )
+		on |= BULK_INTERPOLATED;
+	    BulkAddPoint(bp,&sp->me,on);
+	    if ( sp->next==NULL )
+	break;
+	    if ( sp->next->order2 ) {
+		if ( !sp->nonextcp )
+		    BulkAddPoint(bp,&sp->nextcp,open);
+	    } else if ( !sp->nonextcp || !sp->next->to->noprevcp ) {
+		BulkAddPoint(bp,&sp->nextcp,open);
+		BulkAddPoint(bp,&sp->next->to->prevcp,open);
+	    }
+	    sp = sp->next->to;
+	    if ( sp==ss->first )
+	break;
+	}
+	BulkEndContour(bp);
+    }
+}
+
+/* Returns a writable memoryview (of the given struct format) over a new */
+/*  bytearray, so numpy.asarray() and friends can use it without copying */
+static PyObject *BulkArrayFrom(const void *data, int cnt, int size, const char *format) {
+    PyObject *bytes, *view, *ret;
+
+    bytes = PyByteArray_FromStringAndSize(data,(Py_ssize_t) cnt*size);
+    if ( bytes==NULL )
+return( NULL );
+    view = PyMemoryView_FromObject(bytes);
+    Py_DECREF(bytes);
+    if ( view==NULL )
+return( NULL );
+    ret = PyObject_CallMethod(view,"cast","s",format);
+    Py_DECREF(view);
+return( ret );
+}
+
+static PyObject *BulkPointsToTuple(struct bulkpoints *bp) {
+    PyObject *coords, *flags, *ends;
+
+    coords = BulkArrayFrom(bp->coords,2*bp->pt_cnt,sizeof(double),"d");
+    flags = BulkArrayFrom(bp->flags,bp->pt_cnt,sizeof(uint8_t),"B");
+    ends = BulkArrayFrom(bp->ends,bp->cntr_cnt,sizeof(int32_t),"i");
+    if ( coords==NULL || flags==NULL || ends==NULL ) {
+	Py_XDECREF(coords); Py_XDECREF(flags); Py_XDECREF(ends);
+return( NULL );
+    }
+return( Py_BuildValue("(NNN)",coords,flags,ends) );
+}
+
+/* Reads any C-contiguous buffer-protocol object (or failing that, any */
+/*  sequence) holding numbers into a freshly allocated array of doubles. */
+/*  Returns the element count or -1 */
+static Py_ssize_t BulkBufferToDoubles(PyObject *obj, double **ret, const char *argname) {
+    Py_buffer view;
+    Py_ssize_t cnt, i;
+    const char *fmt;
+    double *vals;
+    PyObject *seq;
+
+    if ( !PyObject_CheckBuffer(obj) ) {
+	seq = PySequence_Fast(obj,"");
+	if ( seq==NULL ) {
+	    PyErr_Format(PyExc_TypeError, "%s must be a sequence or support the buffer protocol", argname);
+return( -1 );
+	}
+	cnt = PySequence_Fast_GET_SIZE(seq);
+	vals = malloc((cnt+1)*sizeof(double));
+	for ( i=0; i<cnt; ++i ) {
+	    vals[i] = PyFloat_AsDouble(PySequence_Fast_GET_ITEM(seq,i));
+	    if ( vals[i]==-1 && PyErr_Occurred() ) {
+		free(vals);
+		Py_DECREF(seq);
+return( -1 );
+	    }
+	}
+	Py_DECREF(seq);
+	*ret = vals;
+return( cnt );
+    }
+    if ( PyObject_GetBuffer(obj,&view,PyBUF_C_CONTIGUOUS|PyBUF_FORMAT)!=0 )
+return( -1 );
+    fmt = view.format==NULL ? "B" : view.format;
+    if ( *fmt=='@' || *fmt=='=' || *fmt=='<' || *fmt=='>' || *fmt=='!' )
+	++fmt;
+    if ( fmt[0]=='\0' || fmt[1]!='\0' || strchr("bBhHiIlLqQfd?",*fmt)==NULL ) {
+	PyErr_Format(PyExc_TypeError, "%s has an unsupported element format '%s'", argname, view.format);
+	PyBuffer_Release(&view);
+return( -1 );
+    }
+    cnt = view.len/view.itemsize;
+    vals = malloc((cnt+1)*sizeof(double));
+    for ( i=0; i<cnt; ++i ) {
+	const char *pt = (const char *) view.buf + i*view.itemsize;
+	switch ( *fmt ) {
+	  case 'b': vals[i] = *(const signed char *) pt; break;
+	  case 'B': case '?': vals[i] = *(const unsigned char *) pt; break;
+	  case 'h': vals[i] = *(const short *) pt; break;
+	  case 'H': vals[i] = *(const unsigned short *) pt; break;
+	  case 'i': vals[i] = *(const int *) pt; break;
+	  case 'I': vals[i] = *(const unsigned int *) pt; break;
+	  case 'l': vals[i] = *(const long *) pt; break;
+	  case 'L': vals[i] = *(const unsigned long *) pt; break;
+	  case 'q': vals[i] = *(const long long *) pt; break;
+	  case 'Q': vals[i] = *(const unsigned long long *) pt; break;
+	  case 'f': vals[i] = *(const float *) pt; break;
+	  default:  vals[i] = *(const double *) pt; break;
+	}
+    }
+    PyBuffer_Release(&view);
+    *ret = vals;
+return( cnt );
+}
+
+static SplinePoint *BulkNewPoint(double x, double y) {
+    SplinePoint *sp = SplinePointCreate(x,y);
+
+    sp->ttfindex = sp->nextcpindex = 0xffff;
+return( sp );
+}
+
+static int BulkAttach(SplineSet *ss, SplinePoint *to, double **off, int off_cnt, int order2) {
+    SplinePoint *from = ss->last;
+
+    if ( order2 && off_cnt==1 ) {
+	from->nextcp.x = to->prevcp.x = off[0][0];
+	from->nextcp.y = to->prevcp.y = off[0][1];
+    } else if ( !order2 && off_cnt==2 ) {
+	from->nextcp.x = off[0][0]; from->nextcp.y = off[0][1];
+	to->prevcp.x = off[1][0]; to->prevcp.y = off[1][1];
+    } else if ( off_cnt!=0 ) {
+	PyErr_Format(PyExc_ValueError, "In cubic splines there must be exactly 2 control points between on curve points");
+return( false );
+    }
+    SplineMake(from,to,order2);
+    ss->last = to;
+return( true );
+}
+
+/* Builds one contour from n points, with the same conventions a contour */
+/*  object uses: cubic segments have exactly 0 or 2 off-curve points, in  */
+/*  quadratic contours two consecutive off-curve points imply an on-curve */
+/*  point between them */
+static SplineSet *BulkContourToSS(double *coords, double *flags, int n, int order2) {
+    SplineSet *ss;
+    SplinePoint *sp;
+    int open, start, i, k, off_cnt;
+    double *off[2];
+
+    if ( n<=0 ) {
+	PyErr_Format(PyExc_ValueError, "Empty contour");
+return( NULL );
+    }
+    open = (((int) flags[0])&BULK_OPEN_CONTOUR)!=0;
+    for ( start=0; start<n && !(((int) flags[start])&BULK_ON_CURVE); ++start );
+    if ( start==n && (!order2 || open) ) {
+	PyErr_Format(PyExc_ValueError, "Contour has points but none are on-curve");
+return( NULL );
+    } else if ( open && start!=0 ) {
+	PyErr_Format(PyExc_ValueError, "An open contour must start with an on-curve point");
+return( NULL );
+    }
+
+    ss = chunkalloc(sizeof(SplineSet));
+    if ( start==n ) {
+	/* A quadratic contour made entirely of off-curve points */
+	start = 0;
+	ss->first = ss->last = BulkNewPoint((coords[2*(n-1)]+coords[0])/2,
+		(coords[2*(n-1)+1]+coords[1])/2);
+    }
+    off_cnt = 0;
+    for ( k=0; k<n; ++k ) {
+	i = (start+k)%n;
+	if ( ((int) flags[i])&BULK_ON_CURVE ) {
+	    sp = BulkNewPoint(coords[2*i],coords[2*i+1]);
+	    if ( ss->first==NULL )
+		ss->first = ss->last = sp;
+	    else if ( !BulkAttach(ss,sp,off,off_cnt,order2) ) {
+		SplinePointFree(sp);
+		SplinePointListsFree(ss);
+return( NULL );
+	    }
+	    off_cnt = 0;
+	} else {
+	    if ( order2 && off_cnt==1 ) {
+		/* Two off-curve points in a row imply an on-curve point midway */
+		sp = BulkNewPoint((off[0][0]+coords[2*i])/2,(off[0][1]+coords[2*i+1])/2);
+		BulkAttach(ss,sp,off,off_cnt,order2);
+		off_cnt = 0;
+	    } else if ( off_cnt==2 ) {
+		SplinePointListsFree(ss);
+		PyErr_Format(PyExc_ValueError, "In cubic splines there must be exactly 2 control points between on curve points");
+return( NULL );
+	    }
+	    off[off_cnt++] = &coords[2*i];
+	}
+    }
+    if ( open ) {
+	if ( off_cnt!=0 ) {
+	    SplinePointListsFree(ss);
+	    PyErr_Format(PyExc_ValueError, "An open contour must end with an on-curve point");
+return( NULL );
+	}
+    } else if ( ss->first!=ss->last || off_cnt!=0 ) {
+	if ( !BulkAttach(ss,ss->first,off,off_cnt,order2) ) {
+	    SplinePointListsFree(ss);
+return( NULL );
+	}
+    }
+    SPLCategorizePoints(ss);
+return( ss );
+}
+
+struct bulkinput {
+    double *coords, *flags, *ends, *glyph_ends;
+    Py_ssize_t pt_cnt, cntr_cnt, glyph_cnt;
+};
+
+static void BulkInputFree(struct bulkinput *bi) {
+    free(bi->coords);
+    free(bi->flags);
+    free(bi->ends);
+    free(bi->glyph_ends);
+}
+
+static int BulkInputParse(struct bulkinput *bi, PyObject *coords, PyObject *flags,
+	PyObject *ends, PyObject *glyph_ends) {
+    Py_ssize_t ccnt, i;
+
+    memset(bi,0,sizeof(*bi));
+    if ( (ccnt = BulkBufferToDoubles(coords,&bi->coords,"coords"))<0 ||
+	    (bi->pt_cnt = BulkBufferToDoubles(flags,&bi->flags,"flags"))<0 ||
+	    (bi->cntr_cnt = BulkBufferToDoubles(ends,&bi->ends,"contour ends"))<0 ||
+	    (glyph_ends!=NULL &&
+	     (bi->glyph_cnt = BulkBufferToDoubles(glyph_ends,&bi->glyph_ends,"glyph ends"))<0) ) {
+	BulkInputFree(bi);
+return( false );
+    }
+    if ( ccnt!=2*bi->pt_cnt ) {
+	PyErr_Format(PyExc_ValueError, "There must be two coordinates for every point flag");
+	BulkInputFree(bi);
+return( false );
+    }
+    for ( i=0; i<bi->cntr_cnt; ++i ) {
+	if ( bi->ends[i]>=bi->pt_cnt || (i>0 && bi->ends[i]<=bi->ends[i-1]) || bi->ends[i]<0 ) {
+	    PyErr_Format(PyExc_ValueError, "Contour ends must be increasing point indices");
+	    BulkInputFree(bi);
+return( false );
+	}
+    }
+    if ( bi->cntr_cnt>0 ? bi->ends[bi->cntr_cnt-1]!=bi->pt_cnt-1 : bi->pt_cnt!=0 ) {
+	PyErr_Format(PyExc_ValueError, "The last contour must end at the last point");
+	BulkInputFree(bi);
+return( false );
+    }
+    for ( i=0; i<bi->glyph_cnt; ++i ) {
+	if ( bi->glyph_ends[i]>bi->cntr_cnt || (i>0 && bi->glyph_ends[i]<bi->glyph_ends[i-1]) || bi->glyph_ends[i]<0 ) {
+	    PyErr_Format(PyExc_ValueError, "Glyph ends must be non-decreasing contour counts");
+	    BulkInputFree(bi);
+return( false );
+	}
+    }
+return( true );
+}
+
+/* Builds the contours [c0,c1) described by the bulk input */
+static int BulkInputToSS(struct bulkinput *bi, int c0, int c1, int order2, SplineSet **ret) {
+    SplineSet *head=NULL, *last=NULL, *cur;
+    int c, p0;
+
+    for ( c=c0; c<c1; ++c ) {
+	p0 = c==0 ? 0 : (int) bi->ends[c-1]+1;
+	cur = BulkContourToSS(bi->coords+2*p0,bi->flags+p0,(int) bi->ends[c]-p0+1,order2);
+	if ( cur==NULL ) {
+	    SplinePointListsFree(head);
+return( false );
+	}
+	if ( head==NULL )
+	    head = cur;
+	else
+	    last->next = cur;
+	last = cur;
+    }
+    *ret = head;
+return( true );
+}
+
+static int BulkLayerCheck(SplineChar *sc, int layer) {
+    if ( layer<ly_back || layer>=sc->layer_cnt ) {
+	PyErr_Format(PyExc_ValueError, "Layer is out of range" );
+return( false );
+    }
+return( true );
+}
+
+static char *glyph_getpointarrays_keywords[] = { "layer", NULL };
+
+static PyObject *PyFFGlyph_getPointArrays(PyFF_Glyph *self, PyObject *args, PyObject *keywds) {
+    struct bulkpoints bp;
+    PyObject *layerp = NULL, *ret;
+    int layer = self->layer;
+
+    if ( !PyArg_ParseTupleAndKeywords(args,keywds,"|O",glyph_getpointarrays_keywords,&layerp) )
+return( NULL );
+    if ( layerp!=NULL && (layer = LayerArgToLayer(self->sc->parent,layerp))==ly_none )
+return( NULL );
+    if ( !BulkLayerCheck(self->sc,layer) )
+return( NULL );
+
+    memset(&bp,0,sizeof(bp));
+    BulkAddSplineSets(&bp,self->sc->layers[layer].splines);
+    ret = BulkPointsToTuple(&bp);
+    BulkPointsFree(&bp);
+return( ret );
+}
+
+static char *glyph_setpointarrays_keywords[] = { "coords", "flags", "ends", "layer", NULL };
+
+static PyObject *PyFFGlyph_setPointArrays(PyFF_Glyph *self, PyObject *args, PyObject *keywds) {
+    struct bulkinput bi;
+    PyObject *coords, *flags, *ends, *layerp = NULL;
+    SplineSet *ss;
+    int layer = self->layer;
+
+    if ( !PyArg_ParseTupleAndKeywords(args,keywds,"OOO|O",glyph_setpointarrays_keywords,
+	    &coords,&flags,&ends,&layerp) )
+return( NULL );
+    if ( layerp!=NULL && (layer = LayerArgToLayer(self->sc->parent,layerp))==ly_none )
+return( NULL );
+    if ( !BulkLayerCheck(self->sc,layer) || !BulkInputParse(&bi,coords,flags,ends,NULL) )
+return( NULL );
+
+    if ( !BulkInputToSS(&bi,0,bi.cntr_cnt,self->sc->layers[layer].order2,&ss) ) {
+	BulkInputFree(&bi);
+return( NULL );
+    }
+    BulkInputFree(&bi);
+    SCPreserveLayer(self->sc,layer,false);
+    SplinePointListsFree(self->sc->layers[layer].splines);
+    self->sc->layers[layer].splines = ss;
+    SCCharChangedUpdate(self->sc,layer);
+Py_RETURN( self );
+}
+
 static PyMethodDef PyFF_Glyph_methods[] = {
     { "glyphPen", (PyCFunction) PyFFGlyph_GlyphPen, METH_VARARGS | METH_KEYWORDS, "Create a pen object which can draw into this glyph"},
     { "draw", (PyCFunction) PyFFGlyph_draw, METH_VARARGS , "Draw the glyph's outline to the pen argument"},
@@ -9801,6 +10265,7 @@ static PyMethodDef PyFF_Glyph_methods[] = {
     { "exclude", (PyCFunction) PyFFGlyph_Exclude, METH_VARARGS, "Exclude the area of the argument (a layer) from the current glyph"},
     { "export", (PyCFunction) PyFFGlyph_export, METH_VARARGS|METH_KEYWORDS, "Export the glyph, the format is determined by the extension. (provide the filename of the image file)" },
     { "genericGlyphChange", (PyCFunction) PyFFGlyph_genericGlyphChange, METH_VARARGS | METH_KEYWORDS, "Rather like changeWeight or condenseExtend, called 'Change Glyph' in UI"},
+    { "getPointArrays", (PyCFunction)PyFFGlyph_getPointArrays, METH_VARARGS | METH_KEYWORDS, "Returns the points of a layer as (coords, flags, contour ends) buffer arrays"},
     { "getPosSub", PyFFGlyph_getPosSub, METH_VARARGS, "Gets position/substitution data from the glyph"},
     { "importOutlines", (PyCFunction) PyFFGlyph_import, METH_VARARGS|METH_KEYWORDS, "Import a background image or a foreground eps/svg/etc. (provide the filename of the image file)" },
     { "intersect", (PyCFunction) PyFFGlyph_Intersect, METH_NOARGS, "Leaves the areas where the contours of a glyph overlap."},
@@ -9809,6 +10274,7 @@ static PyMethodDef PyFF_Glyph_methods[] = {
     { "removePosSub", PyFFGlyph_removePosSub, METH_VARARGS, "Removes position/substitution data from the glyph"},
     { "round", (PyCFunction)PyFFGlyph_Round, METH_VARARGS, "Rounds point coordinates (and reference translations) to integers"},
     { "selfIntersects", (PyCFunction)PyFFGlyph_selfIntersects, METH_NOARGS, "Returns whether this glyph intersects itself" },
+    { "setPointArrays", (PyCFunction)PyFFGlyph_setPointArrays, METH_VARARGS | METH_KEYWORDS, "Replaces the contents of a layer with points from (coords, flags, contour ends) buffer arrays"},
     { "setLayer", (PyCFunction)PyFFGlyph_setLayer, METH_VARARGS, "Replaces the content of the specified layer" },
     { "validate", (PyCFunction)PyFFGlyph_validate, METH_VARARGS, "Returns whether this glyph is valid for output (if not check validation_state" },
     { "simplify", (PyCFunction)PyFFGlyph_Simplify, METH_VARARGS, "Simplifies a glyph" },
@@ -11743,8 +12209,10 @@ return( NULL );
     }
 
     fv->python_fv_object = NULL;
-    FontViewClose(fv);
     self->fv = NULL;
+    PyFF_BEGIN_EXCLUSIVE
+    FontViewClose(fv);
+    PyFF_END_EXCLUSIVE
 Py_RETURN_NONE;
 }
 
@@ -16858,6 +17326,26 @@ struct flaglist genttc_flags[] = {
     FLAGLIST_EMPTY /* Sentinel */
 };
 
+/* The flags GenerateScript wants for a tuple of generate flags */
+static int GenerateFlags(PyObject *flags) {
+    int iflags = FlagsFromTuple(flags,gen_flags,"generate flag");
+
+    if ( iflags==FLAG_UNKNOWN )
+return( iflags );
+    /* Legacy screw ups mean that opentype & apple bits don't mean what */
+    /*  I want them to. Python users should not see that, but fix it up */
+    /*  here */
+    if ( (iflags&0x80) && (iflags&0x10) )	/* Both */
+	iflags &= ~0x10;
+    else if ( (iflags&0x80) && !(iflags&0x10)) /* Just opentype */
+	iflags &= ~0x80;
+    else if ( !(iflags&0x80) && (iflags&0x10)) /* Just apple */
+	/* This one's set already */;
+    else
+	iflags |= 0x90;
+return( iflags );
+}
+
 static PyObject *PyFFFont_Generate(PyFF_Font *self, PyObject *args, PyObject *keywds) {
     char *filename;
     char *locfilename = NULL;
@@ -16868,7 +17356,7 @@ static PyObject *PyFFFont_Generate(PyFF_Font *self, PyObject *args, PyObject *ke
     const char *bitmaptype="";
     char *subfontdirectory=NULL, *namelist=NULL;
     NameList *rename_to = NULL;
-    int layer;
+    int layer, ok;
     char *layer_str=NULL;
 
     if ( CheckIfFontClosed(self) )
@@ -16892,21 +17380,10 @@ return( NULL );
 return( NULL );
     }
     if ( flags!=NULL ) {
-	iflags = FlagsFromTuple(flags,gen_flags,"generate flag");
+	iflags = GenerateFlags(flags);
 	if ( iflags==FLAG_UNKNOWN ) {
 return( NULL );
 	}
-	/* Legacy screw ups mean that opentype & apple bits don't mean what */
-	/*  I want them to. Python users should not see that, but fix it up */
-	/*  here */
-	if ( (iflags&0x80) && (iflags&0x10) )	/* Both */
-	    iflags &= ~0x10;
-	else if ( (iflags&0x80) && !(iflags&0x10)) /* Just opentype */
-	    iflags &= ~0x80;
-	else if ( !(iflags&0x80) && (iflags&0x10)) /* Just apple */
-	    /* This one's set already */;
-	else
-	    iflags |= 0x90;
     }
     if ( namelist!=NULL ) {
 	rename_to = NameListByName(namelist);
@@ -16916,12 +17393,15 @@ return( NULL );
 	}
     }
     locfilename = utf82def_copy(filename);
-    if ( !GenerateScript(fv->sf,locfilename,bitmaptype,iflags,resolution,subfontdirectory,
-	    NULL,fv->normal==NULL?fv->map:fv->normal,rename_to,layer) ) {
+    PyFF_BEGIN_ALLOW_THREADS
+    ok = GenerateScript(fv->sf,locfilename,bitmaptype,iflags,resolution,subfontdirectory,
+	    NULL,fv->normal==NULL?fv->map:fv->normal,rename_to,layer);
+    PyFF_END_ALLOW_THREADS
+    free(locfilename);
+    if ( !ok ) {
 	PyErr_Format(PyExc_EnvironmentError, "Font generation failed");
 return( NULL );
     }
-    free(locfilename);
 Py_RETURN( self );
 }
 
@@ -16997,21 +17477,10 @@ return( NULL );
 return( NULL );
     }
     if ( flags!=NULL ) {
-	iflags = FlagsFromTuple(flags,gen_flags,"generate flag");
+	iflags = GenerateFlags(flags);
 	if ( iflags==FLAG_UNKNOWN ) {
 return( NULL );
 	}
-	/* Legacy screw ups mean that opentype & apple bits don't mean what */
-	/*  I want them to. Python users should not see that, but fix it up */
-	/*  here */
-	if ( (iflags&0x80) && (iflags&0x10) )	/* Both */
-	    iflags &= ~0x10;
-	else if ( (iflags&0x80) && !(iflags&0x10)) /* Just opentype */
-	    iflags &= ~0x80;
-	else if ( !(iflags&0x80) && (iflags&0x10)) /* Just apple */
-	    /* This one's set already */;
-	else
-	    iflags |= 0x90;
     }
     if ( ttcflags!=NULL ) {
 	ittcflags = FlagsFromTuple(ttcflags,genttc_flags,"generate TTC flag");
@@ -17083,19 +17552,112 @@ return( NULL );
 Py_RETURN( self );
 }
 
-static PyObject *PyFFFont_GenerateFeature(PyFF_Font *self, PyObject *args) {
+static char *generateinstances_keywords[] = { "locations", "filenames", "flags", NULL };
+
+static PyObject *PyFFFont_GenerateInstances(PyFF_Font *self, PyObject *args, PyObject *keywds) {
+    PyObject *locations, *filenames, *flags=NULL, *loc, *item;
+    FontViewBase *fv;
+    MMSet *mm;
+    real *coords;
+    char **locfilenames;
+    const char *str;
+    int i, j, cnt, ok, iflags = -1;
+
+    if ( CheckIfFontClosed(self) )
+return (NULL);
+    fv = self->fv;
+    if ( !PyArg_ParseTupleAndKeywords(args,keywds,"OO|O",generateinstances_keywords,
+	    &locations,&filenames,&flags) )
+return( NULL );
+    if ( (mm = fv->sf->mm)==NULL ) {
+	PyErr_Format(PyExc_TypeError, "Not a multiple master font" );
+return( NULL );
+    }
+    if ( !PySequence_Check(locations) || !PySequence_Check(filenames) ||
+	    PyUnicode_Check(filenames) ) {
+	PyErr_Format(PyExc_TypeError, "Expected sequences of locations and of file names" );
+return( NULL );
+    }
+    cnt = PySequence_Size(locations);
+    if ( cnt!=PySequence_Size(filenames) ) {
+	PyErr_Format(PyExc_ValueError, "There must be one file name for each location" );
+return( NULL );
+    }
+    if ( flags!=NULL ) {
+	iflags = GenerateFlags(flags);
+	if ( iflags==FLAG_UNKNOWN )
+return( NULL );
+    }
+
+    coords = malloc((cnt*mm->axis_count+1)*sizeof(real));
+    locfilenames = calloc(cnt+1,sizeof(char *));
+    for ( i=0; i<cnt; ++i ) {
+	loc = PySequence_GetItem(locations,i);
+	if ( loc==NULL || !PySequence_Check(loc) || PySequence_Size(loc)!=mm->axis_count ) {
+	    Py_XDECREF(loc);
+	    PyErr_Format(PyExc_ValueError, "Each location must have one coordinate for each of the %d axes", mm->axis_count );
+  goto fail;
+	}
+	for ( j=0; j<mm->axis_count; ++j ) {
+	    item = PySequence_GetItem(loc,j);
+	    coords[i*mm->axis_count+j] = item==NULL ? -1 : PyFloat_AsDouble(item);
+	    Py_XDECREF(item);
+	    if ( PyErr_Occurred() ) {
+		Py_DECREF(loc);
+  goto fail;
+	    }
+	}
+	Py_DECREF(loc);
+	item = PySequence_GetItem(filenames,i);
+	str = item==NULL ? NULL : PyUnicode_AsUTF8(item);
+	if ( str==NULL ) {
+	    Py_XDECREF(item);
+	    if ( !PyErr_Occurred() )
+		PyErr_Format(PyExc_TypeError, "File names must be strings" );
+  goto fail;
+	}
+	locfilenames[i] = utf82def_copy(str);
+	Py_DECREF(item);
+    }
+
+    PyFF_BEGIN_ALLOW_THREADS
+    ok = MMGenerateInstances(mm,cnt,coords,locfilenames,
+	    fv->normal==NULL?fv->map:fv->normal,iflags,fv->active_layer);
+    PyFF_END_ALLOW_THREADS
+    for ( i=0; i<cnt; ++i )
+	free(locfilenames[i]);
+    free(locfilenames);
+    free(coords);
+    if ( !ok ) {
+	PyErr_Format(PyExc_EnvironmentError, "Instance generation failed");
+return( NULL );
+    }
+Py_RETURN( self );
+
+  fail:
+    for ( i=0; i<cnt; ++i )
+	free(locfilenames[i]);
+    free(locfilenames);
+    free(coords);
+return( NULL );
+}
+
+static char *generatefeature_keywords[] = { "filename", "lookup_name", "fast", NULL };
+
+static PyObject *PyFFFont_GenerateFeature(PyFF_Font *self, PyObject *args, PyObject *keywds) {
     char *filename;
     char *locfilename = NULL;
     char *lookup_name = NULL;
     FontViewBase *fv;
     FILE *out;
     OTLookup *otl = NULL;
-    int err;
+    int err, fast = false;
 
     if ( CheckIfFontClosed(self) )
 return (NULL);
     fv = self->fv;
-    if ( !PyArg_ParseTuple(args,"s|s",&filename,&lookup_name) )
+    if ( !PyArg_ParseTupleAndKeywords(args,keywds,"s|s$p",generatefeature_keywords,
+	    &filename,&lookup_name,&fast) )
 return( NULL );
     locfilename = utf82def_copy(filename);
 
@@ -17113,9 +17675,9 @@ return( NULL );
 return( NULL );
     }
     if ( otl!=NULL )
-	FeatDumpOneLookup(out,fv->sf,otl);
+	_FeatDumpOneLookup(out,fv->sf,otl,fast);
     else
-	FeatDumpFontLookups(out,fv->sf);
+	_FeatDumpFontLookups(out,fv->sf,fast);
     err = ferror(out);
     if ( fclose(out)!=0 || err ) {
 	PyErr_Format(PyExc_EnvironmentError, "IO error on file %s", locfilename);
@@ -17366,7 +17928,9 @@ return( NULL );
 return( NULL );
 	}
     }
+    PyFF_BEGIN_EXCLUSIVE
     SFRemoveGlyph(fv->sf,sc);
+    PyFF_END_EXCLUSIVE
 Py_RETURN( self );
 }
 
@@ -18068,7 +18632,9 @@ static PyObject *PyFFFont_autoHint(PyFF_Font *self, PyObject *UNUSED(args)) {
     if ( CheckIfFontClosed(self) )
 return (NULL);
     fv = self->fv;
+    PyFF_BEGIN_ALLOW_THREADS
     FVAutoHint(fv);
+    PyFF_END_ALLOW_THREADS
 Py_RETURN( self );
 }
 
@@ -18078,7 +18644,9 @@ static PyObject *PyFFFont_autoInstr(PyFF_Font *self, PyObject *UNUSED(args)) {
     if ( CheckIfFontClosed(self) )
 return (NULL);
     fv = self->fv;
+    PyFF_BEGIN_ALLOW_THREADS
     FVAutoInstr(fv);
+    PyFF_END_ALLOW_THREADS
 Py_RETURN( self );
 }
 
@@ -18314,14 +18882,18 @@ Py_RETURN( self );
 static PyObject *PyFFFont_RemoveOverlap(PyFF_Font *self, PyObject *UNUSED(args)) {
     if ( CheckIfFontClosed(self) )
 return (NULL);
+    PyFF_BEGIN_ALLOW_THREADS
     FVOverlap(self->fv,over_remove);
+    PyFF_END_ALLOW_THREADS
 Py_RETURN( self );
 }
 
 static PyObject *PyFFFont_Intersect(PyFF_Font *self, PyObject *UNUSED(args)) {
     if ( CheckIfFontClosed(self) )
 return (NULL);
+    PyFF_BEGIN_ALLOW_THREADS
     FVOverlap(self->fv,over_intersect);
+    PyFF_END_ALLOW_THREADS
 Py_RETURN( self );
 }
 
@@ -18343,6 +18915,164 @@ static PyObject *PyFFFont_correctReferences(PyFF_Font *self, PyObject *UNUSED(ar
 Py_RETURN( self );
 }
 
+/* Resolves the glyphs argument of the bulk point routines. A NULL or None */
+/*  argument means all glyphs of the font, in GID order */
+static int BulkGlyphList(SplineFont *sf, PyObject *glyphs, SplineChar ***ret) {
+    SplineChar **scs;
+    PyObject *item;
+    int cnt, i, gid;
+
+    if ( glyphs==NULL || glyphs==Py_None ) {
+	scs = malloc((sf->glyphcnt+1)*sizeof(SplineChar *));
+	for ( gid=cnt=0; gid<sf->glyphcnt; ++gid )
+	    if ( sf->glyphs[gid]!=NULL )
+		scs[cnt++] = sf->glyphs[gid];
+	*ret = scs;
+return( cnt );
+    }
+    if ( !PySequence_Check(glyphs) || PyUnicode_Check(glyphs) ) {
+	PyErr_Format(PyExc_TypeError, "Expected a sequence of glyphs or glyph names");
+return( -1 );
+    }
+    cnt = PySequence_Size(glyphs);
+    scs = malloc((cnt+1)*sizeof(SplineChar *));
+    for ( i=0; i<cnt; ++i ) {
+	item = PySequence_GetItem(glyphs,i);
+	if ( item==NULL ) {
+	    free(scs);
+return( -1 );
+	}
+	if ( PyType_IsSubtype(&PyFF_GlyphType, Py_TYPE(item)) ) {
+	    scs[i] = ((PyFF_Glyph *) item)->sc;
+	    if ( scs[i]->parent!=sf ) {
+		PyErr_Format(PyExc_ValueError, "Glyph %s is not in this font", scs[i]->name);
+		scs[i] = NULL;
+	    }
+	} else if ( PyUnicode_Check(item) ) {
+	    const char *name = PyUnicode_AsUTF8(item);
+	    scs[i] = name==NULL ? NULL : SFGetChar(sf,-1,name);
+	    if ( scs[i]==NULL && name!=NULL )
+		PyErr_Format(PyExc_ValueError, "No glyph named %s", name);
+	} else {
+	    PyErr_Format(PyExc_TypeError, "Expected a glyph or a glyph name");
+	    scs[i] = NULL;
+	}
+	Py_DECREF(item);
+	if ( scs[i]==NULL ) {
+	    free(scs);
+return( -1 );
+	}
+    }
+    *ret = scs;
+return( cnt );
+}
+
+static char *font_getpointarrays_keywords[] = { "glyphs", "layer", NULL };
+
+static PyObject *PyFFFont_getPointArrays(PyFF_Font *self, PyObject *args, PyObject *keywds) {
+    struct bulkpoints bp;
+    PyObject *glyphs = NULL, *layerp = NULL, *pts, *gends, *ret;
+    SplineFont *sf;
+    SplineChar **scs;
+    int32_t *glyph_ends;
+    int layer, cnt, i;
+
+    if ( CheckIfFontClosed(self) )
+return( NULL );
+    if ( !PyArg_ParseTupleAndKeywords(args,keywds,"|OO",font_getpointarrays_keywords,&glyphs,&layerp) )
+return( NULL );
+    sf = self->fv->sf;
+    layer = self->fv->active_layer;
+    if ( layerp!=NULL && (layer = LayerArgToLayer(sf,layerp))==ly_none )
+return( NULL );
+    if ( layer<ly_back || layer>=sf->layer_cnt ) {
+	PyErr_Format(PyExc_ValueError, "Layer is out of range" );
+return( NULL );
+    }
+    if ( (cnt = BulkGlyphList(sf,glyphs,&scs))<0 )
+return( NULL );
+
+    memset(&bp,0,sizeof(bp));
+    glyph_ends = malloc((cnt+1)*sizeof(int32_t));
+    for ( i=0; i<cnt; ++i ) {
+	BulkAddSplineSets(&bp,scs[i]->layers[layer].splines);
+	glyph_ends[i] = bp.cntr_cnt;
+    }
+    free(scs);
+    pts = BulkPointsToTuple(&bp);
+    gends = BulkArrayFrom(glyph_ends,cnt,sizeof(int32_t),"i");
+    BulkPointsFree(&bp);
+    free(glyph_ends);
+    if ( pts==NULL || gends==NULL ) {
+	Py_XDECREF(pts); Py_XDECREF(gends);
+return( NULL );
+    }
+    ret = Py_BuildValue("(OOON)",PyTuple_GET_ITEM(pts,0),PyTuple_GET_ITEM(pts,1),
+	    PyTuple_GET_ITEM(pts,2),gends);
+    Py_DECREF(pts);
+return( ret );
+}
+
+static char *font_setpointarrays_keywords[] = { "coords", "flags", "ends", "glyph_ends", "glyphs", "layer", NULL };
+
+static PyObject *PyFFFont_setPointArrays(PyFF_Font *self, PyObject *args, PyObject *keywds) {
+    struct bulkinput bi;
+    PyObject *coords, *flags, *ends, *gends, *glyphs = NULL, *layerp = NULL;
+    SplineFont *sf;
+    SplineChar **scs;
+    SplineSet **sss;
+    int layer, cnt, i, c0;
+
+    if ( CheckIfFontClosed(self) )
+return( NULL );
+    if ( !PyArg_ParseTupleAndKeywords(args,keywds,"OOOO|OO",font_setpointarrays_keywords,
+	    &coords,&flags,&ends,&gends,&glyphs,&layerp) )
+return( NULL );
+    sf = self->fv->sf;
+    layer = self->fv->active_layer;
+    if ( layerp!=NULL && (layer = LayerArgToLayer(sf,layerp))==ly_none )
+return( NULL );
+    if ( layer<ly_back || layer>=sf->layer_cnt ) {
+	PyErr_Format(PyExc_ValueError, "Layer is out of range" );
+return( NULL );
+    }
+    if ( (cnt = BulkGlyphList(sf,glyphs,&scs))<0 )
+return( NULL );
+    if ( !BulkInputParse(&bi,coords,flags,ends,gends) ) {
+	free(scs);
+return( NULL );
+    }
+    if ( bi.glyph_cnt!=cnt || (cnt>0 && bi.glyph_ends[cnt-1]!=bi.cntr_cnt) ) {
+	PyErr_Format(PyExc_ValueError, "Glyph ends must have one entry per glyph, the last covering all contours");
+	BulkInputFree(&bi);
+	free(scs);
+return( NULL );
+    }
+
+    /* Build everything first, so a bad contour leaves the font untouched */
+    sss = calloc(cnt+1,sizeof(SplineSet *));
+    for ( i=c0=0; i<cnt; c0 = (int) bi.glyph_ends[i++] ) {
+	if ( !BulkInputToSS(&bi,c0,(int) bi.glyph_ends[i],scs[i]->layers[layer].order2,&sss[i]) ) {
+	    while ( --i>=0 )
+		SplinePointListsFree(sss[i]);
+	    free(sss);
+	    BulkInputFree(&bi);
+	    free(scs);
+return( NULL );
+	}
+    }
+    for ( i=0; i<cnt; ++i ) {
+	SCPreserveLayer(scs[i],layer,false);
+	SplinePointListsFree(scs[i]->layers[layer].splines);
+	scs[i]->layers[layer].splines = sss[i];
+	SCCharChangedUpdate(scs[i],layer);
+    }
+    free(sss);
+    BulkInputFree(&bi);
+    free(scs);
+Py_RETURN( self );
+}
+
 static PyObject *PyFFFont_validate(PyFF_Font *self, PyObject *args) {
     FontViewBase *fv;
     SplineFont *sf;
@@ -18357,6 +19087,98 @@ return( NULL );
 return( Py_BuildValue("i", SFValidate(sf,fv->active_layer,force)));
 }
 
+static struct flaglist validation_flags[] = {
+    { "open-contour", vs_opencontour },
+    { "self-intersects", vs_selfintersects },
+    { "wrong-direction", vs_wrongdirection },
+    { "flipped-references", vs_flippedreferences },
+    { "missing-extrema", vs_missingextrema },
+    { "missing-glyphname-in-gsub", vs_missingglyphnameingsub },
+    { "too-many-points", vs_toomanypoints },
+    { "too-many-hints", vs_toomanyhints },
+    { "bad-glyphname", vs_badglyphname },
+    { "maxp-too-many-points", vs_maxp_toomanypoints },
+    { "maxp-too-many-paths", vs_maxp_toomanypaths },
+    { "maxp-too-many-comp-points", vs_maxp_toomanycomppoints },
+    { "maxp-too-many-comp-paths", vs_maxp_toomanycomppaths },
+    { "maxp-instr-too-long", vs_maxp_instrtoolong },
+    { "maxp-too-many-refs", vs_maxp_toomanyrefs },
+    { "maxp-refs-too-deep", vs_maxp_refstoodeep },
+    { "points-too-far-apart", vs_pointstoofarapart },
+    { "non-integral", vs_nonintegral },
+    { "missing-anchor", vs_missinganchor },
+    { "duplicate-name", vs_dupname },
+    { "duplicate-unicode", vs_dupunicode },
+    { "overlapped-hints", vs_overlappedhints },
+    FLAGLIST_EMPTY /* Sentinel */
+};
+
+static PyObject *PyFFFont_validationReport(PyFF_Font *self, PyObject *args) {
+    FontViewBase *fv;
+    SplineFont *sf, *sub;
+    SplineChar *sc;
+    PyObject *dict, *tuple;
+    int force=false, layer, k, gid, i, cnt, vs;
+
+    if ( CheckIfFontClosed(self) )
+return (NULL);
+    fv = self->fv;
+    sf = fv->sf;
+    layer = fv->active_layer;
+    if ( !PyArg_ParseTuple(args,"|i",&force) )
+return( NULL );
+    if ( SFValidate(sf,layer,force)==-1 ) {
+	PyErr_Format(PyExc_RuntimeError, "Validation was cancelled");
+return( NULL );
+    }
+    if ( sf->cidmaster )
+	sf = sf->cidmaster;
+
+    dict = PyDict_New();
+    if ( dict==NULL )
+return( NULL );
+    k = 0;
+    do {
+	sub = sf->subfontcnt==0 ? sf : sf->subfonts[k];
+	for ( gid=0; gid<sub->glyphcnt; ++gid ) if ( (sc=sub->glyphs[gid])!=NULL ) {
+	    vs = sc->layers[layer].validation_state&~vs_known;
+	    if ( sc->unlink_rm_ovrlp_save_undo )
+		vs &= ~vs_selfintersects;
+	    if ( vs==0 )
+	continue;
+	    for ( i=cnt=0; validation_flags[i].name!=NULL; ++i )
+		if ( vs&validation_flags[i].flag )
+		    ++cnt;
+	    tuple = PyTuple_New(cnt);
+	    if ( tuple==NULL ) {
+		Py_DECREF(dict);
+return( NULL );
+	    }
+	    for ( i=cnt=0; validation_flags[i].name!=NULL; ++i )
+		if ( vs&validation_flags[i].flag )
+		    PyTuple_SET_ITEM(tuple,cnt++,PyUnicode_FromString(validation_flags[i].name));
+	    if ( PyDict_SetItemString(dict,sc->name,tuple)!=0 ) {
+		Py_DECREF(tuple);
+		Py_DECREF(dict);
+return( NULL );
+	    }
+	    Py_DECREF(tuple);
+	}
+	++k;
+    } while ( k<sf->subfontcnt );
+return( dict );
+}
+
+static PyObject *PyFFFont_undoMemory(PyFF_Font *self, PyObject *UNUSED(args)) {
+    size_t bytes;
+    int cnt;
+
+    if ( CheckIfFontClosed(self) )
+return (NULL);
+    bytes = SFUndoBytes(self->fv->sf,&cnt);
+return( Py_BuildValue("(ni)", (Py_ssize_t) bytes, cnt));
+}
+
 static PyObject *PyFFFont_reencode(PyFF_Font *self, PyObject *args) {
     int force=0;
     const char *encname;
@@ -18390,7 +19212,8 @@ PyMethodDef PyFF_Font_methods[] = {
     { "save", (PyCFunction) PyFFFont_Save, METH_VARARGS, "Save the current font to a sfd file" },
     { "generate", (PyCFunction) PyFFFont_Generate, METH_VARARGS | METH_KEYWORDS, "Save the current font to a standard font file" },
     { "generateTtc", (PyCFunction) PyFFFont_GenerateTTC, METH_VARARGS | METH_KEYWORDS, "Save the current font and some others into a truetype collection file" },
-    { "generateFeatureFile", (PyCFunction) PyFFFont_GenerateFeature, METH_VARARGS, "Creates an adobe feature file containing all features and lookups" },
+    { "generateFeatureFile", (PyCFunction) PyFFFont_GenerateFeature, METH_VARARGS | METH_KEYWORDS, "Creates an adobe feature file containing all features and lookups" },
+    { "generateInstances", (PyCFunction) PyFFFont_GenerateInstances, METH_VARARGS | METH_KEYWORDS, "Blends a multiple master font at each of a list of locations and saves each instance to a file" },
     { "mergeKern", (PyCFunction) PyFFFont_MergeKern, METH_VARARGS, "Merge feature data into the current font from an external file" },
     { "mergeFeature", (PyCFunction) PyFFFont_MergeKern, METH_VARARGS, "Merge feature data into the current font from an external file" },
     { "mergeFonts", (PyCFunction) PyFFFont_MergeFonts, METH_VARARGS, "Merge two fonts" },
@@ -18418,6 +19241,7 @@ PyMethodDef PyFF_Font_methods[] = {
     { "buildOrReplaceAALTFeatures", (PyCFunction) PyFFFont_buildOrReplaceAALTFeatures, METH_NOARGS, "Removes any existing 'aalt' features and builds new ones."},
     { "findEncodingSlot", (PyCFunction) PyFFFont_findEncodingSlot, METH_VARARGS, "Returns the encoding of a unicode code point or glyph name if they are in the current encoding. Else returns -1" },
     { "getKerningClass", (PyCFunction) PyFFFont_getKerningClass, METH_VARARGS, "Returns the contents of the kerning class in the named subtable"},
+    { "getPointArrays", (PyCFunction) PyFFFont_getPointArrays, METH_VARARGS | METH_KEYWORDS, "Returns the points of many glyphs as (coords, flags, contour ends, glyph ends) buffer arrays" },
     { "getLookupInfo", (PyCFunction) PyFFFont_getLookupInfo, METH_VARARGS, "Get info about the named lookup" },
     { "getLookupSubtables", (PyCFunction) PyFFFont_getLookupSubtables, METH_VARARGS, "Get a tuple of subtable names in a lookup" },
     { "getLookupSubtableAnchorClasses", (PyCFunction) PyFFFont_getLookupSubtableAnchorClasses, METH_VARARGS, "Get a tuple of all anchor classes in a subtable" },
@@ -18439,6 +19263,7 @@ PyMethodDef PyFF_Font_methods[] = {
     { "removeGlyph", (PyCFunction) PyFFFont_removeGlyph, METH_VARARGS, "Removes the glyph from the font" },
     { "removeLookup", (PyCFunction) PyFFFont_removeLookup, METH_VARARGS, "Removes the named lookup" },
     { "removeLookupSubtable", (PyCFunction) PyFFFont_removeLookupSubtable, METH_VARARGS, "Removes the named lookup subtable" },
+    { "setPointArrays", (PyCFunction) PyFFFont_setPointArrays, METH_VARARGS | METH_KEYWORDS, "Replaces the contents of many glyphs' layers with points from buffer arrays" },
     { "saveNamelist", (PyCFunction) PyFFFont_saveNamelist, METH_VARARGS, "Saves the namelist of the current font." },
     { "replaceAll", (PyCFunction) PyFFFont_replaceAll, METH_VARARGS, "Searches for a pattern in the font and replaces it with another everywhere it was found" },
     { "find", (PyCFunction) PyFFFont_find, METH_VARARGS, "Searches for a pattern in the font and returns an iterator which produces glyphs with that pattern" },
@@ -18480,6 +19305,8 @@ PyMethodDef PyFF_Font_methods[] = {
     { "transform", (PyCFunction)PyFFFont_Transform, METH_VARARGS, "Transform a font by a 6 element matrix." },
     { "nltransform", (PyCFunction)PyFFFont_NLTransform, METH_VARARGS, "Transform a font by non-linear expressions for x and y." },
     { "validate", (PyCFunction)PyFFFont_validate, METH_VARARGS, "Check whether a font is valid and return True if it is." },
+    { "validationReport", (PyCFunction)PyFFFont_validationReport, METH_VARARGS, "Validate the font and return a dictionary of the problems found in each glyph." },
+    { "undoMemory", (PyCFunction)PyFFFont_undoMemory, METH_NOARGS, "Returns a tuple of the approximate bytes held by the font's undoes and redoes, and their number." },
     { "reencode", (PyCFunction)PyFFFont_reencode, METH_VARARGS, "Reencodes the current font into the given encoding." },
     { "clearSpecialData", (PyCFunction)PyFFFont_clearSpecialData, METH_NOARGS, "Clear special data not accessible in FontForge." },
 
@@ -19114,6 +19941,9 @@ PyMethodDef module_fontforge_methods[] = {
     { "setPrefs", PyFF_SetPrefs, METH_VARARGS, "Set FontForge preference items" },
     { "savePrefs", PyFF_SavePrefs, METH_NOARGS, "Save FontForge preference items" },
     { "loadPrefs", PyFF_LoadPrefs, METH_NOARGS, "Load FontForge preference items" },
+    { "glyphCacheStats", PyFF_GlyphCacheStats, METH_NOARGS, "Returns a tuple of the hits, misses and entries of the cache of converted TrueType glyphs" },
+    { "clearGlyphCache", PyFF_ClearGlyphCache, METH_NOARGS, "Empties the cache of converted TrueType glyphs and resets its statistics" },
+    { "layoutTableStats", PyFF_LayoutTableStats, METH_NOARGS, "Returns the sizes of the GSUB and GPOS tables last generated, and the bytes saved by sharing subtables, coverage tables and class definitions" },
     { "hasSpiro", PyFF_hasSpiro, METH_NOARGS, "Returns whether this fontforge has access to Raph Levien's spiro package"},
     { "SpiroVersion", PyFF_SpiroVersion, METH_NOARGS, "Return Spiro Library Version" },
     { "onAppClosing", PyFF_onAppClosing, METH_VARARGS, "add a python function which is called when fontforge is closing down"},
@@ -19380,6 +20210,7 @@ static void PyFF_PickleTypesInit(void) {
 char *PyFF_PickleMeToString(void *pydata) {
     PyObject *pyobj, *arglist, *result;
     char *ret = NULL;
+    PyGILState_STATE gstate = PyGILState_Ensure();
 
     PyFF_PicklerInit();
     pyobj = pydata;
@@ -19395,13 +20226,15 @@ char *PyFF_PickleMeToString(void *pydata) {
     if ( PyErr_Occurred()!=NULL ) {
 	PyErr_Print();
 	free(ret);
-return( NULL );
-    } else
+	ret = NULL;
+    }
+    PyGILState_Release(gstate);
 return( ret );
 }
 
 void *PyFF_UnPickleMeToObjects(char *str) {
     PyObject *arglist, *result;
+    PyGILState_STATE gstate = PyGILState_Ensure();
 
     PyFF_PicklerInit();
     arglist = PyTuple_New(1);
@@ -19410,8 +20243,10 @@ void *PyFF_UnPickleMeToObjects(char *str) {
     Py_DECREF(arglist);
     if ( PyErr_Occurred()!=NULL ) {
 	PyErr_Print();
-return( NULL );
-    } else
+	Py_XDECREF(result);
+	result = NULL;
+    }
+    PyGILState_Release(gstate);
 return( result );
 }
 
@@ -19920,18 +20755,33 @@ void PyFF_ScriptString(FontViewBase *fv,SplineChar *sc, int layer, char *str) {
 }
 
 void PyFF_FreeFV(FontViewBase *fv) {
+    PyGILState_STATE gstate;
+
     if ( fv->python_fv_object!=NULL ) {
+	gstate = PyGILState_Ensure();
 	((PyFF_Font *) (fv->python_fv_object))->fv = NULL;
 	Py_DECREF( (PyObject *) (fv->python_fv_object));
+	PyGILState_Release(gstate);
     }
 }
 
 void PyFF_FreeSF(SplineFont *sf) {
-    Py_XDECREF( (PyObject *) (sf->python_persistent));
-    Py_XDECREF( (PyObject *) (sf->python_temporary));
+    PyGILState_STATE gstate;
+
+    if ( sf->python_persistent!=NULL || sf->python_temporary!=NULL ) {
+	gstate = PyGILState_Ensure();
+	Py_XDECREF( (PyObject *) (sf->python_persistent));
+	Py_XDECREF( (PyObject *) (sf->python_temporary));
+	PyGILState_Release(gstate);
+    }
 }
 
 void PyFF_FreeSC(SplineChar *sc) {
+    PyGILState_STATE gstate;
+
+    if ( sc->python_sc_object==NULL && sc->python_temporary==NULL )
+return;
+    gstate = PyGILState_Ensure();
     if ( sc->python_sc_object!=NULL ) {
 	((PyFF_Glyph *) (sc->python_sc_object))->sc = NULL;
 	Py_DECREF( (PyObject *) (sc->python_sc_object));
@@ -19941,14 +20791,27 @@ void PyFF_FreeSC(SplineChar *sc) {
     Py_XDECREF( (PyObject *) (sc->python_persistent));
 #endif // 0
     Py_XDECREF( (PyObject *) (sc->python_temporary));
+    PyGILState_Release(gstate);
 }
 
 void PyFF_FreeSCLayer(SplineChar *sc, int layer) {
-    Py_XDECREF( (PyObject *) (sc->layers[layer].python_persistent));
+    PyGILState_STATE gstate;
+
+    if ( sc->layers[layer].python_persistent!=NULL ) {
+	gstate = PyGILState_Ensure();
+	Py_DECREF( (PyObject *) (sc->layers[layer].python_persistent));
+	PyGILState_Release(gstate);
+    }
 }
 
 extern void PyFF_FreePythonPersistent(void *python_persistent) {
-    Py_XDECREF((PyObject *)python_persistent);
+    PyGILState_STATE gstate;
+
+    if ( python_persistent!=NULL ) {
+	gstate = PyGILState_Ensure();
+	Py_DECREF((PyObject *)python_persistent);
+	PyGILState_Release(gstate);
+    }
 }
 
 static gint GPtrArrayStrcmp(gconstpointer a, gconstpointer b) {
@@ -20067,17 +20930,24 @@ void PyFF_ProcessInitFiles(int do_inits, int do_plugins) {
 
 void PyFF_CallDictFunc(PyObject *dict,const char *key,const char *argtypes, ... ) {
     PyObject *func, *arglist, *result;
+    PyGILState_STATE gstate;
     const char *pt;
     va_list ap;
     int i;
 
-    if ( dict==NULL || !PyMapping_Check(dict) ||
+    if ( dict==NULL )
+return;
+    gstate = PyGILState_Ensure();
+    if ( !PyMapping_Check(dict) ||
 	 !PyMapping_HasKeyString(dict,(char *)key) ||
-	 (func = PyMapping_GetItemString(dict,(char *)key))==NULL )
+	 (func = PyMapping_GetItemString(dict,(char *)key))==NULL ) {
+	PyGILState_Release(gstate);
 return;
+    }
     if ( !PyCallable_Check(func)) {
 	LogError(_("%s: Is not callable"), key );
 	Py_DECREF(func);
+	PyGILState_Release(gstate);
 return;
     }
     va_start(ap,argtypes);
@@ -20106,9 +20976,11 @@ return;
     va_end(ap);
     result = PyObject_CallObject(func, arglist);
     Py_DECREF(arglist);
+    Py_DECREF(func);
     Py_XDECREF(result);
     if ( PyErr_Occurred()!=NULL )
 	PyErr_Print();
+    PyGILState_Release(gstate);
 }
 
 void PyFF_InitFontHook(FontViewBase *fv) {
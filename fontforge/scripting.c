@@ -6563,6 +6563,64 @@ static void bMMBlendToNewFont(Context *c) {
     Reblend(c,true);
 }
 
+static void bMMGenerateInstances(Context *c) {
+    MMSet *mm = c->curfv->sf->mm;
+    Array *designs, *files, *design;
+    real *coords;
+    char **filenames, *t;
+    int i, j, cnt, ok, fmflags = -1;
+
+    if ( c->a.argc!=3 && c->a.argc!=4 ) {
+	c->error = ce_wrongnumarg;
+	return;
+    } else if ( (c->a.vals[1].type!=v_arr && c->a.vals[1].type!=v_arrfree) ||
+	    (c->a.vals[2].type!=v_arr && c->a.vals[2].type!=v_arrfree) ||
+	    (c->a.argc==4 && c->a.vals[3].type!=v_int) ) {
+	c->error = ce_badargtype;
+	return;
+    }
+    if ( mm==NULL )
+	ScriptError( c, "Not a multiple master font" );
+    designs = c->a.vals[1].u.aval;
+    files = c->a.vals[2].u.aval;
+    if ( designs->argc!=files->argc )
+	ScriptError( c, "There must be one file name for each design vector" );
+    cnt = designs->argc;
+    for ( i=0; i<cnt; ++i ) {
+	if ( (designs->vals[i].type!=v_arr && designs->vals[i].type!=v_arrfree) ||
+		designs->vals[i].u.aval->argc!=mm->axis_count )
+	    ScriptError( c, "Each design vector must be an array with one value for each axis" );
+	design = designs->vals[i].u.aval;
+	for ( j=0; j<mm->axis_count; ++j )
+	    if ( design->vals[j].type!=v_int && design->vals[j].type!=v_real )
+		ScriptError( c, "Bad type of array element" );
+	if ( files->vals[i].type!=v_str )
+	    ScriptError( c, "Bad type of array element" );
+    }
+    if ( c->a.argc==4 )
+	fmflags = c->a.vals[3].u.ival;
+
+    coords = malloc((cnt*mm->axis_count+1)*sizeof(real));
+    filenames = malloc((cnt+1)*sizeof(char *));
+    for ( i=0; i<cnt; ++i ) {
+	design = designs->vals[i].u.aval;
+	for ( j=0; j<mm->axis_count; ++j )
+	    coords[i*mm->axis_count+j] = design->vals[j].type==v_int ?
+		    design->vals[j].u.ival : design->vals[j].u.fval;
+	t = script2utf8_copy(files->vals[i].u.sval);
+	filenames[i] = utf82def_copy(t);
+	free(t);
+    }
+    ok = MMGenerateInstances(mm,cnt,coords,filenames,
+	    c->curfv->normal==NULL?c->curfv->map:c->curfv->normal,fmflags,ly_fore);
+    for ( i=0; i<cnt; ++i )
+	free(filenames[i]);
+    free(filenames);
+    free(coords);
+    if ( !ok )
+	ScriptError(c,"Save failed");
+}
+
 /* **** CID menu **** */
 
 static void bPreloadCidmap(Context *c) {
@@ -8674,6 +8732,7 @@ static struct builtins {
     { "MMChangeInstance", bMMChangeInstance, 0,2,0 },
     { "MMChangeWeight", bMMChangeWeight, 0,2,v_arr },
     { "MMBlendToNewFont", bMMBlendToNewFont, 0,2,v_arr },
+    { "MMGenerateInstances", bMMGenerateInstances, 0,0,0 },
 /* CID Menu */
     { "PreloadCidmap", bPreloadCidmap, 1,5,0 },
     { "ConvertToCID", bConvertToCID, 0,4,0 },
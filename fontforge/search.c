@@ -32,6 +32,7 @@
 #include "cvundoes.h"
 #include "fontforgevw.h"
 #include "fvfonts.h"
+#include "parallel.h"
 #include "splineutil.h"
 #include "splineutil2.h"
 #include "ustring.h"
@@ -1119,14 +1120,250 @@ return(false);
 return( true );
 }
 
+/* ************************************************************************** */
+/* ***************************** Search Index ******************************* */
+/* ************************************************************************** */
+
+/* Trying every point of every glyph as a place the pattern might start, */
+/*  under every transformation, is slow. But any match must pair each */
+/*  contour of the pattern with a contour of the glyph which is open or */
+/*  closed as it is, with as many points, and (unless rotating or scaling) */
+/*  about as wide and high. So keep a few numbers about each contour and */
+/*  only run the matcher on glyphs which could pass */
+struct contoursig {
+    int closed;
+    int cnt;			/* On curve points */
+    real w, h;			/* Extent of the on curve points */
+};
+
+struct glyphsig {
+    int cnt;
+    struct contoursig *cntrs;
+};
+
+struct searchindex {
+    int layer;
+    int gcnt;
+    struct glyphsig *glyphs;
+};
+
+struct searchpattern {
+    int cnt;
+    struct contoursig *cntrs;
+    real *tol;			/* How far w & h may be off for each contour */
+    int use_extents;
+};
+
+static void ContourSig(SplineSet *ss, struct contoursig *cs, real *tolx, real *toly,
+	SearchData *sv) {
+    SplinePoint *sp, *nsp;
+    real minx, maxx, miny, maxy, d, f;
+
+    cs->closed = ss->first->prev!=NULL;
+    cs->cnt = 0;
+    minx = maxx = ss->first->me.x;
+    miny = maxy = ss->first->me.y;
+    if ( tolx!=NULL )
+	*tolx = *toly = .01;
+    for ( sp=ss->first; ; ) {
+	++cs->cnt;
+	if ( sp->me.x<minx ) minx = sp->me.x;
+	if ( sp->me.x>maxx ) maxx = sp->me.x;
+	if ( sp->me.y<miny ) miny = sp->me.y;
+	if ( sp->me.y>maxy ) maxy = sp->me.y;
+	if ( sp->next==NULL )
+    break;
+	nsp = sp->next->to;
+	if ( tolx!=NULL ) {
+	    /* Each step between points may be off by as much as CoordMatches */
+	    /*  allows, so the extents by as much as all of them together */
+	    d = fabs(nsp->me.x-sp->me.x);
+	    f = fabs(sv->fudge_percent*d);
+	    *tolx += f>sv->fudge ? f : sv->fudge;
+	    d = fabs(nsp->me.y-sp->me.y);
+	    f = fabs(sv->fudge_percent*d);
+	    *toly += f>sv->fudge ? f : sv->fudge;
+	}
+	sp = nsp;
+	if ( sp==ss->first )
+    break;
+    }
+    cs->w = maxx-minx;
+    cs->h = maxy-miny;
+}
+
+static void GlyphSig(SplineChar *sc, int layer, struct glyphsig *gs) {
+    SplineSet *ss;
+    int i;
+
+    for ( ss=sc->layers[layer].splines, i=0; ss!=NULL; ss=ss->next, ++i );
+    gs->cnt = i;
+    gs->cntrs = i==0 ? NULL : malloc(i*sizeof(struct contoursig));
+    for ( ss=sc->layers[layer].splines, i=0; ss!=NULL; ss=ss->next, ++i )
+	ContourSig(ss,&gs->cntrs[i],NULL,NULL,NULL);
+}
+
+static void SearchPatternInit(SearchData *sv, struct searchpattern *pat) {
+    SplineSet *ss;
+    int i;
+
+    memset(pat,0,sizeof(*pat));
+    if ( sv->subpatternsearch )
+return;
+    for ( ss=sv->path, i=0; ss!=NULL; ss=ss->next, ++i );
+    pat->cnt = i;
+    if ( i==0 )
+return;
+    pat->cntrs = malloc(i*sizeof(struct contoursig));
+    pat->tol = malloc(2*i*sizeof(real));
+    for ( ss=sv->path, i=0; ss!=NULL; ss=ss->next, ++i )
+	ContourSig(ss,&pat->cntrs[i],&pat->tol[2*i],&pat->tol[2*i+1],sv);
+    pat->use_extents = !sv->tryrotate && !sv->tryscale && !sv->endpoints;
+}
+
+static void SearchPatternFree(struct searchpattern *pat) {
+    free(pat->cntrs);
+    free(pat->tol);
+}
+
+static int ContourCouldMatch(SearchData *sv, struct searchpattern *pat, int i,
+	struct contoursig *cs) {
+    struct contoursig *ps = &pat->cntrs[i];
+
+    if ( ps->closed!=cs->closed )
+return( false );
+    /* With endpoints the ends of the pattern only give directions, so */
+    /*  the point counts need not agree */
+    if ( !sv->endpoints && ps->cnt!=cs->cnt )
+return( false );
+    if ( pat->use_extents && (fabs(ps->w-cs->w)>pat->tol[2*i] ||
+	    fabs(ps->h-cs->h)>pat->tol[2*i+1]) )
+return( false );
+return( true );
+}
+
+static int GlyphCouldMatch(SearchData *sv, struct searchpattern *pat,
+	SplineChar *sc, struct glyphsig *gs) {
+    RefChar *s_r, *r;
+    int i, j;
+    int layer = sv->fv->active_layer;
+
+    if ( sv->subpatternsearch )
+return( gs->cnt!=0 );
+    if ( gs->cnt<pat->cnt )
+return( false );
+    for ( s_r = sv->sc_srch.layers[ly_fore].refs; s_r!=NULL; s_r = s_r->next ) {
+	for ( r = sc->layers[layer].refs; r!=NULL && r->sc!=s_r->sc; r=r->next );
+	if ( r==NULL )
+return( false );
+    }
+    for ( i=0; i<pat->cnt; ++i ) {
+	for ( j=0; j<gs->cnt && !ContourCouldMatch(sv,pat,i,&gs->cntrs[j]); ++j );
+	if ( j==gs->cnt )
+return( false );
+    }
+return( true );
+}
+
+static void SearchIndexFreeGlyph(struct glyphsig *gs) {
+    free(gs->cntrs);
+    gs->cntrs = NULL;
+    gs->cnt = 0;
+}
+
+static void SDFreeIndex(SearchData *sv) {
+    int gid;
+
+    if ( sv->index==NULL )
+return;
+    for ( gid=0; gid<sv->index->gcnt; ++gid )
+	free(sv->index->glyphs[gid].cntrs);
+    free(sv->index->glyphs);
+    free(sv->index);
+    sv->index = NULL;
+}
+
+struct searchindexbuild {
+    SplineFont *sf;
+    struct searchindex *index;
+};
+
+static void SearchIndexBuildGlyph(void *data, int gid) {
+    struct searchindexbuild *b = data;
+
+    if ( b->sf->glyphs[gid]!=NULL )
+	GlyphSig(b->sf->glyphs[gid],b->index->layer,&b->index->glyphs[gid]);
+}
+
+/* Index the glyphs of the font, for a series of searches which don't */
+/*  change the font other than by their own replacements */
+static void SDBuildIndex(SearchData *sv) {
+    struct searchindexbuild b;
+    SplineFont *sf = sv->fv->sf;
+
+    SDFreeIndex(sv);
+    b.sf = sf;
+    b.index = sv->index = calloc(1,sizeof(struct searchindex));
+    b.index->layer = sv->fv->active_layer;
+    b.index->gcnt = sf->glyphcnt;
+    b.index->glyphs = calloc(sf->glyphcnt,sizeof(struct glyphsig));
+    FFParallelFor(sf->glyphcnt,SearchIndexBuildGlyph,&b);
+}
+
+struct findall {
+    SearchData *sv;
+    struct searchpattern *pat;
+    int *gids;
+    uint8_t *found;
+};
+
+static void FindAllGlyph(void *data, int i) {
+    struct findall *fa = data;
+    SearchData s = *fa->sv;
+    int gid = fa->gids[i];
+    SplineChar *sc = s.fv->sf->glyphs[gid];
+    struct glyphsig local, *gs;
+
+    SCSplinePointsUntick(sc,s.fv->active_layer);
+    if ( s.index!=NULL && gid<s.index->gcnt && s.index->layer==s.fv->active_layer )
+	gs = &s.index->glyphs[gid];
+    else
+	GlyphSig(sc,s.fv->active_layer,gs = &local);
+    if ( GlyphCouldMatch(&s,fa->pat,sc,gs) )
+	fa->found[gid] = SearchChar(&s,gid,false);
+    if ( gs==&local )
+	free(local.cntrs);
+}
+
 int _DoFindAll(SearchData *sv) {
-    int i, any=0, gid;
+    int i, any=0, gid, cnt;
     SplineChar *startcur = sv->curchar;
+    SplineFont *sf = sv->fv->sf;
+    struct searchpattern pat;
+    struct findall fa;
+
+    /* Look for the pattern in all the glyphs at once, then replace in */
+    /*  (and report) those where it was found in encoding order, as before */
+    SearchPatternInit(sv,&pat);
+    fa.sv = sv;
+    fa.pat = &pat;
+    fa.gids = malloc(sf->glyphcnt*sizeof(int));
+    fa.found = calloc(sf->glyphcnt,1);
+    cnt = 0;
+    for ( i=0; i<sv->fv->map->enccount; ++i ) {
+	if (( !sv->onlyselected || sv->fv->selected[i]) && (gid=sv->fv->map->map[i])!=-1 &&
+		sf->glyphs[gid]!=NULL && !fa.found[gid] ) {
+	    fa.found[gid] = true;		/* Only list each glyph once */
+	    fa.gids[cnt++] = gid;
+	}
+    }
+    memset(fa.found,0,sf->glyphcnt);
+    FFParallelFor(cnt,FindAllGlyph,&fa);
 
     for ( i=0; i<sv->fv->map->enccount; ++i ) {
 	if (( !sv->onlyselected || sv->fv->selected[i]) && (gid=sv->fv->map->map[i])!=-1 &&
-		sv->fv->sf->glyphs[gid]!=NULL ) {
-	    SCSplinePointsUntick(sv->fv->sf->glyphs[gid],sv->fv->active_layer);
+		sf->glyphs[gid]!=NULL && fa.found[gid] ) {
+	    SCSplinePointsUntick(sf->glyphs[gid],sv->fv->active_layer);
 	    if ( (sv->fv->selected[i] = SearchChar(sv,gid,false)) ) {
 		any = true;
 		if ( sv->replaceall ) {
@@ -1135,11 +1372,18 @@ int _DoFindAll(SearchData *sv) {
 		    break;
 		    } while ( (sv->subpatternsearch || sv->replacewithref) &&
 			    SearchChar(sv,gid,true));
+		    if ( sv->index!=NULL && gid<sv->index->gcnt ) {
+			SearchIndexFreeGlyph(&sv->index->glyphs[gid]);
+			GlyphSig(sf->glyphs[gid],sv->index->layer,&sv->index->glyphs[gid]);
+		    }
 		}
 	    }
 	} else
 	    sv->fv->selected[i] = false;
     }
+    free(fa.gids);
+    free(fa.found);
+    SearchPatternFree(&pat);
     sv->curchar = startcur;
 return( any );
 }
@@ -1159,6 +1403,7 @@ return;
     free(sv->sc_srch.layers);
     free(sv->sc_rpl.layers);
     SplinePointListsFree(sv->revpath);
+    SDFreeIndex(sv);
 }
 
 SearchData *SDFillup(SearchData *sv, FontViewBase *fv) {
@@ -1251,6 +1496,7 @@ void FVBReplaceOutlineWithReference( FontViewBase *fv, double fudge ) {
 	++selcnt;
     ff_progress_start_indicator(10,_("Replace with Reference"),
 	    _("Replace Outline with Reference"),0,selcnt,1);
+    SDBuildIndex(sv);
 
     for ( i=0; i<fv->map->enccount; ++i ) if ( selected[i] && (gid=fv->map->map[i])!=-1 &&
 	    (checksc=sf->glyphs[gid])!=NULL ) {
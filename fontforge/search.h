@@ -31,6 +31,8 @@
 #include "baseviews.h"
 #include "splinefont.h"
 
+struct searchindex;
+
 typedef struct searchdata {
 	SplineChar sc_srch, sc_rpl;
 	SplineSet *path, *revpath, *replacepath, *revreplace;
@@ -64,6 +66,7 @@ typedef struct searchdata {
 	FontViewBase *fv;
 	SplineChar *curchar;
 	int last_gid;
+	struct searchindex *index;          /* Contour signatures of the font's glyphs, kept over several searches */
 } SearchData;
 
 extern void SDDestroy(SearchData *sd);
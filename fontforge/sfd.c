@@ -33,6 +33,7 @@
 #include "baseviews.h"
 #include "bvedit.h"
 #include "cvimages.h"
+#include "autosave.h"
 #include "cvundoes.h"
 #include "encoding.h"
 #include "ffglib.h"
@@ -792,6 +793,8 @@ return( rle );
 }
 
 void SFDDumpUndo(FILE *sfd,SplineChar *sc,Undoes *u, const char* keyPrefix, int idx ) {
+    SplineSet *unpacked;
+
     fprintf(sfd, "%sOperation\n",      keyPrefix );
     fprintf(sfd, "Index: %d\n",        idx );
     fprintf(sfd, "Type: %d\n",         u->undotype );
@@ -832,6 +835,10 @@ void SFDDumpUndo(FILE *sfd,SplineChar *sc,Undoes *u, const char* keyPrefix, int
 	    if( u->u.state.splines ) {
                 fprintf(sfd, "SplineSet\n" );
                 SFDDumpSplineSet( sfd, u->u.state.splines, u->was_order2 );
+            } else if( (unpacked = UndoPackedSplines(u))!=NULL ) {
+                fprintf(sfd, "SplineSet\n" );
+                SFDDumpSplineSet( sfd, unpacked, u->was_order2 );
+                SplinePointListsFree( unpacked );
             }
             break;
 
@@ -1249,9 +1256,10 @@ return;
 
 static void *SFDUnPickle(FILE *sfd, int python_data_has_lists) {
     int ch, quoted;
-    static int max = 0;
-    static char *buf = NULL;
+    int max = 0;
+    char *buf = NULL;
     char *pt, *end;
+    void *ret;
     int cnt;
 
     pt = buf; end = buf+max;
@@ -1274,15 +1282,18 @@ return( NULL );
 	    quoted = false;
 	}
     }
-    if ( pt==buf )
+    if ( pt==buf ) {
+	free(buf);
 return( NULL );
+    }
     *pt='\0';
 #ifdef _NO_PYTHON
-return( copy(buf));
+    ret = buf;
 #else
-return( PyFF_UnPickleMeToObjects(buf));
+    ret = PyFF_UnPickleMeToObjects(buf);
+    free(buf);
 #endif
-    /* buf is a static buffer, I don't free it, I'll reuse it next time */
+return( ret );
 }
 
 
@@ -1395,7 +1406,32 @@ void SFDDumpCharStartingMarker(FILE *sfd,SplineChar *sc) {
 }
 
 
-static void SFDDumpChar(FILE *sfd,SplineChar *sc,EncMap *map,int *newgids,int todir,int saveUndoes) {
+/* The contours an autosave leaves for its writer thread to format. Each */
+/*  is a private copy, to go at an offset into the rest of the text */
+struct sfddeferred {
+    long offset;
+    SplineSet *splines;
+    int order2;
+    struct sfddeferred *next;
+};
+
+static void SFDDeferSplineSet(FILE *sfd,struct sfddeferred **deferred,
+	SplineSet *spl,int order2) {
+    struct sfddeferred *d = calloc(1,sizeof(struct sfddeferred));
+    SplineSet *cur;
+
+    d->offset = ftell(sfd);
+    d->splines = SplinePointListCopy(spl);
+    for ( cur=d->splines; cur!=NULL; cur=cur->next, spl=spl->next )
+	cur->start_offset = spl->start_offset;
+    d->order2 = order2;
+    /* Built backwards, SFDDumpAutoSave puts it in order */
+    d->next = *deferred;
+    *deferred = d;
+}
+
+static void SFDDumpChar(FILE *sfd,SplineChar *sc,EncMap *map,int *newgids,int todir,int saveUndoes,
+	struct sfddeferred **deferred) {
     // TODO: Output the U. F. O. glif name.
     ImageList *img;
     KernPair *kp;
@@ -1561,7 +1597,10 @@ static void SFDDumpChar(FILE *sfd,SplineChar *sc,EncMap *map,int *newgids,int to
 	    SFDDumpImage(sfd,img);
 	if ( sc->layers[i].splines!=NULL ) {
 	    fprintf(sfd, "SplineSet\n" );
-	    SFDDumpSplineSet(sfd,sc->layers[i].splines,sc->layers[i].order2);
+	    if ( deferred!=NULL )
+		SFDDeferSplineSet(sfd,deferred,sc->layers[i].splines,sc->layers[i].order2);
+	    else
+		SFDDumpSplineSet(sfd,sc->layers[i].splines,sc->layers[i].order2);
 	}
 	SFDDumpRefs(sfd,sc->layers[i].refs,newgids);
 	SFDDumpGuidelines(sfd, sc->layers[i].guidelines);
@@ -2789,14 +2828,14 @@ static int SFD_Dump( FILE *sfd, SplineFont *sf, EncMap *map, EncMap *normal,
 	for ( i=0; i<sf->glyphcnt; ++i ) {
 	    if ( !SFDOmit(sf->glyphs[i]) ) {
 		if ( !todir )
-		SFDDumpChar(sfd,sf->glyphs[i],map,newgids,todir,1);
+		SFDDumpChar(sfd,sf->glyphs[i],map,newgids,todir,1,NULL);
 		else {
 		    char *glyphfile = malloc(strlen(dirname)+2*strlen(sf->glyphs[i]->name)+20);
 		    FILE *gsfd;
 		    appendnames(glyphfile,dirname,"/",sf->glyphs[i]->name,GLYPH_EXT );
 		    gsfd = fopen(glyphfile,"w");
 		    if ( gsfd!=NULL ) {
-			SFDDumpChar(gsfd,sf->glyphs[i],map,newgids,todir,1);
+			SFDDumpChar(gsfd,sf->glyphs[i],map,newgids,todir,1,NULL);
 			if ( ferror(gsfd)) err = true;
 			if ( fclose(gsfd)) err = true;
 		    } else
@@ -9169,30 +9208,39 @@ return( false );
 return(false);
     SFRemoveDependencies(sf);
 
-    getint(asfd,&cnt);
-    if ( cnt>sf->glyphcnt ) {
-	sf->glyphs = realloc(sf->glyphs,cnt*sizeof(SplineChar *));
-	for ( i=sf->glyphcnt; i<cnt; ++i )
-	    sf->glyphs[i] = NULL;
-	sf->glyphcnt = sf->glyphmax = cnt;
-    }
-    while ( (sc = SFDGetChar(asfd,&temp,true))!=NULL ) {
-	ssf = sf;
-	for ( k=0; k<sf->subfontcnt; ++k ) {
-	    if ( sc->orig_pos<sf->subfonts[k]->glyphcnt ) {
-		ssf = sf->subfonts[k];
-		if ( SCWorthOutputting(ssf->glyphs[sc->orig_pos]))
-	break;
+    /* Incremental autosaves append further chunks of glyphs to the file, */
+    /*  later copies of a glyph replace earlier ones */
+    do {
+	getint(asfd,&cnt);
+	if ( cnt>sf->glyphcnt ) {
+	    sf->glyphs = realloc(sf->glyphs,cnt*sizeof(SplineChar *));
+	    for ( i=sf->glyphcnt; i<cnt; ++i )
+		sf->glyphs[i] = NULL;
+	    sf->glyphcnt = sf->glyphmax = cnt;
+	}
+	while ( (sc = SFDGetChar(asfd,&temp,true))!=NULL ) {
+	    ssf = sf;
+	    for ( k=0; k<sf->subfontcnt; ++k ) {
+		if ( sc->orig_pos<sf->subfonts[k]->glyphcnt ) {
+		    ssf = sf->subfonts[k];
+		    if ( SCWorthOutputting(ssf->glyphs[sc->orig_pos]))
+	    break;
+		}
 	    }
+	    if ( sc->orig_pos<ssf->glyphcnt ) {
+		if ( ssf->glyphs[sc->orig_pos]!=NULL )
+		    SplineCharFree(ssf->glyphs[sc->orig_pos]);
+		ssf->glyphs[sc->orig_pos] = sc;
+		sc->parent = ssf;
+		sc->changed = true;
+	    } else
+		SplineCharFree(sc);
 	}
-	if ( sc->orig_pos<ssf->glyphcnt ) {
-	    if ( ssf->glyphs[sc->orig_pos]!=NULL )
-		SplineCharFree(ssf->glyphs[sc->orig_pos]);
-	    ssf->glyphs[sc->orig_pos] = sc;
-	    sc->parent = ssf;
-	    sc->changed = true;
-	}
-    }
+	do {
+	    if ( getname(asfd,tok)!=1 )
+		tok[0] = '\0';
+	} while ( strcmp(tok,"EndSplineFont")==0 );
+    } while ( strcmp(tok,"BeginChars:")==0 );
     sf->changed = true;
     SFDFixupRefs(sf);
 return(true);
@@ -9323,56 +9371,182 @@ return( NULL );
 return( ret );
 }
 
-void SFAutoSave(SplineFont *sf,EncMap *map) {
-    int i, k, max;
-    FILE *asfd;
-    SplineFont *ssf;
+/* The glyph an autosave writes at gid i: in a cid keyed font the first */
+/*  subfont with something worth writing there */
+static SplineChar *AutoSaveGlyph(SplineFont *sf,int i) {
+    SplineFont *ssf = sf;
+    int k;
 
-    if ( no_windowing_ui )		/* No autosaves when just scripting */
-return;
+    for ( k=0; k<sf->subfontcnt; ++k ) {
+	if ( i<sf->subfonts[k]->glyphcnt ) {
+	    ssf = sf->subfonts[k];
+	    if ( SCWorthOutputting(ssf->glyphs[i]))
+    break;
+	}
+    }
+return( i<ssf->glyphcnt ? ssf->glyphs[i] : NULL );
+}
 
-    if ( sf->cidmaster!=NULL ) sf=sf->cidmaster;
-    asfd = fopen(sf->autosavename,"w");
-    if ( asfd==NULL )
-return;
+static int AutoSaveMax(SplineFont *sf) {
+    int i, max = sf->glyphcnt;
 
-    max = sf->glyphcnt;
     for ( i=0; i<sf->subfontcnt; ++i )
 	if ( sf->subfonts[i]->glyphcnt>max ) max = sf->subfonts[i]->glyphcnt;
+return( max );
+}
+
+/* Whether the glyphs changed since the last autosave may be appended to */
+/*  its file. Recovery would bring back the copy in the file of a glyph   */
+/*  which has since been removed, or has gone back to being unchanged     */
+/*  (there is no way to say a glyph is gone), so then the file must be    */
+/*  rewritten whole */
+int SFDAutoSaveAppendable(SplineFont *sf) {
+    int i, max, cnt=0;
+    SplineChar *sc;
+
+    if ( sf->cidmaster!=NULL ) sf=sf->cidmaster;
+    max = AutoSaveMax(sf);
+    for ( i=0; i<max; ++i ) {
+	if ( (sc = AutoSaveGlyph(sf,i))==NULL || !sc->in_autosave )
+    continue;
+	if ( !sc->changed )
+return( false );
+	++cnt;
+    }
+    /* Fewer than we marked, so some have been removed */
+return( cnt==sf->autosave.marked_cnt );
+}
+
+/* Writes an autosave file. When incremental it only writes the glyphs */
+/*  changed since the last autosave, as a chunk to be appended to the file */
+/*  (a later copy of a glyph replaces an earlier one on recovery), otherwise */
+/*  a whole file with every changed glyph. Returns the number of glyphs */
+/* If deferred is not NULL the contours of the glyphs are not formatted, */
+/*  instead copies of them are returned there, for SFDWriteDeferred to */
+/*  format into the text on another thread. Everything else refers to the */
+/*  rest of the font, so has to be written while the font can't change */
+int SFDDumpAutoSave(FILE *asfd,SplineFont *sf,EncMap *map,int incremental,
+	struct sfddeferred **deferred) {
+    int i, max, cnt=0;
+    SplineChar *sc;
+    struct sfddeferred *d, *prev, *next;
+
+    if ( sf->cidmaster!=NULL ) sf=sf->cidmaster;
+    max = AutoSaveMax(sf);
+    if ( deferred!=NULL )
+	*deferred = NULL;
 
     locale_t tmplocale; locale_t oldlocale; // Declare temporary locale storage.
     switch_to_c_locale(&tmplocale, &oldlocale); // Switch to the C locale temporarily and cache the old locale.
-    if ( !sf->new && sf->origname!=NULL )	/* might be a new file */
-	fprintf( asfd, "Base: %s%s\n", sf->origname,
-		sf->compression==0?"":compressors[sf->compression-1].ext );
-    fprintf( asfd, "Encoding: %s\n", map->enc->enc_name );
-    fprintf( asfd, "UnicodeInterp: %s\n", unicode_interp_names[sf->uni_interp]);
-    fprintf( asfd, "LayerCount: %d\n", sf->layer_cnt );
-    for ( i=0; i<sf->layer_cnt; ++i ) {
-	fprintf( asfd, "Layer: %d %d ", i, sf->layers[i].order2 );
-	SFDDumpUTF7Str(asfd,sf->layers[i].name);
-	putc('\n',asfd);
+    if ( !incremental ) {
+	if ( !sf->new && sf->origname!=NULL )	/* might be a new file */
+	    fprintf( asfd, "Base: %s%s\n", sf->origname,
+		    sf->compression==0?"":compressors[sf->compression-1].ext );
+	fprintf( asfd, "Encoding: %s\n", map->enc->enc_name );
+	fprintf( asfd, "UnicodeInterp: %s\n", unicode_interp_names[sf->uni_interp]);
+	fprintf( asfd, "LayerCount: %d\n", sf->layer_cnt );
+	for ( i=0; i<sf->layer_cnt; ++i ) {
+	    fprintf( asfd, "Layer: %d %d ", i, sf->layers[i].order2 );
+	    SFDDumpUTF7Str(asfd,sf->layers[i].name);
+	    putc('\n',asfd);
+	}
+	if ( sf->multilayer )
+	    fprintf( asfd, "MultiLayer: %d\n", sf->multilayer );
+	sf->autosave.marked_cnt = 0;
     }
-    if ( sf->multilayer )
-	fprintf( asfd, "MultiLayer: %d\n", sf->multilayer );
     fprintf( asfd, "BeginChars: %d\n", max );
     for ( i=0; i<max; ++i ) {
-	ssf = sf;
-	for ( k=0; k<sf->subfontcnt; ++k ) {
-	    if ( i<sf->subfonts[k]->glyphcnt ) {
-		ssf = sf->subfonts[k];
-		if ( SCWorthOutputting(ssf->glyphs[i]))
-	break;
-	    }
-	}
-	if ( ssf->glyphs[i]!=NULL && ssf->glyphs[i]->changed )
-	    SFDDumpChar( asfd,ssf->glyphs[i],map,NULL,false,1);
+	if ( (sc = AutoSaveGlyph(sf,i))==NULL )
+    continue;
+	/* Not everything which changes a glyph says so to the autosave, so */
+	/*  also catch changed glyphs which aren't in the file yet */
+	if ( incremental ? sc->changed_since_autosave || (sc->changed && !sc->in_autosave) :
+		sc->changed ) {
+	    SFDDumpChar( asfd,sc,map,NULL,false,1,deferred);
+	    if ( !incremental || !sc->in_autosave )
+		++sf->autosave.marked_cnt;
+	    sc->in_autosave = true;
+	    ++cnt;
+	} else if ( !incremental )
+	    sc->in_autosave = false;
+	sc->changed_since_autosave = false;
     }
     fprintf( asfd, "EndChars\n" );
-    fprintf( asfd, "EndSplineFont\n" );
-    fclose(asfd);
+    if ( !incremental )
+	fprintf( asfd, "EndSplineFont\n" );
     switch_to_old_locale(&tmplocale, &oldlocale); // Switch to the cached locale.
     sf->changed_since_autosave = false;
+    if ( deferred!=NULL ) {
+	for ( d=*deferred, prev=NULL; d!=NULL; d=next ) {
+	    next = d->next;
+	    d->next = prev;
+	    prev = d;
+	}
+	*deferred = prev;
+    }
+return( cnt );
+}
+
+/* Writes the text of an autosave with the contours deferred from it */
+/*  formatted in their places, and frees them. Returns false on error */
+int SFDWriteDeferred(FILE *out,const char *data,size_t len,struct sfddeferred *deferred) {
+    struct sfddeferred *next;
+    size_t pos = 0;
+
+    locale_t tmplocale; locale_t oldlocale; // Declare temporary locale storage.
+    switch_to_c_locale(&tmplocale, &oldlocale); // Switch to the C locale temporarily and cache the old locale.
+    for ( ; deferred!=NULL; deferred = next ) {
+	next = deferred->next;
+	fwrite(data+pos,1,deferred->offset-pos,out);
+	pos = deferred->offset;
+	SFDDumpSplineSet(out,deferred->splines,deferred->order2);
+	SplinePointListsFree(deferred->splines);
+	free(deferred);
+    }
+    fwrite(data+pos,1,len-pos,out);
+    switch_to_old_locale(&tmplocale, &oldlocale); // Switch to the cached locale.
+return( !ferror(out) );
+}
+
+void SFDDeferredFree(struct sfddeferred *deferred) {
+    struct sfddeferred *next;
+
+    for ( ; deferred!=NULL; deferred = next ) {
+	next = deferred->next;
+	SplinePointListsFree(deferred->splines);
+	free(deferred);
+    }
+}
+
+void SFAutoSave(SplineFont *sf,EncMap *map) {
+    FILE *asfd;
+    char *tmpname;
+    int cnt;
+
+    if ( no_windowing_ui )		/* No autosaves when just scripting */
+return;
+
+    if ( sf->cidmaster!=NULL ) sf=sf->cidmaster;
+    /* Write it aside and rename it over the old one, so a crash while */
+    /*  saving doesn't lose the last autosave */
+    tmpname = smprintf("%s.tmp",sf->autosavename);
+    asfd = fopen(tmpname,"w");
+    if ( asfd==NULL ) {
+	free(tmpname);
+return;
+    }
+    cnt = SFDDumpAutoSave(asfd,sf,map,false,NULL);
+    if ( fclose(asfd)==0 && AutoSaveRename(tmpname,sf->autosavename)==0 ) {
+	sf->autosave.layer_cnt = sf->layer_cnt;
+	sf->autosave.glyph_cnt = cnt;
+	sf->autosave.journal_cnt = 0;
+    } else {
+	unlink(tmpname);
+	/* Try again, whole, next time */
+	memset(&sf->autosave,0,sizeof(sf->autosave));
+	sf->changed_since_autosave = true;
+    }
+    free(tmpname);
 }
 
 void SFClearAutoSave(SplineFont *sf) {
@@ -9380,7 +9554,10 @@ void SFClearAutoSave(SplineFont *sf) {
     SplineFont *ssf;
 
     if ( sf->cidmaster!=NULL ) sf = sf->cidmaster;
+    /* Don't let a pending background write bring the file back */
+    AutoSaveFlush();
     sf->changed_since_autosave = false;
+    memset(&sf->autosave,0,sizeof(sf->autosave));
     for ( i=0; i<sf->subfontcnt; ++i ) {
 	ssf = sf->subfonts[i];
 	ssf->changed_since_autosave = false;
@@ -118,6 +118,11 @@ extern SplineFont *SFDirRead(char *filename);
 extern SplineFont *_SFDRead(char *filename, FILE *sfd);
 extern SplineFont *SFRecoverFile(char *autosavename, int inquire, int *state);
 extern Undoes *SFDGetUndo(FILE *sfd, SplineChar *sc, const char* startTag, int current_layer);
+struct sfddeferred;
+extern int SFDAutoSaveAppendable(SplineFont *sf);
+extern int SFDDumpAutoSave(FILE *asfd, SplineFont *sf, EncMap *map, int incremental, struct sfddeferred **deferred);
+extern int SFDWriteDeferred(FILE *out, const char *data, size_t len, struct sfddeferred *deferred);
+extern void SFDDeferredFree(struct sfddeferred *deferred);
 extern void SFAutoSave(SplineFont *sf, EncMap *map);
 extern void SFClearAutoSave(SplineFont *sf);
 extern void SFDDumpCharStartingMarker(FILE *sfd, SplineChar *sc);
@@ -35,6 +35,7 @@
 #include "fvfonts.h"
 #include "lookups.h"
 #include "mem.h"
+#include "parallel.h"
 #include "parsettf.h"
 #include "spiro.h"
 #include "splineorder2.h"
@@ -1603,7 +1604,162 @@ return( h1 );
 return( NULL );
 }
 
-int SCValidate(SplineChar *sc, int layer, int force) {
+/* The font's glyph names and encodings, sorted, so that a glyph can be */
+/*  checked for duplicates without looking at every other glyph */
+struct vsnames {
+    char **names;
+    int ncnt;
+    int64_t *unis;		/* (vs+1)<<32 | unienc */
+    int ucnt;
+};
+
+static int64_t VSUniKey(int vs, int unienc) {
+return( ((int64_t) (vs+1)<<32) | (uint32_t) unienc );
+}
+
+/* The keys UniMatch would find the glyph by, each once */
+static int SCUniKeys(SplineChar *sc, int64_t *keys, int max) {
+    struct altuni *alt;
+    int cnt=0, i;
+    int64_t key;
+
+    if ( sc->unicodeenc!=-1 )
+	keys[cnt++] = VSUniKey(-1,sc->unicodeenc);
+    for ( alt=sc->altuni; alt!=NULL && cnt<max; alt=alt->next ) {
+	key = VSUniKey(alt->vs,alt->unienc);
+	for ( i=0; i<cnt && keys[i]!=key; ++i );
+	if ( i==cnt )
+	    keys[cnt++] = key;
+    }
+return( cnt );
+}
+
+static int vsnamecmp(const void *_n1, const void *_n2) {
+return( strcmp(*(char * const *) _n1,*(char * const *) _n2) );
+}
+
+static int vsunicmp(const void *_u1, const void *_u2) {
+    int64_t u1 = *(const int64_t *) _u1, u2 = *(const int64_t *) _u2;
+return( u1<u2 ? -1 : u1>u2 );
+}
+
+static struct vsnames *VSNamesCreate(SplineFont *cid) {
+    struct vsnames *names = calloc(1,sizeof(struct vsnames));
+    SplineFont *sf;
+    SplineChar *sc;
+    struct altuni *alt;
+    int k, gid, nmax=0, umax=0;
+    int64_t keys[64];
+
+    k = 0;
+    do {
+	sf = cid->subfontcnt==0 ? cid : cid->subfonts[k];
+	for ( gid=0; gid<sf->glyphcnt; ++gid ) if ( (sc=sf->glyphs[gid])!=NULL ) {
+	    ++nmax;
+	    umax += 1;
+	    for ( alt=sc->altuni; alt!=NULL; alt=alt->next )
+		++umax;
+	}
+	++k;
+    } while ( k<cid->subfontcnt );
+    names->names = malloc((nmax+1)*sizeof(char *));
+    names->unis = malloc((umax+1)*sizeof(int64_t));
+    k = 0;
+    do {
+	sf = cid->subfontcnt==0 ? cid : cid->subfonts[k];
+	for ( gid=0; gid<sf->glyphcnt; ++gid ) if ( (sc=sf->glyphs[gid])!=NULL ) {
+	    names->names[names->ncnt++] = sc->name;
+	    umax = SCUniKeys(sc,keys,sizeof(keys)/sizeof(keys[0]));
+	    memcpy(names->unis+names->ucnt,keys,umax*sizeof(int64_t));
+	    names->ucnt += umax;
+	}
+	++k;
+    } while ( k<cid->subfontcnt );
+    qsort(names->names,names->ncnt,sizeof(char *),vsnamecmp);
+    qsort(names->unis,names->ucnt,sizeof(int64_t),vsunicmp);
+return( names );
+}
+
+static void VSNamesFree(struct vsnames *names) {
+    if ( names==NULL )
+return;
+    free(names->names);
+    free(names->unis);
+    free(names);
+}
+
+/* More than one glyph has this name (or encoding)? */
+static int VSNameShared(struct vsnames *names, const char *name) {
+    int lo=0, hi=names->ncnt, mid;
+
+    while ( lo<hi ) {
+	mid = (lo+hi)/2;
+	if ( strcmp(names->names[mid],name)<0 )
+	    lo = mid+1;
+	else
+	    hi = mid;
+    }
+return( lo+1<names->ncnt && strcmp(names->names[lo+1],name)==0 );
+}
+
+static int VSUniShared(struct vsnames *names, int64_t key) {
+    int lo=0, hi=names->ucnt, mid;
+
+    while ( lo<hi ) {
+	mid = (lo+hi)/2;
+	if ( names->unis[mid]<key )
+	    lo = mid+1;
+	else
+	    hi = mid;
+    }
+return( lo+1<names->ucnt && names->unis[lo+1]==key );
+}
+
+static int SCValidateDups(SplineChar *sc, struct vsnames *names) {
+    int vs = 0, gid, k, i, cnt;
+    SplineFont *cid, *sf;
+    SplineChar *othersc;
+    struct altuni *alt;
+    int64_t keys[64];
+
+    if ( names!=NULL ) {
+	if ( VSNameShared(names,sc->name) )
+	    vs |= vs_dupname|vs_known;
+	cnt = SCUniKeys(sc,keys,sizeof(keys)/sizeof(keys[0]));
+	for ( i=0; i<cnt; ++i )
+	    if ( VSUniShared(names,keys[i]) )
+		vs |= vs_dupunicode|vs_known;
+return( vs );
+    }
+
+    k=0;
+    cid = sc->parent;
+    if ( cid->cidmaster != NULL )
+	cid = cid->cidmaster;
+    do {
+	sf = cid->subfontcnt==0 ? cid : cid->subfonts[k];
+	for ( gid=0; gid<sf->glyphcnt; ++gid ) if ( (othersc=sf->glyphs[gid])!=NULL ) {
+	    if ( othersc==sc )
+	continue;
+	    if ( strcmp(sc->name,othersc->name)==0 )
+		vs |= vs_dupname|vs_known;
+	    if ( sc->unicodeenc!=-1 && UniMatch(-1,sc->unicodeenc,othersc) )
+		vs |= vs_dupunicode|vs_known;
+	    for ( alt=sc->altuni; alt!=NULL; alt=alt->next )
+		if ( UniMatch(alt->vs,alt->unienc,othersc) )
+		    vs |= vs_dupunicode|vs_known;
+	}
+	++k;
+    } while ( k<cid->subfontcnt );
+return( vs );
+}
+
+/* Works out everything about the glyph's validity except its anchors, */
+/*  which need the font's anchor classes. Only looks at this glyph (and */
+/*  reads the rest of the font), so glyphs may be done in parallel. The */
+/*  new state is stored all at once. names, if given, has the font's */
+/*  glyph names and encodings sorted for the duplicate checks */
+static void _SCValidate(SplineChar *sc, int layer, struct vsnames *names) {
     SplineSet *ss;
     Spline *s1, *s2, *s, *first;
     SplinePoint *sp;
@@ -1619,21 +1775,13 @@ int SCValidate(SplineChar *sc, int layer, int force) {
     extern int allow_utf8_glyphnames;
     RefChar *r;
     BasePoint lastpt;
-    int gid, k;
-    SplineFont *cid, *sf;
-    SplineChar *othersc;
-    struct altuni *alt;
-
-    if ( (sc->layers[layer].validation_state&vs_known) && !force )
-  goto end;
-
-    sc->layers[layer].validation_state = 0;
+    int vs = 0;
 
     base = LayerAllSplines(&sc->layers[layer]);
 
     if ( !allow_utf8_glyphnames ) {
 	if ( strlen(sc->name)>31 )
-	    sc->layers[layer].validation_state |= vs_badglyphname|vs_known;
+	    vs |= vs_badglyphname|vs_known;
 	else {
 	    char *pt;
 	    for ( pt = sc->name; *pt; ++pt ) {
@@ -1643,7 +1791,7 @@ int SCValidate(SplineChar *sc, int layer, int force) {
 			*pt == '.' || *pt == '_' )
 		    /* That's ok */;
 		else {
-		    sc->layers[layer].validation_state |= vs_badglyphname|vs_known;
+		    vs |= vs_badglyphname|vs_known;
 	    break;
 		}
 	    }
@@ -1653,37 +1801,37 @@ int SCValidate(SplineChar *sc, int layer, int force) {
     for ( pst=sc->possub; pst!=NULL; pst=pst->next ) {
 	if ( pst->type==pst_substitution &&
 		!SCWorthOutputting(SFGetChar(sc->parent,-1,pst->u.subs.variant))) {
-	    sc->layers[layer].validation_state |= vs_badglyphname|vs_known;
+	    vs |= vs_badglyphname|vs_known;
     break;
 	} else if ( pst->type==pst_pair &&
 		!SCWorthOutputting(SFGetChar(sc->parent,-1,pst->u.pair.paired))) {
-	    sc->layers[layer].validation_state |= vs_badglyphname|vs_known;
+	    vs |= vs_badglyphname|vs_known;
     break;
 	} else if ( (pst->type==pst_alternate || pst->type==pst_multiple || pst->type==pst_ligature) &&
 		!SFValidNameList(sc->parent,pst->u.mult.components)) {
-	    sc->layers[layer].validation_state |= vs_badglyphname|vs_known;
+	    vs |= vs_badglyphname|vs_known;
     break;
 	}
     }
     if ( sc->vert_variants!=NULL && sc->vert_variants->variants != NULL &&
 	    !SFValidNameList(sc->parent,sc->vert_variants->variants) )
-	sc->layers[layer].validation_state |= vs_badglyphname|vs_known;
+	vs |= vs_badglyphname|vs_known;
     else if ( sc->horiz_variants!=NULL && sc->horiz_variants->variants != NULL &&
 	    !SFValidNameList(sc->parent,sc->horiz_variants->variants) )
-	sc->layers[layer].validation_state |= vs_badglyphname|vs_known;
+	vs |= vs_badglyphname|vs_known;
     else {
 	int i;
 	if ( sc->vert_variants!=NULL ) {
 	    for ( i=0; i<sc->vert_variants->part_cnt; ++i ) {
 		if ( !SCWorthOutputting(SFGetChar(sc->parent,-1,sc->vert_variants->parts[i].component)))
-		    sc->layers[layer].validation_state |= vs_badglyphname|vs_known;
+		    vs |= vs_badglyphname|vs_known;
 	    break;
 	    }
 	}
 	if ( sc->horiz_variants!=NULL ) {
 	    for ( i=0; i<sc->horiz_variants->part_cnt; ++i ) {
 		if ( !SCWorthOutputting(SFGetChar(sc->parent,-1,sc->horiz_variants->parts[i].component)))
-		    sc->layers[layer].validation_state |= vs_badglyphname|vs_known;
+		    vs |= vs_badglyphname|vs_known;
 	    break;
 	    }
 	}
@@ -1694,33 +1842,33 @@ int SCValidate(SplineChar *sc, int layer, int force) {
 	if ( ss->first->next==NULL )
 	    /* Do Nothing */;
 	else if ( ss->first->prev==NULL ) {
-	    sc->layers[layer].validation_state |= vs_opencontour|vs_known;
+	    vs |= vs_opencontour|vs_known;
     break;
 	}
     }
 
     /* If there's an open contour we can't really tell whether it self-intersects */
-    if ( sc->layers[layer].validation_state & vs_opencontour )
-	/* sc->layers[layer].validation_state |= vs_selfintersects*/;
+    if ( vs & vs_opencontour )
+	/* vs |= vs_selfintersects*/;
     else {
 	if ( SplineSetIntersect(base,&s1,&s2) )
-	    sc->layers[layer].validation_state |= vs_selfintersects|vs_known;
+	    vs |= vs_selfintersects|vs_known;
     }
 
     /* If there's a self-intersection we are guaranteed that both the self- */
     /*  intersecting contours will be in the wrong direction at some point */
-    if ( sc->layers[layer].validation_state & vs_selfintersects )
-	/*sc->layers[layer].validation_state |= vs_wrongdirection*/;
+    if ( vs & vs_selfintersects )
+	/*vs |= vs_wrongdirection*/;
     else {
 	if ( SplineSetsDetectDir(&base,&lastscan)!=NULL )
-	    sc->layers[layer].validation_state |= vs_wrongdirection|vs_known;
+	    vs |= vs_wrongdirection|vs_known;
     }
 
     /* Different kind of "wrong direction" */
     for ( ref=sc->layers[layer].refs; ref!=NULL; ref=ref->next ) {
 	if ( ref->transform[0]*ref->transform[3]<0 ||
 		(ref->transform[0]==0 && ref->transform[1]*ref->transform[2]>0)) {
-	    sc->layers[layer].validation_state |= vs_flippedreferences|vs_known;
+	    vs |= vs_flippedreferences|vs_known;
     break;
 	}
     }
@@ -1728,7 +1876,7 @@ int SCValidate(SplineChar *sc, int layer, int force) {
     for ( h=sc->hstem, cnt=0; h!=NULL; h=h->next, ++cnt );
     for ( h=sc->vstem       ; h!=NULL; h=h->next, ++cnt );
     if ( cnt>=96 )
-	sc->layers[layer].validation_state |= vs_toomanyhints|vs_known;
+	vs |= vs_toomanyhints|vs_known;
 
     if ( sc->layers[layer].splines!=NULL ) {
 	int anyhm=0;
@@ -1750,7 +1898,7 @@ int SCValidate(SplineChar *sc, int layer, int force) {
 	if ( !anyhm )
 	    h = SCHintOverlapInMask(sc,NULL);
 	if ( h!=NULL )
-	    sc->layers[layer].validation_state |= vs_overlappedhints|vs_known;
+	    vs |= vs_overlappedhints|vs_known;
     }
 
     memset(&lastpt,0,sizeof(lastpt));
@@ -1761,11 +1909,11 @@ int SCValidate(SplineChar *sc, int layer, int force) {
 	    if ( (!SPInterpolate(sp) && (sp->me.x != rint(sp->me.x) || sp->me.y != rint(sp->me.y))) ||
 		    sp->nextcp.x != rint(sp->nextcp.x) || sp->nextcp.y != rint(sp->nextcp.y) ||
 		    sp->prevcp.x != rint(sp->prevcp.x) || sp->prevcp.y != rint(sp->prevcp.y))
-		sc->layers[layer].validation_state |= vs_nonintegral|vs_known;
+		vs |= vs_nonintegral|vs_known;
 	    if ( BPTooFar(&lastpt,&sp->prevcp) ||
 		    BPTooFar(&sp->prevcp,&sp->me) ||
 		    BPTooFar(&sp->me,&sp->nextcp))
-		sc->layers[layer].validation_state |= vs_pointstoofarapart|vs_known;
+		vs |= vs_pointstoofarapart|vs_known;
 	    memcpy(&lastpt,&sp->nextcp,sizeof(lastpt));
 	    ++pt_cnt;
 	    if ( sp->next==NULL )
@@ -1784,7 +1932,7 @@ int SCValidate(SplineChar *sc, int layer, int force) {
 	}
     }
     if ( pt_cnt>1500 )
-	sc->layers[layer].validation_state |= vs_toomanypoints|vs_known;
+	vs |= vs_toomanypoints|vs_known;
 
     LayerUnAllSplines(&sc->layers[layer]);
 
@@ -1806,7 +1954,7 @@ int SCValidate(SplineChar *sc, int layer, int force) {
 	    len2 = x*x + y*y;
 	    /* short splines (serifs) are not required to have points at their extrema */
 	    if ( len2>bound2 && Spline2DFindExtrema(s,extrema)>0 ) {
-		sc->layers[layer].validation_state |= vs_missingextrema|vs_known;
+		vs |= vs_missingextrema|vs_known;
     goto break_2_loops;
 	    }
 	}
@@ -1829,9 +1977,9 @@ int SCValidate(SplineChar *sc, int layer, int force) {
 	/* Already figured out two of these */
 	if ( sc->layers[layer].splines==NULL ) {
 	    if ( pt_cnt>composit_pt_max )
-		sc->layers[layer].validation_state |= vs_maxp_toomanycomppoints|vs_known;
+		vs |= vs_maxp_toomanycomppoints|vs_known;
 	    if ( path_cnt>composit_path_max )
-		sc->layers[layer].validation_state |= vs_maxp_toomanycomppaths|vs_known;
+		vs |= vs_maxp_toomanycomppaths|vs_known;
 	}
 
 	for ( ss=sc->layers[layer].splines, pt_cnt=path_cnt=0; ss!=NULL; ss=ss->next, ++path_cnt ) {
@@ -1845,12 +1993,12 @@ int SCValidate(SplineChar *sc, int layer, int force) {
 	    }
 	}
 	if ( pt_cnt>pt_max )
-	    sc->layers[layer].validation_state |= vs_maxp_toomanypoints|vs_known;
+	    vs |= vs_maxp_toomanypoints|vs_known;
 	if ( path_cnt>path_max )
-	    sc->layers[layer].validation_state |= vs_maxp_toomanypaths|vs_known;
+	    vs |= vs_maxp_toomanypaths|vs_known;
 
 	if ( sc->ttf_instrs_len>instr_len_max )
-	    sc->layers[layer].validation_state |= vs_maxp_instrtoolong|vs_known;
+	    vs |= vs_maxp_instrtoolong|vs_known;
 
 	rd = 0;
 	for ( r=sc->layers[layer].refs, cnt=0; r!=NULL; r=r->next, ++cnt ) {
@@ -1859,78 +2007,150 @@ int SCValidate(SplineChar *sc, int layer, int force) {
 		rd = rdtest;
 	}
 	if ( cnt>num_comp_max )
-	    sc->layers[layer].validation_state |= vs_maxp_toomanyrefs|vs_known;
+	    vs |= vs_maxp_toomanyrefs|vs_known;
 	if ( rd>comp_depth_max )
-	    sc->layers[layer].validation_state |= vs_maxp_refstoodeep|vs_known;
+	    vs |= vs_maxp_refstoodeep|vs_known;
     }
 
-    k=0;
-    cid = sc->parent;
-    if ( cid->cidmaster != NULL )
-	cid = cid->cidmaster;
-    do {
-	sf = cid->subfontcnt==0 ? cid : cid->subfonts[k];
-	for ( gid=0; gid<sf->glyphcnt; ++gid ) if ( (othersc=sf->glyphs[gid])!=NULL ) {
-	    if ( othersc==sc )
-	continue;
-	    if ( strcmp(sc->name,othersc->name)==0 )
-		sc->layers[layer].validation_state |= vs_dupname|vs_known;
-	    if ( sc->unicodeenc!=-1 && UniMatch(-1,sc->unicodeenc,othersc) )
-		sc->layers[layer].validation_state |= vs_dupunicode|vs_known;
-	    for ( alt=sc->altuni; alt!=NULL; alt=alt->next )
-		if ( UniMatch(alt->vs,alt->unienc,othersc) )
-		    sc->layers[layer].validation_state |= vs_dupunicode|vs_known;
-	}
-	++k;
-    } while ( k<cid->subfontcnt );
+    vs |= SCValidateDups(sc,names);
+
+    sc->layers[layer].validation_state = vs;
+}
 
-  end:;
+/* The part of validation which looks at the font's anchor classes, so */
+/*  must be done for one glyph at a time */
+static void SCValidateFinish(SplineChar *sc, int layer) {
     /* This test is intentionally here and should be done even if the glyph */
     /*  hasn't changed. If the lookup changed it could make the glyph invalid */
     if ( SCValidateAnchors(sc)!=NULL )
 	sc->layers[layer].validation_state |= vs_missinganchor;
 
     sc->layers[layer].validation_state |= vs_known;
+}
+
+int SCValidate(SplineChar *sc, int layer, int force) {
+
+    if ( !(sc->layers[layer].validation_state&vs_known) || force )
+	_SCValidate(sc,layer,NULL);
+    SCValidateFinish(sc,layer);
+
     if ( sc->unlink_rm_ovrlp_save_undo )
 return( sc->layers[layer].validation_state&~(vs_known|vs_selfintersects) );
 
 return( sc->layers[layer].validation_state&~vs_known );
 }
 
+struct validate_glyphs {
+    SplineChar **scs;
+    int layer;
+    struct vsnames *names;
+};
+
+static void SCValidateThread(void *data, int i) {
+    struct validate_glyphs *vg = data;
+
+    _SCValidate(vg->scs[i],vg->layer,vg->names);
+}
+
+/* Looking glyphs up by name builds a hash table the first time, do that */
+/*  before several threads want it */
+static void SFPrepareValidate(SplineFont *cid) {
+    int k;
+
+    (void) SFHashName(cid,".notdef");
+    for ( k=0; k<cid->subfontcnt; ++k )
+	(void) SFHashName(cid->subfonts[k],".notdef");
+}
+
+/* Validates a list of glyphs of one font over all processors */
+void SCsValidate(SplineChar **scs, int cnt, int layer, int force) {
+    struct validate_glyphs vg;
+    SplineChar **todo;
+    SplineFont *cid;
+    int i, tcnt;
+
+    if ( cnt==0 )
+return;
+    cid = scs[0]->parent->cidmaster!=NULL ? scs[0]->parent->cidmaster : scs[0]->parent;
+    todo = malloc(cnt*sizeof(SplineChar *));
+    for ( i=tcnt=0; i<cnt; ++i )
+	if ( force || !(scs[i]->layers[layer].validation_state&vs_known) )
+	    todo[tcnt++] = scs[i];
+    SFPrepareValidate(cid);
+    vg.scs = todo;
+    vg.layer = layer;
+    vg.names = NULL;
+    FFParallelFor(tcnt,SCValidateThread,&vg);
+    for ( i=0; i<cnt; ++i )
+	SCValidateFinish(scs[i],layer);
+    free(todo);
+}
+
 int SFValidate(SplineFont *sf, int layer, int force) {
-    int k, gid;
+    int k, gid, i, batch;
     SplineFont *sub;
     int any = 0;
-    SplineChar *sc;
+    SplineChar *sc, **todo;
     int cnt=0;
+    struct validate_glyphs vg;
 
     if ( sf->cidmaster )
 	sf = sf->cidmaster;
 
-    if ( !no_windowing_ui ) {
-	cnt = 0;
-	k = 0;
-	do {
-	    sub = sf->subfontcnt==0 ? sf : sf->subfonts[k];
-	    for ( gid=0; gid<sub->glyphcnt; ++gid ) if ( (sc=sub->glyphs[gid])!=NULL ) {
-		if ( force || !(sc->layers[layer].validation_state&vs_known) )
-		    ++cnt;
+    cnt = 0;
+    k = 0;
+    do {
+	sub = sf->subfontcnt==0 ? sf : sf->subfonts[k];
+	for ( gid=0; gid<sub->glyphcnt; ++gid ) if ( (sc=sub->glyphs[gid])!=NULL ) {
+	    if ( force || !(sc->layers[layer].validation_state&vs_known) )
+		++cnt;
+	}
+	++k;
+    } while ( k<sf->subfontcnt );
+    if ( !no_windowing_ui && cnt!=0 )
+	ff_progress_start_indicator(10,_("Validating..."),_("Validating..."),0,cnt,1);
+
+    /* The glyphs are independent, so validate them in parallel, in batches */
+    /*  so that the progress indicator moves (and may be cancelled) */
+    todo = malloc((cnt+1)*sizeof(SplineChar *));
+    cnt = 0;
+    k = 0;
+    do {
+	sub = sf->subfontcnt==0 ? sf : sf->subfonts[k];
+	for ( gid=0; gid<sub->glyphcnt; ++gid ) if ( (sc=sub->glyphs[gid])!=NULL ) {
+	    if ( force || !(sc->layers[layer].validation_state&vs_known) )
+		todo[cnt++] = sc;
+	}
+	++k;
+    } while ( k<sf->subfontcnt );
+    vg.layer = layer;
+    vg.names = NULL;
+    if ( cnt!=0 ) {
+	SFPrepareValidate(sf);
+	vg.names = VSNamesCreate(sf);
+    }
+    for ( i=0; i<cnt; i+=batch ) {
+	batch = cnt-i<256 ? cnt-i : 256;
+	vg.scs = todo+i;
+	FFParallelFor(batch,SCValidateThread,&vg);
+	for ( k=0; k<batch; ++k ) {
+	    SCValidateFinish(todo[i+k],layer);
+	    if ( !ff_progress_next()) {
+		VSNamesFree(vg.names);
+		free(todo);
+return( -1 );
 	    }
-	    ++k;
-	} while ( k<sf->subfontcnt );
-	if ( cnt!=0 )
-	    ff_progress_start_indicator(10,_("Validating..."),_("Validating..."),0,cnt,1);
+	}
     }
+    VSNamesFree(vg.names);
+    free(todo);
 
     k = 0;
     do {
 	sub = sf->subfontcnt==0 ? sf : sf->subfonts[k];
 	for ( gid=0; gid<sub->glyphcnt; ++gid ) if ( (sc=sub->glyphs[gid])!=NULL ) {
-	    if ( force || !(sc->layers[layer].validation_state&vs_known) ) {
-		SCValidate(sc,layer,true);
-		if ( !ff_progress_next())
-return( -1 );
-	    } else if ( SCValidateAnchors(sc)!=NULL )
+	    /* With force every glyph was finished above */
+	    if ( !force && SCValidateAnchors(sc)!=NULL )
 		sc->layers[layer].validation_state |= vs_missinganchor;
 
 	    if ( sc->unlink_rm_ovrlp_save_undo )
@@ -2738,6 +2958,7 @@ static void _SCChngNoUpdate(SplineChar *sc,int layer,int changed) {
 	IError( "Bad layer in _SCChngNoUpdate");
 	layer = ly_fore;
     }
+    SCInvalidateBounds(sc);
     if ( layer>=0 && !sc->layers[layer].background )
 	TTFPointMatches(sc,layer,true);
     if ( changed!=-1 ) {
@@ -32,6 +32,7 @@
 #include "edgelist.h"
 #include "fontforge.h"
 #include "fvfonts.h"
+#include "parallel.h"
 #include "psread.h"
 #include "splinefont.h"
 #include "splinesaveafm.h"
@@ -1672,17 +1673,21 @@ static void ByteMult(BDFChar *bc,int factor) {
 	*pt++ *= factor;
 }
 
-BDFChar *BDFPieceMeal(BDFFont *bdf, int index) {
-    SplineChar *sc;
-
-    if ( index<0 )
-return( NULL );
+static void BDFPieceMealGrow(BDFFont *bdf) {
     if ( bdf->glyphcnt<bdf->sf->glyphcnt ) {
 	if ( bdf->glyphmax<bdf->sf->glyphcnt )
 	    bdf->glyphs = realloc(bdf->glyphs,(bdf->glyphmax = bdf->sf->glyphmax)*sizeof(BDFChar *));
 	memset(bdf->glyphs+bdf->glyphcnt,0,(bdf->glyphmax-bdf->glyphcnt)*sizeof(SplineChar *));
 	bdf->glyphcnt = bdf->sf->glyphcnt;
     }
+}
+
+BDFChar *BDFPieceMeal(BDFFont *bdf, int index) {
+    SplineChar *sc;
+
+    if ( index<0 )
+return( NULL );
+    BDFPieceMealGrow(bdf);
     if ( index >= bdf->glyphcnt )
 return( NULL );
 
@@ -1727,6 +1732,56 @@ return( bdf->glyphs[index]);
 return(BDFPieceMeal(bdf,index));
 }
 
+struct piecemeal_many {
+    BDFFont *bdf;
+    const int *gids;
+};
+
+static int gidcmp(const void *_g1, const void *_g2) {
+    int g1 = *(const int *) _g1, g2 = *(const int *) _g2;
+
+return( g1<g2 ? -1 : g1>g2 );
+}
+
+static void BDFPieceMealThread(void *data, int i) {
+    struct piecemeal_many *pm = data;
+
+    BDFPieceMeal(pm->bdf,pm->gids[i]);
+}
+
+/* Rasterizes the listed glyphs, skipping any already done. Our own rasterizer */
+/*  only reads the glyph (and the glyphs it refers to), so several glyphs may */
+/*  be done at once. A freetype context may not be shared between threads, so */
+/*  fonts which use one are done here in order */
+void BDFPieceMealMany(BDFFont *bdf, const int *gids, int cnt) {
+    struct piecemeal_many pm;
+    int *todo, i, k, tcnt;
+
+    BDFPieceMealGrow(bdf);
+    todo = malloc((cnt+1)*sizeof(int));
+    for ( i=tcnt=0; i<cnt; ++i ) {
+	if ( gids[i]>=0 && gids[i]<bdf->glyphcnt && bdf->glyphs[gids[i]]==NULL &&
+		bdf->sf->glyphs[gids[i]]!=NULL )
+	    todo[tcnt++] = gids[i];
+    }
+    /* Two threads must never fill the same slot */
+    qsort(todo,tcnt,sizeof(int),gidcmp);
+    for ( i=k=0; i<tcnt; ++i )
+	if ( k==0 || todo[k-1]!=todo[i] )
+	    todo[k++] = todo[i];
+    tcnt = k;
+    pm.bdf = bdf;
+    pm.gids = todo;
+    if ( tcnt>1 && bdf->freetype_context==NULL && !bdf->recontext_freetype &&
+	    !bdf->unhinted_freetype )
+	FFParallelFor(tcnt,BDFPieceMealThread,&pm);
+    else {
+	for ( i=0; i<tcnt; ++i )
+	    BDFPieceMeal(bdf,todo[i]);
+    }
+    free(todo);
+}
+
 /* Piecemeal fonts are used as the display font in the fontview, metricsview and other places*/
 /*  as such they are simple fonts (ie. we only display the current cid subfont) */
 BDFFont *SplineFontPieceMeal(SplineFont *sf,int layer,int ptsize,int dpi,
@@ -9,6 +9,7 @@ enum piecemeal_flags { pf_antialias=1, pf_bbsized=2, pf_ft_nohints=4, pf_ft_reco
 
 extern BDFChar *BDFPieceMeal(BDFFont *bdf, int index);
 extern BDFChar *BDFPieceMealCheck(BDFFont *bdf, int index);
+extern void BDFPieceMealMany(BDFFont *bdf, const int *gids, int cnt);
 extern BDFChar *SplineCharAntiAlias(SplineChar *sc, int layer, int pixelsize, int linear_scale);
 extern BDFChar *SplineCharRasterize(SplineChar *sc, int layer, bigreal pixelsize);
 extern BDFFont *SplineFontAntiAlias(SplineFont *_sf, int layer, int pixelsize, int linear_scale);
@@ -28,6 +28,7 @@
 
 #include <fontforge-config.h>
 
+#include "arena.h"
 #include "fontforge.h"
 #include "splinefit.h"
 #include "splineorder2.h"
@@ -1365,7 +1366,7 @@ SplinePoint *_ApproximateSplineSetFromGen(SplinePoint *from, SplinePoint *to,
 
     if ( (toler_is_sumsq ? errsum : maxerr) > toler && depth < 6 ) {
 	mid_t = fp[maxerri].t * (end_t-start_t) + start_t;
-	free(fp);
+	ArenaChunkFree(fp,cnt*sizeof(FitPoint));
 	SplineFree(from->next);
 	from->next = NULL;
 	to->prev = NULL;
@@ -1398,7 +1399,7 @@ SplinePoint *_ApproximateSplineSetFromGen(SplinePoint *from, SplinePoint *to,
 	      toler_is_sumsq ? "Sum of squared errors" : "Maximum error length",
 	      toler_is_sumsq ? errsum : maxerr, toler, depth);
     }
-    free(fp);
+    ArenaChunkFree(fp,cnt*sizeof(FitPoint));
     return to;
 }
 
@@ -54,8 +54,9 @@ extern Spline *ApproximateSplineFromPointsSlopes(SplinePoint *from, SplinePoint
  * the point of largest error, where the position and slope are fixed
  * according to the FitPoint entries. 
  *
- * A GenPointsP function should allocate a free-able array of FitPoints,
- * set *fpp to point to it, and return the number of points allocated.
+ * A GenPointsP function should allocate an array of FitPoints with
+ * ArenaChunkAlloc (it is released with ArenaChunkFree), set *fpp to
+ * point to it, and return the number of points allocated.
  * The points should correspond to values chosen between the interval
  * t_start and t_end, but just what this interval corresponds to depends
  * on vinfo and is therefore opaque to the tracing system. It is up to the
@@ -907,6 +907,8 @@ typedef struct undoes {
 	    char *comment;			/* in utf8 */
 	    PST *possub;			/* only for ut_statename */
 	    struct splinepointlist *splines;
+	    uint8_t *packed_splines;		/* splines, serialized, when undoes are compressed */
+	    uint32_t packed_len;
 	    struct refchar *refs;
 
 	    struct imagelist *images;
@@ -941,6 +943,8 @@ typedef struct undoes {
 	uint8_t *bitmap;
     } u;
     struct splinefont *copied_from;
+    uint32_t stamp;		/* When it was added, to find the oldest undoes in the session */
+    size_t bytes;		/* Memory it holds, if counted against the undo budget */
 } Undoes;
 
 enum sfundotype
@@ -1326,6 +1330,8 @@ typedef struct layer /* : reflayer */{
     unsigned int dofill: 1;
     unsigned int dostroke: 1;
     unsigned int fillfirst: 1;
+    unsigned int bounds_cached: 1;	/* bounds holds the layer's exact bounds */
+    unsigned int qbounds_cached: 1;	/* qbounds and cbounds are valid */
     struct brush fill_brush;
     struct pen stroke_pen;
     SplinePointList *splines;
@@ -1336,6 +1342,11 @@ typedef struct layer /* : reflayer */{
     Undoes *redoes;
     uint32_t validation_state;
     uint32_t old_vs;
+    /* Cached bounds, cleared by SCInvalidateBounds when the glyph or one */
+    /*  it refers to changes. bounds covers the whole layer (references, */
+    /*  images and stroking too), qbounds and cbounds are the quick and the */
+    /*  quick conservative bounds of its contours alone */
+    DBounds bounds, qbounds, cbounds;
     void *python_persistent;		/* If python this will hold a python object, if not python this will hold a string containing a pickled object. We do nothing with it (if not python) except save it back out unchanged */
     int python_persistent_has_lists;
 } Layer;
@@ -1484,6 +1495,7 @@ typedef struct splinechar {
     unsigned int ticked: 1;	/* For reference character processing */
 				/* And fontview processing */
     unsigned int changed_since_autosave: 1;
+    unsigned int in_autosave: 1;	/* A copy of it is in the font's autosave file */
     unsigned int widthset: 1;	/* needed so an emspace char doesn't disappear */
     unsigned int vconflicts: 1;	/* Any hint overlaps in the vstem list? */
     unsigned int hconflicts: 1;	/* Any hint overlaps in the hstem list? */
@@ -1865,6 +1877,12 @@ typedef struct splinefont {
     BDFFont *bitmaps;
     char *origname;		/* filename of font file (ie. if not an sfd) */
     char *autosavename;
+    struct {
+	int layer_cnt;		/* Of the whole autosave file, 0 if none has been written */
+	int glyph_cnt;		/* Glyphs in the whole file */
+	int journal_cnt;	/* Glyphs appended to it since */
+	int marked_cnt;		/* Glyphs marked in_autosave */
+    } autosave;
     int display_size;		/* a val <0 => Generate our own images from splines, a value >0 => find a bdf font of that size */
     struct psdict *private;	/* read in from type1 file or provided by user */
     char *xuid;
@@ -2354,7 +2372,8 @@ struct pscontext {
     int painttype;
     int instance_count;
     real blend_values[17];
-    int blend_warn;
+    int blend_warn;		/* We've complained about the blend operator */
+    int blend_seen;		/* The blend operator has been used */
 };
 
 extern int NameToEncoding(SplineFont *sf,EncMap *map,const char *uname);
@@ -2511,8 +2530,10 @@ extern int BPTooFar(BasePoint *bp1, BasePoint *bp2);
 extern StemInfo *SCHintOverlapInMask(SplineChar *sc,HintMask *hm);
 extern char *VSErrorsFromMask(int mask,int private_mask);
 extern int SCValidate(SplineChar *sc, int layer, int force);
+extern void SCsValidate(SplineChar **scs, int cnt, int layer, int force);
 extern AnchorClass *SCValidateAnchors(SplineChar *sc);
 extern void SCTickValidationState(SplineChar *sc,int layer);
+extern void SCInvalidateBounds(SplineChar *sc);
 extern int ValidatePrivate(SplineFont *sf);
 extern int SFValidate(SplineFont *sf, int layer, int force);
 extern int VSMaskFromFormat(SplineFont *sf, int layer, enum fontformat format);
@@ -29,6 +29,7 @@
 
 #include "splineoverlap.h"
 
+#include "arena.h"
 #include "edgelist2.h"
 #include "fontforge.h"
 #include "gwidget.h"		/* For PostNotice */
@@ -89,9 +90,12 @@
 // (The pointers tend to clutter the diff a bit.)
 // #define FF_OVERLAP_VERBOSE
 
-static char *glyphname=NULL;
+/* Name of the glyph being processed, for messages. Kept per thread as */
+/*  different fonts may have their overlap removed concurrently */
+static GPrivate overlap_glyphname = G_PRIVATE_INIT(NULL);
 
 static void SOError(const char *format,...) {
+    const char *glyphname = g_private_get(&overlap_glyphname);
     va_list ap;
     va_start(ap,format);
     if ( glyphname==NULL )
@@ -106,6 +110,7 @@ static void SONotify(const char *format,...) {
     va_list ap;
     va_start(ap,format);
 #ifdef FF_OVERLAP_VERBOSE
+    const char *glyphname = g_private_get(&overlap_glyphname);
     if ( glyphname==NULL )
 	fprintf(stderr, "Note (overlap): " );
     else
@@ -234,7 +239,7 @@ static Monotonic *SplineToMonotonic(Spline *s,extended startt,extended endt,
 return( last );
     }
 
-    m = chunkalloc(sizeof(Monotonic));
+    m = ArenaChunkAlloc(sizeof(Monotonic));
     m->s = s;
     m->tstart = startt;
     m->tend = endt;
@@ -419,7 +424,7 @@ ValidateMListTs_IF_VERBOSE(il->monos)
 	}
     }
 
-    ml = chunkalloc(sizeof(MList)); // Create a new monotonic list item.
+    ml = ArenaChunkAlloc(sizeof(MList)); // Create a new monotonic list item.
     // Add the new item to the monotonic list for the input intersection.
     ml->next = il->monos;
     il->monos = ml;
@@ -464,7 +469,7 @@ static void MListCleanEmpty(struct mlist ** base_pointer) {
   while (*current_pointer) {
     if ((*current_pointer)->m == NULL) {
       tmp_pointer = (*current_pointer)->next;
-      chunkfree(*current_pointer, sizeof(struct mlist));
+      ArenaChunkFree(*current_pointer, sizeof(struct mlist));
       (*current_pointer) = tmp_pointer;
     }
     current_pointer = &((*current_pointer)->next);
@@ -479,7 +484,7 @@ static void MListRemoveMonotonic(struct mlist ** base_pointer, struct monotonic
   while (*current_pointer) {
     if (((*current_pointer)->m == findm) && ((*current_pointer)->isend == isend)) {
       tmp_pointer = (*current_pointer)->next;
-      chunkfree(*current_pointer, sizeof(struct mlist));
+      ArenaChunkFree(*current_pointer, sizeof(struct mlist));
       (*current_pointer) = tmp_pointer;
     }
     if (*current_pointer) current_pointer = &((*current_pointer)->next);
@@ -533,7 +538,7 @@ static void CleanMonotonics(struct monotonic ** base_pointer) {
         SOError("Partially stranded monotonic.\n");
       } else {
         tmp_pointer = current_pointer->linked;
-        chunkfree(current_pointer, sizeof(struct monotonic));
+        ArenaChunkFree(current_pointer, sizeof(struct monotonic));
         current_pointer = tmp_pointer;
 	if ( last_pointer!=NULL )
           last_pointer->linked = current_pointer;
@@ -842,7 +847,7 @@ return;
 	    SOError( "The monotonic curve is too short.\n");
         else {
 	    /* It is monotonic, so a subset of it must also be */
-	    Monotonic *m2 = chunkalloc(sizeof(Monotonic));
+	    Monotonic *m2 = ArenaChunkAlloc(sizeof(Monotonic));
 	    BasePoint pt, inter;
             BasePoint oldend;
             if (m->end != NULL) oldend = m->end->inter;
@@ -1029,7 +1034,7 @@ static void SplitMonotonicAtT(Monotonic *m,int which,bigreal t,bigreal coord,
     } else {
 	SONotify("Break monotonic from t = %f to t = %f at t = %f.\n", m->tstart, m->tend, t);
 	othert = t;
-	otherm = chunkalloc(sizeof(Monotonic));
+	otherm = ArenaChunkAlloc(sizeof(Monotonic));
 	*otherm = *m;
 	otherm->pending = NULL;
 	m->next = otherm;
@@ -1406,7 +1411,7 @@ ValidateMListTs_IF_VERBOSE(il->monos)
     // If we are not reusing a point, make one.
     if ( closest==NULL ) {
         SONotify("New inter at (%f, %f).\n", inter->x, inter->y);
-	closest = chunkalloc(sizeof(Intersection));
+	closest = ArenaChunkAlloc(sizeof(Intersection));
 	closest->inter = *inter;
 	closest->next = ilist;
 	ilist = closest;
@@ -1417,7 +1422,7 @@ ValidateMListTs_IF_VERBOSE(closest->monos)
         if (closest->monos == NULL) {
           SONotify("Never mind that new point.\n");
           ilist = closest->next;
-          chunkfree(closest, sizeof(Intersection)); closest = NULL;
+          ArenaChunkFree(closest, sizeof(Intersection)); closest = NULL;
         }
     } else {
         SONotify("Old inter at (%f, %f).\n", closest->inter.x, closest->inter.y);
@@ -1634,7 +1639,7 @@ static void AddPreIntersection(Monotonic *m1, Monotonic *m2,
 	( m2->next==m1 && (t2==t1 || (t2==1.0 && t1==0.0))) )
 return;
 
-    p = chunkalloc(sizeof(PreIntersection));
+    p = ArenaChunkAlloc(sizeof(PreIntersection));
     p->next = m1->pending;
     m1->pending = p;
     p->m1 = m1;
@@ -2178,7 +2183,7 @@ static Intersection *TurnPreInter2Inter(Monotonic *ms) {
 		ilist = AddCloseIntersection(ilist,m1,m2,p->t1,p->t2,&p->inter);
 	    else
 		ilist = AddIntersection(ilist,m1,m2,p->t1,p->t2,&p->inter);
-	    chunkfree(p,sizeof(PreIntersection));
+	    ArenaChunkFree(p,sizeof(PreIntersection));
 	}
 	ms->pending = NULL;
     }
@@ -2271,13 +2276,13 @@ static void FigureProperMonotonicsAtIntersections(Intersection *ilist) {
 		if ( ml2!=NULL ) {
 		    if ( ml2==mlnext ) mlnext = ml2->next;
 		    p2->next = ml2->next;
-		    chunkfree(ml2,sizeof(*ml2));
+		    ArenaChunkFree(ml2,sizeof(*ml2));
 		}
 		if ( prev==NULL )
 		    ilist->monos = mlnext;
 		else
 		    prev->next = mlnext;
-		chunkfree(ml,sizeof(*ml));
+		ArenaChunkFree(ml,sizeof(*ml));
 	    }
 	}
 	ilist = ilist->next;
@@ -2338,7 +2343,7 @@ static Intersection *FindIntersections(Monotonic **ms, enum overlap_type ot) {
 	for ( m1=*ms; m1!=NULL; m1=m2->linked ) {
 	    if ( m1->start==NULL && m1->end==NULL ) {
 		Intersection *il;
-		il = chunkalloc(sizeof(Intersection));
+		il = ArenaChunkAlloc(sizeof(Intersection));
 		il->inter = m1->s->from->me;
 		il->next = ilist;
 		AddSpline(il,m1,0);
@@ -3394,32 +3399,11 @@ void FreeMonotonics(Monotonic *m) {
 
     while ( m!=NULL ) {
 	next = m->linked;
-	chunkfree(m,sizeof(*m));
+	ArenaChunkFree(m,sizeof(*m));
 	m = next;
     }
 }
 
-static void FreeMList(MList *ml) {
-    MList *next;
-
-    while ( ml!=NULL ) {
-	next = ml->next;
-	chunkfree(ml,sizeof(*ml));
-	ml = next;
-    }
-}
-
-static void FreeIntersections(Intersection *ilist) {
-    Intersection *next;
-
-    while ( ilist!=NULL ) {
-	next = ilist->next;
-	FreeMList(ilist->monos);
-	chunkfree(ilist,sizeof(*ilist));
-	ilist = next;
-    }
-}
-
 static void MonoSplit(Monotonic *m) {
     Spline *s = m->s;
     SplinePoint *last = s->from;
@@ -3966,9 +3950,10 @@ SplineSet *SplineSetRemoveOverlap(SplineChar *sc, SplineSet *base,enum overlap_t
     Monotonic *ms;
     Intersection *ilist;
     SplineSet *ret;
+    Arena *arena;
 
     if ( sc!=NULL )
-	glyphname = sc->name;
+	g_private_set(&overlap_glyphname,sc->name);
 
     base = SSRemoveTiny(base);
     SSRemoveStupidControlPoints(base);
@@ -3977,6 +3962,9 @@ SplineSet *SplineSetRemoveOverlap(SplineChar *sc, SplineSet *base,enum overlap_t
     // base = SSRemoveReversals(base);
     // Frank suspects that improvements to FindIntersections have made SSRemoveReverals unnecessary.
     // And it breaks certain glyphs such as the only glyph in rmo-triangle2.sfd from debugfonts.
+    /* The monotonics and intersections all come from the arena, and are */
+    /*  released together when it ends */
+    arena = ArenaBegin();
     ms = SSsToMContours(base,ot);
     {
       Monotonic * tmpm = ms;
@@ -3999,8 +3987,7 @@ SplineSet *SplineSetRemoveOverlap(SplineChar *sc, SplineSet *base,enum overlap_t
 	SplineSet *tmpret = JoinAllNeeded(ilist);
 	ret = MergeOpenAndFreeClosed(tmpret,base,ot);
     }
-    FreeMonotonics(ms);
-    FreeIntersections(ilist);
-    glyphname = NULL;
+    ArenaEnd(arena);
+    g_private_set(&overlap_glyphname,NULL);
 return( ret );
 }
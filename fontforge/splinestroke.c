@@ -29,6 +29,7 @@
 
 #include "splinestroke.h"
 
+#include "arena.h"
 #include "baseviews.h"
 #include "cvundoes.h"
 #include "fontforge.h"
@@ -1191,7 +1192,7 @@ int GenStrokeTracePoints(void *vinfo, bigreal t_fm, bigreal t_to,
     BasePoint xy;
 
     *fpp = NULL;
-    fp = calloc(stip->num_points, sizeof(FitPoint));
+    fp = ArenaChunkAlloc(stip->num_points*sizeof(FitPoint));
     nidiff = (t_to - t_fm) / (stip->num_points-1);
 
     nib_ccw = SplineTurningCCWAt(stip->s, t_fm);
@@ -1216,7 +1217,7 @@ int GenStrokeTracePoints(void *vinfo, bigreal t_fm, bigreal t_to,
 		                                      stip->is_right,
 		                                      nib_ccw, CUSPD_MARGIN,
 						      stip->starts_on_cusp);
-		free(fp);
+		ArenaChunkFree(fp,stip->num_points*sizeof(FitPoint));
 		return 0;
 	    }
 	} else {
@@ -1254,7 +1255,7 @@ SplinePoint *TraceAndFitSpline(StrokeContext *c, Spline *s, bigreal t_fm,
 
     if ( on_cusp && !TRACE_CUSPS ) {
 	GenStrokeTracePoints((void *)&sti, t_fm, t_to, &fpp);
-	free(fpp);
+	ArenaChunkFree(fpp,sti.num_points*sizeof(FitPoint));
     } else
 	sp = ApproximateSplineSetFromGen(tailp, NULL, t_fm, t_to, c->acctarget,
 	                                 false, &GenStrokeTracePoints,
@@ -2519,6 +2520,7 @@ SplineSet *SplineSetStroke(SplineSet *ss,StrokeInfo *si, int order2) {
     int max_pc;
     StrokeContext c;
     SplineSet *nibs, *nib, *first, *last, *cur;
+    Arena *arena;
     bigreal sn = 0.0, co = 1.0, mr, wh_ratio, maxdim;
     DBounds b;
     real trans[6];
@@ -2609,6 +2611,8 @@ SplineSet *SplineSetStroke(SplineSet *ss,StrokeInfo *si, int order2) {
     SplinePointListTransformExtended(nibs,trans,tpt_AllPoints,
 	                             tpmask_dontTrimValues);
 
+    /* The traced points of every stroked spline go into the arena */
+    arena = ArenaBegin();
     first = last = NULL;
     for ( nib=nibs; nib!=NULL; nib=nib->next ) {
 	assert( NibIsValid(nib)==Shape_Convex );
@@ -2623,6 +2627,7 @@ SplineSet *SplineSetStroke(SplineSet *ss,StrokeInfo *si, int order2) {
 	    while ( last->next!=NULL )
 	        last = last->next;
     }
+    ArenaEnd(arena);
     if ( c.rmov==srmov_layer )
 	first=SplineSetRemoveOverlap(NULL,first,over_remove);
     if ( c.extrema )
@@ -39,6 +39,7 @@
 #include "glif_name_hash.h"
 #include "mm.h"
 #include "namelist.h"
+#include "parallel.h"
 #include "parsepfa.h"
 #include "parsettf.h"
 #include "psfont.h"
@@ -678,12 +679,38 @@ static void _ImageFindBounds(ImageList *img,DBounds *bounds) {
     }
 }
 
-static void _SplineCharLayerFindBounds(SplineChar *sc,int layer, DBounds *bounds) {
+/* Finding the exact bounds of a glyph means solving for the extrema of    */
+/*  every spline, and the font writers, the metrics view and autowidth ask */
+/*  for the bounds of every glyph again and again. So each layer remembers */
+/*  its bounds (and the quick bounds of its contours) until the glyph, or  */
+/*  one it refers to, is changed. SCInvalidateBounds is called from the    */
+/*  change notifications (SCCharChangedUpdate and friends), from FVTrans   */
+/*  and whenever a reference is reinstanciated.                            */
+/* Much code changes a glyph in place and measures it again before anyone  */
+/*  has been told of the change, so the plain per-glyph routines always    */
+/*  recompute (refreshing the cache). Only callers which measure glyphs    */
+/*  at rest use the ...Cached variants, as do the font wide routines.      */
+void SCInvalidateBounds(SplineChar *sc) {
+    struct splinecharlist *dlist;
+    int i;
+
+    for ( i=0; i<sc->layer_cnt; ++i ) {
+	sc->layers[i].bounds_cached = false;
+	sc->layers[i].qbounds_cached = false;
+    }
+    /* Glyphs referring to this one include its bounds in theirs */
+    for ( dlist=sc->dependents; dlist!=NULL; dlist=dlist->next )
+	SCInvalidateBounds(dlist->sc);
+}
+
+/* The bounds of one layer: references, contours, images and stroking */
+static void LayerFindBounds(SplineChar *sc,int layer, DBounds *bounds) {
     RefChar *rf;
     ImageList *img;
     real e;
     DBounds b, clipb;
 
+    memset(bounds,0,sizeof(*bounds));
     for ( rf=sc->layers[layer].refs; rf!=NULL; rf = rf->next ) {
 	if ( bounds->minx==0 && bounds->maxx==0 && bounds->miny==0 && bounds->maxy == 0 )
 	    *bounds = rf->bb;
@@ -721,6 +748,25 @@ static void _SplineCharLayerFindBounds(SplineChar *sc,int layer, DBounds *bounds
 	if ( b.maxx > bounds->maxx ) bounds->maxx = b.maxx;
 	if ( b.maxy > bounds->maxy ) bounds->maxy = b.maxy;
     }
+}
+
+static void _SplineCharLayerFindBounds(SplineChar *sc,int layer, DBounds *bounds, int use_cache) {
+    Layer *ly = &sc->layers[layer];
+    DBounds b;
+
+    if ( !use_cache || !ly->bounds_cached ) {
+	LayerFindBounds(sc,layer,&ly->bounds);
+	ly->bounds_cached = true;
+    }
+    b = ly->bounds;
+    if ( bounds->minx==0 && bounds->maxx==0 && bounds->miny==0 && bounds->maxy == 0 )
+	*bounds = b;
+    else if ( b.minx!=0 || b.maxx != 0 || b.maxy != 0 || b.miny!=0 ) {
+	if ( b.minx < bounds->minx ) bounds->minx = b.minx;
+	if ( b.miny < bounds->miny ) bounds->miny = b.miny;
+	if ( b.maxx > bounds->maxx ) bounds->maxx = b.maxx;
+	if ( b.maxy > bounds->maxy ) bounds->maxy = b.maxy;
+    }
 
     if ( sc->parent!=NULL && sc->parent->strokedfont &&
 	    (bounds->minx!=bounds->maxx || bounds->miny!=bounds->maxy)) {
@@ -730,33 +776,49 @@ static void _SplineCharLayerFindBounds(SplineChar *sc,int layer, DBounds *bounds
     }
 }
 
-void SplineCharLayerFindBounds(SplineChar *sc,int layer,DBounds *bounds) {
-
-    if ( sc->parent!=NULL && sc->parent->multilayer ) {
-	SplineCharFindBounds(sc,bounds);
-return;
-    }
+static void SplineCharBounds(SplineChar *sc,DBounds *bounds,int use_cache) {
+    int i;
+    int first,last;
 
     /* a char with no splines (ie. a space) must have an lbearing of 0 */
     bounds->minx = bounds->maxx = 0;
     bounds->miny = bounds->maxy = 0;
 
-    _SplineCharLayerFindBounds(sc,layer,bounds);
+    first = last = ly_fore;
+    if ( sc->parent!=NULL )
+	last = sc->layer_cnt-1;
+    for ( i=first; i<=last; ++i )
+	_SplineCharLayerFindBounds(sc,i,bounds,use_cache);
 }
 
 void SplineCharFindBounds(SplineChar *sc,DBounds *bounds) {
-    int i;
-    int first,last;
+    SplineCharBounds(sc,bounds,false);
+}
+
+void SplineCharFindBoundsCached(SplineChar *sc,DBounds *bounds) {
+    SplineCharBounds(sc,bounds,true);
+}
+
+static void SplineCharLayerBounds(SplineChar *sc,int layer,DBounds *bounds,int use_cache) {
+
+    if ( sc->parent!=NULL && sc->parent->multilayer ) {
+	SplineCharBounds(sc,bounds,use_cache);
+return;
+    }
 
     /* a char with no splines (ie. a space) must have an lbearing of 0 */
     bounds->minx = bounds->maxx = 0;
     bounds->miny = bounds->maxy = 0;
 
-    first = last = ly_fore;
-    if ( sc->parent!=NULL )
-	last = sc->layer_cnt-1;
-    for ( i=first; i<=last; ++i )
-	_SplineCharLayerFindBounds(sc,i,bounds);
+    _SplineCharLayerFindBounds(sc,layer,bounds,use_cache);
+}
+
+void SplineCharLayerFindBounds(SplineChar *sc,int layer,DBounds *bounds) {
+    SplineCharLayerBounds(sc,layer,bounds,false);
+}
+
+void SplineCharLayerFindBoundsCached(SplineChar *sc,int layer,DBounds *bounds) {
+    SplineCharLayerBounds(sc,layer,bounds,true);
 }
 
 void SplineFontLayerFindBounds(SplineFont *sf,int layer,DBounds *bounds) {
@@ -777,7 +839,7 @@ return;
 	    if ( sc->parent != NULL && sc->parent->multilayer )
 		last = sc->layer_cnt-1;
 	    for ( k=first; k<=last; ++k )
-		_SplineCharLayerFindBounds(sc,k,bounds);
+		_SplineCharLayerFindBounds(sc,k,bounds,true);
 	}
     }
 }
@@ -795,7 +857,7 @@ void SplineFontFindBounds(SplineFont *sf,DBounds *bounds) {
 	    if ( sf->multilayer )
 		last = sc->layer_cnt-1;
 	    for ( k=first; k<=last; ++k )
-		_SplineCharLayerFindBounds(sc,k,bounds);
+		_SplineCharLayerFindBounds(sc,k,bounds,true);
 	}
     }
 }
@@ -884,7 +946,24 @@ void SplineSetQuickBounds(SplineSet *ss,DBounds *b) {
     if ( b->maxy<-65536 ) b->maxy = 0;
 }
 
-void SplineCharQuickBounds(SplineChar *sc, DBounds *b) {
+/* The quick (or quick conservative) bounds of a layer's contours */
+static void LayerQuickBounds(Layer *ly,DBounds *b,int conservative,int use_cache) {
+    if ( !use_cache ) {
+	if ( conservative )
+	    SplineSetQuickConservativeBounds(ly->splines,b);
+	else
+	    SplineSetQuickBounds(ly->splines,b);
+return;
+    }
+    if ( !ly->qbounds_cached ) {
+	SplineSetQuickBounds(ly->splines,&ly->qbounds);
+	SplineSetQuickConservativeBounds(ly->splines,&ly->cbounds);
+	ly->qbounds_cached = true;
+    }
+    *b = conservative ? ly->cbounds : ly->qbounds;
+}
+
+static void _SplineCharQuickBounds(SplineChar *sc, DBounds *b, int use_cache) {
     RefChar *ref;
     int i,first, last;
     DBounds temp;
@@ -897,7 +976,7 @@ void SplineCharQuickBounds(SplineChar *sc, DBounds *b) {
     if ( sc->parent!=NULL && sc->parent->multilayer )
 	last = sc->layer_cnt-1;
     for ( i=first; i<=last; ++i ) {
-	SplineSetQuickBounds(sc->layers[i].splines,&temp);
+	LayerQuickBounds(&sc->layers[i],&temp,false,use_cache);
 	for ( img=sc->layers[i].images; img!=NULL; img=img->next )
 	    _ImageFindBounds(img,b);
 	if ( sc->layers[i].dostroke && sc->layers[i].splines!=NULL ) {
@@ -936,19 +1015,27 @@ void SplineCharQuickBounds(SplineChar *sc, DBounds *b) {
 	memset(b,0,sizeof(*b));
 }
 
-void SplineCharLayerQuickBounds(SplineChar *sc,int layer,DBounds *bounds) {
+void SplineCharQuickBounds(SplineChar *sc, DBounds *b) {
+    _SplineCharQuickBounds(sc,b,false);
+}
+
+void SplineCharQuickBoundsCached(SplineChar *sc, DBounds *b) {
+    _SplineCharQuickBounds(sc,b,true);
+}
+
+static void _SplineCharLayerQuickBounds(SplineChar *sc,int layer,DBounds *bounds,int use_cache) {
     RefChar *ref;
     DBounds temp;
 
     if ( sc->parent!=NULL && sc->parent->multilayer ) {
-	SplineCharQuickBounds(sc,bounds);
+	_SplineCharQuickBounds(sc,bounds,use_cache);
 return;
     }
 
     bounds->minx = bounds->miny = 1e10;
     bounds->maxx = bounds->maxy = -1e10;
 
-    SplineSetQuickBounds(sc->layers[layer].splines,bounds);
+    LayerQuickBounds(&sc->layers[layer],bounds,false,use_cache);
 
     for ( ref = sc->layers[layer].refs; ref!=NULL; ref = ref->next ) {
 	SplineSetQuickBounds(ref->layers[0].splines,&temp);
@@ -966,6 +1053,14 @@ return;
 	memset(bounds,0,sizeof(*bounds));
 }
 
+void SplineCharLayerQuickBounds(SplineChar *sc,int layer,DBounds *bounds) {
+    _SplineCharLayerQuickBounds(sc,layer,bounds,false);
+}
+
+void SplineCharLayerQuickBoundsCached(SplineChar *sc,int layer,DBounds *bounds) {
+    _SplineCharLayerQuickBounds(sc,layer,bounds,true);
+}
+
 void SplineSetQuickConservativeBounds(SplineSet *ss,DBounds *b) {
     SplinePoint *sp;
 
@@ -998,7 +1093,7 @@ void SplineSetQuickConservativeBounds(SplineSet *ss,DBounds *b) {
     if ( b->maxy<-65536 ) b->maxy = 0;
 }
 
-void SplineCharQuickConservativeBounds(SplineChar *sc, DBounds *b) {
+static void _SplineCharQuickConservativeBounds(SplineChar *sc, DBounds *b, int use_cache) {
     RefChar *ref;
     int i, first,last;
     DBounds temp;
@@ -1010,7 +1105,7 @@ void SplineCharQuickConservativeBounds(SplineChar *sc, DBounds *b) {
     if ( sc->parent!=NULL && sc->parent->multilayer )
 	last = sc->layer_cnt-1;
     for ( i=first; i<=last; ++i ) {
-	SplineSetQuickConservativeBounds(sc->layers[i].splines,&temp);
+	LayerQuickBounds(&sc->layers[i],&temp,true,use_cache);
 	for ( img=sc->layers[i].images; img!=NULL; img=img->next )
 	    _ImageFindBounds(img,b);
 	if ( sc->layers[i].dostroke && sc->layers[i].splines!=NULL ) {
@@ -1046,6 +1141,14 @@ void SplineCharQuickConservativeBounds(SplineChar *sc, DBounds *b) {
     }
 }
 
+void SplineCharQuickConservativeBounds(SplineChar *sc, DBounds *b) {
+    _SplineCharQuickConservativeBounds(sc,b,false);
+}
+
+void SplineCharQuickConservativeBoundsCached(SplineChar *sc, DBounds *b) {
+    _SplineCharQuickConservativeBounds(sc,b,true);
+}
+
 void SplineFontQuickConservativeBounds(SplineFont *sf,DBounds *b) {
     DBounds bb;
     int i;
@@ -1053,7 +1156,7 @@ void SplineFontQuickConservativeBounds(SplineFont *sf,DBounds *b) {
     b->minx = b->miny = 1e10;
     b->maxx = b->maxy = -1e10;
     for ( i=0; i<sf->glyphcnt; ++i ) if ( sf->glyphs[i]!=NULL ) {
-	SplineCharQuickConservativeBounds(sf->glyphs[i],&bb);
+	_SplineCharQuickConservativeBounds(sf->glyphs[i],&bb,true);
 	if ( bb.minx < b->minx ) b->minx = bb.minx;
 	if ( bb.miny < b->miny ) b->miny = bb.miny;
 	if ( bb.maxx > b->maxx ) b->maxx = bb.maxx;
@@ -2486,6 +2589,7 @@ return;		/* It's just the expected matrix */
 
     for ( i=0; i<sf->glyphcnt; ++i ) if ( (sc=sf->glyphs[i])!=NULL ) {
 	SplinePointListTransform(sc->layers[ly_fore].splines,trans,tpt_AllPoints);
+	SCInvalidateBounds(sc);
 	for ( refs=sc->layers[ly_fore].refs; refs!=NULL; refs=refs->next ) {
 	    /* Just scale the offsets. we'll do all the base characters */
 	    real temp = refs->transform[4]*trans[0] +
@@ -2540,6 +2644,54 @@ void SFInstanciateRefs(SplineFont *sf) {
     }
 }
 
+/* Interpreting one charstring doesn't depend on any other, so fonts with */
+/*  many glyphs are converted on several threads. Each gets its own copy */
+/*  of the context, since the interpreter writes to it. Warnings the */
+/*  interpreter gives only once are given afterwards by CharStringsDone */
+struct charstringjob {
+    FontDict *fd;
+    int is_cid;
+    char **names;
+    struct pscontext *pscontext;
+    SplineChar **chars;
+    int blend_seen;
+};
+
+static void CharStringThread(void *_job, int i) {
+    struct charstringjob *job = _job;
+    FontDict *fd = job->fd;
+    struct pscontext context = *job->pscontext;
+    struct pschars *subrs;
+    int j;
+
+    context.blend_warn = true;
+    context.blend_seen = false;
+
+    if ( job->is_cid ) {
+	j = fd->cidfds[i];		/* We get font indexes of 255 for non-existant chars */
+	if ( fd->cidlens[i]<=0 || j>=fd->fdcnt )
+return;
+	subrs = fd->fds[j]->private->subrs;
+	context.is_type2 = fd->fds[j]->fonttype==2;
+	job->chars[i] = PSCharStringToSplines(fd->cidstrs[i],fd->cidlens[i],
+		&context,subrs,NULL,job->names[i]);
+    } else
+	job->chars[i] = PSCharStringToSplines(fd->chars->values[i],fd->chars->lens[i],
+		&context,fd->private->subrs,NULL,job->names[i]);
+    if ( context.blend_seen )
+	g_atomic_int_set(&job->blend_seen,true);
+}
+
+static void CharStringsDone(struct charstringjob *job) {
+    if ( job->blend_seen ) {
+	job->pscontext->blend_seen = true;
+	if ( !job->pscontext->blend_warn ) {
+	    LogError( _("Use of obsolete blend operator.\n") );
+	    job->pscontext->blend_warn = true;
+	}
+    }
+}
+
 /* Also handles type3s */
 static void _SplineFontFromType1(SplineFont *sf, FontDict *fd, struct pscontext *pscontext) {
     int i, j, notdefpos;
@@ -2610,11 +2762,19 @@ static void _SplineFontFromType1(SplineFont *sf, FontDict *fd, struct pscontext
     for ( i=0; i<map->enccount; ++i ) if ( map->map[i]==-1 )
 	map->map[i] = notdefpos;
 
+    if ( !istype3 ) {
+	struct charstringjob job;
+
+	memset(&job,0,sizeof(job));
+	job.fd = fd;
+	job.names = fd->chars->keys;
+	job.pscontext = pscontext;
+	job.chars = sf->glyphs;
+	FFParallelFor(sf->glyphcnt,CharStringThread,&job);
+	CharStringsDone(&job);
+    }
     for ( i=0; i<sf->glyphcnt; ++i ) {
-	if ( !istype3 )
-	    sf->glyphs[i] = PSCharStringToSplines(fd->chars->values[i],fd->chars->lens[i],
-		    pscontext,fd->private->subrs,NULL,fd->chars->keys[i]);
-	else
+	if ( istype3 )
 	    sf->glyphs[i] = fd->charprocs->values[i];
 	if ( sf->glyphs[i]!=NULL ) {
 	    sf->glyphs[i]->orig_pos = i;
@@ -2907,7 +3067,9 @@ static SplineFont *SplineFontFromCIDType1(SplineFont *sf, FontDict *fd,
 	struct pscontext *pscontext) {
     int i,j,k, bad, uni;
     SplineChar **chars;
-    char buffer[100];
+    char buffer[100], **names;
+    int *unis;
+    struct charstringjob job;
     struct cidmap *map;
     SplineFont *_sf;
     SplineChar *sc;
@@ -2953,13 +3115,23 @@ return( NULL );
     map = FindCidMap(sf->cidregistry,sf->ordering,sf->supplement,sf);
 
     chars = calloc(fd->cidcnt,sizeof(SplineChar *));
+    names = calloc(fd->cidcnt,sizeof(char *));
+    unis = malloc(fd->cidcnt*sizeof(int));
     for ( i=0; i<fd->cidcnt; ++i ) if ( fd->cidlens[i]>0 ) {
-	j = fd->cidfds[i];		/* We get font indexes of 255 for non-existant chars */
-	uni = CID2NameUni(map,i,buffer,sizeof(buffer));
-	pscontext->is_type2 = fd->fds[j]->fonttype==2;
-	chars[i] = PSCharStringToSplines(fd->cidstrs[i],fd->cidlens[i],
-		    pscontext,fd->fds[j]->private->subrs,
-		    NULL,buffer);
+	unis[i] = CID2NameUni(map,i,buffer,sizeof(buffer));
+	names[i] = copy(buffer);
+    }
+    memset(&job,0,sizeof(job));
+    job.fd = fd;
+    job.is_cid = true;
+    job.names = names;
+    job.pscontext = pscontext;
+    job.chars = chars;
+    FFParallelFor(fd->cidcnt,CharStringThread,&job);
+    CharStringsDone(&job);
+    for ( i=0; i<fd->cidcnt; ++i ) if ( chars[i]!=NULL ) {
+	j = fd->cidfds[i];
+	uni = unis[i];
 	chars[i]->vwidth = sf->subfonts[j]->ascent+sf->subfonts[j]->descent;
 	chars[i]->unicodeenc = uni;
 	chars[i]->orig_pos = i;
@@ -2971,6 +3143,10 @@ return( NULL );
 	sf->subfonts[j]->glyphcnt = sf->subfonts[j]->glyphmax = i+1;
 	ff_progress_next();
     }
+    for ( i=0; i<fd->cidcnt; ++i )
+	free(names[i]);
+    free(names);
+    free(unis);
     for ( i=0; i<fd->fdcnt; ++i )
 	sf->subfonts[i]->glyphs = calloc(sf->subfonts[i]->glyphcnt,sizeof(SplineChar *));
     for ( i=0; i<fd->cidcnt; ++i ) if ( chars[i]!=NULL ) {
@@ -3089,6 +3265,7 @@ void SCReinstanciateRefChar(SplineChar *sc,RefChar *rf,int layer) {
     SplineChar *rsc = rf->sc;
     real extra=0,e;
 
+    SCInvalidateBounds(sc);
     for ( i=0; i<rf->layer_cnt; ++i ) {
 	SplinePointListsFree(rf->layers[i].splines);
 	GradientFree(rf->layers[i].fill_brush.gradient);
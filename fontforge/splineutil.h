@@ -183,12 +183,17 @@ extern void SFReinstanciateRefs(SplineFont *sf);
 extern void SFRemoveAnchorClass(SplineFont *sf, AnchorClass *an);
 extern void SFRemoveSavedTable(SplineFont *sf, uint32_t tag);
 extern void SplineCharFindBounds(SplineChar *sc, DBounds *bounds);
+extern void SplineCharFindBoundsCached(SplineChar *sc, DBounds *bounds);
 extern void SplineCharFreeContents(SplineChar *sc);
 extern void SplineCharLayerFindBounds(SplineChar *sc, int layer, DBounds *bounds);
+extern void SplineCharLayerFindBoundsCached(SplineChar *sc, int layer, DBounds *bounds);
 extern void SplineCharLayerQuickBounds(SplineChar *sc, int layer, DBounds *bounds);
+extern void SplineCharLayerQuickBoundsCached(SplineChar *sc, int layer, DBounds *bounds);
 extern void SplineCharListsFree(struct splinecharlist *dlist);
 extern void SplineCharQuickBounds(SplineChar *sc, DBounds *b);
+extern void SplineCharQuickBoundsCached(SplineChar *sc, DBounds *b);
 extern void SplineCharQuickConservativeBounds(SplineChar *sc, DBounds *b);
+extern void SplineCharQuickConservativeBoundsCached(SplineChar *sc, DBounds *b);
 extern void SplineFindExtrema(const Spline1D *sp, extended *_t1, extended *_t2);
 extern void SplineFontClearSpecial(SplineFont *sf);
 extern void SplineFontFindBounds(SplineFont *sf, DBounds *bounds);
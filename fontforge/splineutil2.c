@@ -30,6 +30,7 @@
 
 #include "splineutil2.h"
 
+#include "arena.h"
 #include "autohint.h"
 #include "cvundoes.h"
 #include "edgelist.h"
@@ -722,7 +723,7 @@ static FitPoint *SplinesFigureFPsBetween(SplinePoint *from, SplinePoint *to,
     } else
 	pcnt = 2*cnt;
 
-    fp = malloc((pcnt+1)*sizeof(FitPoint)); i = 0;
+    fp = ArenaChunkAlloc((pcnt+1)*sizeof(FitPoint)); i = 0;
     if ( len==0 ) {
 	for ( i=0; i<=pcnt; ++i ) {
 	    fp[i].t = i/(pcnt);
@@ -789,7 +790,7 @@ void SplinesRemoveBetween(SplineChar *sc, SplinePoint *from, SplinePoint *to,int
 	SplinePointMDFree(sc,np);
     }
     
-    free(fp);
+    ArenaChunkFree(fp,(tot+1)*sizeof(FitPoint));
 
     SplinePointReCategorize(from,oldfpt);
     SplinePointReCategorize(to,oldtpt);
@@ -1300,7 +1301,7 @@ static int SplinesRemoveBetweenMaybe(SplineChar *sc,
 return( false );
 
     fp = SplinesFigureFPsBetween(from,to,&tot);
-    fp2 = malloc((tot+1)*sizeof(FitPoint));
+    fp2 = ArenaChunkAlloc((tot+1)*sizeof(FitPoint));
     memcpy(fp2,fp,tot*sizeof(FitPoint));
 
     if ( !(flags&sf_ignoreslopes) )
@@ -1320,8 +1321,8 @@ return( false );
 	good = SplineNearPoint(from->next,&test,err)!= -1;
     }
 
-    free(fp);
-    free(fp2);
+    ArenaChunkFree(fp,(tot+1)*sizeof(FitPoint));
+    ArenaChunkFree(fp2,(tot+1)*sizeof(FitPoint));
     if ( good ) {
 	SplineFree(afterfrom->prev);
 	for ( sp=afterfrom; sp!=to; sp=next ) {
@@ -1383,7 +1384,7 @@ static int Spline2Interpolate(SplinePoint *mid, bigreal err) {
 	SplineRefigure(mid->next);
 	SplineRefigure(mid->prev);
     }
-    free(fp);
+    ArenaChunkFree(fp,(tot+1)*sizeof(FitPoint));
 return( good );
 }
 
@@ -1936,7 +1937,7 @@ static void SPLStartToExtremum(SplineChar *sc,SplinePointList *spl) {
 /*  direction but are very close to the base point. We get these from some */
 /*  TeX fonts. I assume they are due to rounding errors (or just errors) in*/
 /*  some autotracer */
-void SplinePointListSimplify(SplineChar *sc,SplinePointList *spl,
+static void _SplinePointListSimplify(SplineChar *sc,SplinePointList *spl,
 	struct simplifyinfo *smpl) {
     SplinePoint *first, *next, *sp, *nsp;
     BasePoint suv, nuv;
@@ -2074,6 +2075,16 @@ return;
 }
 
 /* cleanup may be: -1 => lines become lines, 0 => simplify & retain slopes, 1=> simplify and discard slopes, 2=>discard extrema */
+/* The fitting data for each attempted merge comes from an arena which */
+/*  is dropped once the contour is done */
+void SplinePointListSimplify(SplineChar *sc,SplinePointList *spl,
+	struct simplifyinfo *smpl) {
+    Arena *arena = ArenaBegin();
+
+    _SplinePointListSimplify(sc,spl,smpl);
+    ArenaEnd(arena);
+}
+
 SplineSet *SplineCharSimplify(SplineChar *sc,SplineSet *head,
 	struct simplifyinfo *smpl) {
     SplineSet *spl, *prev, *snext;
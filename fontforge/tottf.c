@@ -42,6 +42,7 @@
 #include "macenc.h"
 #include "mem.h"
 #include "mm.h"
+#include "parallel.h"
 #include "parsepfa.h"
 #include "parsettfbmf.h"
 #include "splinefill.h"
@@ -58,6 +59,7 @@
 #include "ustring.h"
 #include "utype.h"
 
+#include <glib.h>
 #include <locale.h>
 #include <math.h>
 #include <time.h>
@@ -1107,7 +1109,7 @@ static void dumpcomposite(SplineChar *sc, struct glyphinfo *gi) {
 	IError("max glyph count wrong in ttf output");
     gi->loca[gi->next_glyph] = ftell(gi->glyphs);
 
-    SplineCharLayerQuickBounds(sc,gi->layer,&bb);
+    SplineCharLayerQuickBoundsCached(sc,gi->layer,&bb);
     gh.numContours = -1;
     gh.xmin = floor(bb.minx); gh.ymin = floor(bb.miny);
     gh.xmax = ceil(bb.maxx); gh.ymax = ceil(bb.maxy);
@@ -1202,13 +1204,242 @@ static void dumpcomposite(SplineChar *sc, struct glyphinfo *gi) {
 	putc('\0',gi->glyphs);		/* on a word boundary, can only happen if odd number of instrs */
 }
 
-static void dumpglyph(SplineChar *sc, struct glyphinfo *gi) {
-    struct glyphhead gh;
-    DBounds bb;
-    SplineSet *ss, *ttfss;
-    int contourcnt, ptcnt, origptcnt;
+/* The outline of a simple glyph, converted to quadratic splines and */
+/*  numbered. This is most of the work of dumping a glyph and doesn't   */
+/*  depend on any other glyph, so dumpglyphs prepares them all at once  */
+/*  on several threads and then writes them out in order */
+struct ttfglyphprep {
     BasePoint *bp;
     char *fs;
+    int32_t *ends;		/* Last point of each contour */
+    int contourcnt, ptcnt;
+    int origptcnt;		/* Point count from SSTtfNumberPoints */
+    DBounds bb;
+    uint64_t key;		/* Of the outline, when the glyph cache is on */
+    struct ttfglyphcache *cached;	/* Cache entry it was copied from */
+    unsigned int ready: 1;
+};
+
+static void TTFPrepareGlyph(SplineChar *sc,int layer,struct ttfglyphprep *prep) {
+    SplineSet *ss, *ttfss;
+    int ptcnt, contourcnt;
+
+    ttfss = SCttfApprox(sc,layer);
+    prep->origptcnt = SSTtfNumberPoints(ttfss);
+    for ( ss=ttfss, contourcnt=0; ss!=NULL; ss=ss->next ) {
+	++contourcnt;
+    }
+    prep->contourcnt = contourcnt;
+    SplineSetQuickBounds(ttfss,&prep->bb);
+
+    prep->bp = malloc(prep->origptcnt*sizeof(BasePoint));
+    prep->fs = malloc(prep->origptcnt);
+    prep->ends = malloc(contourcnt*sizeof(int32_t));
+    ptcnt = contourcnt = 0;
+    for ( ss=ttfss; ss!=NULL; ss=ss->next ) {
+	ptcnt = SSAddPoints(ss,ptcnt,prep->bp,prep->fs);
+	prep->ends[contourcnt++] = ptcnt-1;
+    }
+    prep->ptcnt = ptcnt;
+    prep->ready = true;
+    SplinePointListsFree(ttfss);
+}
+
+static void TTFGlyphPrepFree(struct ttfglyphprep *prep) {
+    free(prep->bp);
+    free(prep->fs);
+    free(prep->ends);
+    memset(prep,0,sizeof(*prep));
+}
+
+static void TTFGlyphPrepCopy(struct ttfglyphprep *to,const struct ttfglyphprep *from) {
+    *to = *from;
+    to->bp = malloc(from->origptcnt*sizeof(BasePoint));
+    memcpy(to->bp,from->bp,from->origptcnt*sizeof(BasePoint));
+    to->fs = malloc(from->origptcnt);
+    memcpy(to->fs,from->fs,from->origptcnt);
+    to->ends = malloc(from->contourcnt*sizeof(int32_t));
+    memcpy(to->ends,from->ends,from->contourcnt*sizeof(int32_t));
+    to->cached = NULL;
+}
+
+/* Regenerating a font after changing a few glyphs converts the rest to */
+/*  exactly what it did last time. So (if GenerateGlyphCache is set) we */
+/*  remember the prepared outlines along with everything which went into */
+/*  them: the splines of the glyph and its references, and the point    */
+/*  numbering. Entries are found by a hash of that, but only used if it  */
+/*  matches exactly. Instructions and metrics are cheap and still come   */
+/*  from the glyph itself. Entries which haven't been used by the last   */
+/*  few fonts generated are dropped */
+int GenerateGlyphCache = false;
+
+#define TTF_CACHE_AGE	4
+
+struct ttfglyphsrc {
+    uint8_t *data;
+    size_t len, max;
+};
+
+struct ttfglyphcache {
+    struct ttfglyphprep prep;
+    struct ttfglyphsrc src;	/* What the outline was prepared from */
+    int generation;		/* When last used */
+    struct ttfglyphcache *next;
+};
+
+/* Several fonts may be generated at once (from python threads), so the */
+/*  cache is locked, even though within one font it's only read while   */
+/*  the outlines are prepared and only written afterwards */
+static GMutex ttfcache_lock;
+
+static struct {
+    struct ttfglyphcache **buckets;
+    int bucket_cnt, cnt;
+    int generation;
+    int hits, misses;
+} ttfcache;
+
+static void ttfsrc_add(struct ttfglyphsrc *src,const void *data,size_t len) {
+    if ( src->len+len>src->max ) {
+	src->max = src->max==0 ? 1024 : 2*src->max;
+	if ( src->max<src->len+len )
+	    src->max = src->len+len;
+	src->data = realloc(src->data,src->max);
+    }
+    memcpy(src->data+src->len,data,len);
+    src->len += len;
+}
+
+static void ttfsrc_splines(struct ttfglyphsrc *src,const SplineSet *ss) {
+    const SplinePoint *sp;
+    double vals[6];
+    int ivals[4];
+
+    for ( ; ss!=NULL; ss=ss->next ) {
+	for ( sp=ss->first; ; ) {
+	    vals[0] = sp->me.x; vals[1] = sp->me.y;
+	    vals[2] = sp->nextcp.x; vals[3] = sp->nextcp.y;
+	    vals[4] = sp->prevcp.x; vals[5] = sp->prevcp.y;
+	    ivals[0] = sp->ttfindex;
+	    ivals[1] = sp->nextcpindex;
+	    ivals[2] = sp->nonextcp | (sp->noprevcp<<1) | (sp->dontinterpolate<<2) |
+		    (sp->roundx<<3) | (sp->roundy<<4);
+	    ivals[3] = sp->next==NULL ? 1 : 0;
+	    ttfsrc_add(src,vals,sizeof(vals));
+	    ttfsrc_add(src,ivals,sizeof(ivals));
+	    if ( sp->next==NULL )
+	break;
+	    sp = sp->next->to;
+	    if ( sp==ss->first )
+	break;
+	}
+	ttfsrc_add(src,"|",1);		/* Contour boundary */
+    }
+}
+
+static uint64_t TTFGlyphSource(SplineChar *sc,int layer,struct ttfglyphsrc *src) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    RefChar *ref;
+    int order2 = sc->layers[layer].order2;
+    size_t i;
+
+    ttfsrc_add(src,&order2,sizeof(order2));
+    ttfsrc_splines(src,sc->layers[layer].splines);
+    for ( ref=sc->layers[layer].refs; ref!=NULL; ref=ref->next ) {
+	ttfsrc_add(src,"&",1);
+	ttfsrc_splines(src,ref->layers[0].splines);
+    }
+    for ( i=0; i<src->len; ++i ) {
+	hash ^= src->data[i];
+	hash *= 0x100000001b3ULL;
+    }
+return( hash );
+}
+
+/* Call with the lock held */
+static struct ttfglyphcache *TTFGlyphCacheFind(uint64_t key,const struct ttfglyphsrc *src) {
+    struct ttfglyphcache *tc;
+
+    if ( ttfcache.bucket_cnt==0 )
+return( NULL );
+    for ( tc=ttfcache.buckets[key&(ttfcache.bucket_cnt-1)]; tc!=NULL; tc=tc->next )
+	if ( tc->prep.key==key && tc->src.len==src->len &&
+		memcmp(tc->src.data,src->data,src->len)==0 )
+return( tc );
+return( NULL );
+}
+
+/* Call with the lock held, the cache takes over src */
+static void TTFGlyphCacheAdd(const struct ttfglyphprep *prep,struct ttfglyphsrc *src) {
+    struct ttfglyphcache *tc, *next, **newb;
+    int i, newcnt;
+
+    if ( ttfcache.cnt>=ttfcache.bucket_cnt ) {
+	newcnt = ttfcache.bucket_cnt==0 ? 1024 : 2*ttfcache.bucket_cnt;
+	newb = calloc(newcnt,sizeof(struct ttfglyphcache *));
+	for ( i=0; i<ttfcache.bucket_cnt; ++i ) {
+	    for ( tc=ttfcache.buckets[i]; tc!=NULL; tc=next ) {
+		next = tc->next;
+		tc->next = newb[tc->prep.key&(newcnt-1)];
+		newb[tc->prep.key&(newcnt-1)] = tc;
+	    }
+	}
+	free(ttfcache.buckets);
+	ttfcache.buckets = newb;
+	ttfcache.bucket_cnt = newcnt;
+    }
+    tc = calloc(1,sizeof(struct ttfglyphcache));
+    TTFGlyphPrepCopy(&tc->prep,prep);
+    tc->src = *src;
+    memset(src,0,sizeof(*src));
+    tc->generation = ttfcache.generation;
+    tc->next = ttfcache.buckets[prep->key&(ttfcache.bucket_cnt-1)];
+    ttfcache.buckets[prep->key&(ttfcache.bucket_cnt-1)] = tc;
+    ++ttfcache.cnt;
+}
+
+/* Drops entries older than age generations (all of them if age is 0) */
+/*  Call with the lock held */
+static void TTFGlyphCachePrune(int age) {
+    struct ttfglyphcache *tc, **prev;
+    int i;
+
+    for ( i=0; i<ttfcache.bucket_cnt; ++i ) {
+	for ( prev = &ttfcache.buckets[i]; (tc = *prev)!=NULL; ) {
+	    if ( age==0 || ttfcache.generation-tc->generation>=age ) {
+		*prev = tc->next;
+		TTFGlyphPrepFree(&tc->prep);
+		free(tc->src.data);
+		free(tc);
+		--ttfcache.cnt;
+	    } else
+		prev = &tc->next;
+	}
+    }
+}
+
+void TTFGlyphCacheClear(void) {
+    g_mutex_lock(&ttfcache_lock);
+    TTFGlyphCachePrune(0);
+    free(ttfcache.buckets);
+    ttfcache.buckets = NULL;
+    ttfcache.bucket_cnt = ttfcache.cnt = 0;
+    ttfcache.hits = ttfcache.misses = 0;
+    g_mutex_unlock(&ttfcache_lock);
+}
+
+void TTFGlyphCacheStats(int *hits, int *misses, int *entries) {
+    g_mutex_lock(&ttfcache_lock);
+    *hits = ttfcache.hits;
+    *misses = ttfcache.misses;
+    *entries = ttfcache.cnt;
+    g_mutex_unlock(&ttfcache_lock);
+}
+
+static void dumpglyph(SplineChar *sc, struct glyphinfo *gi, struct ttfglyphprep *prep) {
+    struct glyphhead gh;
+    struct ttfglyphprep local;
+    int i;
     SplineChar *isc = sc->ttf_instrs==NULL && sc->parent->mm!=NULL && sc->parent->mm->apple ?
 		sc->parent->mm->normal->glyphs[sc->orig_pos] : sc;
 
@@ -1229,40 +1460,30 @@ return;
 	IError("max glyph count wrong in ttf output");
     gi->loca[gi->next_glyph] = ftell(gi->glyphs);
 
-    ttfss = SCttfApprox(sc,gi->layer);
-    ptcnt = SSTtfNumberPoints(ttfss);
-    for ( ss=ttfss, contourcnt=0; ss!=NULL; ss=ss->next ) {
-	++contourcnt;
+    if ( prep==NULL || !prep->ready ) {
+	prep = &local;
+	TTFPrepareGlyph(sc,gi->layer,prep);
     }
-    origptcnt = ptcnt;
 
-    SplineSetQuickBounds(ttfss,&bb);
-    gh.numContours = contourcnt;
-    gh.xmin = floor(bb.minx); gh.ymin = floor(bb.miny);
-    gh.xmax = ceil(bb.maxx); gh.ymax = ceil(bb.maxy);
+    gh.numContours = prep->contourcnt;
+    gh.xmin = floor(prep->bb.minx); gh.ymin = floor(prep->bb.miny);
+    gh.xmax = ceil(prep->bb.maxx); gh.ymax = ceil(prep->bb.maxy);
     dumpghstruct(gi,&gh);
-    if ( contourcnt>gi->maxp->maxContours ) gi->maxp->maxContours = contourcnt;
-    if ( ptcnt>gi->maxp->maxPoints ) gi->maxp->maxPoints = ptcnt;
+    if ( prep->contourcnt>gi->maxp->maxContours ) gi->maxp->maxContours = prep->contourcnt;
+    if ( prep->origptcnt>gi->maxp->maxPoints ) gi->maxp->maxPoints = prep->origptcnt;
 
-    bp = malloc(ptcnt*sizeof(BasePoint));
-    fs = malloc(ptcnt);
-    ptcnt = contourcnt = 0;
-    for ( ss=ttfss; ss!=NULL; ss=ss->next ) {
-	ptcnt = SSAddPoints(ss,ptcnt,bp,fs);
-	putshort(gi->glyphs,ptcnt-1);
-    }
-    if ( ptcnt!=origptcnt )
-	IError( "Point count wrong calculated=%d, actual=%d in %.20s", origptcnt, ptcnt, sc->name );
-    gi->pointcounts[gi->next_glyph++] = ptcnt;
+    for ( i=0; i<prep->contourcnt; ++i )
+	putshort(gi->glyphs,prep->ends[i]);
+    if ( prep->ptcnt!=prep->origptcnt )
+	IError( "Point count wrong calculated=%d, actual=%d in %.20s", prep->origptcnt, prep->ptcnt, sc->name );
+    gi->pointcounts[gi->next_glyph++] = prep->ptcnt;
 
     dumpinstrs(gi,isc->ttf_instrs,isc->ttf_instrs_len);
 
-    dumppointarrays(gi,bp,fs,ptcnt);
-    SplinePointListsFree(ttfss);
-    free(bp);
-    free(fs);
+    dumppointarrays(gi,prep->bp,prep->fs,prep->ptcnt);
 
-    ttfdumpmetrics(sc,gi,&bb);
+    ttfdumpmetrics(sc,gi,&prep->bb);
+    TTFGlyphPrepFree(prep);
 }
 
 void SFDummyUpCIDs(struct glyphinfo *gi,SplineFont *sf) {
@@ -1408,10 +1629,95 @@ static int AssignTTFBitGlyph(struct glyphinfo *gi,SplineFont *sf,EncMap *map,int
 return j;
 }
 
+/* The glyph dumpglyphs will pass to dumpglyph for the i'th output glyph, */
+/*  if it has an outline to convert */
+static SplineChar *TTFOutlineGlyph(SplineFont *sf,struct glyphinfo *gi,int i) {
+    SplineChar *sc;
+
+    if ( gi->onlybitmaps || gi->bygid[i]==-1 )
+return( NULL );
+    sc = sf->glyphs[gi->bygid[i]];
+    if ( i==0 ) {
+	if ( gi->fixed_width>0 && sc->width!=gi->fixed_width )
+return( NULL );
+    } else if ( sc->ttf_glyph<=0 || IsTTFRefable(sc,gi->layer) )
+return( NULL );
+    if ( sc->layers[gi->layer].splines==NULL && sc->layers[gi->layer].refs==NULL )
+return( NULL );
+return( sc );
+}
+
+struct ttfprepjob {
+    SplineFont *sf;
+    struct glyphinfo *gi;
+    struct ttfglyphprep *preps;
+    struct ttfglyphsrc *srcs;	/* When the glyph cache is on */
+};
+
+static void TTFPrepareGlyphThread(void *data,int i) {
+    struct ttfprepjob *job = data;
+    struct ttfglyphprep *prep = &job->preps[i];
+    struct ttfglyphcache *tc;
+    SplineChar *sc = TTFOutlineGlyph(job->sf,job->gi,i);
+    uint64_t key;
+
+    if ( sc==NULL )
+return;
+    if ( GenerateGlyphCache ) {
+	key = TTFGlyphSource(sc,job->gi->layer,&job->srcs[i]);
+	g_mutex_lock(&ttfcache_lock);
+	if ( (tc = TTFGlyphCacheFind(key,&job->srcs[i]))!=NULL ) {
+	    TTFGlyphPrepCopy(prep,&tc->prep);
+	    prep->cached = tc;		/* Only a flag once the lock is released */
+	    /* Keep it out of this round's pruning */
+	    tc->generation = ttfcache.generation+1;
+	}
+	g_mutex_unlock(&ttfcache_lock);
+	if ( prep->cached!=NULL )
+return;
+	TTFPrepareGlyph(sc,job->gi->layer,prep);
+	prep->key = key;
+    } else
+	TTFPrepareGlyph(sc,job->gi->layer,prep);
+}
+
+static void TTFGlyphCacheUpdate(struct ttfprepjob *job) {
+    struct ttfglyphcache *tc;
+    int i;
+
+    g_mutex_lock(&ttfcache_lock);
+    ++ttfcache.generation;
+    for ( i=0; i<job->gi->gcnt; ++i ) {
+	struct ttfglyphprep *prep = &job->preps[i];
+	if ( !prep->ready )
+    continue;
+	/* Look the entry up again, another font may have cleared the cache */
+	/*  since the thread found it */
+	tc = TTFGlyphCacheFind(prep->key,&job->srcs[i]);
+	if ( prep->cached!=NULL ) {
+	    if ( tc!=NULL )
+		tc->generation = ttfcache.generation;
+	    ++ttfcache.hits;
+	} else {
+	    /* (the same outline may turn up twice in one font) */
+	    if ( tc==NULL )
+		TTFGlyphCacheAdd(prep,&job->srcs[i]);
+	    ++ttfcache.misses;
+	}
+	prep->cached = NULL;
+    }
+    TTFGlyphCachePrune(TTF_CACHE_AGE);
+    g_mutex_unlock(&ttfcache_lock);
+    for ( i=0; i<job->gi->gcnt; ++i )
+	free(job->srcs[i].data);
+    free(job->srcs);
+}
+
 static int dumpglyphs(SplineFont *sf,struct glyphinfo *gi) {
     int i;
     int fixed = gi->fixed_width;
     int answer, answered=-1;
+    struct ttfprepjob job;
 
     ff_progress_change_stages(2+gi->strikecnt);
     QuickBlues(sf,gi->layer,&gi->bd);
@@ -1462,10 +1768,21 @@ static int dumpglyphs(SplineFont *sf,struct glyphinfo *gi) {
 	gi->lasthwidth = 3;
 	gi->hfullcnt = 3;
     }
+    job.sf = sf;
+    job.gi = gi;
+    job.preps = calloc(gi->gcnt,sizeof(struct ttfglyphprep));
+    job.srcs = NULL;
+    if ( !gi->onlybitmaps ) {
+	if ( GenerateGlyphCache )
+	    job.srcs = calloc(gi->gcnt,sizeof(struct ttfglyphsrc));
+	FFParallelFor(gi->gcnt,TTFPrepareGlyphThread,&job);
+	if ( GenerateGlyphCache )
+	    TTFGlyphCacheUpdate(&job);
+    }
     for ( i=0; i<gi->gcnt; ++i ) {
 	if ( i==0 ) {
 	    if ( gi->bygid[0]!=-1 && (fixed<=0 || sf->glyphs[gi->bygid[0]]->width==fixed))
-		dumpglyph(sf->glyphs[gi->bygid[0]],gi);
+		dumpglyph(sf->glyphs[gi->bygid[0]],gi,&job.preps[0]);
 	    else
 		dumpmissingglyph(sf,gi,fixed);
 	} else if ( i<=2 && gi->bygid[i]==-1 )
@@ -1478,7 +1795,7 @@ static int dumpglyphs(SplineFont *sf,struct glyphinfo *gi) {
 		if ( IsTTFRefable(sf->glyphs[gi->bygid[i]],gi->layer) )
 		    dumpcomposite(sf->glyphs[gi->bygid[i]],gi);
 		else
-		    dumpglyph(sf->glyphs[gi->bygid[i]],gi);
+		    dumpglyph(sf->glyphs[gi->bygid[i]],gi,&job.preps[i]);
 	    }
 	}
 	if ( (ftell(gi->glyphs)&3) != 0 ) {
@@ -1489,9 +1806,14 @@ static int dumpglyphs(SplineFont *sf,struct glyphinfo *gi) {
 	    if ( ftell(gi->glyphs)&2 )
 		putshort(gi->glyphs,0);
 	}
-	if ( !ff_progress_next())
+	if ( !ff_progress_next()) {
+	    for ( ; i<gi->gcnt; ++i )
+		TTFGlyphPrepFree(&job.preps[i]);
+	    free(job.preps);
 return( false );
+	}
     }
+    free(job.preps);
 
     /* extra location entry points to end of last glyph */
     gi->loca[gi->next_glyph] = ftell(gi->glyphs);
@@ -2429,7 +2751,7 @@ static int dumpcffhmtx(struct alltabs *at,SplineFont *sf,int bitmaps) {
     FigureFullMetricsEnd(sf,&at->gi,bitmaps);	/* Bitmap fonts use ttf convention of 3 magic glyphs */
     if ( at->gi.bygid[0]!=-1 && (sf->glyphs[at->gi.bygid[0]]->width==width || width<=0 )) {
 	putshort(at->gi.hmtx,sf->glyphs[at->gi.bygid[0]]->width);
-	SplineCharLayerFindBounds(sf->glyphs[at->gi.bygid[0]],at->gi.layer,&b);
+	SplineCharLayerFindBoundsCached(sf->glyphs[at->gi.bygid[0]],at->gi.layer,&b);
 	putshort(at->gi.hmtx,b.minx);
 	if ( dovmetrics ) {
 	    putshort(at->gi.vmtx,sf->glyphs[at->gi.bygid[0]]->vwidth);
@@ -2466,7 +2788,7 @@ static int dumpcffhmtx(struct alltabs *at,SplineFont *sf,int bitmaps) {
 	if ( SCWorthOutputting(sc) ) {
 	    if ( i<=at->gi.lasthwidth )
 		putshort(at->gi.hmtx, sc->width<0 ? 0 : sc->width);
-	    SplineCharLayerFindBounds(sc,at->gi.layer,&b);
+	    SplineCharLayerFindBoundsCached(sc,at->gi.layer,&b);
 	    putshort(at->gi.hmtx,b.minx);
 	    if ( dovmetrics ) {
 		if ( i<=at->gi.lastvwidth )
@@ -2517,7 +2839,7 @@ static void dumpcffcidhmtx(struct alltabs *at,SplineFont *_sf) {
 	    sc = sf->glyphs[cid];
 	    if ( sc->ttf_glyph<=at->gi.lasthwidth )
 		putshort(at->gi.hmtx,sc->width);
-	    SplineCharLayerFindBounds(sc,at->gi.layer,&b);
+	    SplineCharLayerFindBoundsCached(sc,at->gi.layer,&b);
 	    putshort(at->gi.hmtx,b.minx);
 	    if ( dovmetrics ) {
 		if ( sc->ttf_glyph<=at->gi.lastvwidth )
@@ -2852,7 +3174,7 @@ static void sethhead(struct hhead *hhead,struct hhead *vhead,struct alltabs *at,
     xmax = ymax = 0x80000000; xmin = ymin = 0x7fffffff;
     for ( i=0; i<at->gi.gcnt; ++i ) if ( at->gi.bygid[i]!=-1 ) {
 	SplineChar *sc = sf->glyphs[at->gi.bygid[i]];
-	SplineCharLayerFindBounds(sc,at->gi.layer,&bb);
+	SplineCharLayerFindBoundsCached(sc,at->gi.layer,&bb);
 	if ( sc->width>width ) width = sc->width;
 	if ( sc->vwidth>height ) height = sc->vwidth;
 	if ( sc->width-bb.maxx < rbearing ) rbearing = sc->width-bb.maxx;
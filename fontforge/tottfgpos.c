@@ -48,6 +48,12 @@ int use_second_indic_scripts = true;
 
 #include "ttf.h"
 
+/* The size of the GSUB and GPOS tables of the last font output, and how */
+/*  much sharing identical subtables saved. Indexed by is_gpos */
+static struct layoutstats {
+    int len, saved;
+} layout_stats[2];
+
 /* This file contains routines to create the otf gpos and gsub tables and their */
 /*  attendant subtables */
 
@@ -1541,21 +1547,6 @@ uint16_t *ClassesFromNames(SplineFont *sf,char **classnames,int class_cnt,
 return( class );
 }
 
-static SplineChar **GlyphsFromClasses(SplineChar **gs, int numGlyphs) {
-    int i, cnt;
-    SplineChar **glyphs;
-
-    for ( i=cnt=0; i<numGlyphs; ++i )
-	if ( gs[i]!=NULL ) ++cnt;
-    glyphs = malloc((cnt+1)*sizeof(SplineChar *));
-    for ( i=cnt=0; i<numGlyphs; ++i )
-	if ( gs[i]!=NULL )
-	    glyphs[cnt++] = gs[i];
-    glyphs[cnt++] = NULL;
-    free(gs);
-return( glyphs );
-}
-
 static SplineChar **GlyphsFromInitialClasses(SplineChar **gs, int numGlyphs, uint16_t *classes, uint16_t *initial) {
     int i, j, cnt;
     SplineChar **glyphs;
@@ -1616,82 +1607,491 @@ static void DumpClass(FILE *gpos,uint16_t *class,int numGlyphs) {
     }
 }
 
-static void dumpgposkernclass(FILE *gpos,SplineFont *sf,
-	struct lookup_subtable *sub, struct alltabs *at) {
-    uint32_t begin_off = ftell(gpos), pos;
+/* The size DumpClass will give the class definition table */
+static int ClassDefLen(uint16_t *class,int numGlyphs) {
+    int ranges, i, cur, first= -1, last=-1;
+
+    for ( i=ranges=0; i<numGlyphs; ) {
+	int istart = i;
+	cur = class[i];
+	while ( i<numGlyphs && class[i]==cur )
+	    ++i;
+	if ( cur!=0 ) {
+	    ++ranges;
+	    if ( first==-1 ) first = istart;
+	    last = i-1;
+	}
+    }
+    if ( ranges*3+1>last-first+1+2 || first==-1 ) {
+	if ( first==-1 ) first = last = 0;
+return( 3*sizeof(uint16_t) + (last-first+1)*sizeof(uint16_t) );
+    }
+return( 2*sizeof(uint16_t) + 3*ranges*sizeof(uint16_t) );
+}
+
+/* The size dumpcoveragetable will give the coverage table */
+static int CoverageLen(SplineChar **glyphs) {
+    int i, last = -2, range_cnt=0;
+
+    for ( i=0; glyphs[i]!=NULL; i++ ) {
+	if ( glyphs[i]->ttf_glyph>=0 ) {
+	    if ( range_cnt==0 || glyphs[i]->ttf_glyph>last+1 )
+		++range_cnt;
+	    last = glyphs[i]->ttf_glyph;
+	}
+    }
+    if ( !(coverageformatsallowed&2) || ((coverageformatsallowed&1) && i<=3*range_cnt ))
+return( 2*sizeof(uint16_t) + i*sizeof(uint16_t) );
+return( 2*sizeof(uint16_t) + 3*range_cnt*sizeof(uint16_t) );
+}
+
+/* A kerning class is rarely output as the dense first_cnt*second_cnt */
+/*  matrix it is stored as. Rows (first classes) with identical kerning */
+/*  are merged, and within each subtable so are columns (second classes). */
+/*  Any column which matches column 0 can be dropped from the second class */
+/*  definition entirely. The rows are then packed into as many subtables */
+/*  as it takes to keep each of them under 64k, and each subtable is */
+/*  written in whichever of format 1 (glyph pairs) or 2 (classes) is */
+/*  smaller */
+struct kcpack {
+    KernClass *kc;
+    int numGlyphs;
     uint16_t *class1, *class2;
-    KernClass *kc = sub->kc, *test;
-    SplineChar **glyphs;
-    int i, isv;
-    int anydevtab = false;
-    int next_devtab;
+    SplineChar **gs;		/* The first glyphs, by glyph id */
+    int *gcnt1, *gcnt2;		/* Glyphs in each first/second class */
+    int *rowrep;		/* First class -> the class whose row it shares, -1 if omitted */
+    int *rowcluster;		/* First class -> subtable holding its row */
+    int vf1;			/* The value format, without device tables */
+    int last;			/* No later subtable in the lookup */
+};
 
-    putshort(gpos,2);		/* format 2 of the pair adjustment subtable */
-    putshort(gpos,0);		/* offset to coverage table */
-    for ( i=0; i<kc->first_cnt*kc->second_cnt; ++i ) {
-	if ( kc->adjusts[i].corrections!=NULL ) {
-	    anydevtab = true;
-    break;
+static int KCCellZero(KernClass *kc,int i) {
+return( kc->offsets[i]==0 && kc->adjusts[i].corrections==NULL );
+}
+
+static int KCCellsSame(KernClass *kc,int i1,int i2) {
+return( kc->offsets[i1]==kc->offsets[i2] &&
+	DevTabsSame(&kc->adjusts[i1],&kc->adjusts[i2]) );
+}
+
+static uint32_t KCCellHash(KernClass *kc,int i,uint32_t h) {
+    DeviceTable *dt = &kc->adjusts[i];
+    int j;
+
+    h = (h^(uint16_t) kc->offsets[i])*0x01000193;
+    if ( dt->corrections!=NULL ) {
+	h = (h^dt->first_pixel_size^(dt->last_pixel_size<<8))*0x01000193;
+	for ( j=dt->last_pixel_size-dt->first_pixel_size; j>=0; --j )
+	    h = (h^(uint8_t) dt->corrections[j])*0x01000193;
+    }
+return( h );
+}
+
+static int KCRowsSame(KernClass *kc,int r1,int r2) {
+    int j, n = kc->second_cnt;
+
+    for ( j=0; j<n; ++j )
+	if ( !KCCellsSame(kc,r1*n+j,r2*n+j) )
+return( false );
+return( true );
+}
+
+static int KCColsSame(KernClass *kc,int *rows,int rcnt,int c1,int c2) {
+    int i, n = kc->second_cnt;
+
+    for ( i=0; i<rcnt; ++i )
+	if ( !KCCellsSame(kc,rows[i]*n+c1,rows[i]*n+c2) )
+return( false );
+return( true );
+}
+
+/* A small chained hash used to spot identical kerning rows and columns, */
+/*  and identical lookup subtables */
+struct sharehash {
+    int size;
+    int *bucket, *next;
+    uint32_t *hash;
+};
+
+static void ShareHashInit(struct sharehash *h,int cnt) {
+    int i;
+
+    for ( h->size=16; h->size<2*cnt; h->size<<=1 );
+    h->bucket = malloc(h->size*sizeof(int));
+    for ( i=0; i<h->size; ++i )
+	h->bucket[i] = -1;
+    h->next = malloc((cnt+1)*sizeof(int));
+    h->hash = malloc((cnt+1)*sizeof(uint32_t));
+}
+
+static void ShareHashFree(struct sharehash *h) {
+    free(h->bucket);
+    free(h->next);
+    free(h->hash);
+}
+
+static void ShareHashAdd(struct sharehash *h,int item,uint32_t hash) {
+    int b = hash&(h->size-1);
+
+    h->hash[item] = hash;
+    h->next[item] = h->bucket[b];
+    h->bucket[b] = item;
+}
+
+/* Works out which rows to output, and which of them share kerning */
+static int KCFigureRows(struct kcpack *kp) {
+    KernClass *kc = kp->kc;
+    int i, j, n = kc->second_cnt, cnt = 0;
+    struct sharehash h;
+    uint32_t hash;
+
+    ShareHashInit(&h,kc->first_cnt);
+    for ( i=0; i<kc->first_cnt; ++i ) {
+	kp->rowrep[i] = -1;
+	if ( kp->gcnt1[i]==0 )
+    continue;
+	hash = 0x811c9dc5;
+	for ( j=0; j<n; ++j )
+	    hash = KCCellHash(kc,i*n+j,hash);
+	/* A row of zeros still stops later subtables from applying to */
+	/*  its glyphs, so it can only be dropped from the last one */
+	if ( kp->last ) {
+	    for ( j=0; j<n && KCCellZero(kc,i*n+j); ++j );
+	    if ( j==n )
+    continue;
+	}
+	for ( j=h.bucket[hash&(h.size-1)]; j!=-1; j=h.next[j] )
+	    if ( h.hash[j]==hash && KCRowsSame(kc,i,j) )
+	break;
+	if ( j!=-1 ) {
+	    kp->rowrep[i] = j;
+	    kp->gcnt1[j] += kp->gcnt1[i];
+	} else {
+	    kp->rowrep[i] = i;
+	    ShareHashAdd(&h,i,hash);
+	    ++cnt;
 	}
     }
+    ShareHashFree(&h);
+return( cnt );
+}
 
-    for ( test=sf->vkerns; test!=NULL && test!=kc; test=test->next );
-    isv = test==kc;
+/* Counts the columns a row adds to a subtable: those in which it kerns */
+/*  differently from column 0, and which no earlier row in it needed */
+static int KCRowNewCols(struct kcpack *kp,int row,uint8_t *used,int *gcnt,int mark) {
+    KernClass *kc = kp->kc;
+    int j, n = kc->second_cnt, cnt = 0;
 
-    if ( isv ) {
-	/* As far as I know there is no "bottom to top" writing direction */
-	/*  Oh. There is. Ogham, Runic */
-	putshort(gpos,anydevtab?0x0088:0x0008);	/* Alter YAdvance of first character */
-	putshort(gpos,0x0000);			/* leave second char alone */
-    } else {
-	putshort(gpos,anydevtab?0x0044:0x0004);	/* Alter XAdvance of first character */
-	putshort(gpos,0x0000);			/* leave second char alone */
-    }
-    class1 = ClassesFromNames(sf,kc->firsts,kc->first_cnt,at->maxp.numGlyphs,&glyphs,false);
-    glyphs = GlyphsFromClasses(glyphs,at->maxp.numGlyphs);
-    class2 = ClassesFromNames(sf,kc->seconds,kc->second_cnt,at->maxp.numGlyphs,NULL,false);
-    putshort(gpos,0);		/* offset to first glyph classes */
-    putshort(gpos,0);		/* offset to second glyph classes */
-    putshort(gpos,kc->first_cnt);
-    putshort(gpos,kc->second_cnt);
-    next_devtab = ftell(gpos)-begin_off + kc->first_cnt*kc->second_cnt*2*sizeof(uint16_t);
-    for ( i=0; i<kc->first_cnt*kc->second_cnt; ++i ) {
-	putshort(gpos,kc->offsets[i]);
-	if ( anydevtab && kc->adjusts[i].corrections!=NULL ) {
-	    putshort(gpos,next_devtab);
-	    next_devtab += DevTabLen(&kc->adjusts[i]);
-	} else if ( anydevtab )
-	    putshort(gpos,0);
+    *gcnt = 0;
+    for ( j=1; j<n; ++j ) {
+	if ( !used[j] && kp->gcnt2[j]!=0 && !KCCellsSame(kc,row*n+j,row*n) ) {
+	    ++cnt;
+	    *gcnt += kp->gcnt2[j];
+	    if ( mark )
+		used[j] = true;
+	}
     }
-    if ( anydevtab ) {
-	for ( i=0; i<kc->first_cnt*kc->second_cnt; ++i ) {
-	    if ( kc->adjusts[i].corrections!=NULL )
-		dumpgposdevicetable(gpos,&kc->adjusts[i]);
-	}
-	if ( next_devtab!=ftell(gpos)-begin_off )
-	    IError("Device table offsets screwed up in kerning class");
-    }
-    pos = ftell(gpos);
-    fseek(gpos,begin_off+4*sizeof(uint16_t),SEEK_SET);
-    putshort(gpos,pos-begin_off);
-    fseek(gpos,pos,SEEK_SET);
-    DumpClass(gpos,class1,at->maxp.numGlyphs);
-
-    pos = ftell(gpos);
-    fseek(gpos,begin_off+5*sizeof(uint16_t),SEEK_SET);
-    putshort(gpos,pos-begin_off);
-    fseek(gpos,pos,SEEK_SET);
-    DumpClass(gpos,class2,at->maxp.numGlyphs);
-
-    pos = ftell(gpos);
-    fseek(gpos,begin_off+sizeof(uint16_t),SEEK_SET);
-    putshort(gpos,pos-begin_off);
-    fseek(gpos,pos,SEEK_SET);
-    dumpcoveragetable(gpos,glyphs);
+return( cnt );
+}
+
+/* Greedily packs the rows into subtables, using an upper bound on each */
+/*  subtable's size. Returns the number of subtables */
+static int KCFigureClusters(struct kcpack *kp) {
+    KernClass *kc = kp->kc;
+    int i, j, n = kc->second_cnt;
+    int cluster = 0, rcnt = 0, ccnt = 1, g1 = 0, g2 = 0, devlen = 0, anydev = false;
+    int rdevlen, rdev, newc, newg2, size;
+    uint8_t *used = calloc(n,sizeof(uint8_t));
+
+    for ( i=0; i<kc->first_cnt; ++i ) {
+	kp->rowcluster[i] = -1;
+	if ( kp->rowrep[i]!=i )
+    continue;
+	rdevlen = 0; rdev = false;
+	for ( j=0; j<n; ++j ) {
+	    if ( kc->adjusts[i*n+j].corrections!=NULL ) {
+		rdevlen += DevTabLen(&kc->adjusts[i*n+j]);
+		rdev = true;
+	    }
+	}
+	newc = KCRowNewCols(kp,i,used,&newg2,false);
+	size = 16*sizeof(uint16_t) +
+		(rcnt+1)*(ccnt+newc)*((anydev||rdev)?4:2) + devlen+rdevlen +
+		(g1+kp->gcnt1[i])*sizeof(uint16_t) +		/* coverage */
+		3*(g1+kp->gcnt1[i])*sizeof(uint16_t) +		/* first classes */
+		3*(g2+newg2)*sizeof(uint16_t);			/* second classes */
+	if ( rcnt!=0 && size>65535 ) {
+	    ++cluster;
+	    rcnt = 0; ccnt = 1; g1 = g2 = devlen = 0; anydev = false;
+	    memset(used,0,n);
+	}
+	ccnt += KCRowNewCols(kp,i,used,&newg2,true);
+	g2 += newg2;
+	g1 += kp->gcnt1[i];
+	devlen += rdevlen;
+	anydev |= rdev;
+	++rcnt;
+	kp->rowcluster[i] = cluster;
+    }
+    free(used);
+return( rcnt==0 ? cluster : cluster+1 );
+}
+
+static void dumpgposkernclustertable(FILE *gpos,struct kcpack *kp,int cluster,
+	struct lookup_subtable *sub) {
+    KernClass *kc = kp->kc;
+    int n = kc->second_cnt, numGlyphs = kp->numGlyphs;
+    int *rows, *rowidx, *colmap, *colrep, *devcell, *devat, *devoff;
+    int rcnt, ccnt, dcnt, i, j, k, best, anydevtab, vr, next_devtab;
+    int f1len, f2len, pairs, gcnt, use_f1;
+    uint16_t *class1, *class2;
+    SplineChar **glyphs;
+    struct sharehash h;
+    uint32_t hash;
+    uint32_t begin_off = ftell(gpos), pos;
+
+    /* Rows in this subtable, the one with most glyphs as class 0 */
+    rows = malloc(kc->first_cnt*sizeof(int));
+    rowidx = malloc(kc->first_cnt*sizeof(int));
+    for ( i=rcnt=best=0; i<kc->first_cnt; ++i ) {
+	if ( kp->rowrep[i]==i && kp->rowcluster[i]==cluster ) {
+	    if ( rcnt!=0 && kp->gcnt1[i]>kp->gcnt1[rows[best]] ) best = rcnt;
+	    rows[rcnt++] = i;
+	}
+    }
+    if ( best!=0 ) {
+	i = rows[0]; rows[0] = rows[best]; rows[best] = i;
+    }
+    for ( i=0; i<kc->first_cnt; ++i )
+	rowidx[i] = -1;
+    for ( i=0; i<rcnt; ++i )
+	rowidx[rows[i]] = i;
+
+    /* Columns, merging those which kern the same within these rows */
+    colmap = malloc(n*sizeof(int));
+    colrep = malloc(n*sizeof(int));
+    ShareHashInit(&h,n);
+    ccnt = 1; colmap[0] = 0; colrep[0] = 0;
+    for ( j=1; j<n; ++j ) {
+	if ( kp->gcnt2[j]==0 || KCColsSame(kc,rows,rcnt,0,j) ) {
+	    colmap[j] = 0;
+    continue;
+	}
+	hash = 0x811c9dc5;
+	for ( i=0; i<rcnt; ++i )
+	    hash = KCCellHash(kc,rows[i]*n+j,hash);
+	for ( k=h.bucket[hash&(h.size-1)]; k!=-1; k=h.next[k] )
+	    if ( h.hash[k]==hash && KCColsSame(kc,rows,rcnt,k,j) )
+	break;
+	if ( k!=-1 )
+	    colmap[j] = colmap[k];
+	else {
+	    colmap[j] = ccnt;
+	    colrep[ccnt++] = j;
+	    ShareHashAdd(&h,j,hash);
+	}
+    }
+    ShareHashFree(&h);
+
+    class1 = calloc(numGlyphs,sizeof(uint16_t));
+    class2 = calloc(numGlyphs,sizeof(uint16_t));
+    glyphs = malloc((numGlyphs+1)*sizeof(SplineChar *));
+    for ( i=gcnt=0; i<numGlyphs; ++i ) {
+	class2[i] = colmap[kp->class2[i]];
+	if ( kp->gs[i]!=NULL && (k = kp->rowrep[kp->class1[i]])!=-1 &&
+		kp->rowcluster[k]==cluster ) {
+	    class1[i] = rowidx[k];
+	    glyphs[gcnt++] = kp->gs[i];
+	}
+    }
+    glyphs[gcnt] = NULL;
+
+    /* Device tables, each distinct one output once */
+    devcell = malloc(rcnt*ccnt*sizeof(int));
+    devat = malloc(rcnt*ccnt*sizeof(int));
+    devoff = malloc(rcnt*ccnt*sizeof(int));
+    dcnt = 0; anydevtab = false; next_devtab = 0;
+    for ( i=0; i<rcnt; ++i ) for ( j=0; j<ccnt; ++j ) {
+	int cell = rows[i]*n+colrep[j];
+	devoff[i*ccnt+j] = -1;
+	if ( kc->adjusts[cell].corrections==NULL )
+    continue;
+	anydevtab = true;
+	for ( k=0; k<dcnt; ++k )
+	    if ( DevTabsSame(&kc->adjusts[devcell[k]],&kc->adjusts[cell]) )
+	break;
+	if ( k==dcnt ) {
+	    devcell[dcnt] = cell;
+	    devat[dcnt++] = next_devtab;
+	    next_devtab += DevTabLen(&kc->adjusts[cell]);
+	}
+	devoff[i*ccnt+j] = devat[k];
+    }
+    vr = anydevtab ? 2*sizeof(uint16_t) : sizeof(uint16_t);
+    f2len = 8*sizeof(uint16_t) + rcnt*ccnt*vr + next_devtab + CoverageLen(glyphs) +
+	    ClassDefLen(class1,numGlyphs) + ClassDefLen(class2,numGlyphs);
+
+    /* Glyph pairs can only say that a pair doesn't kern by leaving it out, */
+    /*  which lets later subtables try it, and have no way to say "any */
+    /*  other glyph" as column 0 does */
+    use_f1 = false;
+    if ( kp->last && !anydevtab ) {
+	for ( i=0; i<rcnt && KCCellZero(kc,rows[i]*n); ++i );
+	if ( i==rcnt ) {
+	    f1len = 5*sizeof(uint16_t) + gcnt*sizeof(uint16_t) + CoverageLen(glyphs);
+	    for ( k=0; k<numGlyphs; ++k ) if ( class2[k]!=0 ) {
+		for ( i=0; i<rcnt; ++i )
+		    if ( !KCCellZero(kc,rows[i]*n+colrep[class2[k]]) )
+			f1len += 2*sizeof(uint16_t);
+	    }
+	    f1len += rcnt*sizeof(uint16_t);
+	    use_f1 = f1len<f2len;
+	}
+    }
+    if ( (use_f1 ? f1len : f2len)>65535 )
+	LogError(_("Lookup subtable %s contains a kerning class row whose data takes up more than 64k bytes\n"),
+		sub->subtable_name );
+
+    if ( use_f1 ) {
+	int *pairset = malloc(rcnt*sizeof(int));
 
+	putshort(gpos,1);		/* format 1 of the pair adjustment subtable */
+	putshort(gpos,0);		/* offset to coverage table */
+	putshort(gpos,kp->vf1);
+	putshort(gpos,0x0000);		/* leave second char alone */
+	putshort(gpos,gcnt);
+	for ( i=0; i<gcnt; ++i )
+	    putshort(gpos,0);		/* offset to pair set, filled in below */
+	for ( i=0; i<rcnt; ++i ) {
+	    pairset[i] = ftell(gpos)-begin_off;
+	    for ( k=pairs=0; k<numGlyphs; ++k )
+		if ( class2[k]!=0 && !KCCellZero(kc,rows[i]*n+colrep[class2[k]]) )
+		    ++pairs;
+	    putshort(gpos,pairs);
+	    for ( k=0; k<numGlyphs; ++k )
+		if ( class2[k]!=0 && !KCCellZero(kc,rows[i]*n+colrep[class2[k]]) ) {
+		    putshort(gpos,k);
+		    putshort(gpos,kc->offsets[rows[i]*n+colrep[class2[k]]]);
+		}
+	}
+	pos = ftell(gpos);
+	fseek(gpos,begin_off+5*sizeof(uint16_t),SEEK_SET);
+	for ( i=0; i<gcnt; ++i )
+	    putshort(gpos,pairset[class1[glyphs[i]->ttf_glyph]]);
+	fseek(gpos,begin_off+sizeof(uint16_t),SEEK_SET);
+	putshort(gpos,pos-begin_off);
+	fseek(gpos,pos,SEEK_SET);
+	dumpcoveragetable(gpos,glyphs);
+	free(pairset);
+    } else {
+	putshort(gpos,2);		/* format 2 of the pair adjustment subtable */
+	putshort(gpos,0);		/* offset to coverage table */
+	putshort(gpos,anydevtab ? kp->vf1|(kp->vf1<<4) : kp->vf1);
+	putshort(gpos,0x0000);		/* leave second char alone */
+	putshort(gpos,0);		/* offset to first glyph classes */
+	putshort(gpos,0);		/* offset to second glyph classes */
+	putshort(gpos,rcnt);
+	putshort(gpos,ccnt);
+	next_devtab = ftell(gpos)-begin_off + rcnt*ccnt*vr;
+	for ( i=0; i<rcnt; ++i ) for ( j=0; j<ccnt; ++j ) {
+	    putshort(gpos,kc->offsets[rows[i]*n+colrep[j]]);
+	    if ( anydevtab )
+		putshort(gpos,devoff[i*ccnt+j]==-1 ? 0 : next_devtab+devoff[i*ccnt+j]);
+	}
+	for ( k=0; k<dcnt; ++k )
+	    dumpgposdevicetable(gpos,&kc->adjusts[devcell[k]]);
+
+	pos = ftell(gpos);
+	fseek(gpos,begin_off+4*sizeof(uint16_t),SEEK_SET);
+	putshort(gpos,pos-begin_off);
+	fseek(gpos,pos,SEEK_SET);
+	DumpClass(gpos,class1,numGlyphs);
+
+	pos = ftell(gpos);
+	fseek(gpos,begin_off+5*sizeof(uint16_t),SEEK_SET);
+	putshort(gpos,pos-begin_off);
+	fseek(gpos,pos,SEEK_SET);
+	DumpClass(gpos,class2,numGlyphs);
+
+	pos = ftell(gpos);
+	fseek(gpos,begin_off+sizeof(uint16_t),SEEK_SET);
+	putshort(gpos,pos-begin_off);
+	fseek(gpos,pos,SEEK_SET);
+	dumpcoveragetable(gpos,glyphs);
+    }
+
+    free(devcell);
+    free(devat);
+    free(devoff);
     free(glyphs);
     free(class1);
     free(class2);
+    free(colmap);
+    free(colrep);
+    free(rows);
+    free(rowidx);
+}
+
+static void dumpgposkernclass(FILE *gpos,SplineFont *sf,
+	struct lookup_subtable *sub, struct alltabs *at) {
+    struct kcpack kp;
+    KernClass *kc = sub->kc, *test;
+    struct lookup_subtable *later;
+    int i, cnt, isv;
+
+    memset(&kp,0,sizeof(kp));
+    for ( test=sf->vkerns; test!=NULL && test!=kc; test=test->next );
+    isv = test==kc;
+    /* As far as I know there is no "bottom to top" writing direction */
+    /*  Oh. There is. Ogham, Runic */
+    kp.vf1 = isv ? 0x0008 : 0x0004;	/* Alter Y/XAdvance of first character */
+
+    for ( later=sub->next; later!=NULL && later->unused; later=later->next );
+    kp.last = later==NULL;
+
+    kp.kc = kc;
+    kp.numGlyphs = at->maxp.numGlyphs;
+    kp.class1 = ClassesFromNames(sf,kc->firsts,kc->first_cnt,kp.numGlyphs,&kp.gs,false);
+    kp.class2 = ClassesFromNames(sf,kc->seconds,kc->second_cnt,kp.numGlyphs,NULL,false);
+    kp.gcnt1 = calloc(kc->first_cnt,sizeof(int));
+    kp.gcnt2 = calloc(kc->second_cnt,sizeof(int));
+    for ( i=0; i<kp.numGlyphs; ++i ) {
+	if ( kp.gs[i]!=NULL )
+	    ++kp.gcnt1[kp.class1[i]];
+	++kp.gcnt2[kp.class2[i]];
+    }
+    kp.rowrep = malloc(kc->first_cnt*sizeof(int));
+    kp.rowcluster = malloc(kc->first_cnt*sizeof(int));
+
+    if ( KCFigureRows(&kp)==0 ) {
+	/* Nothing kerns. Output an empty set of pairs */
+	putshort(gpos,1);
+	putshort(gpos,5*sizeof(uint16_t));	/* offset to coverage table */
+	putshort(gpos,kp.vf1);
+	putshort(gpos,0x0000);
+	putshort(gpos,0);
+	putshort(gpos,1);		/* an empty coverage table */
+	putshort(gpos,0);
+    } else {
+	cnt = KCFigureClusters(&kp);
+	if ( cnt>1 ) {
+	    sub->extra_subtables = malloc((cnt+1)*sizeof(int32_t));
+	    sub->extra_subtables[cnt] = -1;
+	}
+	for ( i=0; i<cnt; ++i ) {
+	    if ( cnt>1 )
+		sub->extra_subtables[i] = ftell(gpos);
+	    dumpgposkernclustertable(gpos,&kp,i,sub);
+	}
+    }
+
+    free(kp.class1);
+    free(kp.class2);
+    free(kp.gs);
+    free(kp.gcnt1);
+    free(kp.gcnt2);
+    free(kp.rowrep);
+    free(kp.rowcluster);
 }
 
 static void dumpanchor(FILE *gpos,AnchorPoint *ap, int is_ttf ) {
@@ -2518,16 +2918,74 @@ static void dumpg___ContextChainClass(FILE *lfile,SplineFont *sf,
 	at->os2.maxContext = maxcontext;
 }
 
+/* The coverage tables already written for the current subtable, so that */
+/*  identical ones can share an offset */
+struct coveragepool {
+    int cnt, max;
+    SplineChar ***glyphs;
+    uint32_t *pos;
+    int saved;
+};
+
+static int CoverageSame(SplineChar **glyphs1,SplineChar **glyphs2) {
+    int i;
+
+    for ( i=0; glyphs1[i]!=NULL && glyphs2[i]!=NULL; ++i )
+	if ( glyphs1[i]->ttf_glyph!=glyphs2[i]->ttf_glyph )
+return( false );
+return( glyphs1[i]==glyphs2[i] );
+}
+
+/* Writes a coverage table at the end of the file, unless the pool already */
+/*  has an identical one. Returns where the table is. Frees glyphs */
+static uint32_t dumpsharedcoveragetable(FILE *lfile,struct coveragepool *cp,
+	SplineChar **glyphs) {
+    uint32_t pos;
+    int i;
+
+    for ( i=0; i<cp->cnt; ++i ) {
+	if ( CoverageSame(cp->glyphs[i],glyphs) ) {
+	    cp->saved += CoverageLen(glyphs);
+	    free(glyphs);
+return( cp->pos[i] );
+	}
+    }
+    fseek(lfile,0,SEEK_END);
+    pos = ftell(lfile);
+    dumpcoveragetable(lfile,glyphs);
+    if ( cp->cnt>=cp->max ) {
+	cp->max += 10;
+	cp->glyphs = realloc(cp->glyphs,cp->max*sizeof(SplineChar **));
+	cp->pos = realloc(cp->pos,cp->max*sizeof(uint32_t));
+    }
+    cp->glyphs[cp->cnt] = glyphs;
+    cp->pos[cp->cnt++] = pos;
+return( pos );
+}
+
+static void CoveragePoolFree(struct coveragepool *cp) {
+    int i;
+
+    for ( i=0; i<cp->cnt; ++i )
+	free(cp->glyphs[i]);
+    free(cp->glyphs);
+    free(cp->pos);
+}
+
 static void dumpg___ContextChainCoverage(FILE *lfile,SplineFont *sf,
 	struct lookup_subtable *sub, struct alltabs *at) {
     FPST *fpst = sub->fpst;
     int iscontext = fpst->type==pst_contextpos || fpst->type==pst_contextsub;
-    uint32_t base = ftell(lfile), ibase, lbase, bbase;
+    int is_gpos = fpst->type==pst_contextpos || fpst->type==pst_chainpos;
+    uint32_t base = ftell(lfile), ibase, lbase, bbase, pos;
     int i, l;
     SplineChar **glyphs;
+    struct coveragepool cp;
     int curcontext;
     int lc;
 
+    memset(&cp,0,sizeof(cp));
+
     if ( fpst->rule_cnt!=1 )
 	IError("Bad rule cnt in coverage context lookup");
     if ( fpst->format==pst_reversecoverage && fpst->rules[0].u.rcoverage.always1!=1 )
@@ -2551,13 +3009,11 @@ static void dumpg___ContextChainCoverage(FILE *lfile,SplineFont *sf,
 		putshort(lfile,fpst->rules[0].lookups[i].lookup->lookup_index);
 	    }
 	for ( i=0; i<fpst->rules[0].u.coverage.ncnt; ++i ) {
-	    uint32_t pos = ftell(lfile);
+	    pos = dumpsharedcoveragetable(lfile,&cp,
+		    OrderedGlyphsFromNames(sf,fpst->rules[0].u.coverage.ncovers[i]));
 	    fseek(lfile,base+6+2*i,SEEK_SET);
 	    putshort(lfile,pos-base);
-	    fseek(lfile,pos,SEEK_SET);
-	    glyphs = OrderedGlyphsFromNames(sf,fpst->rules[0].u.coverage.ncovers[i]);
-	    dumpcoveragetable(lfile,glyphs);
-	    free(glyphs);
+	    fseek(lfile,0,SEEK_END);
 	}
     } else {
 	if ( fpst->format==pst_reversecoverage ) {
@@ -2596,34 +3052,31 @@ static void dumpg___ContextChainCoverage(FILE *lfile,SplineFont *sf,
 	    free(glyphs);
 	}
 	for ( i=0; i<fpst->rules[0].u.coverage.ncnt; ++i ) {
-	    uint32_t pos = ftell(lfile);
+	    pos = dumpsharedcoveragetable(lfile,&cp,
+		    OrderedGlyphsFromNames(sf,fpst->rules[0].u.coverage.ncovers[i]));
 	    fseek(lfile,ibase+2*i,SEEK_SET);
 	    putshort(lfile,pos-base);
-	    fseek(lfile,pos,SEEK_SET);
-	    glyphs = OrderedGlyphsFromNames(sf,fpst->rules[0].u.coverage.ncovers[i]);
-	    dumpcoveragetable(lfile,glyphs);
-	    free(glyphs);
+	    fseek(lfile,0,SEEK_END);
 	}
 	for ( i=0; i<fpst->rules[0].u.coverage.bcnt; ++i ) {
-	    uint32_t pos = ftell(lfile);
+	    pos = dumpsharedcoveragetable(lfile,&cp,
+		    OrderedGlyphsFromNames(sf,fpst->rules[0].u.coverage.bcovers[i]));
 	    fseek(lfile,bbase+2*i,SEEK_SET);
 	    putshort(lfile,pos-base);
-	    fseek(lfile,pos,SEEK_SET);
-	    glyphs = OrderedGlyphsFromNames(sf,fpst->rules[0].u.coverage.bcovers[i]);
-	    dumpcoveragetable(lfile,glyphs);
-	    free(glyphs);
+	    fseek(lfile,0,SEEK_END);
 	}
 	for ( i=0; i<fpst->rules[0].u.coverage.fcnt; ++i ) {
-	    uint32_t pos = ftell(lfile);
+	    pos = dumpsharedcoveragetable(lfile,&cp,
+		    OrderedGlyphsFromNames(sf,fpst->rules[0].u.coverage.fcovers[i]));
 	    fseek(lfile,lbase+2*i,SEEK_SET);
 	    putshort(lfile,pos-base);
-	    fseek(lfile,pos,SEEK_SET);
-	    glyphs = OrderedGlyphsFromNames(sf,fpst->rules[0].u.coverage.fcovers[i]);
-	    dumpcoveragetable(lfile,glyphs);
-	    free(glyphs);
+	    fseek(lfile,0,SEEK_END);
 	}
     }
 
+    layout_stats[is_gpos].saved += cp.saved;
+    CoveragePoolFree(&cp);
+
     curcontext = fpst->rules[0].u.coverage.ncnt+fpst->rules[0].u.coverage.bcnt+fpst->rules[0].u.coverage.fcnt;
     if ( curcontext>at->os2.maxContext )
 	at->os2.maxContext = curcontext;
@@ -2862,17 +3315,336 @@ static void otf_dumpALookup(FILE *lfile, OTLookup *otl, SplineFont *sf,
     otl->lookup_length = ftell(lfile)-otl->lookup_offset;
 }
 
+/* A coverage table or class definition which subtables may share */
+struct layoutobj {
+    uint32_t start, len;	/* Where it was output */
+    uint32_t pos;		/* Where it is packed */
+};
+
+/* An offset in a packed subtable to a shared object, to be filled in */
+struct layoutref {
+    uint32_t slot, base;	/* Where the offset is, and its subtable */
+    int obj;
+};
+
+/* Shared objects are written after the subtables which use them, once */
+/*  all of those have been written. Objects before first have been */
+/*  written already, and may be out of reach of the subtables to come */
+struct layoutpool {
+    struct sharehash h;
+    struct layoutobj *objs;
+    struct layoutref *refs;
+    int ocnt, rcnt, first;
+};
+
+static uint16_t DataShort(const uint8_t *data,uint32_t pos) {
+return( (data[pos]<<8)|data[pos+1] );
+}
+
+/* The length of the coverage table (or class definition) at pos, 0 if */
+/*  it doesn't end by end */
+static uint32_t LayoutObjLen(const uint8_t *data,uint32_t pos,uint32_t end,int is_class) {
+    uint32_t len;
+    int format;
+
+    if ( pos+4>end )
+return( 0 );
+    format = DataShort(data,pos);
+    if ( format==2 )
+	len = 4+6*DataShort(data,pos+2);
+    else if ( format!=1 )
+return( 0 );
+    else if ( !is_class )
+	len = 4+2*DataShort(data,pos+2);
+    else if ( pos+6>end )
+return( 0 );
+    else
+	len = 6+2*DataShort(data,pos+4);
+return( pos+len<=end ? len : 0 );
+}
+
+/* Where in a subtable of this type and format are the offsets to its */
+/*  coverage tables and class definitions. moved is set to the offset to */
+/*  the data which follows them (the mark array of mark attachment), -1 */
+/*  if nothing does. Returns how many there are */
+static int LayoutObjSlots(int lookup_type,int format,int *slots,int *is_class,int *moved) {
+    *moved = -1;
+    switch ( lookup_type ) {
+      case gpos_single: case gpos_cursive:
+      case gsub_single: case gsub_multiple: case gsub_alternate: case gsub_ligature:
+	slots[0] = 2; is_class[0] = false;
+return( 1 );
+      case gpos_pair:
+	slots[0] = 2; is_class[0] = false;
+	if ( format!=2 )
+return( 1 );
+	slots[1] = 8; slots[2] = 10;
+	is_class[1] = is_class[2] = true;
+return( 3 );
+      case gpos_mark2base: case gpos_mark2ligature: case gpos_mark2mark:
+	slots[0] = 2; slots[1] = 4;
+	is_class[0] = is_class[1] = false;
+	*moved = 8;
+return( 2 );
+      default:
+return( 0 );
+    }
+}
+
+/* Finds the shareable objects of the subtable from start to end. They */
+/*  must lie together (from tail to rest) at its end, or be followed only */
+/*  by a block reached through the moved offset. All our subtable writers */
+/*  put them there. Returns their count, 0 if the subtable can't be cut up */
+static int LayoutSplitSubtable(const uint8_t *data,uint32_t start,uint32_t end,
+	int lookup_type,int *slots,uint32_t *objstart,uint32_t *objlen,
+	uint32_t *tail,uint32_t *rest,int *moved) {
+    int is_class[3], cnt, i, j, found, dups;
+    uint32_t header, off, pos;
+
+    if ( end-start<4 )
+return( 0 );
+    cnt = LayoutObjSlots(lookup_type,DataShort(data,start),slots,is_class,moved);
+    if ( cnt==0 )
+return( 0 );
+    header = (*moved!=-1 ? *moved : slots[cnt-1]) + 2;
+    if ( start+header>end )
+return( 0 );
+    *tail = end; *rest = start;
+    for ( i=0; i<cnt; ++i ) {
+	off = DataShort(data,start+slots[i]);
+	if ( off<header || (objlen[i] = LayoutObjLen(data,start+off,end,is_class[i]))==0 )
+return( 0 );
+	objstart[i] = start+off;
+	if ( objstart[i]<*tail ) *tail = objstart[i];
+	if ( objstart[i]+objlen[i]>*rest ) *rest = objstart[i]+objlen[i];
+    }
+    /* Each object must start where another ends, with no gaps */
+    for ( pos=*tail, found=0; pos<*rest; pos += objlen[i] ) {
+	for ( i=0; i<cnt && objstart[i]!=pos; ++i );
+	if ( i==cnt )
+return( 0 );
+	++found;
+    }
+    for ( i=dups=0; i<cnt; ++i ) {
+	for ( j=i+1; j<cnt && objstart[j]!=objstart[i]; ++j );
+	if ( j<cnt )
+	    ++dups;		/* The same object twice */
+    }
+    if ( pos!=*rest || found+dups!=cnt )
+return( 0 );
+    if ( *moved!=-1 ? start+DataShort(data,start+*moved)!=*rest : *rest!=end )
+return( 0 );
+return( cnt );
+}
+
+static int LayoutPoolAdd(struct layoutpool *pool,const uint8_t *data,uint32_t start,uint32_t len) {
+    uint32_t hash = 0x811c9dc5, pos;
+    int k;
+
+    for ( pos=start; pos<start+len; ++pos )
+	hash = (hash^data[pos])*0x01000193;
+    for ( k=pool->h.bucket[hash&(pool->h.size-1)]; k!=-1; k=pool->h.next[k] )
+	if ( k>=pool->first && pool->h.hash[k]==hash && pool->objs[k].len==len &&
+		memcmp(data+pool->objs[k].start,data+start,len)==0 )
+return( k );
+    pool->objs[pool->ocnt].start = start;
+    pool->objs[pool->ocnt].len = len;
+    ShareHashAdd(&pool->h,pool->ocnt,hash);
+return( pool->ocnt++ );
+}
+
+/* Copies the subtable from start to end, leaving its coverage tables and */
+/*  class definitions to the pool (if there is one). Returns where it went */
+static uint32_t LayoutPackSubtable(FILE *final,const uint8_t *data,uint32_t start,
+	uint32_t end,int lookup_type,struct layoutpool *pool) {
+    uint32_t pos = ftell(final), objstart[3], objlen[3], tail, rest;
+    int slots[3], cnt, moved, i;
+
+    if ( pool==NULL || (cnt = LayoutSplitSubtable(data,start,end,lookup_type,
+	    slots,objstart,objlen,&tail,&rest,&moved))==0 ) {
+	fwrite(data+start,1,end-start,final);
+return( pos );
+    }
+    fwrite(data+start,1,tail-start,final);
+    fwrite(data+rest,1,end-rest,final);
+    if ( moved!=-1 ) {
+	fseek(final,pos+moved,SEEK_SET);
+	putshort(final,tail-start);
+	fseek(final,0,SEEK_END);
+    }
+    for ( i=0; i<cnt; ++i ) {
+	pool->refs[pool->rcnt].slot = pos+slots[i];
+	pool->refs[pool->rcnt].base = pos;
+	pool->refs[pool->rcnt++].obj = LayoutPoolAdd(pool,data,objstart[i],objlen[i]);
+    }
+return( pos );
+}
+
+/* Writes the objects pooled since the last time, fills in the offsets */
+/*  to them and returns the bytes written */
+static uint32_t LayoutPoolFlush(FILE *final,const uint8_t *data,struct layoutpool *pool) {
+    uint32_t start = ftell(final), end;
+    int i;
+
+    for ( i=pool->first; i<pool->ocnt; ++i ) {
+	pool->objs[i].pos = ftell(final);
+	fwrite(data+pool->objs[i].start,1,pool->objs[i].len,final);
+    }
+    end = ftell(final);
+    for ( i=0; i<pool->rcnt; ++i ) {
+	fseek(final,pool->refs[i].slot,SEEK_SET);
+	putshort(final,pool->objs[pool->refs[i].obj].pos-pool->refs[i].base);
+    }
+    fseek(final,end,SEEK_SET);
+    pool->first = pool->ocnt;
+    pool->rcnt = 0;
+return( end-start );
+}
+
+/* Whether two subtables with the same bytes were split the same way */
+static int LayoutSameSplits(int32_t *orig,uint32_t ostart,struct lookup_subtable *sub,uint32_t start) {
+    int j;
+
+    if ( orig==NULL || sub->extra_subtables==NULL )
+return( orig==NULL && sub->extra_subtables==NULL );
+    for ( j=0; orig[j]!=-1 && sub->extra_subtables[j]!=-1; ++j )
+	if ( orig[j]-ostart!=sub->extra_subtables[j]-start )
+return( false );
+return( orig[j]==sub->extra_subtables[j] );
+}
+
+/* Copies the lookups into a new file in the given order. Identical */
+/*  subtables (several lookups are often built from the same data) are */
+/*  copied once and the repeats pointed at the first copy. The offsets to */
+/*  subtables are all forward from the lookup list, which precedes this */
+/*  data, so a subtable may be anywhere in it. */
+/* The coverage tables and class definitions of the subtables which have */
+/*  them at their end (most but the contextual ones) are cut off, and */
+/*  identical ones written once after all the subtables which use them. */
+/*  Their offsets are 16 bits from the subtable, so if the table is */
+/*  small they are shared across it, otherwise only within a lookup */
+/*  small enough, and the lookups are left as they are. Splitting */
+/*  subtables which are too big is left to the writers, as before */
+/* Returns the bytes saved */
+static int G___PackLookups(FILE *lfile,FILE *final,OTLookup **ordered,int cnt) {
+    struct lookup_subtable *sub, *next, *first;
+    struct sharehash h;
+    struct layoutpool pool;
+    uint32_t len = ftell(lfile), start, end, pos, hash, lstart, written, physend;
+    uint32_t *regstart, *reglen;
+    struct lookup_subtable **regsub;
+    int32_t **regsplits;
+    uint8_t *data;
+    int i, j, k, rcnt, pcnt, saved = 0, whole, type;
+
+    data = malloc(len+1);
+    rewind(lfile);
+    if ( fread(data,1,len,lfile)!=len )
+	IError("Could not reread the lookups");
+
+    for ( i=rcnt=pcnt=0; i<cnt; ++i )
+	for ( sub = ordered[i]->subtables; sub!=NULL; sub=sub->next ) {
+	    ++rcnt;
+	    if ( sub->extra_subtables==NULL )
+		++pcnt;
+	    else for ( j=0; sub->extra_subtables[j]!=-1; ++j )
+		++pcnt;
+	}
+    regstart = malloc((rcnt+1)*sizeof(uint32_t));
+    reglen = malloc((rcnt+1)*sizeof(uint32_t));
+    regsub = malloc((rcnt+1)*sizeof(struct lookup_subtable *));
+    regsplits = malloc((rcnt+1)*sizeof(int32_t *));
+    ShareHashInit(&h,rcnt);
+    memset(&pool,0,sizeof(pool));
+    ShareHashInit(&pool.h,3*pcnt);
+    pool.objs = malloc((3*pcnt+1)*sizeof(struct layoutobj));
+    pool.refs = malloc((3*pcnt+1)*sizeof(struct layoutref));
+    whole = len<65536;
+
+    for ( i=rcnt=0; i<cnt; ++i ) {
+	lstart = ordered[i]->lookup_offset;
+	ordered[i]->lookup_offset = ftell(final);
+	type = ordered[i]->lookup_type;
+	for ( sub = ordered[i]->subtables; sub!=NULL; sub=sub->next ) {
+	    if ( sub->subtable_offset==-1 )
+	continue;
+	    /* A subtable runs up to the next one, or the end of its lookup */
+	    for ( next=sub->next; next!=NULL && next->subtable_offset==-1; next=next->next );
+	    start = sub->subtable_offset;
+	    end = next!=NULL ? (uint32_t) next->subtable_offset : lstart+ordered[i]->lookup_length;
+	    hash = 0x811c9dc5;
+	    for ( pos=start; pos<end; ++pos )
+		hash = (hash^data[pos])*0x01000193;
+	    for ( k=h.bucket[hash&(h.size-1)]; k!=-1; k=h.next[k] )
+		if ( h.hash[k]==hash && reglen[k]==end-start &&
+			regsub[k]->lookup->lookup_type==type &&
+			memcmp(data+regstart[k],data+start,end-start)==0 &&
+			LayoutSameSplits(regsplits[k],regstart[k],sub,start) )
+	    break;
+	    if ( k!=-1 ) {
+		first = regsub[k];
+		saved += end-start;
+		sub->subtable_offset = first->subtable_offset;
+		if ( sub->extra_subtables!=NULL ) {
+		    for ( j=0; sub->extra_subtables[j]!=-1; ++j )
+			sub->extra_subtables[j] = first->extra_subtables[j];
+		}
+	continue;
+	    }
+	    regstart[rcnt] = start;
+	    reglen[rcnt] = end-start;
+	    regsub[rcnt] = sub;
+	    regsplits[rcnt] = NULL;
+	    written = ftell(final);
+	    if ( sub->extra_subtables==NULL )
+		LayoutPackSubtable(final,data,start,end,type,
+			whole || ordered[i]->lookup_length<65536 ? &pool : NULL);
+	    else {
+		for ( j=0; sub->extra_subtables[j]!=-1; ++j );
+		regsplits[rcnt] = malloc((j+1)*sizeof(int32_t));
+		memcpy(regsplits[rcnt],sub->extra_subtables,(j+1)*sizeof(int32_t));
+		/* Anything before the first split goes as it is */
+		if ( (uint32_t) sub->extra_subtables[0]>start )
+		    fwrite(data+start,1,sub->extra_subtables[0]-start,final);
+		for ( j=0; sub->extra_subtables[j]!=-1; ++j ) {
+		    physend = regsplits[rcnt][j+1]!=-1 ?
+			    (uint32_t) regsplits[rcnt][j+1] : end;
+		    sub->extra_subtables[j] = LayoutPackSubtable(final,data,
+			    regsplits[rcnt][j],physend,type,
+			    whole || ordered[i]->lookup_length<65536 ? &pool : NULL);
+		}
+	    }
+	    sub->subtable_offset = written;
+	    saved += (end-start) - (ftell(final)-written);
+	    ShareHashAdd(&h,rcnt++,hash);
+	}
+	if ( !whole )
+	    saved -= LayoutPoolFlush(final,data,&pool);
+    }
+    if ( whole )
+	saved -= LayoutPoolFlush(final,data,&pool);
+    ShareHashFree(&h);
+    ShareHashFree(&pool.h);
+    for ( k=0; k<rcnt; ++k )
+	free(regsplits[k]);
+    free(regsplits);
+    free(regsub);
+    free(regstart);
+    free(reglen);
+    free(pool.objs);
+    free(pool.refs);
+    free(data);
+return( saved );
+}
+
 static FILE *G___figureLookups(SplineFont *sf,int is_gpos,
 	struct alltabs *at) {
     OTLookup *otl;
-    struct lookup_subtable *sub;
-    int index, i,j;
+    int index;
     FILE *final;
     FILE *lfile = GFileTmpfile();
-    OTLookup **sizeordered;
+    OTLookup **ordered;
     OTLookup *all = is_gpos ? sf->gpos_lookups : sf->gsub_lookups;
-    char *buffer;
-    int len;
 
     index = 0;
     for ( otl=all; otl!=NULL; otl=otl->next ) {
@@ -2889,55 +3661,23 @@ static FILE *G___figureLookups(SplineFont *sf,int is_gpos,
     if ( is_gpos )
 	AnchorGuessContext(sf,at);
 
-    /* We don't need to reorder short files */
-    if ( ftell(lfile)<65536 )
-return( lfile );
+    ordered = malloc((index+1)*sizeof(OTLookup *));
+    for ( otl=all; otl!=NULL; otl=otl->next )
+	if ( otl->lookup_index!=-1 )
+	    ordered[ otl->lookup_index ] = otl;
 
-    /* Order the lookups so that the smallest ones come first */
+    /* We don't need to reorder short files */
+    /* Otherwise order the lookups so that the smallest ones come first */
     /*  thus we are less likely to need extension tables */
     /* I think it's better to order the entire lookup rather than ordering the*/
     /*  subtables -- since the extension subtable would be required for all */
     /*  subtables in the lookup, so might as well keep them all together */
-    sizeordered = malloc(index*sizeof(OTLookup *));
-    for ( otl=is_gpos ? sf->gpos_lookups : sf->gsub_lookups; otl!=NULL; otl=otl->next )
-	if ( otl->lookup_index!=-1 )
-	    sizeordered[ otl->lookup_index ] = otl;
-    qsort(sizeordered,index,sizeof(OTLookup *),lookup_size_cmp);
+    if ( ftell(lfile)>=65536 )
+	qsort(ordered,index,sizeof(OTLookup *),lookup_size_cmp);
 
     final = GFileTmpfile();
-    buffer = malloc(32768);
-    for ( i=0; i<index; ++i ) {
-	uint32_t diff;
-	otl = sizeordered[i];
-	fseek(lfile,otl->lookup_offset,SEEK_SET);
-	diff = ftell(final) - otl->lookup_offset;
-	otl->lookup_offset = ftell(final);
-	len = otl->lookup_length;
-	while ( len>=32768 ) {
-	    int done = fread(buffer,1,32768,lfile);
-	    if ( done==0 )		/* fread returns 0 on error, not EOF */
-	break;
-	    fwrite(buffer,1,done,final);
-	    len -= done;
-	}
-	if ( len>0 && len<=32768 ) {
-	    int done = fread(buffer,1,len,lfile);
-	    if ( done==0 )
-	break;
-	    fwrite(buffer,1,done,final);
-	}
-	for ( sub = otl->subtables; sub!=NULL; sub=sub->next ) {
-	    if ( !sub->unused ) {
-		sub->subtable_offset += diff;
-		if ( sub->extra_subtables!=NULL ) {
-		    for ( j=0; sub->extra_subtables[j]!=-1; ++j )
-			sub->extra_subtables[j] += diff;
-		}
-	    }
-	}
-    }
-    free(buffer);
-    free(sizeordered);
+    layout_stats[is_gpos].saved += G___PackLookups(lfile,final,ordered,index);
+    free(ordered);
     fclose(lfile);
 return( final );
 }
@@ -3475,9 +4215,10 @@ void otf_dumpgpos(struct alltabs *at, SplineFont *sf) {
     for ( ac=sf->anchor; ac!=NULL; ac=ac->next )
 	ac->processed = false;
 
+    layout_stats[true].len = layout_stats[true].saved = 0;
     at->gpos = dumpg___info(at, sf,true);
     if ( at->gpos!=NULL ) {
-	at->gposlen = ftell(at->gpos);
+	at->gposlen = layout_stats[true].len = ftell(at->gpos);
 	if ( at->gposlen&1 ) putc('\0',at->gpos);
 	if ( (at->gposlen+1)&2 ) putshort(at->gpos,0);
     }
@@ -3487,15 +4228,21 @@ void otf_dumpgsub(struct alltabs *at, SplineFont *sf) {
     /* substitutions such as: Ligatures, cjk vertical rotation replacement, */
     /*  arabic forms, small caps, ... */
     SFLigaturePrepare(sf);
+    layout_stats[false].len = layout_stats[false].saved = 0;
     at->gsub = dumpg___info(at, sf, false);
     if ( at->gsub!=NULL ) {
-	at->gsublen = ftell(at->gsub);
+	at->gsublen = layout_stats[false].len = ftell(at->gsub);
 	if ( at->gsublen&1 ) putc('\0',at->gsub);
 	if ( (at->gsublen+1)&2 ) putshort(at->gsub,0);
     }
     SFLigatureCleanup(sf);
 }
 
+void LayoutTableStats(int is_gpos, int *len, int *saved) {
+    *len = layout_stats[is_gpos!=0].len;
+    *saved = layout_stats[is_gpos!=0].saved;
+}
+
 int LigCaretCnt(SplineChar *sc) {
     PST *pst;
     int j, cnt;
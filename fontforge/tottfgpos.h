@@ -11,6 +11,8 @@ extern void otf_dumpgdef(struct alltabs *at, SplineFont *sf);
 extern void otf_dumpbase(struct alltabs *at, SplineFont *sf);
 extern void otf_dumpjstf(struct alltabs *at, SplineFont *sf);
 extern void otf_dump_dummydsig(struct alltabs *at, SplineFont *sf);
+/* Size of the GSUB or GPOS table last output, and bytes saved by sharing */
+extern void LayoutTableStats(int is_gpos, int *len, int *saved);
 extern int gdefclass(SplineChar *sc);
 
 extern int SCRightToLeft(SplineChar *sc);
@@ -32,6 +32,7 @@
 #include "fontforge.h"
 #include "gfile.h"
 #include "mem.h"
+#include "parallel.h"
 #include "splinesaveafm.h"
 #include "tottf.h"
 #include "ttf.h"
@@ -415,16 +416,16 @@ return( NULL );
 
     /* If all variants of the glyph are the same, no point in having a gvar */
     /*  entry for it */
-    for ( i=0 ; i<mm->instance_count; ++i ) {
+    for ( i=0 ; i<2*mm->instance_count; ++i ) {
 	for ( j=0; j<ptcnt; ++j )
 	    if ( deltas[i][j]!=0 )
 	break;
 	if ( j!=ptcnt )
     break;
     }
-    if ( i==mm->instance_count ) {
+    if ( i==2*mm->instance_count ) {
 	/* All zeros */
-	for ( i=0 ; i<mm->instance_count; ++i )
+	for ( i=0 ; i<2*mm->instance_count; ++i )
 	    free(deltas[i]);
 	free(deltas);
 return( NULL );
@@ -612,101 +613,422 @@ return;
 	putshort(at->cvar,0);
 }
 
-static void dumpdeltas(struct alltabs *at,int16_t *deltas,int ptcnt) {
-    int j,rj;
+/* A delta is left out of a glyph's variation data when the rasterizer will */
+/*  interpolate (IUP) one within this many em-units of it from the points   */
+/*  around it. A negative value writes every point of every tuple */
+float GvarIUPTolerance = 0.5;
+
+#define IUP_LOOKBACK	8	/* Longest run of points we try to interpolate */
+
+struct gvarbuf {
+    uint8_t *data;
+    int len, max;
+};
+
+struct iupcontour {
+    const int32_t *x, *y;	/* Coordinates in the default master */
+    const int16_t *dx, *dy;
+    int n;
+};
+
+struct gvarglyph {
+    int16_t **deltas;		/* As returned by SCFindDeltas */
+    int ptcnt;			/* Including the four phantom points */
+    int32_t *x, *y;		/* Outline points, NULL unless IUP can be used */
+    int *ends;			/* Last point of each contour */
+    int ccnt;
+    unsigned int composite: 1;
+    struct gvarbuf gb;		/* The glyph's variation data */
+};
+
+struct gvarjob {
+    MMSet *mm;
+    struct gvarglyph *glyphs;
+    double tol;
+};
+
+static void gb_putc(struct gvarbuf *gb, int ch) {
+    if ( gb->len>=gb->max ) {
+	gb->max = gb->max==0 ? 256 : 2*gb->max;
+	gb->data = realloc(gb->data,gb->max);
+    }
+    gb->data[gb->len++] = ch;
+}
+
+static void gb_putshort(struct gvarbuf *gb, int val) {
+    gb_putc(gb,(val>>8)&0xff);
+    gb_putc(gb,val&0xff);
+}
 
-    for ( j=0; j<ptcnt; ) {
-	for ( rj=j; rj<ptcnt && rj<j+0x40 && deltas[rj]==0; ++rj );
-	if ( rj!=j ) {
-	    putc((rj-j-1)|0x80,at->gvar);
-	    j = rj;
-    continue;
+static void gb_setshort(struct gvarbuf *gb, int pos, int val) {
+    gb->data[pos] = (val>>8)&0xff;
+    gb->data[pos+1] = val&0xff;
+}
+
+static int IUPAxisCanInterpolate(int32_t c1, int32_t c2, int d1, int d2) {
+    /* Rasterizers disagree about what happens between two reference points */
+    /*  with the same coordinate but different deltas, so we don't rely on it */
+return( c1!=c2 || d1==d2 );
+}
+
+static double IUPInterpolate(double c, double c1, double c2, double d1, double d2) {
+    if ( c1==c2 )
+return( d1 );
+    if ( c1>c2 ) {
+	double t;
+	t = c1; c1 = c2; c2 = t;
+	t = d1; d1 = d2; d2 = t;
+    }
+    if ( c<=c1 )
+return( d1 );
+    if ( c>=c2 )
+return( d2 );
+return( d1 + (c-c1)*(d2-d1)/(c2-c1) );
+}
+
+/* Can all the points strictly between i and j get their deltas from IUP? */
+/*  i and j index a contour traversed twice, i may be -1 */
+static int IUPCanInterpolate(const struct iupcontour *ic, int i, int j, double tol) {
+    int n = ic->n, p1 = (i+n)%n, p2 = j%n, k, p;
+    double ix, iy;
+
+    if ( !IUPAxisCanInterpolate(ic->x[p1],ic->x[p2],ic->dx[p1],ic->dx[p2]) ||
+	    !IUPAxisCanInterpolate(ic->y[p1],ic->y[p2],ic->dy[p1],ic->dy[p2]) )
+return( j==i+1 );
+    for ( k=i+1; k<j; ++k ) {
+	p = k%n;
+	ix = IUPInterpolate(ic->x[p],ic->x[p1],ic->x[p2],ic->dx[p1],ic->dx[p2]);
+	iy = IUPInterpolate(ic->y[p],ic->y[p1],ic->y[p2],ic->dy[p1],ic->dy[p2]);
+	if ( hypot(ix-ic->dx[p],iy-ic->dy[p])>tol )
+return( false );
+    }
+return( true );
+}
+
+/* Marks the points of a contour which need explicit deltas, the smallest */
+/*  set from which IUP reproduces the rest to within tol */
+static void IUPOptimizeContour(const struct iupcontour *ic, uint8_t *keep, double tol) {
+    int n = ic->n, i, j, lim, start, best_start, best_cost, c;
+    int *cost, *chain;
+
+    memset(keep,0,n);
+    for ( i=0; i<n && hypot(ic->dx[i],ic->dy[i])<=tol; ++i );
+    if ( i==n )
+return;			/* Nothing moves, leave the contour untouched */
+    if ( n==1 ) {
+	keep[0] = true;
+return;
+    }
+    for ( i=1; i<n && ic->dx[i]==ic->dx[0] && ic->dy[i]==ic->dy[0]; ++i );
+    if ( i==n ) {
+	/* A single referenced point shifts the whole contour */
+	keep[0] = true;
+return;
+    }
+
+    /* Dynamic programming over the contour traversed twice. cost[i+1] is */
+    /*  the fewest points needed up to and including point i, chain[i+1]  */
+    /*  the previous explicit point on that path (-1 is the start) */
+    cost = malloc((2*n+1)*sizeof(int));
+    chain = malloc((2*n+1)*sizeof(int));
+    cost[0] = 0; chain[0] = -2;
+    for ( i=0; i<2*n; ++i ) {
+	cost[i+1] = cost[i]+1;
+	chain[i+1] = i-1;
+	lim = i-IUP_LOOKBACK;
+	if ( lim<-2 ) lim = -2;
+	for ( j=i-2; j>lim; --j ) {
+	    if ( cost[j+1]+1<cost[i+1] && IUPCanInterpolate(ic,j,i,tol) ) {
+		cost[i+1] = cost[j+1]+1;
+		chain[i+1] = j;
+	    }
 	}
-	if ( deltas[j]>0x7f || deltas[j]<0x80 ) {
-	    for ( rj=j+1; rj<j+0x40 && rj<ptcnt; ++rj ) {
-		if ( deltas[rj]>0x7f || deltas[rj]<0x80 ||
-			(rj+1<j+0x40 && rj+1<ptcnt && (deltas[rj+1]>0x7f || deltas[rj+1]<0x80)) )
-		    /* Keep going with a big run */;
-		else
-	    break;
+    }
+    /* Now find the cheapest path which closes on itself one lap earlier */
+    best_cost = -1; best_start = n-1;
+    for ( start=n-1; start<2*n-1; ++start ) {
+	for ( i=start; i>start-n; i=chain[i+1] );
+	if ( i==start-n ) {
+	    c = cost[start+1]-cost[start-n+1];
+	    if ( best_cost<0 || c<=best_cost ) {
+		best_cost = c;
+		best_start = start;
 	    }
-	    putc( (rj-j-1)|0x40,at->gvar );
-	    for ( ; j<rj ; ++j )
-		putshort( at->gvar, deltas[j] );
+	}
+    }
+    for ( i=best_start; i>best_start-n; i=chain[i+1] )
+	keep[i%n] = true;
+    free(cost);
+    free(chain);
+}
+
+static void GvarGlyphOutline(SplineChar *sc, struct gvarglyph *gg) {
+    /* IUP only applies to simple glyphs, and needs to know where each point */
+    /*  is in the default master and which contour it belongs to */
+    int n = gg->ptcnt-4, ccnt, last, max, idx, k;
+    SplineSet *ss;
+    SplinePoint *sp;
+    uint8_t *seen;
+
+    if ( sc->layers[ly_fore].refs!=NULL ) {
+	gg->composite = true;
+return;
+    }
+    if ( n<=0 )
+return;
+    for ( ss=sc->layers[ly_fore].splines, ccnt=0; ss!=NULL; ss=ss->next )
+	++ccnt;
+    gg->x = malloc(2*n*sizeof(int32_t));
+    gg->y = gg->x+n;
+    gg->ends = malloc(ccnt*sizeof(int));
+    seen = calloc(n,1);
+    last = -1;
+    for ( ss=sc->layers[ly_fore].splines; ss!=NULL; ss=ss->next ) {
+	max = -1;
+	for ( sp=ss->first; ; ) {
+	    for ( k=0; k<2; ++k ) {
+		idx = k==0 ? sp->ttfindex : sp->nextcpindex;
+		if ( idx==0xffff )
+	    continue;
+		if ( idx<=last || idx>=n )
+    goto fail;		/* Contours aren't numbered consecutively */
+		gg->x[idx] = rint(k==0 ? sp->me.x : sp->nextcp.x);
+		gg->y[idx] = rint(k==0 ? sp->me.y : sp->nextcp.y);
+		seen[idx] = true;
+		if ( idx>max ) max = idx;
+	    }
+	    if ( sp->next==NULL )
+	break;
+	    sp = sp->next->to;
+	    if ( sp==ss->first )
+	break;
+	}
+	if ( max!=-1 )
+	    gg->ends[gg->ccnt++] = last = max;
+    }
+    for ( k=0; k<n && seen[k]; ++k );
+    if ( k==n ) {
+	free(seen);
+return;
+    }
+  fail:
+    free(seen);
+    free(gg->x); gg->x = gg->y = NULL;
+    free(gg->ends); gg->ends = NULL;
+    gg->ccnt = 0;
+}
+
+/* Fills in keep with the points tuple t must list, returns their count */
+static int GvarTuplePoints(struct gvarglyph *gg, int t, double tol, uint8_t *keep) {
+    int16_t *dx = gg->deltas[2*t], *dy = gg->deltas[2*t+1];
+    int n = gg->ptcnt-4, c, k, first, cnt;
+    struct iupcontour ic;
+
+    if ( tol<0 ) {
+	memset(keep,1,gg->ptcnt);
+return( gg->ptcnt );
+    }
+    if ( gg->x!=NULL ) {
+	for ( c=first=0; c<gg->ccnt; first=gg->ends[c++]+1 ) {
+	    ic.x = gg->x+first; ic.y = gg->y+first;
+	    ic.dx = dx+first; ic.dy = dy+first;
+	    ic.n = gg->ends[c]-first+1;
+	    IUPOptimizeContour(&ic,keep+first,tol);
+	}
+    } else if ( gg->composite ) {
+	/* Component offsets aren't interpolated, a missing one just doesn't move */
+	for ( k=0; k<n; ++k )
+	    keep[k] = dx[k]!=0 || dy[k]!=0;
+    } else
+	memset(keep,1,n);
+    /* Nor are the phantom points */
+    for ( k=n; k<gg->ptcnt; ++k )
+	keep[k] = dx[k]!=0 || dy[k]!=0;
+    for ( k=cnt=0; k<gg->ptcnt; ++k )
+	cnt += keep[k];
+return( cnt );
+}
+
+static void GvarPutPoints(struct gvarbuf *gb, const uint8_t *keep, int ptcnt) {
+    int *pts, cnt, j, rj, last, big;
+
+    for ( j=cnt=0; j<ptcnt; ++j )
+	cnt += keep[j];
+    if ( cnt==ptcnt ) {
+	gb_putc(gb,0);			/* All points */
+return;
+    }
+    if ( cnt<0x80 )
+	gb_putc(gb,cnt);
+    else
+	gb_putshort(gb,0x8000|cnt);
+    pts = malloc(cnt*sizeof(int));
+    for ( j=cnt=0; j<ptcnt; ++j )
+	if ( keep[j] )
+	    pts[cnt++] = j;
+    for ( j=0, last=0; j<cnt; ) {
+	big = pts[j]-last>0xff;
+	for ( rj=j+1; rj<cnt && rj<j+0x80 && (pts[rj]-pts[rj-1]>0xff)==big; ++rj );
+	gb_putc(gb,(rj-j-1)|(big?0x80:0));
+	for ( ; j<rj; ++j ) {
+	    if ( big )
+		gb_putshort(gb,pts[j]-last);
+	    else
+		gb_putc(gb,pts[j]-last);
+	    last = pts[j];
+	}
+    }
+    free(pts);
+}
+
+#define DeltaIsByte(d)	((d)>=-0x80 && (d)<=0x7f)
+
+static void GvarPutDeltas(struct gvarbuf *gb, const int16_t *deltas, const uint8_t *keep, int ptcnt) {
+    int16_t *d;
+    int j, rj, cnt;
+
+    d = malloc(ptcnt*sizeof(int16_t));
+    for ( j=cnt=0; j<ptcnt; ++j )
+	if ( keep[j] )
+	    d[cnt++] = deltas[j];
+    for ( j=0; j<cnt; ) {
+	if ( d[j]==0 ) {
+	    for ( rj=j+1; rj<cnt && rj<j+0x40 && d[rj]==0; ++rj );
+	    gb_putc(gb,0x80|(rj-j-1));
+	    j = rj;
+	} else if ( DeltaIsByte(d[j]) ) {
+	    /* A lone zero is cheaper inside a run of bytes than as its own run */
+	    for ( rj=j+1; rj<cnt && rj<j+0x40 && DeltaIsByte(d[rj]) &&
+		    !(d[rj]==0 && rj+1<cnt && d[rj+1]==0); ++rj );
+	    gb_putc(gb,rj-j-1);
+	    for ( ; j<rj; ++j )
+		gb_putc(gb,d[j]&0xff);
 	} else {
-	    for ( rj=j+1; rj<j+0x40 && rj<ptcnt; ++rj ) {
-		if ( deltas[rj]>0x7f || deltas[rj]<0x80 ||
-			(deltas[rj]==0 && rj+1<j+0x40 && rj+1<ptcnt &&
-			    deltas[rj+1]<=0x7f && deltas[rj+1]>=0x80 && deltas[rj+1]!=0 ))
-	    break;
+	    /* Likewise a lone small value between two big ones */
+	    for ( rj=j+1; rj<cnt && rj<j+0x40 && (!DeltaIsByte(d[rj]) ||
+		    (d[rj]!=0 && rj+1<cnt && !DeltaIsByte(d[rj+1]))); ++rj );
+	    gb_putc(gb,0x40|(rj-j-1));
+	    for ( ; j<rj; ++j )
+		gb_putshort(gb,d[j]);
+	}
+    }
+    free(d);
+}
+
+static void GvarGlyphEncode(void *data, int gi) {
+    struct gvarjob *job = data;
+    struct gvarglyph *gg = &job->glyphs[gi];
+    int tcnt = job->mm->instance_count, t, u, m, uses, best_uses, shared, hdr, start;
+    uint8_t **keep;
+    int *kcnt;
+
+    if ( gg->deltas==NULL )
+return;
+    keep = malloc(tcnt*sizeof(uint8_t *));
+    kcnt = malloc(tcnt*sizeof(int));
+    for ( t=0; t<tcnt; ++t ) {
+	keep[t] = malloc(gg->ptcnt);
+	kcnt[t] = GvarTuplePoints(gg,t,job->tol,keep[t]);
+    }
+
+    /* Tuples frequently end up with the same points, if so list them once */
+    shared = -1; best_uses = 1;
+    for ( t=m=0; t<tcnt; ++t ) if ( kcnt[t]!=0 ) {
+	++m;
+	for ( u=0, uses=0; u<tcnt; ++u )
+	    if ( kcnt[u]==kcnt[t] && memcmp(keep[u],keep[t],gg->ptcnt)==0 )
+		++uses;
+	if ( uses>best_uses ) {
+	    best_uses = uses;
+	    shared = t;
+	}
+    }
+
+    if ( m!=0 ) {
+	gb_putshort(&gg->gb,m|(shared!=-1?0x8000:0));
+	gb_putshort(&gg->gb,4+4*m);		/* offset to data */
+	hdr = gg->gb.len;
+	for ( t=0; t<tcnt; ++t ) if ( kcnt[t]!=0 ) {
+	    gb_putshort(&gg->gb,0);		/* tuple data size, fix later */
+	    gb_putshort(&gg->gb,t);		/* global tuple t, flags fixed later */
+	}
+	if ( shared!=-1 )
+	    GvarPutPoints(&gg->gb,keep[shared],gg->ptcnt);
+	for ( t=0; t<tcnt; ++t ) if ( kcnt[t]!=0 ) {
+	    start = gg->gb.len;
+	    if ( shared==-1 || memcmp(keep[t],keep[shared],gg->ptcnt)!=0 ) {
+		gb_setshort(&gg->gb,hdr+2,0x2000|t);	/* private points */
+		GvarPutPoints(&gg->gb,keep[t],gg->ptcnt);
 	    }
-	    putc( rj-j-1,at->gvar );
-	    for ( ; j<rj ; ++j )
-		putc( deltas[j], at->gvar );
+	    GvarPutDeltas(&gg->gb,gg->deltas[2*t],keep[t],gg->ptcnt);
+	    GvarPutDeltas(&gg->gb,gg->deltas[2*t+1],keep[t],gg->ptcnt);
+	    gb_setshort(&gg->gb,hdr,gg->gb.len-start);
+	    hdr += 4;
 	}
+	if ( gg->gb.len&1 )
+	    gb_putc(&gg->gb,0);		/* Short offsets need every glyph to be even */
     }
+
+    for ( t=0; t<tcnt; ++t ) {
+	free(keep[t]);
+	free(gg->deltas[2*t]); free(gg->deltas[2*t+1]);
+    }
+    free(keep); free(kcnt);
+    free(gg->deltas); gg->deltas = NULL;
 }
 
 static void ttf_dumpgvar(struct alltabs *at, MMSet *mm) {
-    int i,j, last;
-    uint32_t gcoordoff, glyphoffs, start, here, tupledataend, tupledatastart;
-    int16_t **deltas;
-    int ptcnt;
+    struct gvarjob job;
+    struct gvarglyph *gg;
+    int i, j, gcnt, longoffsets;
+    uint32_t total, off;
+
+    gcnt = at->gi.gcnt<at->maxp.numGlyphs ? at->gi.gcnt : at->maxp.numGlyphs;
+    job.mm = mm;
+    job.tol = GvarIUPTolerance;
+    job.glyphs = gg = calloc(gcnt>0 ? gcnt : 1,sizeof(struct gvarglyph));
+    /* Finding the deltas may renumber points, so that must be done in order */
+    for ( i=0; i<gcnt; ++i ) if ( at->gi.bygid[i]!=-1 ) {
+	gg[i].deltas = SCFindDeltas(mm,at->gi.bygid[i],&gg[i].ptcnt);
+	if ( gg[i].deltas!=NULL )
+	    GvarGlyphOutline(mm->normal->glyphs[at->gi.bygid[i]],&gg[i]);
+    }
+    /* But after that each glyph's data is independent of the others' */
+    FFParallelFor(gcnt,GvarGlyphEncode,&job);
+
+    for ( i=0, total=0; i<gcnt; ++i )
+	total += gg[i].gb.len;
+    longoffsets = total>0x1fffe;
 
     at->gvar = GFileTmpfile();
     putlong( at->gvar, 0x00010000 );	/* Format */
     putshort( at->gvar, mm->axis_count );
     putshort( at->gvar, mm->instance_count );	/* Number of global tuples */
-    gcoordoff = ftell(at->gvar);
-    putlong( at->gvar, 0 );		/* Offset to global tuples, fix later */
-    putshort( at->gvar,at->maxp.numGlyphs );
-    putshort( at->gvar, 1 );		/* always output 32bit offsets */
-    putlong( at->gvar, ftell(at->gvar)+4 + (at->maxp.numGlyphs+1)*4);
-    glyphoffs = ftell(at->gvar);
-    for ( i=0; i<=at->maxp.numGlyphs; ++i )
-	putlong( at->gvar,0 );
-
-    start = ftell( at->gvar );
-    last = -1;
-    for ( i=0; i<at->gi.gcnt; ++i ) if ( at->gi.bygid[i]!=-1 ) {
-	deltas = SCFindDeltas(mm,at->gi.bygid[i],&ptcnt);
-	if ( deltas==NULL )
-    continue;
-	here = ftell(at->gvar);
-	fseek(at->gvar,glyphoffs+(last+1)*4,SEEK_SET);
-	for ( ; last< i; ++last )
-	    putlong(at->gvar,here-start);
-	fseek(at->gvar,here,SEEK_SET);
-	putshort(at->gvar,mm->instance_count);
-	putshort(at->gvar,4+4*mm->instance_count);	/* offset to data */
-	for ( j=0; j<mm->instance_count; ++j ) {
-	    putshort(at->gvar,0);			/* tuple data size, fix later */
-	    putshort(at->gvar,0x2000|j);		/* private points, tuple i */
-	}
-	for ( j=0; j<mm->instance_count; ++j ) {
-	    tupledatastart = ftell(at->gvar);
-	    putc('\0',at->gvar);			/* Point list, all points */
-	    dumpdeltas(at,deltas[2*j],ptcnt);
-	    dumpdeltas(at,deltas[2*j+1],ptcnt);
-	    tupledataend = ftell(at->gvar);
-	    fseek(at->gvar,here+4+4*j,SEEK_SET);
-	    putshort( at->gvar,tupledataend-tupledatastart);
-	    fseek(at->gvar,tupledataend,SEEK_SET);
-	    free(deltas[2*j]); free(deltas[2*j+1]);
-	}
-	free(deltas);
+    off = 20 + (at->maxp.numGlyphs+1)*(longoffsets?4:2);
+    putlong( at->gvar, off );		/* Offset to global tuples */
+    putshort( at->gvar, at->maxp.numGlyphs );
+    putshort( at->gvar, longoffsets );
+    putlong( at->gvar, off + 2*mm->instance_count*mm->axis_count );
+    for ( i=0, off=0; i<=at->maxp.numGlyphs; ++i ) {
+	if ( longoffsets )
+	    putlong( at->gvar, off );
+	else
+	    putshort( at->gvar, off/2 );
+	if ( i<gcnt )
+	    off += gg[i].gb.len;
     }
-    here = ftell(at->gvar);
-    fseek(at->gvar,glyphoffs+(last+1)*4,SEEK_SET);
-    for ( ; last< at->maxp.numGlyphs; ++last )
-	putlong(at->gvar,here-start);
-    fseek(at->gvar,gcoordoff,SEEK_SET);
-    putlong(at->gvar,here);
-    fseek(at->gvar,here,SEEK_SET);
     for ( j=0; j<mm->instance_count; ++j ) {
 	for ( i=0; i<mm->axis_count; ++i )
 	    putshort(at->gvar,rint(16384*mm->positions[j*mm->axis_count+i]));
     }
+    for ( i=0; i<gcnt; ++i ) {
+	if ( gg[i].gb.len!=0 )
+	    fwrite(gg[i].gb.data,1,gg[i].gb.len,at->gvar);
+	free(gg[i].gb.data);
+	free(gg[i].x);
+	free(gg[i].ends);
+    }
+    free(gg);
 
     at->gvarlen = ftell(at->gvar);
     if ( at->gvarlen&1 )
@@ -442,6 +442,13 @@ typedef struct fontview {
     GTimer *pressed;
     GTimer *resize;
     GEvent resize_event;
+    GTimer *raster;		/* Rasterizes the glyphs FVDrawGlyph couldn't draw yet */
+    int32_t *raster_queue;	/* Encodings waiting for their glyph to be rasterized */
+    int raster_cnt, raster_max;
+    uint8_t *raster_queued;	/* Per encoding, whether it is in raster_queue */
+    int raster_queued_max;
+    int32_t raster_lastoff;	/* rowoff when last prefetched, gives the scroll direction */
+    int raster_dir;
     GIC *gic;
     GIC *gwgic;
     int width, height;		/* of v */
@@ -1495,32 +1495,78 @@ void CVDrawSplineSet(CharView *cv, GWindow pixmap, SplinePointList *set,
 }
 
 
+/* Whether any of the contour (or its stroke) may lie within clip, expanded */
+/*  by margin. The contour lies within the hull of its points and control */
+/*  points. A contour wholly outside clip can't change the winding number */
+/*  of anything inside it either, so it may be skipped when filling too */
+static int SplineSetMayBeVisible(SplinePointList *spl, DRect *clip, real margin) {
+    SplinePoint *sp;
+    real minx, maxx, miny, maxy;
+    real cminx, cmaxx, cminy, cmaxy;
+
+    if ( clip==NULL || spl->first==NULL )
+return( true );
+    cminx = clip->x-margin; cmaxx = clip->x+clip->width+margin;
+    cminy = clip->y-margin; cmaxy = clip->y+clip->height+margin;
+    minx = maxx = spl->first->me.x;
+    miny = maxy = spl->first->me.y;
+    for ( sp=spl->first; ; ) {
+	/* Most contours have a point on screen, so stop as soon as we see one */
+	if ( sp->me.x>=cminx && sp->me.x<=cmaxx && sp->me.y>=cminy && sp->me.y<=cmaxy )
+return( true );
+	if ( sp->me.x<minx ) minx = sp->me.x; else if ( sp->me.x>maxx ) maxx = sp->me.x;
+	if ( sp->me.y<miny ) miny = sp->me.y; else if ( sp->me.y>maxy ) maxy = sp->me.y;
+	if ( sp->nextcp.x<minx ) minx = sp->nextcp.x; else if ( sp->nextcp.x>maxx ) maxx = sp->nextcp.x;
+	if ( sp->nextcp.y<miny ) miny = sp->nextcp.y; else if ( sp->nextcp.y>maxy ) maxy = sp->nextcp.y;
+	if ( sp->prevcp.x<minx ) minx = sp->prevcp.x; else if ( sp->prevcp.x>maxx ) maxx = sp->prevcp.x;
+	if ( sp->prevcp.y<miny ) miny = sp->prevcp.y; else if ( sp->prevcp.y>maxy ) maxy = sp->prevcp.y;
+	if ( sp->next==NULL )
+    break;
+	sp = sp->next->to;
+	if ( sp==spl->first )
+    break;
+    }
+return( maxx>=cminx && minx<=cmaxx && maxy>=cminy && miny<=cmaxy );
+}
+
 void CVDrawSplineSetOutlineOnly(CharView *cv, GWindow pixmap, SplinePointList *set,
 				Color fg, int dopoints, DRect *clip, enum outlinesfm_flags strokeFillMode ) {
     SplinePointList *spl;
     int currentSplineCounter = 0;
     int activelayer = CVLayer(&cv->b);
     CharViewTab* tab = CVGetActiveTab(cv);
+    int in_active_layer;
+    real margin;
 
     if( strokeFillMode == sfm_fill ) {
     	GDrawFillRuleSetWinding(pixmap);
     }
 
-    for ( spl = set; spl!=NULL; spl = spl->next ) {
-
-	Color fc  = spl->is_clip_path ? clippathcol : fg;
-	/**
-	 * Only make the outline red if this is not a grid layer
-	 * and we want to highlight open paths
-	 * and the activelayer is sane
-	 * and the activelayer contains the given splinepointlist
-	 * and the path is open
-	 */
-	if ( cv->b.drawmode!=dm_grid
+    /**
+     * Only make the outline red if this is not a grid layer
+     * and we want to highlight open paths
+     * and the activelayer is sane
+     * and the activelayer contains the given splinepointlist
+     * and the path is open.
+     * A contour belongs to one list, so if the set is in the active layer
+     * all the contours after it are too. No need to look for each one.
+     */
+    in_active_layer = cv->b.drawmode!=dm_grid
 	     && DrawOpenPathsWithHighlight
 	     && activelayer < cv->b.sc->layer_cnt
 	     && activelayer >= 0
-	     && SplinePointListContains( cv->b.sc->layers[activelayer].splines, spl )
+	     && SplinePointListContains( cv->b.sc->layers[activelayer].splines, set );
+    /* Half the stroke, and a couple of pixels for rounding, in glyph units */
+    margin = (GDrawGetLineWidth( pixmap )/2.0 + 2)/tab->scale;
+
+    for ( spl = set; spl!=NULL; spl = spl->next ) {
+
+	Color fc  = spl->is_clip_path ? clippathcol : fg;
+
+	if ( !SplineSetMayBeVisible(spl,clip,margin) )
+    continue;
+
+	if ( in_active_layer
 	     && spl->first
 	     && spl->first->prev==NULL )
 	{
@@ -5098,6 +5144,7 @@ void CVSetCharChanged(CharView *cv,int changed) {
 	    sf->onlybitmaps = false;
 	}
 	SCTickValidationState(cv->b.sc,cvlayer);
+	SCInvalidateBounds(cv->b.sc);
 	if ( (sc->changed==0) != (changed==0) ) {
 	    sc->changed = (changed!=0);
 	    FVToggleCharChanged(sc);
@@ -5154,6 +5201,7 @@ static void _SC_CharChangedUpdate(SplineChar *sc,int layer,int changed) {
 	IError( "Bad layer in _SC_CharChangedUpdate");
 	layer = ly_fore;
     }
+    SCInvalidateBounds(sc);
     if ( layer>=0 && !sc->layers[layer].background )
 	TTFPointMatches(sc,layer,true);
     if ( changed != -1 ) {
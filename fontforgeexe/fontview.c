@@ -48,6 +48,7 @@
 #include "mm.h"
 #include "namelist.h"
 #include "nonlineartrans.h"
+#include "parallel.h"
 #include "psfont.h"
 #include "pua.h"
 #include "scripting.h"
@@ -133,8 +134,10 @@ static Color fvmetadvanceatcol = 0x008000;
 static Color fvmetadvancetocol = 0x008000;
 static Color fvmissingbitmapcol = 0xff0000;
 static Color fvmissingoutlinecol = 0x008000;
+static Color fvpendingcol = 0xc0c0c0;
 
 enum glyphlable { gl_glyph, gl_name, gl_unicode, gl_encoding };
+int fv_raster_cache = 64;		/* Megabytes of glyph images kept for a font view */
 int default_fv_showhmetrics=false, default_fv_showvmetrics=false,
 	default_fv_glyphlabel = gl_glyph;
 FontView *fv_list=NULL;
@@ -245,6 +248,181 @@ extern BDFFont *FVSplineFontPieceMeal(SplineFont *sf, int layer, int ptsize, int
     return new;
 }
 
+static void FVDrawGlyph(GWindow pixmap, FontView *fv, int index, int request_expose );
+
+/* Glyph images are not rasterized in the expose handler (on a large font */
+/*  that makes scrolling crawl). Instead FVDrawGlyph queues the slot and  */
+/*  draws a placeholder, and a timer rasterizes the queue a few glyphs at */
+/*  a time on all processors, then redraws the slots. When the queue is   */
+/*  empty the timer rasterizes the screen beyond the one in view (in the  */
+/*  direction we were scrolling), and finally frees the images far from   */
+/*  the screen if there are more than fv_raster_cache megabytes of them   */
+static void FVRasterQueue(FontView *fv,int enc) {
+    int newmax;
+
+    if ( enc>=fv->raster_queued_max ) {
+	newmax = fv->b.map->enccount>enc ? fv->b.map->enccount : enc+1;
+	fv->raster_queued = realloc(fv->raster_queued,newmax);
+	memset(fv->raster_queued+fv->raster_queued_max,0,newmax-fv->raster_queued_max);
+	fv->raster_queued_max = newmax;
+    }
+    if ( fv->raster_queued[enc] )
+return;
+    if ( fv->raster_cnt>=fv->raster_max )
+	fv->raster_queue = realloc(fv->raster_queue,(fv->raster_max += 256)*sizeof(int32_t));
+    fv->raster_queue[fv->raster_cnt++] = enc;
+    fv->raster_queued[enc] = true;
+    if ( fv->raster==NULL && fv->v!=NULL )
+	fv->raster = GDrawRequestTimer(fv->v,1,0,NULL);
+}
+
+static void FVRasterClear(FontView *fv) {
+    int i;
+
+    for ( i=0; i<fv->raster_cnt; ++i )
+	fv->raster_queued[fv->raster_queue[i]] = false;
+    fv->raster_cnt = 0;
+}
+
+static int FVRasterNeeded(FontView *fv,int enc) {
+    int gid = FeatureTrans(fv,enc);
+    BDFFont *bdf = fv->show;
+
+return( gid!=-1 && fv->b.sf->glyphs[gid]!=NULL &&
+	    (gid>=bdf->glyphcnt || bdf->glyphs[gid]==NULL) );
+}
+
+static void FVRasterPrefetch(FontView *fv) {
+    int start, end, enc;
+
+    if ( fv->rowoff!=fv->raster_lastoff ) {
+	fv->raster_dir = fv->rowoff<fv->raster_lastoff ? -1 : 1;
+	fv->raster_lastoff = fv->rowoff;
+    }
+    if ( fv->raster_dir<0 ) {
+	start = (fv->rowoff-fv->rowcnt)*fv->colcnt;
+	end = fv->rowoff*fv->colcnt;
+    } else {
+	start = (fv->rowoff+fv->rowcnt+1)*fv->colcnt;
+	end = (fv->rowoff+2*fv->rowcnt+1)*fv->colcnt;
+    }
+    if ( start<0 ) start = 0;
+    if ( end>fv->b.map->enccount ) end = fv->b.map->enccount;
+    for ( enc=start; enc<end; ++enc )
+	if ( FVRasterNeeded(fv,enc) )
+	    FVRasterQueue(fv,enc);
+}
+
+static int BCBytes(BDFChar *bdfc) {
+return( sizeof(BDFChar) + bdfc->bytes_per_line*(bdfc->ymax-bdfc->ymin+1) );
+}
+
+static void FVRasterEvict(FontView *fv) {
+    BDFFont *bdf = fv->filled;
+    FontView *fvs;
+    size_t bytes = 0, limit = ((size_t) fv_raster_cache)<<20;
+    uint8_t *keep;
+    int gid, enc, start, end;
+
+    if ( fv_raster_cache<=0 || fv->show!=bdf || !bdf->piecemeal )
+return;
+    for ( gid=0; gid<bdf->glyphcnt; ++gid )
+	if ( bdf->glyphs[gid]!=NULL )
+	    bytes += BCBytes(bdf->glyphs[gid]);
+    if ( bytes<=limit )
+return;
+
+    /* Keep what any view of this font has on screen, or is about to */
+    keep = calloc(bdf->glyphcnt+1,1);
+    for ( fvs=(FontView *) (fv->b.sf->fv); fvs!=NULL; fvs = (FontView *) (fvs->b.nextsame) ) {
+	if ( fvs->filled!=bdf || fvs->colcnt==0 )
+    continue;
+	start = (fvs->rowoff-fvs->rowcnt)*fvs->colcnt;
+	end = (fvs->rowoff+2*fvs->rowcnt+1)*fvs->colcnt;
+	if ( start<0 ) start = 0;
+	if ( end>fvs->b.map->enccount ) end = fvs->b.map->enccount;
+	for ( enc=start; enc<end; ++enc ) {
+	    gid = FeatureTrans(fvs,enc);
+	    if ( gid>=0 && gid<bdf->glyphcnt )
+		keep[gid] = true;
+	}
+    }
+    /* Go well below the limit so we don't do this again on the next scroll */
+    for ( gid=0; gid<bdf->glyphcnt && bytes>limit*3/4; ++gid ) {
+	if ( bdf->glyphs[gid]!=NULL && !keep[gid] ) {
+	    bytes -= BCBytes(bdf->glyphs[gid]);
+	    BDFCharFree(bdf->glyphs[gid]);
+	    bdf->glyphs[gid] = NULL;
+	}
+    }
+    free(keep);
+}
+
+static void FVRasterTick(FontView *fv) {
+    gint64 start = g_get_monotonic_time();
+    int batch = 4*FFThreadCount();
+    int32_t *encs = malloc(batch*sizeof(int32_t));
+    int *gids = malloc(batch*sizeof(int));
+    int first, last, lo, hi, i, k, cnt, enc;
+
+    fv->raster = NULL;
+    if ( fv->show==NULL || !fv->show->piecemeal || fv->colcnt==0 ) {
+	FVRasterClear(fv);
+	free(encs); free(gids);
+return;
+    }
+    do {
+	/* What's on the screen, including the half row at the bottom */
+	first = fv->rowoff*fv->colcnt;
+	last = (fv->rowoff+fv->rowcnt+1)*fv->colcnt;
+	/* Further away than the prefetch, so we've scrolled past it */
+	lo = (fv->rowoff-fv->rowcnt)*fv->colcnt;
+	hi = (fv->rowoff+2*fv->rowcnt+1)*fv->colcnt;
+	cnt = 0;
+	for ( i=0; i<fv->raster_cnt && cnt<batch; ++i ) {
+	    enc = fv->raster_queue[i];
+	    if ( enc>=first && enc<last ) {
+		encs[cnt++] = enc;
+		fv->raster_queue[i] = -1;
+	    }
+	}
+	for ( i=0; i<fv->raster_cnt && cnt<batch; ++i ) {
+	    enc = fv->raster_queue[i];
+	    if ( enc==-1 )
+	continue;
+	    if ( enc>=lo && enc<hi )
+		encs[cnt++] = enc;
+	    else
+		fv->raster_queued[enc] = false;
+	    fv->raster_queue[i] = -1;
+	}
+	for ( i=k=0; i<fv->raster_cnt; ++i )
+	    if ( fv->raster_queue[i]!=-1 )
+		fv->raster_queue[k++] = fv->raster_queue[i];
+	fv->raster_cnt = k;
+	if ( cnt==0 )
+    break;
+
+	for ( i=0; i<cnt; ++i )
+	    gids[i] = FeatureTrans(fv,encs[i]);
+	BDFPieceMealMany(fv->show,gids,cnt);
+	for ( i=0; i<cnt; ++i ) {
+	    fv->raster_queued[encs[i]] = false;
+	    if ( encs[i]>=first && encs[i]<last )
+		FVDrawGlyph(fv->v,fv,encs[i],true);
+	}
+    } while ( g_get_monotonic_time()-start < 8000 );	/* Half a frame */
+    free(encs); free(gids);
+
+    if ( fv->raster_cnt==0 )
+	FVRasterPrefetch(fv);
+    if ( fv->raster_cnt!=0 ) {
+	if ( fv->raster==NULL )
+	    fv->raster = GDrawRequestTimer(fv->v,1,0,NULL);
+    } else
+	FVRasterEvict(fv);
+}
+
 static void FVDrawGlyph(GWindow pixmap, FontView *fv, int index, int request_expose ) {
     GRect box, old2;
     int feat_gid;
@@ -286,8 +464,16 @@ static void FVDrawGlyph(GWindow pixmap, FontView *fv, int index, int request_exp
 	if ( fv->show!=NULL && fv->show->piecemeal &&
 		feat_gid!=-1 &&
 		(feat_gid>=fv->show->glyphcnt || fv->show->glyphs[feat_gid]==NULL) &&
-		fv->b.sf->glyphs[feat_gid]!=NULL )
-	    BDFPieceMeal(fv->show,feat_gid);
+		fv->b.sf->glyphs[feat_gid]!=NULL ) {
+	    /* FVRasterTick will draw it properly shortly */
+	    FVRasterQueue(fv,index);
+	    if ( SCWorthOutputting(sc) ) {
+		box.x = j*fv->cbw+3; box.width = fv->cbw-6;
+		box.y = i*fv->cbh+fv->lab_height+3; box.height = fv->cbw-5;
+		GDrawDrawRect(pixmap,&box,fvpendingcol);
+	    }
+return;
+	}
 
 	if ( fv->show!=NULL && feat_gid!=-1 &&
 		feat_gid < fv->show->glyphcnt &&
@@ -6839,6 +7025,8 @@ static void FVTimer(FontView *fv, GEvent *event) {
 		GDrawScroll(fv->v,NULL,0,dy*fv->cbh);
 	    }
 	}
+    } else if ( event->u.timer.timer==fv->raster ) {
+	FVRasterTick(fv);
     } else if ( event->u.timer.timer==fv->resize ) {
 	/* It's a delayed resize event (for kde which sends continuous resizes) */
 	fv->resize = NULL;
@@ -7280,6 +7468,7 @@ static struct resed fontview_re[] = {
     {N_("Changed Color"), "ChangedColor", rt_color, &fvchangedcol, N_("Color used to mark a changed glyph"), NULL, { 0 }, 0, 0 },
     {N_("Missing Bitmap Color"), "MissingBitmapColor", rt_color, &fvmissingbitmapcol, N_("Color used to mark a glyph with an outline and no bitmap when displaying bitmaps"), NULL, { 0 }, 0, 0 },
     {N_("Missing Outline Color"), "MissingOutlineColor", rt_color, &fvmissingoutlinecol, N_("Color used to mark a glyph with a bitmap but no outline when displaying outlines"), NULL, { 0 }, 0, 0 },
+    {N_("Pending Glyph Color"), "PendingGlyphColor", rt_color, &fvpendingcol, N_("Color used to outline a glyph slot while its image is being rasterized"), NULL, { 0 }, 0, 0 },
     {N_("Hinting Needed Color"), "HintingNeededColor", rt_color, &fvhintingneededcol, N_("Color used to mark glyphs that need hinting"), NULL, { 0 }, 0, 0 },
     {N_("Metrics Advance At Color"), "MetricsAdvanceAtColor", rt_color, &fvmetadvanceatcol, N_("Color used to draw the (vertical or) horizontal line at the advance when that metric is selected in View"), NULL, { 0 }, 0, 0 },
     {N_("Metrics Advance To Color"), "MetricsAdvanceToColor", rt_color, &fvmetadvancetocol, N_("Color used to draw the (horizontal or) vertical line from the origin to the advance when that metric is selected in View"), NULL, { 0 }, 0, 0 },
@@ -7564,6 +7753,8 @@ static void FontView_Free(FontView *fv) {
 #endif
     free(fv->b.selected);
     free(fv->fontset);
+    free(fv->raster_queue);
+    free(fv->raster_queued);
 #ifndef _NO_PYTHON
     PyFF_FreeFV(&fv->b);
 #endif
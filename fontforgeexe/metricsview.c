@@ -739,7 +739,7 @@ static void MVRefreshValues(MetricsView *mv, int i) {
     SplineChar *sc = mv->glyphs[i].sc;
     int kern_offset;
 
-    SplineCharFindBounds(sc,&bb);
+    SplineCharFindBoundsCached(sc,&bb);
 
     if( !mv->perchar[i].name )
 	return;
@@ -1159,7 +1159,7 @@ return( true );
 	    transform[0] = transform[3] = 1.0;
 	    transform[1] = transform[2] = transform[5] = 0;
 	    DBounds bb;
-	    SplineCharFindBounds(sc,&bb);
+	    SplineCharFindBoundsCached(sc,&bb);
 	    transform[4] = offset-bb.minx;
 	    FVTrans( (FontViewBase *)mv->fv,sc,transform,NULL, 0 | fvt_alllayers );
 
@@ -1198,7 +1198,7 @@ return( true );
 	double val = u_strtod(_GGadgetGetTitle(g),&end);
 	SplineChar *sc = mv->glyphs[which].sc;
 	DBounds bb;
-	SplineCharFindBounds(sc,&bb);
+	SplineCharFindBoundsCached(sc,&bb);
 	if (!isValidInt(end))
 	    GDrawBeep(NULL);
 	else if ( !mv->vertical && val!=bb.minx ) {
@@ -1241,7 +1241,7 @@ return( true );
 	int val = u_strtod(_GGadgetGetTitle(g),&end);
 	SplineChar *sc = mv->glyphs[which].sc;
 	DBounds bb;
-	SplineCharFindBounds(sc,&bb);
+	SplineCharFindBoundsCached(sc,&bb);
 	if (!isValidInt(end))
 	    GDrawBeep(NULL);
 	else if ( !mv->vertical && rint(val+bb.maxx)!=sc->width ) {
@@ -2642,7 +2642,7 @@ static int getorigin(void *d, BasePoint *base, int index) {
 	/* all done */
       break;
       case 1:		/* Center of selection */
-	SplineCharFindBounds(sc,&bb);
+	SplineCharFindBoundsCached(sc,&bb);
 	base->x = (bb.minx+bb.maxx)/2;
 	base->y = (bb.miny+bb.maxy)/2;
       break;
@@ -3419,7 +3419,7 @@ static void MVMenuCenter(GWindow gw, struct gmenuitem *mi, GEvent *UNUSED(e))
 	sc = mv->glyphs[i].sc;
 	transform[0] = transform[3] = 1.0;
 	transform[1] = transform[2] = transform[5] = 0.0;
-	SplineCharFindBounds(sc,&bb);
+	SplineCharFindBoundsCached(sc,&bb);
 	if ( mi->mid==MID_Center )
 	    transform[4] = (sc->width-(bb.maxx-bb.minx))/2 - bb.minx;
 	else
@@ -4484,7 +4484,7 @@ static void _MVSubVMouse(MetricsView *mv,GEvent *event) {
 	} else if ( mv->type!=mv_kernonly ) {
 	    real transform[6];
 	    DBounds bb;
-	    SplineCharFindBounds(sc,&bb);
+	    SplineCharFindBoundsCached(sc,&bb);
 	    transform[0] = transform[3] = 1.0;
 	    transform[1] = transform[2] = transform[4] = 0;
 	    transform[5] = -diff*
@@ -109,46 +109,6 @@ static char *cdv_4axis[3] = {
 
 static char *axistablab[] = { N_("Axis 1"), N_("Axis 2"), N_("Axis 3"), N_("Axis 4") };
 
-static int ExecConvertDesignVector(real *designs, int dcnt, char *ndv, char *cdv,
-	real *stack) {
-    char *temp, dv[101];
-    int j, len, cnt;
-
-    /* PostScript parses things in "C" locale too */
-    locale_t tmplocale; locale_t oldlocale; // Declare temporary locale storage.
-    switch_to_c_locale(&tmplocale, &oldlocale); // Switch to the C locale temporarily and cache the old locale.
-    len = 0;
-    for ( j=0; j<dcnt; ++j ) {
-	sprintf(dv+len, "%g ", (double) designs[j]);
-	len += strlen(dv+len);
-    }
-    switch_to_old_locale(&tmplocale, &oldlocale); // Switch to the cached locale.
-
-    temp = malloc(len+strlen(ndv)+strlen(cdv)+20);
-    strcpy(temp,dv);
-    /*strcpy(temp+len++," ");*/		/* dv always will end in a space */
-
-    while ( isspace(*ndv)) ++ndv;
-    if ( *ndv=='{' )
-	++ndv;
-    strcpy(temp+len,ndv);
-    len += strlen(temp+len);
-    while ( len>0 && (temp[len-1]==' '||temp[len-1]=='\n') ) --len;
-    if ( len>0 && temp[len-1]=='}' ) --len;
-
-    while ( isspace(*cdv)) ++cdv;
-    if ( *cdv=='{' )
-	++cdv;
-    strcpy(temp+len,cdv);
-    len += strlen(temp+len);
-    while ( len>0 && (temp[len-1]==' '||temp[len-1]=='\n') ) --len;
-    if ( len>0 && temp[len-1]=='}' ) --len;
-
-    cnt = EvaluatePS(temp,stack,MmMax);
-    free(temp);
-return( cnt );
-}
-
 static int StandardPositions(MMSet *mm,int instance_count, int axis_count,int isapple) {
     int i,j,factor,v;
 
@@ -437,7 +397,7 @@ return(false);
 return(false);
 	}
     } else {
-	i = ExecConvertDesignVector(blends, i, mm->ndv, mm->cdv,
+	i = MMConvertDesignVector(blends, i, mm->ndv, mm->cdv,
 		blends);
 	if ( i!=instance_count ) {
 	    ff_post_error(_("Bad MM Weights"),_("The results produced by applying the NormalizeDesignVector and ConvertDesignVector functions were not the results expected. You may need to change these functions"));
@@ -1580,7 +1540,7 @@ static void MMW_WeightsValid(MMW *mmw) {
 		    axiscoords[i] = (mmw->mm->axismaps[i].designs[0]+
 			    mmw->mm->axismaps[i].designs[mmw->mm->axismaps[i].points-1])/2;
 	    }
-	    i = ExecConvertDesignVector(axiscoords,mmw->axis_count,mmw->mm->ndv,mmw->mm->cdv,
+	    i = MMConvertDesignVector(axiscoords,mmw->axis_count,mmw->mm->ndv,mmw->mm->cdv,
 		    weights);
 	    if ( i!=mmw->instance_count ) {	/* The functions don't work */
 		for ( i=0; i<mmw->instance_count; ++i )
@@ -102,6 +102,7 @@ extern int save_to_dir;			/* in fontview, use sfdir rather than sfd */
 extern int palettes_docked;		/* in cvpalettes */
 extern int cvvisible[2], bvvisible[3];	/* in cvpalettes.c */
 extern int maxundoes;			/* in cvundoes */
+extern int undo_memory_limit, undo_compress;	/* in cvundoes */
 extern int pref_mv_shift_and_arrow_skip;         /* in metricsview.c */
 extern int pref_mv_control_shift_and_arrow_skip; /* in metricsview.c */
 extern int mv_type;                              /* in metricsview.c */
@@ -179,10 +180,13 @@ extern int ps_pointcnt;				/* from cvpalettes.c */
 extern float star_percent;			/* from cvpalettes.c */
 extern int home_char;				/* from fontview.c */
 extern int compact_font_on_open;		/* from fontview.c */
+extern int fv_raster_cache;			/* from fontview.c */
 extern int aa_pixelsize;			/* from anchorsaway.c */
 extern enum cvtools cv_b1_tool, cv_cb1_tool, cv_b2_tool, cv_cb2_tool; /* cvpalettes.c */
 extern int show_kerning_pane_in_class;		/* kernclass.c */
 extern int AutoSaveFrequency;			/* autosave.c */
+extern int AutoSaveIncremental;			/* autosave.c */
+extern int AutoSaveSync;			/* autosave.c */
 extern int UndoRedoLimitToSave;  /* sfd.c */
 extern int UndoRedoLimitToLoad;  /* sfd.c */
 extern int prefRevisionsToRetain; /* sfd.c */
@@ -193,6 +197,8 @@ extern int prefs_cv_outline_thickness; /* from charview.c */
 
 extern float OpenTypeLoadHintEqualityTolerance;  /* autohint.c */
 extern float GenerateHintWidthEqualityTolerance; /* splinesave.c */
+extern float GvarIUPTolerance; /* tottfvar.c */
+extern int GenerateGlyphCache; /* tottf.c */
 extern int warn_script_unsaved; /* fontview.c */
 extern NameList *force_names_when_opening;
 extern NameList *force_names_when_saving;
@@ -309,6 +315,8 @@ static struct prefs_list {
 #endif
 	{ N_("ExportClipboard"), pr_bool, &export_clipboard, NULL, NULL, '\0', NULL, 0, N_( "If you are running an X11 clipboard manager you might want\nto turn this off. FF can put things into its internal clipboard\nwhich it cannot export to X11 (things like copying more than\none glyph in the fontview). If you have a clipboard manager\nrunning it will force these to be exported with consequent\nloss of data.") },
 	{ N_("AutoSaveFrequency"), pr_int, &AutoSaveFrequency, NULL, NULL, '\0', NULL, 0, N_( "The number of seconds between autosaves. If you set this to 0 there will be no autosaves.") },
+	{ N_("AutoSaveIncremental"), pr_bool, &AutoSaveIncremental, NULL, NULL, '\0', NULL, 0, N_( "Only add the glyphs changed since the last autosave to the\nautosave file, rather than writing it all out each time.\nThe file is rewritten now and then to keep it small") },
+	{ N_("AutoSaveSync"), pr_int, &AutoSaveSync, NULL, NULL, '\0', NULL, 0, N_( "When to make sure autosaves have reached the disk:\n0 never, 1 when the whole file is rewritten, 2 always.\nAutosaves are written in the background either way") },
 	{ N_("RevisionsToRetain"), pr_int, &prefRevisionsToRetain, NULL, NULL, '\0', NULL, 0, N_( "When Saving, keep this number of previous versions of the file. file.sfd-01 will be the last saved file, file.sfd-02 will be the file saved before that, and so on. If you set this to 0 then no revisions will be retained.") },
 	{ N_("UndoRedoLimitToSave"), pr_int, &UndoRedoLimitToSave, NULL, NULL, '\0', NULL, 0, N_( "The number of undo and redo operations which will be saved in sfd files.\nIf you set this to 0 undo/redo information is not saved to sfd files.\nIf set to -1 then all available undo/redo information is saved without limit.") },
 	{ N_("SaveEditorState"), pr_bool, &SaveEditorState, NULL, NULL, '\0', NULL, 0, N_( "When saving, keep editor state like window size and position, selected points and references, and open glyphs.") },
@@ -339,6 +347,7 @@ static struct prefs_list {
 	{ N_("GlyphAutoGoto"), pr_bool, &cv_auto_goto, NULL, NULL, '\0', NULL, 0, N_("Typing a normal character in the glyph view window changes the window to look at that character.\nEnabling GlyphAutoGoto will disable the shortcut where holding just the ` key will enable Preview mode as long as the key is held.") },
 	{ N_("OpenCharsInNewWindow"), pr_bool, &OpenCharsInNewWindow, NULL, NULL, '\0', NULL, 0, N_("When double clicking on a character in the font view\nopen that character in a new window, otherwise\nreuse an existing one.") },
 	{ N_("FontViewMetricsViewSelectMax"), pr_int, &fvmv_selectmax, NULL, NULL, '\0', NULL, 0, N_("When characters are selected in the FontView, how many should be put into the MetricsView if you open one? Negative values mean there's no limit, which should be used sparingly.") },
+	{ N_("FontViewImageCache"), pr_int, &fv_raster_cache, NULL, NULL, '\0', NULL, 0, N_("The most memory (in megabytes) the glyph images of a font view may use.\nImages of glyphs far from the part of the font on screen are freed\nwhen there are more. 0 means no limit") },
 	PREFS_LIST_EMPTY
 },
   editing_list[] = {
@@ -351,6 +360,8 @@ static struct prefs_list {
 	{ N_("JoinSnap"), pr_real, &joinsnap, NULL, NULL, '\0', NULL, 0, N_("The Edit->Join command will join points which are this close together\nA value of 0 means they must be coincident") },
 	{ N_("CopyMetaData"), pr_bool, &copymetadata, NULL, NULL, '\0', NULL, 0, N_("When copying glyphs from the font view, also copy the\nglyphs' metadata (name, encoding, comment, etc).") },
 	{ N_("UndoDepth"), pr_int, &maxundoes, NULL, NULL, '\0', NULL, 0, N_("The maximum number of Undoes/Redoes stored in a glyph. Use -1 for infinite Undoes\n(but watch RAM consumption and use the Edit menu's Remove Undoes as needed)") },
+	{ N_("UndoMemoryLimit"), pr_int, &undo_memory_limit, NULL, NULL, '\0', NULL, 0, N_("The most memory (in megabytes) the undoes of all open fonts may use together.\nWhen there are more the oldest undoes, of whichever font,\nare dropped (the latest undo of each glyph is always kept). 0 means no limit") },
+	{ N_("CompressUndoes"), pr_bool, &undo_compress, NULL, NULL, '\0', NULL, 0, N_("Keep all but the latest undo of each glyph in a packed form\nwhich uses much less memory. This also makes scripts keep undoes") },
 	{ N_("UpdateFlex"), pr_bool, &updateflex, NULL, NULL, '\0', NULL, 0, N_("Figure out flex hints after every change") },
 	{ N_("AutoKernDialog"), pr_bool, &default_autokern_dlg, NULL, NULL, '\0', NULL, 0, N_("Open AutoKern dialog for new kerning subtables") },
 	{ N_("MetricsShiftSkip"), pr_int, &pref_mv_shift_and_arrow_skip, NULL, NULL, '\0', NULL, 0, N_("Number of units to increment/decrement a table value by in the metrics window when shift is held") },
@@ -412,7 +423,9 @@ static struct prefs_list {
     { N_("WritePNGInSFD"), pr_bool, &WritePNGInSFD, NULL, NULL, 'B', NULL, 0, N_("If your SFD contains images, write them as PNG; this results in smaller SFDs; but was not supported in FontForge versions compiled before July 2019, so older FontForge versions cannot read them.") },
 #endif
 
+	{ N_("GenerateGlyphCache"), pr_bool, &GenerateGlyphCache, NULL, NULL, '\0', NULL, 0, N_("Remember the TrueType outlines of the glyphs in the last few fonts generated, so that regenerating a font only converts the glyphs which have changed.") },
 	{ N_("GenerateHintWidthEqualityTolerance"), pr_real, &GenerateHintWidthEqualityTolerance, NULL, NULL, '\0', NULL, 0, N_( "When generating a font, ignore slight rounding errors for hints that should be at the top or bottom of the glyph. For example, you might like to set this to 0.02 so that 19.999 will be considered 20. But only for the hint width value.") },
+	{ N_("GvarIUPTolerance"), pr_real, &GvarIUPTolerance, NULL, NULL, '\0', NULL, 0, N_("When generating a TrueType distortable font, leave out of the gvar table any delta that the rasterizer can interpolate from the points around it to within this many em-units. A negative value writes every delta.") },
 	
 	PREFS_LIST_EMPTY
 },
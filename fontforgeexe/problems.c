@@ -36,6 +36,7 @@
 #include "gresedit.h"
 #include "gwidget.h"
 #include "namelist.h"
+#include "parallel.h"
 #include "splineorder2.h"
 #include "splineoverlap.h"
 #include "splinesaveafm.h"
@@ -5174,14 +5175,29 @@ return;
     GDrawPopClip(pixmap,&old);
 }
 
+static SplineChar *VWGlyph(SplineFont *sf, int gid) {
+    SplineFont *sub;
+    int k;
+
+    if ( sf->subfontcnt==0 )
+return( sf->glyphs[gid] );
+    for ( k=0; k<sf->subfontcnt; ++k ) {
+	sub = sf->subfonts[k];
+	if ( gid<sub->glyphcnt && sub->glyphs[gid]!=NULL )
+return( sub->glyphs[gid] );
+    }
+return( NULL );
+}
+
 static int VWCheckup(struct val_data *vw) {
     /* Check some glyphs to see what their validation state is or if they have*/
     /*  changed */
-    int gid, k, cnt=0;
+    int gid, cnt=0, end;
     int max;
-    SplineFont *sf=vw->sf, *sub;
-    int cntmax = vw->finished_first_pass ? 40 : 60;
-    SplineChar *sc;
+    SplineFont *sf=vw->sf;
+    /* Glyphs are validated on all processors, so each can take its share */
+    int cntmax = (vw->finished_first_pass ? 40 : 60) * FFThreadCount();
+    SplineChar *sc, **todo;
     int a_change = false;
     int firstv = true;
     char *buts[4];
@@ -5191,25 +5207,22 @@ static int VWCheckup(struct val_data *vw) {
     else
 	max = vw->cidmax;
 
+    todo = malloc(cntmax*sizeof(SplineChar *));
     for ( gid=vw->laststart; gid<max && cnt<cntmax && gid<vw->laststart+2000; ++gid ) {
-	if ( sf->subfontcnt==0 )
-	    sc = sf->glyphs[gid];
-	else {
-	    for ( k=0; k<sf->subfontcnt; ++k ) {
-		sub = sf->subfonts[k];
-		if ( gid<sub->glyphcnt && (sc = sub->glyphs[gid])!=NULL )
-	    break;
-	    }
-	}
-	if ( sc!=NULL && !(sc->layers[vw->layer].validation_state&vs_known)) {
-	    if ( firstv ) {
-		GDrawSetCursor(vw->v,ct_watch);
-		GDrawSync(NULL);
-		firstv = false;
-	    }
-	    SCValidate(sc,vw->layer,true);
-	    ++cnt;
-	}
+	if ( (sc = VWGlyph(sf,gid))!=NULL && !(sc->layers[vw->layer].validation_state&vs_known))
+	    todo[cnt++] = sc;
+    }
+    end = gid;
+    if ( cnt!=0 ) {
+	GDrawSetCursor(vw->v,ct_watch);
+	GDrawSync(NULL);
+	firstv = false;
+	SCsValidate(todo,cnt,vw->layer,true);
+    }
+    free(todo);
+
+    for ( gid=vw->laststart; gid<end; ++gid ) {
+	sc = VWGlyph(sf,gid);
 	if ( sc!=NULL && vw->need_to_check_with_user_on_mask &&
 		(sc->layers[vw->layer].validation_state&vs_nonintegral )) {
 	    vw->need_to_check_with_user_on_mask = false;
@@ -30,6 +30,7 @@
 #include "fontforgeui.h"
 #include "gkeysym.h"
 #include "gresedit.h"
+#include "parallel.h"
 #include "ustring.h"
 #include "utype.h"
 
@@ -477,6 +478,9 @@ return;
 
 static void _LogError(const char *format,va_list ap) {
     char buffer[2500], nbuffer[2600], *str, *pt, *npt;
+
+    if ( FFParallelDeferLog(format,ap) )
+return;
     vsnprintf(buffer,sizeof(buffer),format,ap);
     for ( pt=buffer, npt=nbuffer; *pt!='\0' && npt<nbuffer+sizeof(nbuffer)-2; ) {
 	*npt++ = *pt++;
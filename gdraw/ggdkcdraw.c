@@ -251,8 +251,17 @@ static void _GGDKDraw_EllipsePath(cairo_t *cc, double cx, double cy, double widt
     cairo_close_path(cc);
 }
 
-static cairo_surface_t *_GGDKDraw_GImage2Surface(GImage *image, GRect *src) {
-    struct _GImage *base = (image->list_len == 0) ? image->u.image : image->u.images[0];
+#ifndef WORDS_BIGENDIAN
+#define R2(n) n, n + 2*64, n + 1*64, n + 3*64
+#define R4(n) R2(n), R2(n + 2*16), R2(n + 1*16), R2(n + 3*16)
+#define R6(n) R4(n), R4(n + 2*4), R4(n + 1*4), R4(n + 3*4)
+static const uint8_t bitreverse[256] = { R6(0), R6(2), R6(1), R6(3) };
+#undef R2
+#undef R4
+#undef R6
+#endif
+
+static cairo_surface_t *_GGDKDraw_GImageConvert(struct _GImage *base, GRect *src) {
     cairo_format_t type;
     uint8_t *pt;
     uint32_t *idata, *ipt, *ito;
@@ -296,18 +305,15 @@ static cairo_surface_t *_GGDKDraw_GImage2Surface(GImage *image, GRect *src) {
         ipt = ((uint32_t *)(base->data + src->y * base->bytes_per_line)) + src->x;
         ito = idata;
         for (i = 0; i < src->height; ++i) {
+            /* No branches, so the compiler can vectorize this. When alpha */
+            /*  is 0 or 0xff the products come out as 0 or the channel anyway */
             for (j = 0; j < src->width; ++j) {
                 uint32_t orig = ipt[j];
-                int alpha = orig >> 24;
-                if (alpha == 0xff) {
-                    ito[j] = orig;
-                } else if (alpha == 0) {
-                    ito[j] = 0x00000000;
-                } else
-                    ito[j] = (alpha << 24) |
-                             ((COLOR_RED(orig) * alpha / 255) << 16) |
-                             ((COLOR_GREEN(orig) * alpha / 255) << 8) |
-                             ((COLOR_BLUE(orig) * alpha / 255));
+                uint32_t alpha = orig >> 24;
+                ito[j] = (alpha << 24) |
+                         ((COLOR_RED(orig) * alpha / 255) << 16) |
+                         ((COLOR_GREEN(orig) * alpha / 255) << 8) |
+                         ((COLOR_BLUE(orig) * alpha / 255));
             }
             ipt = (uint32_t *)(((uint8_t *) ipt) + base->bytes_per_line);
             ito = (uint32_t *)(((uint8_t *) ito) + stride);
@@ -318,11 +324,8 @@ static cairo_surface_t *_GGDKDraw_GImage2Surface(GImage *image, GRect *src) {
         ito = idata;
         for (i = 0; i < src->height; ++i) {
             for (j = 0; j < src->width; ++j) {
-                if (ipt[j] == trans) {
-                    ito[j] = 0x00000000;
-                } else {
-                    ito[j] = ipt[j] | 0xff000000;
-                }
+                uint32_t pix = ipt[j];
+                ito[j] = (pix == trans) ? 0x00000000 : (pix | 0xff000000);
             }
             ipt = (uint32_t *)(((uint8_t *) ipt) + base->bytes_per_line);
             ito = (uint32_t *)(((uint8_t *) ito) + stride);
@@ -337,37 +340,47 @@ static cairo_surface_t *_GGDKDraw_GImage2Surface(GImage *image, GRect *src) {
             ipt = (uint32_t *)(((uint8_t *) ipt) + base->bytes_per_line);
             ito = (uint32_t *)(((uint8_t *) ito) + stride);
         }
-    } else if (base->image_type == it_index && base->clut->trans_index != COLOR_UNKNOWN) {
-        int trans = base->clut->trans_index;
-        Color *clut = base->clut->clut;
+    } else if (base->image_type == it_index) {
+        /* Fold the alpha channel and the transparent index into the clut */
+        /*  so each pixel is a single lookup */
+        uint32_t lut[256];
+        for (i = 0; i < 256; ++i) {
+            /* In theory RGB24 images don't need the alpha channel set*/
+            /*  but there is a bug in Cairo 1.2, and they do. */
+            lut[i] = base->clut->clut[i] | 0xff000000;
+        }
+        if (base->clut->trans_index != COLOR_UNKNOWN && base->clut->trans_index < 256) {
+            lut[base->clut->trans_index] = 0x00000000;
+        }
         pt = base->data + src->y * base->bytes_per_line + src->x;
         ito = idata;
         for (i = 0; i < src->height; ++i) {
             for (j = 0; j < src->width; ++j) {
-                int index = pt[j];
-                if (index == trans) {
-                    ito[j] = 0x00000000;
-                } else
-                    /* In theory RGB24 images don't need the alpha channel set*/
-                    /*  but there is a bug in Cairo 1.2, and they do. */
-                {
-                    ito[j] = clut[index] | 0xff000000;
-                }
+                ito[j] = lut[pt[j]];
             }
             pt += base->bytes_per_line;
             ito = (uint32_t *)(((uint8_t *) ito) + stride);
         }
-    } else if (base->image_type == it_index) {
-        Color *clut = base->clut->clut;
-        pt = base->data + src->y * base->bytes_per_line + src->x;
-        ito = idata;
+    } else if (base->image_type == it_mono && base->clut != NULL &&
+               base->clut->trans_index != COLOR_UNKNOWN && (src->x & 7) == 0) {
+        /* Byte aligned, so whole bytes of the bitmap become bytes of the */
+        /*  mask (cairo wants the first pixel in the low bit on little endian */
+        /*  machines, the high bit on big endian ones) */
+        uint8_t flip = base->clut->trans_index == 0 ? 0x00 : 0xff;
+        uint8_t *bto;
+        int bcnt = (src->width + 7) >> 3;
+        pt = base->data + src->y * base->bytes_per_line + (src->x >> 3);
+        bto = (uint8_t *) idata;
         for (i = 0; i < src->height; ++i) {
-            for (j = 0; j < src->width; ++j) {
-                int index = pt[j];
-                ito[j] = clut[index] | 0xff000000;
+            for (j = 0; j < bcnt; ++j) {
+#ifdef WORDS_BIGENDIAN
+                bto[j] = pt[j] ^ flip;
+#else
+                bto[j] = bitreverse[pt[j]] ^ flip;
+#endif
             }
             pt += base->bytes_per_line;
-            ito = (uint32_t *)(((uint8_t *) ito) + stride);
+            bto += stride;
         }
 #ifdef WORDS_BIGENDIAN
     } else if (base->image_type == it_mono && base->clut != NULL &&
@@ -469,16 +482,13 @@ static cairo_surface_t *_GGDKDraw_GImage2Surface(GImage *image, GRect *src) {
         /*  but there is a bug in Cairo 1.2, and they do. */
         fg |= 0xff000000;
         bg |= 0xff000000;
+        int sx = src->x & 7;
         pt = base->data + src->y * base->bytes_per_line + (src->x >> 3);
         ito = idata;
         for (i = 0; i < src->height; ++i) {
-            bit = (0x80 >> (src->x & 0x7));
-            for (j = jj = 0; j < src->width; ++j) {
-                ito[j] = (pt[jj] & bit) ? fg : bg;
-                if ((bit >>= 1) == 0) {
-                    bit = 0x80;
-                    ++jj;
-                }
+            for (j = 0; j < src->width; ++j) {
+                uint32_t on = (pt[(j + sx) >> 3] >> (7 - ((j + sx) & 7))) & 1;
+                ito[j] = bg ^ ((fg ^ bg) & -on);
             }
             pt += base->bytes_per_line;
             ito = (uint32_t *)(((uint8_t *) ito) + stride);
@@ -488,13 +498,154 @@ static cairo_surface_t *_GGDKDraw_GImage2Surface(GImage *image, GRect *src) {
     return cs;
 }
 
+/* Converting an image to a cairo surface can cost more than drawing it, */
+/*  and the same large images (background images, magnified bitmaps) are */
+/*  drawn on every expose. So keep the last few surfaces made from large  */
+/*  images. A GImage doesn't know when it has been modified (and is often */
+/*  a temporary on the stack wrapping someone else's pixels), so an entry */
+/*  is only reused while a fingerprint of those pixels and the clut still */
+/*  matches, which is much cheaper than converting them again */
+#define GIMAGE_CACHE_SIZE       16
+#define GIMAGE_CACHE_MIN_AREA   (128*128)
+#define GIMAGE_CACHE_MAX_BYTES  (32<<20)
+
+static struct gimage_cache_entry {
+    const struct _GImage *base;
+    const uint8_t *data;
+    GRect src;
+    uint64_t fingerprint;
+    cairo_surface_t *cs;
+    size_t bytes;
+    uint32_t last_used;
+} gimage_cache[GIMAGE_CACHE_SIZE];
+static uint32_t gimage_cache_clock;
+static size_t gimage_cache_bytes;
+
+static uint64_t _GGDKDraw_HashBytes(uint64_t h, const uint8_t *pt, size_t len) {
+    uint64_t w;
+
+    for (; len >= 8; pt += 8, len -= 8) {
+        memcpy(&w, pt, 8);
+        h = (h ^ w) * 0x100000001b3ULL;
+        h ^= h >> 29;
+    }
+    for (; len > 0; ++pt, --len) {
+        h = (h ^ *pt) * 0x100000001b3ULL;
+    }
+    return h;
+}
+
+static uint64_t _GGDKDraw_GImageFingerprint(struct _GImage *base, GRect *src) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    int32_t hdr[4];
+    size_t off, len;
+    int i;
+
+    hdr[0] = base->image_type;
+    hdr[1] = base->trans;
+    hdr[2] = base->clut == NULL ? -1 : base->clut->trans_index;
+    hdr[3] = base->bytes_per_line;
+    h = _GGDKDraw_HashBytes(h, (const uint8_t *) hdr, sizeof(hdr));
+    if (base->clut != NULL) {
+        h = _GGDKDraw_HashBytes(h, (const uint8_t *) base->clut->clut, sizeof(base->clut->clut));
+    }
+    if (base->image_type == it_mono) {
+        off = src->x >> 3;
+        len = ((src->x + src->width + 7) >> 3) - off;
+    } else if (base->image_type == it_index) {
+        off = src->x;
+        len = src->width;
+    } else {
+        off = 4 * src->x;
+        len = 4 * src->width;
+    }
+    for (i = 0; i < src->height; ++i) {
+        h = _GGDKDraw_HashBytes(h, base->data + (src->y + i) * base->bytes_per_line + off, len);
+    }
+    return h;
+}
+
+static cairo_surface_t *_GGDKDraw_GImage2Surface(GImage *image, GRect *src) {
+    struct _GImage *base = (image->list_len == 0) ? image->u.image : image->u.images[0];
+    struct gimage_cache_entry *ent, *lru;
+    uint64_t fingerprint;
+    cairo_surface_t *cs;
+    size_t bytes;
+    int i;
+
+    /* Opaque true colour images are drawn straight from their own data */
+    if ((base->image_type == it_true && base->trans == COLOR_UNKNOWN) ||
+            src->width * src->height < GIMAGE_CACHE_MIN_AREA) {
+        return _GGDKDraw_GImageConvert(base, src);
+    }
+
+    fingerprint = _GGDKDraw_GImageFingerprint(base, src);
+    for (i = 0; i < GIMAGE_CACHE_SIZE; ++i) {
+        ent = &gimage_cache[i];
+        if (ent->cs != NULL && ent->base == base && ent->data == base->data &&
+                ent->fingerprint == fingerprint &&
+                ent->src.x == src->x && ent->src.y == src->y &&
+                ent->src.width == src->width && ent->src.height == src->height) {
+            ent->last_used = ++gimage_cache_clock;
+            return cairo_surface_reference(ent->cs);
+        }
+    }
+
+    cs = _GGDKDraw_GImageConvert(base, src);
+    bytes = (size_t) cairo_image_surface_get_stride(cs) * src->height;
+    if (bytes > GIMAGE_CACHE_MAX_BYTES / 2) {
+        return cs;
+    }
+    do {
+        /* Free the least recently used entry, or find an empty one */
+        lru = &gimage_cache[0];
+        for (i = 0; i < GIMAGE_CACHE_SIZE; ++i) {
+            ent = &gimage_cache[i];
+            if (ent->cs == NULL) {
+                lru = ent;
+                break;
+            } else if (ent->last_used < lru->last_used) {
+                lru = ent;
+            }
+        }
+        if (lru->cs != NULL) {
+            cairo_surface_destroy(lru->cs);
+            gimage_cache_bytes -= lru->bytes;
+            lru->cs = NULL;
+        } else if (gimage_cache_bytes + bytes > GIMAGE_CACHE_MAX_BYTES) {
+            /* An empty slot, but still too much in the others */
+            lru = NULL;
+            for (i = 0; i < GIMAGE_CACHE_SIZE; ++i) {
+                ent = &gimage_cache[i];
+                if (ent->cs != NULL && (lru == NULL || ent->last_used < lru->last_used)) {
+                    lru = ent;
+                }
+            }
+            cairo_surface_destroy(lru->cs);
+            gimage_cache_bytes -= lru->bytes;
+            lru->cs = NULL;
+        }
+    } while (gimage_cache_bytes + bytes > GIMAGE_CACHE_MAX_BYTES);
+    lru->base = base;
+    lru->data = base->data;
+    lru->src = *src;
+    lru->fingerprint = fingerprint;
+    lru->cs = cairo_surface_reference(cs);
+    lru->bytes = bytes;
+    lru->last_used = ++gimage_cache_clock;
+    gimage_cache_bytes += bytes;
+    return cs;
+}
+
 static GImage *_GGDKDraw_GImageExtract(struct _GImage *base, GRect *src, GRect *size,
                                        double xscale, double yscale) {
     static GImage temp;
     static struct _GImage tbase;
     static uint8_t *data;
     static int dlen;
-    int r, c;
+    static int *cols;
+    static int clen;
+    int r, c, prev_or;
 
     memset(&temp, 0, sizeof(temp));
     tbase = *base;
@@ -515,38 +666,44 @@ static GImage *_GGDKDraw_GImageExtract(struct _GImage *base, GRect *src, GRect *
 
     /* I used to use rint(x). Now I use floor(x). For normal images rint */
     /*  might be better, but for text we need floor */
+    /* Every row samples the same columns, so work them out once. And when */
+    /*  magnified several rows in a row come from the same source row, */
+    /*  those are just copies of the first */
+    if (size->width > clen) {
+        cols = realloc(cols, (clen = size->width) * sizeof(int));
+    }
+    for (c = 0; c < size->width; ++c) {
+        cols[c] = ((int) floor((c + size->x) / xscale));
+    }
+    prev_or = -1;
 
     if (base->image_type == it_mono) {
         memset(data, 0, tbase.height * tbase.bytes_per_line);
-        for (r = 0; r < size->height; ++r) {
-            int or = ((int) floor((r + size->y) / yscale));
-            uint8_t *pt = data + r * tbase.bytes_per_line;
-            uint8_t *opt = base->data + or * base->bytes_per_line;
+    }
+    for (r = 0; r < size->height; ++r) {
+        int or = ((int) floor((r + size->y) / yscale));
+        uint8_t *pt = data + r * tbase.bytes_per_line;
+        uint8_t *opt = base->data + or * base->bytes_per_line;
+        if (or == prev_or) {
+            memcpy(pt, pt - tbase.bytes_per_line, tbase.bytes_per_line);
+            continue;
+        }
+        prev_or = or;
+        if (base->image_type == it_mono) {
             for (c = 0; c < size->width; ++c) {
-                int oc = ((int) floor((c + size->x) / xscale));
+                int oc = cols[c];
                 if (opt[oc >> 3] & (0x80 >> (oc & 7))) {
                     pt[c >> 3] |= (0x80 >> (c & 7));
                 }
             }
-        }
-    } else if (base->image_type == it_index) {
-        for (r = 0; r < size->height; ++r) {
-            int or = ((int) floor((r + size->y) / yscale));
-            uint8_t *pt = data + r * tbase.bytes_per_line;
-            uint8_t *opt = base->data + or * base->bytes_per_line;
+        } else if (base->image_type == it_index) {
             for (c = 0; c < size->width; ++c) {
-                int oc = ((int) floor((c + size->x) / xscale));
-                *pt++ = opt[oc];
+                pt[c] = opt[cols[c]];
             }
-        }
-    } else {
-        for (r = 0; r < size->height; ++r) {
-            int or = ((int) floor((r + size->y) / yscale));
-            uint32_t *pt = (uint32_t *)(data + r * tbase.bytes_per_line);
-            uint32_t *opt = (uint32_t *)(base->data + or * base->bytes_per_line);
+        } else {
+            uint32_t *ipt = (uint32_t *) pt, *iopt = (uint32_t *) opt;
             for (c = 0; c < size->width; ++c) {
-                int oc = ((int) floor((c + size->x) / xscale));
-                *pt++ = opt[oc];
+                ipt[c] = iopt[cols[c]];
             }
         }
     }
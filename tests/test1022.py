@@ -0,0 +1,74 @@
+#Needs: fonts/Ambrosia.sfd
+
+# Bulk point array access
+
+import sys, fontforge
+
+font = fontforge.open(sys.argv[1])
+
+# Round trip every glyph through the glyph level arrays
+for name in font:
+    g = font[name]
+    coords, flags, ends = g.getPointArrays()
+    assert len(coords) == 2*len(flags)
+    fore = g.foreground
+    assert len(ends) == len(fore)
+    pts = [ p for c in fore for p in c ]
+    assert len(pts) == len(flags)
+    for i, p in enumerate(pts):
+        assert (p.x, p.y) == (coords[2*i], coords[2*i+1])
+        assert p.on_curve == bool(flags[i] & 1)
+    g.setPointArrays(coords, flags, ends)
+    assert g.getPointArrays() == (coords, flags, ends)
+
+# Font level arrays match the per glyph ones
+coords, flags, ends, glyph_ends = font.getPointArrays()
+names = list(font)
+assert len(glyph_ends) == len(names)
+start = 0
+for i, name in enumerate(names):
+    gcoords, gflags, gends = font[name].getPointArrays()
+    assert len(gends) == glyph_ends[i] - start
+    start = glyph_ends[i]
+
+# Writing back a shifted copy moves every glyph
+shifted = [ c+10 for c in coords ]
+font.setPointArrays(shifted, flags, ends, glyph_ends)
+assert list(font.getPointArrays()[0]) == shifted
+
+# A subset by name, in the given order
+sub = font.getPointArrays(("b", "a"))
+assert sub[0].tolist() == list(font["b"].getPointArrays()[0]) + list(font["a"].getPointArrays()[0])
+
+# Quadratic contours with implied on-curve points
+font.is_quadratic = True
+g = font["a"]
+coords, flags, ends = g.getPointArrays()
+g.setPointArrays(coords, flags, ends)
+assert g.getPointArrays()[0] == coords
+
+# Bad input is rejected without touching the glyph
+try:
+    g.setPointArrays([0, 0, 10, 10], [1, 1], [5])
+    raise AssertionError("Bad contour ends accepted")
+except ValueError:
+    pass
+assert g.getPointArrays()[0] == coords
+
+# The arrays are a copy, writing to them leaves the glyph alone
+coords = g.getPointArrays()[0]
+coords[0] += 50
+assert g.getPointArrays()[0][0] == coords[0] - 50
+
+# Setting the arrays can be undone
+fontforge.setPrefs("CompressUndoes", True)
+g = font["b"]
+orig = g.getPointArrays()
+coords, flags, ends = orig
+g.setPointArrays([ c+20 for c in coords ], flags, ends)
+g.doUndoLayer(1)
+assert g.getPointArrays() == orig
+coords, flags, ends, glyph_ends = font.getPointArrays(("a", "b"))
+font.setPointArrays([ c-20 for c in coords ], flags, ends, glyph_ends, ("a", "b"))
+font["b"].doUndoLayer(1)
+assert font["b"].getPointArrays() == orig
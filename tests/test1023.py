@@ -0,0 +1,53 @@
+#Needs: fonts/Ambrosia.sfd
+
+# Packed undoes survive undo and redo, and are reported per font
+
+import sys, fontforge, psMat
+
+fontforge.setPrefs("CompressUndoes", True)
+font = fontforge.open(sys.argv[1])
+
+g = font["A"]
+orig = g.getPointArrays()
+seen = [orig]
+for i in range(4):
+    g.preserveLayerAsUndo()
+    g.transform(psMat.translate(10, 5))
+    seen.append(g.getPointArrays())
+
+size, cnt = font.undoMemory()
+assert cnt >= 4 and size > 0
+
+for i in range(cnt):
+    g.doUndoLayer(1)
+    assert g.getPointArrays() in seen
+assert g.getPointArrays() == orig
+
+for i in range(cnt):
+    g.doUndoLayer(1, True)
+assert g.getPointArrays() == seen[-1]
+
+font.close()
+
+# The memory limit covers the undoes of every font. Build up undoes in one
+#  font without a limit, then an edit to another font drops them
+def polygon(n, shift):
+    coords = []
+    for i in range(n):
+        coords += [shift + (i % 100)*10, (i // 100)*10 + (i % 2)]
+    return coords, [1]*n, [n-1]
+
+older = fontforge.font()
+g = older.createChar(0x41, "A")
+for i in range(4):
+    g.setPointArrays(*polygon(20000, i))
+assert older.undoMemory()[1] == 4
+
+fontforge.setPrefs("UndoMemoryLimit", 1)
+newer = fontforge.font()
+newer.createChar(0x41, "A").setPointArrays(*polygon(4, 0))
+assert older.undoMemory()[1] == 1
+assert newer.undoMemory()[1] == 1
+fontforge.setPrefs("UndoMemoryLimit", 0)
+newer.close()
+older.close()
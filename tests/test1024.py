@@ -0,0 +1,32 @@
+#Needs: fonts/Ambrosia.sfd
+
+# Comparing fonts skips identical glyphs and reports the rest in glyph order
+
+import os, sys, tempfile, fontforge, psMat
+
+font1 = fontforge.open(sys.argv[1])
+font2 = fontforge.open(sys.argv[1])
+
+def compare():
+    fd, name = tempfile.mkstemp(suffix=".txt")
+    os.close(fd)
+    ret = font2.compareFonts(font1, name, ("outlines", "hints"))
+    with open(name, encoding="utf-8") as f:
+        report = f.read()
+    os.remove(name)
+    return ret, report
+
+ret, report = compare()
+assert ret == 0, report
+assert "Glyph Differences" not in report
+
+changed = [g.glyphname for g in font2.glyphs() if not g.foreground.isEmpty()][-3:]
+for name in changed:
+    font2[name].transform(psMat.translate(7, 0))
+
+ret, report = compare()
+assert ret != 0
+pos = [report.find("“%s”" % name) for name in changed]
+assert all(p >= 0 for p in pos), report
+assert pos == sorted(pos), report
+assert compare() == (ret, report)
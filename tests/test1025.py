@@ -0,0 +1,51 @@
+# Replacing outlines with references only touches glyphs which contain them
+
+import fontforge
+
+def square(x, y, size):
+    c = fontforge.contour()
+    c.moveTo(x, y)
+    c.lineTo(x, y + size)
+    c.lineTo(x + size, y + size)
+    c.lineTo(x + size, y)
+    c.closed = True
+    return c
+
+def triangle(x, y):
+    c = fontforge.contour()
+    c.moveTo(x, y)
+    c.lineTo(x + 50, y + 100)
+    c.lineTo(x + 100, y)
+    c.closed = True
+    return c
+
+font = fontforge.font()
+shapes = {
+    "a": [square(0, 0, 200), triangle(300, 0)],
+    "b": [square(100, 50, 200), triangle(400, 50)],
+    "c": [square(100, 50, 200), triangle(400, 50), square(600, 600, 30)],
+    "d": [square(100, 50, 250), triangle(450, 50)],
+    "e": [square(100, 50, 200)],
+}
+for name, contours in shapes.items():
+    g = font.createChar(-1, name)
+    layer = fontforge.layer()
+    for c in contours:
+        layer += c
+    g.foreground = layer
+
+font.selection.select("a")
+font.replaceWithReference()
+
+assert [r[0] for r in font["b"].references] == ["a"]
+assert len(font["b"].foreground) == 0
+assert [r[0] for r in font["c"].references] == ["a"]
+assert len(font["c"].foreground) == 1
+for name in ("d", "e"):
+    assert font[name].references == ()
+    assert len(font[name].foreground) == len(shapes[name])
+
+# The pattern is found wherever it was moved to, and only there
+font.replaceAll(square(0, 0, 200), square(0, 0, 180))
+assert font["e"].foreground[0].boundingBox() == (100, 50, 280, 230)
+assert font["d"].foreground[0].boundingBox() == (100, 50, 350, 300)
@@ -0,0 +1,49 @@
+# Validation reports the problems of each glyph, whichever thread found them
+
+import fontforge
+
+def square(x, y, size, closed=True):
+    c = fontforge.contour()
+    c.moveTo(x, y)
+    c.lineTo(x, y + size)
+    c.lineTo(x + size, y + size)
+    c.lineTo(x + size, y)
+    c.closed = closed
+    return c
+
+font = fontforge.font()
+for i in range(600):
+    g = font.createChar(0x4e00 + i, "uni%04X" % (0x4e00 + i))
+    l = fontforge.layer()
+    l += square(100, 100, 500, i % 7 != 3)
+    g.foreground = l
+    g.width = 700
+
+dup = font.createChar(-1, "dupe")
+dup.unicode = 0x4e00
+l = fontforge.layer()
+l += square(100, 100, 500)
+dup.foreground = l
+dup.width = 700
+
+mask = font.validate(True)
+report = font.validationReport()
+
+for i in range(600):
+    name = "uni%04X" % (0x4e00 + i)
+    if i % 7 == 3:
+        assert "open-contour" in report[name], (name, report.get(name))
+    elif i != 0:
+        assert name not in report, (name, report[name])
+assert "duplicate-unicode" in report["dupe"], report.get("dupe")
+assert "duplicate-unicode" in report["uni4E00"], report.get("uni4E00")
+
+# The mask of the whole font covers what the report lists, and forcing the
+# validation again gives the same answer
+for name, problems in report.items():
+    assert problems and all(isinstance(p, str) for p in problems)
+    assert (font[name].validation_state & mask) == (font[name].validation_state & ~1)
+assert font.validationReport(True) == report
+assert font.validate(True) == mask
+
+font.close()
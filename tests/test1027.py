@@ -0,0 +1,48 @@
+# Feature file export, with and without gathering glyphs with shared anchors
+
+import os, sys, tempfile, fontforge
+
+def makefont():
+    font = fontforge.font()
+    for u in list(range(ord("A"), ord("Z")+1)) + list(range(ord("a"), ord("z")+1)) + list(range(0x300, 0x305)):
+        font.createChar(u)
+    return font
+
+def anchors(font):
+    return sorted((g.glyphname, a) for g in font.glyphs() for a in g.anchorPoints)
+
+def possubs(font):
+    return sorted((g.glyphname, p[1:]) for g in font.glyphs() for p in g.getPosSub("*"))
+
+font = makefont()
+scripts = (("latn", ("dflt",)),)
+font.addLookup("marks", "gpos_mark2base", (), (("mark", scripts),))
+font.addLookupSubtable("marks", "marks-1")
+font.addAnchorClass("marks-1", "top")
+font.addLookup("pairs", "gpos_pair", (), (("kern", scripts),))
+font.addLookupSubtable("pairs", "pairs-1")
+font.addLookup("singles", "gsub_single", (), (("smcp", scripts),))
+font.addLookupSubtable("singles", "singles-1")
+for u in range(0x300, 0x305):
+    font[u].addAnchorPoint("top", "mark", 250, 500)
+for u in range(ord("A"), ord("Z")+1):
+    g = font[u]
+    g.addAnchorPoint("top", "base", 300 if u%3 else 200, 700)
+    g.addPosSub("pairs-1", "V", -(u%7+1)*10)
+    g.addPosSub("singles-1", fontforge.nameFromUnicode(u+32))
+
+tmpdir = tempfile.mkdtemp()
+results = []
+for fast in (False, True):
+    fea = os.path.join(tmpdir, "fast.fea" if fast else "slow.fea")
+    font.generateFeatureFile(fea, fast=fast)
+    copy = makefont()
+    copy.mergeFeature(fea)
+    results.append((anchors(copy), possubs(copy), os.path.getsize(fea)))
+
+slow, fast = results
+assert slow[0] == anchors(font)
+assert slow[0] == fast[0]
+assert len(slow[1]) == len(possubs(font))
+assert slow[1] == fast[1]
+assert fast[2] > slow[2]
@@ -0,0 +1,40 @@
+#Needs: fonts/Ambrosia.sfd
+
+# Regenerating a TrueType font reuses the outlines of unchanged glyphs
+
+import os, sys, tempfile, fontforge, psMat
+
+font = fontforge.open(sys.argv[1])
+tmpdir = tempfile.mkdtemp()
+
+def generate(name):
+    path = os.path.join(tmpdir, name)
+    font.generate(path)
+    with open(path, "rb") as f:
+        return f.read()
+
+fontforge.setPrefs("GenerateGlyphCache", False)
+fontforge.clearGlyphCache()
+plain = generate("plain.ttf")
+assert fontforge.glyphCacheStats() == (0, 0, 0)
+
+fontforge.setPrefs("GenerateGlyphCache", True)
+first = generate("first.ttf")
+hits, misses, entries = fontforge.glyphCacheStats()
+assert hits == 0 and misses > 0 and 0 < entries <= misses
+
+second = generate("second.ttf")
+hits, misses2, entries2 = fontforge.glyphCacheStats()
+assert hits == misses and misses2 == misses and entries2 == entries
+assert plain == first == second
+
+name = [g.glyphname for g in font.glyphs() if not g.foreground.isEmpty()][-1]
+font[name].transform(psMat.translate(7, 0))
+generate("third.ttf")
+hits2, misses3, entries3 = fontforge.glyphCacheStats()
+assert misses3 > misses and hits2 > hits
+assert (hits2-hits) + (misses3-misses) == misses
+
+fontforge.clearGlyphCache()
+assert fontforge.glyphCacheStats() == (0, 0, 0)
+fontforge.setPrefs("GenerateGlyphCache", False)
@@ -0,0 +1,184 @@
+# Compacted class kerning in the GPOS table keeps every pair's kerning
+
+import os, re, struct, tempfile, fontforge
+
+tmpdir = tempfile.mkdtemp()
+
+def new_font(names):
+    font = fontforge.font()
+    for i, name in enumerate(names):
+        font.createChar(0xe000+i, name).width = 500
+    font.addLookup("kern", "gpos_pair", (), (("kern", (("latn", ("dflt",)),)),))
+    return font
+
+def kerning(font, seconds):
+    """The kerning of every pair whose second glyph is listed, as it will
+       be applied: the first subtable covering the first glyph wins"""
+    result = {}
+    for lookup in font.gpos_lookups:
+        for sub in font.getLookupSubtables(lookup):
+            if font.isKerningClass(sub):
+                f, s, o = font.getKerningClass(sub)
+                column = {}
+                for j, sc in enumerate(s):
+                    for second in sc or ():
+                        column[second] = j
+                for i, fc in enumerate(f):
+                    for first in fc or ():
+                        for second in seconds:
+                            if (first, second) not in result:
+                                result[first, second] = o[i*len(s)+column.get(second, 0)]
+            else:
+                for g in font.glyphs():
+                    for p in g.getPosSub(sub):
+                        if (g.glyphname, p[2]) not in result:
+                            result[g.glyphname, p[2]] = p[5]
+    return dict((k, v) for k, v in result.items() if v != 0)
+
+def pair_subtables(otf):
+    """The 'GPOS' table, and the offset in it of each pair positioning
+       subtable (looking through extension lookups)"""
+    with open(otf, "rb") as f:
+        data = f.read()
+    for i in range(struct.unpack(">H", data[4:6])[0]):
+        tag, _, off, length = struct.unpack(">4sLLL", data[12+16*i:28+16*i])
+        if tag == b"GPOS":
+            gpos = data[off:off+length]
+    u16 = lambda off: struct.unpack(">H", gpos[off:off+2])[0]
+    subs = []
+    lookups = u16(8)
+    for i in range(u16(lookups)):
+        lookup = lookups + u16(lookups+2+2*i)
+        for j in range(u16(lookup+4)):
+            sub = lookup + u16(lookup+6+2*j)
+            kind = u16(lookup)
+            if kind == 9:
+                _, kind, off = struct.unpack(">HHL", gpos[sub:sub+8])
+                sub += off
+            if kind == 2:
+                subs.append(sub)
+    return gpos, subs
+
+def formats(otf):
+    gpos, subs = pair_subtables(otf)
+    return [struct.unpack(">H", gpos[sub:sub+2])[0] for sub in subs]
+
+def round_trip(font, name, seconds):
+    """Generates the font and checks its kerning survives being read back.
+       Returns the file generated and the formats of its pair subtables"""
+    otf = os.path.join(tmpdir, name + ".otf")
+    font.generate(otf)
+    copy = fontforge.open(otf)
+    assert kerning(copy, seconds) == kerning(font, seconds), name
+    copy.close()
+    return otf, formats(otf)
+
+uppers = [chr(c) for c in range(ord("A"), ord("Z")+1)]
+lowers = [chr(c) for c in range(ord("a"), ord("z")+1)]
+
+# Rows repeat and most columns are empty, so the classes should shrink
+font = new_font(uppers + lowers)
+firsts = (None,) + tuple((c,) for c in uppers)
+seconds = (None,) + tuple((c,) for c in lowers)
+offsets = []
+for i in range(len(firsts)):
+    for j in range(len(seconds)):
+        if i == 0 or j == 0 or j > 6:
+            offsets.append(0)
+        else:
+            offsets.append(-10*((i % 3)+1)*(j % 2))
+font.addKerningClass("kern", "kern-1", firsts, seconds, tuple(offsets))
+otf, fmts = round_trip(font, "compact", lowers)
+assert fmts == [2]
+copy = fontforge.open(otf)
+subs = copy.getLookupSubtables(copy.gpos_lookups[0])
+assert len(subs) == 1 and copy.isKerningClass(subs[0])
+f, s, o = copy.getKerningClass(subs[0])
+assert len(f) == 3 and len(s) == 2
+copy.close()
+font.close()
+
+# A single kerning pair is smaller written as glyph pairs
+font = new_font(uppers + lowers)
+sparse = [0]*(len(firsts)*len(seconds))
+sparse[1*len(seconds)+1] = -50
+font.addKerningClass("kern", "kern-1", firsts, seconds, tuple(sparse))
+otf, fmts = round_trip(font, "pairs", lowers)
+assert fmts == [1]
+assert kerning(font, lowers) == {("A", "a"): -50}
+
+# But not when a later subtable could then match pairs the class covers
+bs = [0]*(len(firsts)*len(seconds))
+bs[2*len(seconds)+2] = -30
+bs[3*len(seconds)+3] = -40
+font.addKerningClass("kern", "kern-2", firsts, seconds, tuple(bs), "kern-1")
+otf, fmts = round_trip(font, "shadowed", lowers)
+assert fmts == [2, 1]
+assert kerning(font, lowers) == {("A", "a"): -50}
+font.close()
+
+# Identical device tables are written once. The python interface can't
+#  set them, so add them to the saved kerning class
+font = new_font(["A", "B", "C", "a", "b", "c"])
+d1, d2 = "{12-13 1,2}", "{9-10 -1,-1}"
+cells = [(0, "{}"), (0, "{}"), (0, "{}"), (0, "{}"),
+         (0, "{}"), (-20, d1), (-30, d2), (-40, "{}"),
+         (0, "{}"), (-20, d1), (-30, "{}"), (-45, d2),
+         (0, "{}"), (-25, d1), (-30, d2), (-40, d1)]
+font.addKerningClass("kern", "kern-1", (None, ("A",), ("B",), ("C",)),
+                     (None, ("a",), ("b",), ("c",)), tuple(c[0] for c in cells))
+sfd = os.path.join(tmpdir, "devtab.sfd")
+font.save(sfd)
+font.close()
+with open(sfd) as f:
+    text = f.read()
+line = "".join(" %d %s" % c for c in cells)
+text, n = re.subn(r"^(?: -?\d+ \{[^}]*\})+$", line, text, flags=re.M)
+assert n == 1
+with open(sfd, "w") as f:
+    f.write(text)
+font = fontforge.open(sfd)
+otf, fmts = round_trip(font, "devtab", ["a", "b", "c"])
+font.close()
+assert fmts == [2]
+gpos, subs = pair_subtables(otf)
+vf1, vf2, c1, c2 = struct.unpack(">HH4xHH", gpos[subs[0]+4:subs[0]+16])
+assert vf1 == 0x44 and vf2 == 0 and c1*c2 >= 9
+records = struct.unpack(">%dH" % (2*c1*c2), gpos[subs[0]+16:subs[0]+16+4*c1*c2])
+devtabs = [d for d in records[1::2] if d != 0]
+assert len(devtabs) == 7 and len(set(devtabs)) == 2
+copy = fontforge.open(otf)
+copy.save(sfd)
+copy.close()
+with open(sfd) as f:
+    text = f.read()
+assert text.count(d1) == 4 and text.count(d2) == 3
+
+# Too many distinct rows and columns for one subtable's 16 bit offsets.
+#  Every row and column kerns differently, so nothing can be merged
+fnames = ["f%d" % i for i in range(180)]
+snames = ["s%d" % j for j in range(199)]
+font = new_font(fnames + snames)
+firsts = (None,) + tuple((n,) for n in fnames)
+seconds = (None,) + tuple((n,) for n in snames)
+offsets = []
+for i in range(len(firsts)):
+    for j in range(len(seconds)):
+        if i == 0 or j == 0:
+            offsets.append(0)
+        else:
+            offsets.append(((31+j)*i + 17*j) % 199 - 99)
+font.addKerningClass("kern", "kern-1", firsts, seconds, tuple(offsets))
+otf, fmts = round_trip(font, "split", snames)
+assert fmts == [2, 2]
+copy = fontforge.open(otf)
+subs = copy.getLookupSubtables(copy.gpos_lookups[0])
+assert len(subs) == 2 and all(copy.isKerningClass(sub) for sub in subs)
+rows = 0
+for sub in subs:
+    f, s, o = copy.getKerningClass(sub)
+    assert len(s) == len(seconds)
+    rows += len(f)
+assert rows == len(fnames)
+copy.close()
+font.close()
@@ -0,0 +1,77 @@
+# Identical lookup subtables, and coverage tables, are written once
+
+import os, struct, tempfile, fontforge
+
+def makefont(share):
+    font = fontforge.font()
+    for u in list(range(ord("A"), ord("Z")+1)) + list(range(ord("a"), ord("z")+1)):
+        font.createChar(u).width = 500
+    scripts = (("latn", ("dflt",)),)
+    for feature in ("smcp", "c2sc"):
+        font.addLookup(feature, "gsub_single", (), ((feature, scripts),))
+        font.addLookupSubtable(feature, feature + "-1")
+    for u in range(ord("a"), ord("z")+1):
+        font[u].addPosSub("smcp-1", fontforge.nameFromUnicode(u-32))
+        # Unless shared, the second lookup maps each letter to itself
+        font[u].addPosSub("c2sc-1", fontforge.nameFromUnicode(u-32 if share else u))
+    return font
+
+def substitutions(font):
+    return sorted((g.glyphname, p[2]) for g in font.glyphs() for p in g.getPosSub("*"))
+
+tmpdir = tempfile.mkdtemp()
+sizes = {}
+for share in (False, True):
+    font = makefont(share)
+    otf = os.path.join(tmpdir, "share.otf" if share else "noshare.otf")
+    font.generate(otf)
+    sizes[share] = fontforge.layoutTableStats()["GSUB"]
+    copy = fontforge.open(otf)
+    assert substitutions(copy) == substitutions(font)
+    copy.close()
+    font.close()
+
+# Both share the coverage table, only one the whole subtable
+assert 0 < sizes[False][1] < sizes[True][1]
+assert sizes[True][0] < sizes[False][0]
+
+# Coverage tables are shared by subtables which differ otherwise
+def gpos_coverages(otf):
+    """The position in the 'GPOS' table of the coverage table of each
+       subtable, in lookup order"""
+    with open(otf, "rb") as f:
+        data = f.read()
+    for i in range(struct.unpack(">H", data[4:6])[0]):
+        tag, _, off, length = struct.unpack(">4sLLL", data[12+16*i:28+16*i])
+        if tag == b"GPOS":
+            gpos = data[off:off+length]
+    u16 = lambda off: struct.unpack(">H", gpos[off:off+2])[0]
+    result = []
+    lookups = u16(8)
+    for i in range(u16(lookups)):
+        lookup = lookups + u16(lookups+2+2*i)
+        for j in range(u16(lookup+4)):
+            sub = lookup + u16(lookup+6+2*j)
+            result.append(sub + u16(sub+2))
+    return result
+
+scripts = (("latn", ("dflt",)),)
+font = fontforge.font()
+names = [fontforge.nameFromUnicode(u) for u in range(ord("A"), ord("Z")+1)]
+for name in names:
+    font.createChar(fontforge.unicodeFromName(name), name).width = 500
+for feature, dx in (("cpsp", 10), ("case", 0)):
+    font.addLookup(feature, "gpos_single", (), ((feature, scripts),))
+    font.addLookupSubtable(feature, feature + "-1")
+    for name in names:
+        font[name].addPosSub(feature + "-1", dx, 30, 2*dx, 0)
+otf = os.path.join(tmpdir, "coverage.otf")
+font.generate(otf)
+gposlen, gpossaved = fontforge.layoutTableStats()["GPOS"]
+coverages = gpos_coverages(otf)
+assert len(coverages) == 2 and coverages[0] == coverages[1]
+assert gpossaved > 0
+copy = fontforge.open(otf)
+assert substitutions(copy) == substitutions(font)
+copy.close()
+font.close()
@@ -0,0 +1,55 @@
+# Generating several multiple master instances at once
+
+import os, re, sys, tempfile, fontforge
+
+tmpdir = tempfile.mkdtemp()
+
+# Give each master (and the weighted font) a kerning pair from A to V
+mm = fontforge.open(sys.argv[1])
+mmsfd = os.path.join(tmpdir, "mm.sfd")
+mm.save(mmsfd)
+mm.close()
+with open(mmsfd) as f:
+    fonts = f.read().split("BeginChars:")
+kerned = fonts[0]
+# The masters are written before the weighted font
+for font, off in zip(fonts[1:], (-40, -120, -80)):
+    gid = re.search(r"StartChar: V\nEncoding: \d+ \d+ (\d+)", font).group(1)
+    font = re.sub(r"(StartChar: A\n(?:.*\n)*?Width: \d+\n)",
+                  r'\1Kerns2: %s %d "kern1-1"\n' % (gid, off), font, count=1)
+    kerned += "BeginChars:" + font
+lookup = 'Lookup: 258 0 0 "kern1" { "kern1-1"  } [\'kern\' (\'latn\' <\'dflt\' > ) ]\n'
+kerned = kerned.replace("BeginChars:", lookup + "BeginChars:")
+with open(mmsfd, "w") as f:
+    f.write(kerned)
+
+mm = fontforge.open(mmsfd)
+names = [os.path.join(tmpdir, "w%d.sfd" % w) for w in (100, 550, 1000)]
+mm.generateInstances(((100,), (550,), (1000,)), names)
+
+light, regular, bold = [fontforge.open(n) for n in names]
+assert len(light) == len(regular) == len(bold)
+assert light.fontname != bold.fontname
+outlined = 0
+for g in light.glyphs():
+    if g.glyphname not in bold or g.foreground.isEmpty():
+        continue
+    outlined += 1
+    # The middle instance lies half way between the extremes
+    w = (light[g.glyphname].width + bold[g.glyphname].width) / 2
+    assert abs(regular[g.glyphname].width - w) <= 1
+assert outlined > 0
+assert any(light[g].width != bold[g].width for g in light)
+
+# Each instance has its own copy of the kerning lookup
+for font, off in ((light, -40), (regular, -80), (bold, -120)):
+    assert font.gpos_lookups == ("kern1",)
+    assert font.getLookupSubtables("kern1") == ("kern1-1",)
+    kerns = [p for p in font["A"].getPosSub("kern1-1") if p[2] == "V"]
+    assert len(kerns) == 1 and abs(kerns[0][5] - off) <= 1
+
+try:
+    mm.generateInstances(((100,), (550,), (1000,)), names[:1])
+    assert False
+except ValueError:
+    pass
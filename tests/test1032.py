@@ -0,0 +1,118 @@
+# Round trip an apple distortable font through its 'gvar' table
+
+import math, os, re, struct, sys, tempfile, fontforge
+
+tmpdir = tempfile.mkdtemp()
+with open(sys.argv[1]) as f:
+    fixture = f.read()
+
+def masters(sfd):
+    """Per master font (in file order) a dict of glyph name to its advance,
+       the coordinates of its points and the offsets of its references"""
+    result = []
+    for font in sfd.split("BeginChars:")[1:]:
+        glyphs = {}
+        for name, body in re.findall(r"StartChar: (\S+)\n(.*?)EndChar", font, re.S):
+            width = int(re.search(r"^Width: (-?\d+)", body, re.M).group(1))
+            points = [(float(x), float(y)) for x, y in
+                      re.findall(r"^ ?(-?[\d.]+) (-?[\d.]+) [ml] ", body, re.M)]
+            refs = [(float(e), float(f)) for e, f in
+                    re.findall(r"^Refer: \d+ -?\d+ \S+ \S+ \S+ \S+ \S+ (\S+) (\S+)", body, re.M)]
+            glyphs[name] = (width, points, refs)
+        result.append(glyphs)
+    return result
+
+def gvar_glyph(ttf, gid):
+    """The offset format of the 'gvar' table, and a glyph's tuple count,
+       its tuple headers and its serialized data"""
+    with open(ttf, "rb") as f:
+        data = f.read()
+    for i in range(struct.unpack(">H", data[4:6])[0]):
+        tag, _, off, length = struct.unpack(">4sLLL", data[12+16*i:28+16*i])
+        if tag == b"gvar":
+            gvar = data[off:off+length]
+    gcnt, flags, dataoff = struct.unpack(">HHL", gvar[12:20])
+    if flags & 1:
+        offsets = struct.unpack(">%dL" % (gcnt+1), gvar[20:20+4*(gcnt+1)])
+    else:
+        offsets = [2*o for o in struct.unpack(">%dH" % (gcnt+1), gvar[20:20+2*(gcnt+1)])]
+    glyph = gvar[dataoff+offsets[gid]:dataoff+offsets[gid+1]]
+    count, serialized = struct.unpack(">HH", glyph[:4])
+    tuples = [struct.unpack(">HH", glyph[4+4*i:8+4*i]) for i in range(count & 0xfff)]
+    return flags & 1, count, tuples, glyph[serialized:]
+
+def round_trip(sfd, tolerance, name):
+    """Generates a variable font from the sfd text and compares the masters
+       read back from it with the originals"""
+    src = os.path.join(tmpdir, name + ".sfd")
+    ttf = os.path.join(tmpdir, name + ".ttf")
+    back = os.path.join(tmpdir, name + "-back.sfd")
+    with open(src, "w") as f:
+        f.write(sfd)
+    fontforge.setPrefs("GvarIUPTolerance", tolerance)
+    font = fontforge.open(src)
+    font.generate(ttf, flags=("apple",))
+    font.close()
+    font = fontforge.open(ttf)
+    gids = dict((g.glyphname, g.originalgid) for g in font.glyphs())
+    font.save(back)
+    font.close()
+    with open(back) as f:
+        read = masters(f.read())
+    orig = masters(sfd)
+    assert len(read) == len(orig) == 3
+    # IUP may leave an inferred point as far as the tolerance from where it was
+    slop = max(tolerance, 0) + 1e-3
+    for o, r in zip(orig, read):
+        for gname, (width, points, refs) in o.items():
+            assert r[gname][0] == width, (name, gname)
+            assert len(r[gname][1]) == len(points), (name, gname)
+            for (x1, y1), (x2, y2) in zip(points, r[gname][1]):
+                assert abs(x1-x2) <= slop and abs(y1-y2) <= slop, (name, gname, x1, y1, x2, y2)
+            assert r[gname][2] == refs, (name, gname)
+    return ttf, gids
+
+# Every point of every tuple, and both tuples share the point numbers
+ttf, gids = round_trip(fixture, -1.0, "all")
+longoffsets, count, tuples, serialized = gvar_glyph(ttf, gids["A"])
+assert not longoffsets
+assert count == 0x8002 and serialized[0] == 0
+assert all(t[1] & 0x2000 == 0 for t in tuples)
+
+# IUP leaves points out
+ttf, gids = round_trip(fixture, 0.5, "iup")
+# Both tuples move the same points of B, listed once
+longoffsets, count, tuples, serialized = gvar_glyph(ttf, gids["B"])
+assert not longoffsets
+assert count == 0x8002 and 0 < serialized[0] < 8+4
+# While each tuple of D lists its own
+longoffsets, count, tuples, serialized = gvar_glyph(ttf, gids["D"])
+assert count == 2 and all(t[1] & 0x2000 for t in tuples)
+# The composite lists the component offsets and advance which change
+longoffsets, count, tuples, serialized = gvar_glyph(ttf, gids["C"])
+assert count & 0xfff == 2
+
+# Enough data to need long offsets, 200 glyphs of 100 points whose deltas
+#  don't fit in a byte
+extra = 200
+bulk = ([], [], [])
+for i in range(extra):
+    for m, (dx, dy) in enumerate(((-150, 130), (220, -170), (0, 0))):
+        lines = ["\nStartChar: bulk%d\nEncoding: %d %d %d\nWidth: 600\nFlags: W\nLayerCount: 2\nFore\nSplineSet\n"
+                 % (i, 0xe000+i, 0xe000+i, 5+i)]
+        for k in range(100):
+            jitter = ((i*7 + k*13 + m*5) % 17) - 8 if m != 2 else 0
+            x = 300 + round(300*math.cos(k*0.0628)) + dx + jitter
+            y = 300 + round(300*math.sin(-k*0.0628)) + dy - jitter
+            if k == 0:
+                start = (x, y)
+            lines.append("%s%d %d %s 1,%d,-1\n" % (" " if k else "", x, y, "l" if k else "m", k))
+        lines.append(" %d %d l 1,0,-1\nEndSplineSet\nEndChar\n" % start)
+        bulk[m].append("".join(lines))
+fonts = fixture.split("EndChars\n")
+big = "".join(font + "".join(glyphs) + "EndChars\n" for font, glyphs in zip(fonts, bulk)) + fonts[-1]
+big = big.replace("BeginChars: 65537 5", "BeginChars: 65537 %d" % (5+extra))
+big = big.replace("BeginMMFonts: 3 5", "BeginMMFonts: 3 %d" % (5+extra))
+ttf, gids = round_trip(big, -1.0, "long")
+longoffsets, count, tuples, serialized = gvar_glyph(ttf, gids["bulk%d" % (extra-1)])
+assert longoffsets and count == 0x8002
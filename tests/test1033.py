@@ -0,0 +1,64 @@
+# Cached glyph bounds follow changes to a glyph and to the glyphs using it
+
+import os, struct, tempfile, fontforge, psMat
+
+tmpdir = tempfile.mkdtemp()
+
+def square(x, size):
+    c = fontforge.contour()
+    c.moveTo(x, 0)
+    c.lineTo(x, size)
+    c.lineTo(x + size, size)
+    c.lineTo(x + size, 0)
+    c.closed = True
+    layer = fontforge.layer()
+    layer += c
+    return layer
+
+def metrics(font, name):
+    """The font's xMin in 'head' and each glyph's left side bearing in
+       'hmtx', as generated"""
+    ttf = os.path.join(tmpdir, name + ".ttf")
+    font.generate(ttf)
+    copy = fontforge.open(ttf)
+    gids = dict((g.glyphname, g.originalgid) for g in copy.glyphs())
+    copy.close()
+    with open(ttf, "rb") as f:
+        data = f.read()
+    tables = {}
+    for i in range(struct.unpack(">H", data[4:6])[0]):
+        tag, _, off, length = struct.unpack(">4sLLL", data[12+16*i:28+16*i])
+        tables[tag] = data[off:off+length]
+    xmin = struct.unpack(">h", tables[b"head"][36:38])[0]
+    hcnt = struct.unpack(">H", tables[b"hhea"][34:36])[0]
+    lsbs = {}
+    for name, gid in gids.items():
+        if gid < hcnt:
+            lsbs[name] = struct.unpack(">h", tables[b"hmtx"][4*gid+2:4*gid+4])[0]
+        else:
+            off = 4*hcnt + 2*(gid-hcnt)
+            lsbs[name] = struct.unpack(">h", tables[b"hmtx"][off:off+2])[0]
+    return xmin, lsbs
+
+font = fontforge.font()
+for code, name in ((0x42, "B"), (0x43, "C"), (0x44, "D")):
+    font.createChar(code, name).width = 600
+font["B"].foreground = square(100, 200)
+font["C"].addReference("B", psMat.translate(50, 0))
+font["D"].foreground = square(200, 60)
+
+xmin, lsbs = metrics(font, "first")
+assert (xmin, lsbs["B"], lsbs["C"], lsbs["D"]) == (100, 100, 150, 200)
+
+# A changed glyph, and the glyph referring to it, are measured again.
+#  Without a UI nothing moves the reference's own bounds, so set it again
+font["B"].foreground = square(20, 200)
+font["C"].references = font["C"].references
+xmin, lsbs = metrics(font, "changed")
+assert (xmin, lsbs["B"], lsbs["C"], lsbs["D"]) == (20, 20, 70, 200)
+
+# So is a transformed one
+font["D"].transform(psMat.translate(-190, 0))
+xmin, lsbs = metrics(font, "moved")
+assert (xmin, lsbs["B"], lsbs["C"], lsbs["D"]) == (10, 20, 70, 10)
+font.close()